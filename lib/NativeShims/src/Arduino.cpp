@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "Arduino.h"
+
+EspClass ESP;
+HardwareSerial Serial;
+
+static std::atomic<uint64_t> simulatedMicros{0};
+static time_t fixedTime = 0;
+static bool psramAvailable = true;
+static size_t psramRequested = 0;
+static std::mutex interruptsMutex;
+static std::map<uint8_t, std::pair<void (*)(void *), void *>> interrupts;
+
+unsigned long millis() {
+  return simulatedMicros.load() / 1000;
+}
+
+unsigned long micros() {
+  return simulatedMicros.load();
+}
+
+void delay(uint32_t ms) {
+  simulatedMicros.fetch_add(ms * 1000ull);
+}
+
+void delayMicroseconds(uint32_t us) {
+  simulatedMicros.fetch_add(us);
+}
+
+void yield() {
+  std::this_thread::yield();
+}
+
+void nativeAdvanceMillis(uint32_t ms) {
+  delay(ms);
+}
+
+bool getLocalTime(struct tm *info, uint32_t ms) {
+  time_t now = fixedTime != 0 ? fixedTime : time(nullptr);
+  localtime_r(&now, info);
+  return true;
+}
+
+void configTime(long gmtOffsetSeconds, int daylightOffsetSeconds, const char *server1,
+                const char *server2, const char *server3) {
+  // what the core does: a POSIX TZ without DST rules for the fixed offsets
+  char tz[32];
+  long offset = -(gmtOffsetSeconds + daylightOffsetSeconds);
+  snprintf(tz, sizeof(tz), "UTC%+ld:%02ld", offset / 3600, labs(offset) % 3600 / 60);
+  setenv("TZ", tz, 1);
+  tzset();
+}
+
+void configTzTime(const char *tz, const char *server1, const char *server2, const char *server3) {
+  setenv("TZ", tz, 1);
+  tzset();
+}
+
+void nativeSetTime(time_t epoch) {
+  fixedTime = epoch;
+}
+
+bool psramFound() {
+  return psramAvailable;
+}
+
+void *ps_malloc(size_t size) {
+  psramRequested += size;
+  return malloc(size);
+}
+
+void *ps_calloc(size_t count, size_t size) {
+  psramRequested += count * size;
+  return calloc(count, size);
+}
+
+void *ps_realloc(void *pointer, size_t size) {
+  psramRequested += size;
+  return realloc(pointer, size);
+}
+
+size_t nativePsramRequested() {
+  return psramRequested;
+}
+
+void nativeSetPsramFound(bool found) {
+  psramAvailable = found;
+}
+
+uint32_t EspClass::getCycleCount() {
+  auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch());
+  return (uint32_t)(nanos.count() * 240 / 1000);
+}
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void *), void *argument, int mode) {
+  std::lock_guard<std::mutex> lock(interruptsMutex);
+  interrupts[pin] = {handler, argument};
+}
+
+void detachInterrupt(uint8_t pin) {
+  std::lock_guard<std::mutex> lock(interruptsMutex);
+  interrupts.erase(pin);
+}
+
+void nativeTriggerInterrupt(uint8_t pin) {
+  std::pair<void (*)(void *), void *> interrupt;
+  {
+    std::lock_guard<std::mutex> lock(interruptsMutex);
+    auto it = interrupts.find(pin);
+    if (it == interrupts.end()) {
+      return;
+    }
+    interrupt = it->second;
+  }
+  interrupt.first(interrupt.second);
+}
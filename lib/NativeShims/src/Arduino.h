@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+/**
+ * Host stand-in for the parts of the Arduino ESP32 core the sources in src/ use, for the native
+ * test environment. The functions prefixed with "native" are test hooks that don't exist on the
+ * device.
+ *
+ * millis() and micros() run on a simulated clock that only moves on through delay() and
+ * nativeAdvanceMillis(), so timeouts and backoffs can be tested without waiting for them. The
+ * time of day is the host's unless a test fixes it with nativeSetTime().
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#include "FreeRTOS.h"
+#include "IPAddress.h"
+#include "WString.h"
+
+using std::max;
+using std::min;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define DEC 10
+#define HEX 16
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define LOW 0x0
+#define HIGH 0x1
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define IRAM_ATTR
+#define PROGMEM
+
+#define constrain(amount, low, high)                                                               \
+  ((amount) < (low) ? (low) : ((amount) > (high) ? (high) : (amount)))
+
+// esp32-hal-log.h: 1 error, 2 warning, 3 info, 4 debug, 5 verbose
+#ifndef CORE_DEBUG_LEVEL
+#define CORE_DEBUG_LEVEL 2
+#endif
+#define NATIVE_LOG(level, letter, format, ...)                                                     \
+  do {                                                                                             \
+    if (CORE_DEBUG_LEVEL >= level) fprintf(stderr, "[" letter "] " format "\n", ##__VA_ARGS__);    \
+  } while (0)
+#define log_e(format, ...) NATIVE_LOG(1, "E", format, ##__VA_ARGS__)
+#define log_w(format, ...) NATIVE_LOG(2, "W", format, ##__VA_ARGS__)
+#define log_i(format, ...) NATIVE_LOG(3, "I", format, ##__VA_ARGS__)
+#define log_d(format, ...) NATIVE_LOG(4, "D", format, ##__VA_ARGS__)
+#define log_v(format, ...) NATIVE_LOG(5, "V", format, ##__VA_ARGS__)
+
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+inline size_t strlcpy(char *destination, const char *source, size_t size) {
+  size_t length = strlen(source);
+  if (size > 0) {
+    size_t copied = min(length, size - 1);
+    memcpy(destination, source, copied);
+    destination[copied] = '\0';
+  }
+  return length;
+}
+#endif
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+void nativeAdvanceMillis(uint32_t ms);
+
+// time.h is the host's. getLocalTime() reports the time fixed with nativeSetTime(), if any.
+bool getLocalTime(struct tm *info, uint32_t ms = 5000);
+void configTime(long gmtOffsetSeconds, int daylightOffsetSeconds, const char *server1,
+                const char *server2 = nullptr, const char *server3 = nullptr);
+void configTzTime(const char *tz, const char *server1, const char *server2 = nullptr,
+                  const char *server3 = nullptr);
+void nativeSetTime(time_t epoch);
+
+// PSRAM is plain heap, nativeSetPsramFound(false) makes the code take its fallbacks.
+bool psramFound();
+void *ps_malloc(size_t size);
+void *ps_calloc(size_t count, size_t size);
+void *ps_realloc(void *pointer, size_t size);
+void nativeSetPsramFound(bool found);
+// Native: bytes asked for through the ps_* functions so far.
+size_t nativePsramRequested();
+
+inline void pinMode(uint8_t pin, uint8_t mode) {}
+inline int digitalRead(uint8_t pin) { return HIGH; }
+inline void digitalWrite(uint8_t pin, uint8_t value) {}
+inline int digitalPinToInterrupt(uint8_t pin) { return pin; }
+void attachInterruptArg(uint8_t pin, void (*handler)(void *), void *argument, int mode);
+void detachInterrupt(uint8_t pin);
+// Native: runs the handler attached to the pin, on the calling thread as if it was the ISR.
+void nativeTriggerInterrupt(uint8_t pin);
+inline double ledcSetup(uint8_t channel, double frequency, uint8_t resolutionBits) {
+  return frequency;
+}
+inline void ledcAttachPin(uint8_t pin, uint8_t channel) {}
+inline void ledcWrite(uint8_t channel, uint32_t duty) {}
+
+// Fixed numbers for the memory stats, the cycle count is derived from the host's clock at 240 MHz.
+class EspClass {
+public:
+  uint32_t getHeapSize() { return 327680; }
+  uint32_t getFreeHeap() { return 262144; }
+  uint32_t getMinFreeHeap() { return 245760; }
+  uint32_t getMaxAllocHeap() { return 114676; }
+  uint32_t getPsramSize() { return 4194304; }
+  uint32_t getFreePsram() { return 4063232; }
+  uint32_t getMaxAllocPsram() { return 4063232; }
+  uint32_t getCycleCount();
+};
+
+extern EspClass ESP;
+
+class HardwareSerial {
+public:
+  void begin(unsigned long baud) {}
+  size_t print(const char *text) { return printf("%s", text); }
+  size_t print(const String &text) { return print(text.c_str()); }
+  size_t print(long value, int base = DEC) { return print(String(value, base)); }
+  size_t println(const char *text = "") { return printf("%s\n", text); }
+  size_t println(const String &text) { return println(text.c_str()); }
+  size_t println(long value, int base = DEC) { return println(String(value, base)); }
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+    va_list arguments;
+    va_start(arguments, format);
+    int length = vfprintf(stdout, format, arguments);
+    va_end(arguments);
+    return length < 0 ? 0 : length;
+  }
+};
+
+extern HardwareSerial Serial;
@@ -0,0 +1,201 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "FS.h"
+
+namespace fs {
+
+class FileImpl {
+public:
+  FS *fs;
+  std::string path;
+  std::string name;
+  FILE *stream = nullptr;
+  DIR *directory = nullptr;
+
+  ~FileImpl() { close(); }
+
+  void close() {
+    if (stream != nullptr) {
+      fclose(stream);
+      stream = nullptr;
+    }
+    if (directory != nullptr) {
+      closedir(directory);
+      directory = nullptr;
+    }
+  }
+};
+
+static std::string baseName(const std::string &path) {
+  size_t slash = path.find_last_of('/');
+  return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+File::operator bool() const {
+  return _impl != nullptr && (_impl->stream != nullptr || _impl->directory != nullptr);
+}
+
+size_t File::write(const uint8_t *buffer, size_t size) {
+  if (!*this || _impl->stream == nullptr) {
+    return 0;
+  }
+  long &budget = _impl->fs->_writeBudget;
+  if (budget >= 0 && (long)size > budget) {
+    // a short write, like LittleFS running out of blocks part way
+    size = budget;
+  }
+  size_t written = fwrite(buffer, 1, size, _impl->stream);
+  if (budget >= 0) {
+    budget -= written;
+  }
+  return written;
+}
+
+int File::available() {
+  if (!*this || _impl->stream == nullptr) {
+    return 0;
+  }
+  return size() - position();
+}
+
+int File::read() {
+  uint8_t value;
+  return read(&value, 1) == 1 ? value : -1;
+}
+
+size_t File::read(uint8_t *buffer, size_t size) {
+  if (!*this || _impl->stream == nullptr) {
+    return 0;
+  }
+  return fread(buffer, 1, size, _impl->stream);
+}
+
+void File::flush() {
+  if (*this && _impl->stream != nullptr) {
+    fflush(_impl->stream);
+  }
+}
+
+bool File::seek(uint32_t position, SeekMode mode) {
+  if (!*this || _impl->stream == nullptr) {
+    return false;
+  }
+  int whence = mode == SeekSet ? SEEK_SET : mode == SeekCur ? SEEK_CUR : SEEK_END;
+  return fseek(_impl->stream, position, whence) == 0;
+}
+
+size_t File::position() const {
+  if (!*this || _impl->stream == nullptr) {
+    return 0;
+  }
+  return ftell(_impl->stream);
+}
+
+size_t File::size() const {
+  if (!*this || _impl->stream == nullptr) {
+    return 0;
+  }
+  long current = ftell(_impl->stream);
+  fseek(_impl->stream, 0, SEEK_END);
+  long end = ftell(_impl->stream);
+  fseek(_impl->stream, current, SEEK_SET);
+  return end;
+}
+
+void File::close() {
+  if (_impl != nullptr) {
+    _impl->close();
+  }
+}
+
+const char *File::path() const {
+  return _impl != nullptr ? _impl->path.c_str() : nullptr;
+}
+
+const char *File::name() const {
+  return _impl != nullptr ? _impl->name.c_str() : nullptr;
+}
+
+bool File::isDirectory() const {
+  return _impl != nullptr && _impl->directory != nullptr;
+}
+
+File File::openNextFile(const char *mode) {
+  if (!isDirectory()) {
+    return File();
+  }
+  while (struct dirent *entry = readdir(_impl->directory)) {
+    if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+      continue;
+    }
+    std::string path = _impl->path == "/" ? "/" : _impl->path + "/";
+    return _impl->fs->open((path + entry->d_name).c_str(), mode);
+  }
+  return File();
+}
+
+bool FS::nativeMountTemporary() {
+  char directory[] = "/tmp/littlefs-XXXXXX";
+  if (mkdtemp(directory) == nullptr) {
+    return false;
+  }
+  _root = directory;
+  _writeBudget = -1;
+  return true;
+}
+
+std::string FS::hostPath(const char *path) {
+  std::string root = _root.empty() ? "." : _root;
+  return path[0] == '/' ? root + path : root + "/" + path;
+}
+
+File FS::open(const char *path, const char *mode, bool create) {
+  _pathLookups++;
+  std::string host = hostPath(path);
+  auto impl = std::make_shared<FileImpl>();
+  impl->fs = this;
+  impl->path = path;
+  impl->name = baseName(path);
+
+  struct stat info;
+  if (stat(host.c_str(), &info) == 0 && S_ISDIR(info.st_mode)) {
+    impl->directory = opendir(host.c_str());
+    return File(impl);
+  }
+  // LittleFS opens binary, "w" truncates and "a" appends just like stdio
+  std::string binaryMode = std::string(mode) + "b";
+  impl->stream = fopen(host.c_str(), binaryMode.c_str());
+  if (impl->stream == nullptr) {
+    return File();
+  }
+  return File(impl);
+}
+
+bool FS::exists(const char *path) {
+  _pathLookups++;
+  struct stat info;
+  return stat(hostPath(path).c_str(), &info) == 0;
+}
+
+bool FS::remove(const char *path) {
+  return unlink(hostPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const char *from, const char *to) {
+  return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+}
+
+bool FS::mkdir(const char *path) {
+  return ::mkdir(hostPath(path).c_str(), 0755) == 0;
+}
+
+bool FS::rmdir(const char *path) {
+  return ::rmdir(hostPath(path).c_str()) == 0;
+}
+
+} // namespace fs
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "Arduino.h"
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class FileImpl;
+
+/**
+ * Host stand-in for the ESP32 fs::File, a file or directory below the host directory the file
+ * system is mounted on.
+ */
+class File {
+public:
+  File(std::shared_ptr<FileImpl> impl = nullptr) : _impl(impl) {}
+
+  operator bool() const;
+  size_t write(uint8_t value) { return write(&value, 1); }
+  size_t write(const uint8_t *buffer, size_t size);
+  int available();
+  int read();
+  size_t read(uint8_t *buffer, size_t size);
+  void flush();
+  bool seek(uint32_t position, SeekMode mode = SeekSet);
+  size_t position() const;
+  size_t size() const;
+  void close();
+  const char *path() const;
+  const char *name() const;
+  bool isDirectory() const;
+  File openNextFile(const char *mode = "r");
+
+private:
+  std::shared_ptr<FileImpl> _impl;
+};
+
+class FS {
+public:
+  File open(const char *path, const char *mode = "r", bool create = false);
+  File open(const String &path, const char *mode = "r", bool create = false) {
+    return open(path.c_str(), mode, create);
+  }
+  bool exists(const char *path);
+  bool exists(const String &path) { return exists(path.c_str()); }
+  bool remove(const char *path);
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool rename(const char *from, const char *to);
+  bool rename(const String &from, const String &to) { return rename(from.c_str(), to.c_str()); }
+  bool mkdir(const char *path);
+  bool rmdir(const char *path);
+
+  // Native: the host directory the paths are resolved against.
+  void nativeMount(const std::string &directory) { _root = directory; }
+  const std::string &nativeRoot() { return _root; }
+  // Native: mounts a new empty directory below /tmp, for tests that write files.
+  bool nativeMountTemporary();
+  // Native: writes fail once this many more bytes were written, as on a full flash. -1 for never.
+  void nativeFailWritesAfter(long bytes) { _writeBudget = bytes; }
+  // Native: open() and exists() calls so far, each walks the directory metadata on LittleFS.
+  uint32_t nativePathLookups() { return _pathLookups; }
+
+protected:
+  std::string _root;
+  long _writeBudget = -1;
+  uint32_t _pathLookups = 0;
+
+  std::string hostPath(const char *path);
+  friend class File;
+  friend class FileImpl;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::SeekCur;
+using fs::SeekEnd;
+using fs::SeekMode;
+using fs::SeekSet;
@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "FreeRTOS.h"
+
+struct NativeTask {
+  std::mutex mutex;
+  std::condition_variable notified;
+  uint32_t notifications = 0;
+};
+
+// Like in FreeRTOS, semaphores are queues of items without data.
+struct NativeQueue {
+  std::mutex mutex;
+  std::condition_variable changed;
+  std::vector<uint8_t> items;
+  size_t itemSize;
+  size_t length;
+  size_t head = 0;
+  size_t count = 0;
+};
+
+static thread_local NativeTask *currentTask = nullptr;
+
+// Waits until ready() holds or the ticks passed, returns false on a timeout.
+template <typename Predicate>
+static bool waitFor(std::condition_variable &condition, std::unique_lock<std::mutex> &lock,
+                    TickType_t ticks, Predicate ready) {
+  if (ticks == portMAX_DELAY) {
+    condition.wait(lock, ready);
+    return true;
+  }
+  return condition.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stackDepth,
+                                   void *parameter, UBaseType_t priority, TaskHandle_t *handle,
+                                   BaseType_t core) {
+  // tasks run until the process ends, like on the device
+  NativeTask *task = new NativeTask();
+  if (handle != nullptr) {
+    *handle = task;
+  }
+  std::thread([task, function, parameter]() {
+    currentTask = task;
+    function(parameter);
+  }).detach();
+  return pdPASS;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  if (currentTask == nullptr) {
+    // the main thread, the first time it asks
+    currentTask = new NativeTask();
+  }
+  return currentTask;
+}
+
+void vTaskDelay(TickType_t ticks) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+TickType_t xTaskGetTickCount() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                               start)
+      .count();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait) {
+  NativeTask *task = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> lock(task->mutex);
+  if (!waitFor(task->notified, lock, ticksToWait, [task]() { return task->notifications > 0; })) {
+    return 0;
+  }
+  uint32_t notifications = task->notifications;
+  task->notifications = clearCountOnExit ? 0 : notifications - 1;
+  return notifications;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  {
+    std::lock_guard<std::mutex> lock(task->mutex);
+    task->notifications++;
+  }
+  task->notified.notify_all();
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken) {
+  xTaskNotifyGive(task);
+  if (higherPriorityTaskWoken != nullptr) {
+    *higherPriorityTaskWoken = pdFALSE;
+  }
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  NativeQueue *queue = new NativeQueue();
+  queue->itemSize = itemSize;
+  queue->length = length;
+  queue->items.resize(length * itemSize);
+  return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+  delete queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticksToWait) {
+  {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!waitFor(queue->changed, lock, ticksToWait,
+                 [queue]() { return queue->count < queue->length; })) {
+      return pdFAIL;
+    }
+    size_t tail = (queue->head + queue->count) % queue->length;
+    if (queue->itemSize > 0) {
+      memcpy(&queue->items[tail * queue->itemSize], item, queue->itemSize);
+    }
+    queue->count++;
+  }
+  queue->changed.notify_all();
+  return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticksToWait) {
+  {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!waitFor(queue->changed, lock, ticksToWait, [queue]() { return queue->count > 0; })) {
+      return pdFAIL;
+    }
+    if (queue->itemSize > 0) {
+      memcpy(item, &queue->items[queue->head * queue->itemSize], queue->itemSize);
+    }
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+  }
+  queue->changed.notify_all();
+  return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  return queue->count;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  SemaphoreHandle_t semaphore = xQueueCreate(1, 0);
+  xSemaphoreGive(semaphore);
+  return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+  return xQueueCreate(1, 0);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+  vQueueDelete(semaphore);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait) {
+  return xQueueReceive(semaphore, nullptr, ticksToWait);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+  return xQueueSend(semaphore, nullptr, 0);
+}
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "HTTPClient.h"
+
+static std::deque<NativeHttpResponse> responses;
+static std::vector<NativeHttpRequest> requests;
+
+bool HTTPClient::begin(const String &url) {
+  _request = {};
+  _request.url = url.c_str();
+  return true;
+}
+
+void HTTPClient::addHeader(const String &name, const String &value) {
+  _request.headers[name.c_str()] = value.c_str();
+}
+
+void HTTPClient::collectHeaders(const char *keys[], size_t count) {
+  _collect.assign(keys, keys + count);
+}
+
+int HTTPClient::GET() {
+  requests.push_back(_request);
+  if (responses.empty()) {
+    _response = {HTTPC_ERROR_CONNECTION_REFUSED, "", {}};
+  } else {
+    _response = responses.front();
+    responses.pop_front();
+  }
+  _stream = WiFiClient(_response.body.substr(0, _response.sentBytes));
+  return _response.code;
+}
+
+int HTTPClient::getSize() {
+  return _response.code > 0 && _response.contentLength ? (int)_response.body.size() : -1;
+}
+
+String HTTPClient::getString() {
+  return String(_response.body);
+}
+
+// Only the collected headers are available, like on the device.
+String HTTPClient::header(const char *name) {
+  for (const std::string &key : _collect) {
+    if (key == name) {
+      auto value = _response.headers.find(key);
+      return value == _response.headers.end() ? String() : String(value->second);
+    }
+  }
+  return String();
+}
+
+String HTTPClient::errorToString(int error) {
+  switch (error) {
+    case HTTPC_ERROR_CONNECTION_REFUSED: return String("connection refused");
+    case HTTPC_ERROR_READ_TIMEOUT: return String("read Timeout");
+    default: return String();
+  }
+}
+
+void HTTPClient::nativeRespond(const NativeHttpResponse &response) {
+  responses.push_back(response);
+}
+
+std::vector<NativeHttpRequest> &HTTPClient::nativeRequests() {
+  return requests;
+}
+
+void HTTPClient::nativeReset() {
+  responses.clear();
+  requests.clear();
+}
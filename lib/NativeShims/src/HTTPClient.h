@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "WiFi.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+typedef enum {
+  HTTP_CODE_OK = 200,
+  HTTP_CODE_NOT_MODIFIED = 304,
+  HTTP_CODE_NOT_FOUND = 404,
+  HTTP_CODE_TOO_MANY_REQUESTS = 429,
+  HTTP_CODE_INTERNAL_SERVER_ERROR = 500
+} t_http_codes;
+
+// A scripted response; code is a status code or one of the negative HTTPC_ERROR_* values.
+typedef struct NativeHttpResponse {
+  int code;
+  std::string body;
+  std::map<std::string, std::string> headers;
+  // whether the Content-Length header is sent
+  bool contentLength = true;
+  // how much of the body arrives before the connection drops, all of it by default
+  size_t sentBytes = std::string::npos;
+} NativeHttpResponse;
+
+typedef struct NativeHttpRequest {
+  std::string url;
+  std::map<std::string, std::string> headers;
+} NativeHttpRequest;
+
+/**
+ * Host stand-in for the ESP32 HTTPClient. GET() answers with the next response queued through
+ * nativeRespond(), or a refused connection if there is none, and logs the request.
+ */
+class HTTPClient {
+public:
+  bool begin(const String &url);
+  void end() {}
+  void addHeader(const String &name, const String &value);
+  void collectHeaders(const char *keys[], size_t count);
+  int GET();
+  int getSize();
+  WiFiClient *getStreamPtr() { return &_stream; }
+  String getString();
+  String header(const char *name);
+  static String errorToString(int error);
+
+  static void nativeRespond(const NativeHttpResponse &response);
+  static std::vector<NativeHttpRequest> &nativeRequests();
+  // Native: drops the queued responses and the logged requests.
+  static void nativeReset();
+
+private:
+  NativeHttpRequest _request;
+  std::vector<std::string> _collect;
+  NativeHttpResponse _response;
+  WiFiClient _stream;
+};
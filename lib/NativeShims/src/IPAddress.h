@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+#include "WString.h"
+
+// Host stand-in for the Arduino IPAddress, stored like the ESP32 core does: the first octet in the
+// lowest byte of the uint32.
+class IPAddress {
+public:
+  IPAddress(uint32_t address = 0) : _address(address) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+      : _address(a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+
+  operator uint32_t() const { return _address; }
+  uint8_t operator[](int index) const { return _address >> (8 * index); }
+  bool operator==(const IPAddress &other) const { return _address == other._address; }
+
+  bool fromString(const char *address) {
+    unsigned int a, b, c, d;
+    if (sscanf(address, "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 || b > 255 || c > 255 ||
+        d > 255) {
+      return false;
+    }
+    *this = IPAddress(a, b, c, d);
+    return true;
+  }
+
+  String toString() const {
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return String(text);
+  }
+
+private:
+  uint32_t _address;
+};
+
+#define INADDR_NONE IPAddress((uint32_t)0)
@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <sys/stat.h>
+
+#include "LittleFS.h"
+
+fs::LittleFSFS LittleFS;
+
+namespace fs {
+
+bool LittleFSFS::begin(bool formatOnFail, const char *basePath, uint8_t maxOpenFiles,
+                       const char *partitionLabel) {
+  if (_root.empty()) {
+    _root = NATIVE_FS_ROOT;
+  }
+  struct stat info;
+  if (stat(_root.c_str(), &info) == 0 && S_ISDIR(info.st_mode)) {
+    return true;
+  }
+  return formatOnFail && format();
+}
+
+bool LittleFSFS::format() {
+  if (_root.empty()) {
+    _root = NATIVE_FS_ROOT;
+  }
+  return ::mkdir(_root.c_str(), 0755) == 0;
+}
+
+} // namespace fs
@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "FS.h"
+
+// The directory LittleFS is mounted on, scripts/native_assets.py converts data/ into it.
+#ifndef NATIVE_FS_ROOT
+#define NATIVE_FS_ROOT "data"
+#endif
+
+namespace fs {
+
+class LittleFSFS : public FS {
+public:
+  bool begin(bool formatOnFail = false, const char *basePath = "/littlefs",
+             uint8_t maxOpenFiles = 10, const char *partitionLabel = "spiffs");
+  void end() {}
+  bool format();
+  size_t totalBytes() { return 0x160000; }
+  size_t usedBytes() { return 0; }
+};
+
+} // namespace fs
+
+extern fs::LittleFSFS LittleFS;
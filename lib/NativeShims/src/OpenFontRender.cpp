@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "OpenFontRender.h"
+
+// coverage of the left column of each glyph, the rest is solid
+#define NATIVE_GLYPH_EDGE_ALPHA 96
+
+static uint32_t nextCodepoint(const char *&text) {
+  uint8_t lead = *text++;
+  uint8_t extra = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+  uint32_t codepoint = extra == 0 ? lead : lead & (0x3F >> extra);
+  for (uint8_t i = 0; i < extra && (*text & 0xC0) == 0x80; i++) {
+    codepoint = (codepoint << 6) | (*text++ & 0x3F);
+  }
+  return codepoint;
+}
+
+FT_Error OpenFontRender::loadFont(const unsigned char *data, size_t size) {
+  return data != nullptr && size > 0 ? FT_Err_Ok : 1;
+}
+
+int32_t OpenFontRender::nativeAdvance(uint32_t codepoint) {
+  if (codepoint == ' ') {
+    return _size * 20;
+  }
+  return _size * (33 + (codepoint % 5) * 4);
+}
+
+void OpenFontRender::measure(const char *text, int32_t &inkLeft, int32_t &inkRight) {
+  inkLeft = INT32_MAX;
+  inkRight = -1;
+  int32_t pen = 0;
+  while (*text != '\0') {
+    uint32_t codepoint = nextCodepoint(text);
+    int32_t advance = nativeAdvance(codepoint);
+    if (codepoint != ' ') {
+      int32_t left = ((pen + 32) >> 6) + 1;
+      int32_t width = max((int32_t)1, ((advance + 32) >> 6) - 2);
+      inkLeft = min(inkLeft, left);
+      inkRight = max(inkRight, left + width);
+    }
+    pen += advance;
+  }
+  if (inkRight < 0) {
+    inkLeft = -1;
+  }
+}
+
+uint16_t OpenFontRender::render(const char *text, int32_t x, int32_t y) {
+  int32_t pen = 0;
+  while (*text != '\0') {
+    uint32_t codepoint = nextCodepoint(text);
+    int32_t advance = nativeAdvance(codepoint);
+    if (codepoint != ' ' && _drawer != nullptr) {
+      int32_t left = x + ((pen + 32) >> 6) + 1;
+      int32_t width = max((int32_t)1, ((advance + 32) >> 6) - 2);
+      int32_t top = y + (codepoint % 3 == 0 ? _size / 4 : _size / 3);
+      uint16_t edge = _drawer->alphaBlend(NATIVE_GLYPH_EDGE_ALPHA, _fontColor, _backgroundColor);
+      _glyphsRendered++;
+      for (int32_t py = top; py < y + (int32_t)_size; py++) {
+        for (int32_t col = 0; col < width; col++) {
+          _drawer->drawPixel(left + col, py, col == 0 && width > 1 ? edge : _fontColor);
+        }
+      }
+    }
+    pen += advance;
+  }
+  return (pen + 32) >> 6;
+}
+
+uint16_t OpenFontRender::drawString(const char *text, int32_t x, int32_t y) {
+  return render(text, x, y);
+}
+
+uint16_t OpenFontRender::cdrawString(const char *text, int32_t x, int32_t y) {
+  int32_t inkLeft, inkRight;
+  measure(text, inkLeft, inkRight);
+  if (inkRight >= 0) {
+    x -= (inkRight - inkLeft) / 2 + inkLeft;
+  }
+  return render(text, x, y);
+}
+
+uint32_t OpenFontRender::getTextWidth(const char *format, ...) {
+  char text[512];
+  va_list arguments;
+  va_start(arguments, format);
+  vsnprintf(text, sizeof(text), format, arguments);
+  va_end(arguments);
+  int32_t inkLeft, inkRight;
+  measure(text, inkLeft, inkRight);
+  return inkRight < 0 ? 0 : inkRight - inkLeft;
+}
+
+uint32_t OpenFontRender::getTextHeight(const char *format, ...) {
+  return _size;
+}
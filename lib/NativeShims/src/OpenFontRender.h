@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "TFT_eSPI.h"
+
+typedef int FT_Error;
+#define FT_Err_Ok 0
+
+/**
+ * Host stand-in for OpenFontRender without FreeType. Glyphs are boxes derived from the codepoint
+ * with an anti-aliased left edge and fractional advances, laid out in 26.6 fixed point like
+ * FreeType does. That's enough to test layout, caching and blending deterministically; the
+ * shapes have nothing to do with the loaded font.
+ */
+class OpenFontRender {
+public:
+  FT_Error loadFont(const unsigned char *data, size_t size);
+  void unloadFont() {}
+  void setDrawer(TFT_eSPI &drawer) { _drawer = &drawer; }
+  void setFontSize(unsigned int size) { _size = size; }
+  void setFontColor(uint16_t color) { _fontColor = color; }
+  void setFontColor(uint16_t color, uint16_t background) {
+    _fontColor = color;
+    _backgroundColor = background;
+  }
+  void setBackgroundColor(uint16_t color) { _backgroundColor = color; }
+  // x, y is the pen position at the top of the text
+  uint16_t drawString(const char *text, int32_t x, int32_t y);
+  // centers the ink box of the string on x
+  uint16_t cdrawString(const char *text, int32_t x, int32_t y);
+  // width of the ink box in whole pixels
+  uint32_t getTextWidth(const char *format, ...) __attribute__((format(printf, 2, 3)));
+  uint32_t getTextHeight(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+  // Native: advance of a glyph in 26.6 fixed point at the current size.
+  int32_t nativeAdvance(uint32_t codepoint);
+  // Native: glyphs rendered so far, what FreeType would have rasterized.
+  uint32_t nativeGlyphsRendered() { return _glyphsRendered; }
+
+private:
+  TFT_eSPI *_drawer = nullptr;
+  unsigned int _size = 16;
+  uint16_t _fontColor = TFT_WHITE;
+  uint16_t _backgroundColor = TFT_BLACK;
+  uint32_t _glyphsRendered = 0;
+
+  // ink box left and right in pixels relative to the start of the string, -1 if there's no ink
+  void measure(const char *text, int32_t &inkLeft, int32_t &inkRight);
+  uint16_t render(const char *text, int32_t x, int32_t y);
+};
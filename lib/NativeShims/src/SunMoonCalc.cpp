@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "SunMoonCalc.h"
+
+#define NATIVE_NEW_MOON_EPOCH 947182440
+#define NATIVE_LUNAR_MONTH_DAYS 29.530588853
+
+static const char *const PHASE_NAMES[] = {"New Moon",       "Waxing Crescent", "First Quarter",
+                                          "Waxing Gibbous", "Full Moon",       "Waning Gibbous",
+                                          "Third Quarter",  "Waning Crescent"};
+
+SunMoonCalc::SunMoonCalc(time_t timestamp, double lat, double lon) {
+  _timestamp = timestamp;
+  _lat = lat;
+  _lon = lon;
+}
+
+SunMoonCalc::Result SunMoonCalc::calculateSunAndMoonData() {
+  Result result;
+  time_t midnightUtc = _timestamp - _timestamp % 86400;
+  time_t noon = midnightUtc + 12 * 3600 - (time_t)lround(_lon * 240);
+  result.sun.rise = noon - 6 * 3600;
+  result.sun.set = noon + 6 * 3600;
+
+  double age = fmod((_timestamp - NATIVE_NEW_MOON_EPOCH) / 86400.0, NATIVE_LUNAR_MONTH_DAYS);
+  result.moon.age = age;
+  result.moon.illumination = (1 - cos(2 * M_PI * age / NATIVE_LUNAR_MONTH_DAYS)) / 2;
+  result.moon.rise = result.sun.rise + (time_t)(age / NATIVE_LUNAR_MONTH_DAYS * 86400);
+  result.moon.set = result.moon.rise + 12 * 3600;
+  uint8_t index = (uint8_t)lround(age / NATIVE_LUNAR_MONTH_DAYS * 8) % 8;
+  result.moon.phase = {index, PHASE_NAMES[index]};
+  return result;
+}
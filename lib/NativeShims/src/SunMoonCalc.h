@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "Arduino.h"
+
+/**
+ * Host stand-in for SunMoonCalc of the ESP8266 Weather Station library, with the fields the app
+ * reads. Not astronomy: the sun rises 6 hours before and sets 6 hours after the local solar noon
+ * of the longitude, the moon ages linearly from the new moon of 2000-01-06 18:14 UTC and rises
+ * that share of a day after the sun. Deterministic for a given time and place, which is what the
+ * host rendering needs.
+ */
+class SunMoonCalc {
+public:
+  typedef struct Sun {
+    time_t rise;
+    time_t set;
+  } Sun;
+
+  typedef struct MoonPhase {
+    uint8_t index;
+    String name;
+  } MoonPhase;
+
+  typedef struct Moon {
+    time_t rise;
+    time_t set;
+    // days since the new moon
+    double age;
+    double illumination;
+    MoonPhase phase;
+  } Moon;
+
+  typedef struct Result {
+    Sun sun;
+    Moon moon;
+  } Result;
+
+  SunMoonCalc(time_t timestamp, double lat, double lon);
+  Result calculateSunAndMoonData();
+
+private:
+  time_t _timestamp;
+  double _lat;
+  double _lon;
+};
@@ -0,0 +1,256 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+
+#include "TFT_eSPI.h"
+
+static uint16_t swap16(uint16_t value) {
+  return (value >> 8) | (value << 8);
+}
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) {
+  _nativeWidth = w;
+  _nativeHeight = h;
+  _width = w;
+  _height = h;
+}
+
+void TFT_eSPI::init() {
+  _frame.assign(_width * _height, TFT_BLACK);
+}
+
+void TFT_eSPI::setRotation(uint8_t rotation) {
+  _rotation = rotation & 3;
+  bool portrait = _rotation % 2 == 0;
+  _width = portrait ? _nativeWidth : _nativeHeight;
+  _height = portrait ? _nativeHeight : _nativeWidth;
+  _frame.assign(_width * _height, TFT_BLACK);
+}
+
+void TFT_eSPI::nativeResetStats() {
+  _windows = 0;
+  _pixels = 0;
+}
+
+void TFT_eSPI::nativeSetTransferTime(uint32_t nanosPerWindow, uint32_t nanosPerPixel) {
+  _nanosPerWindow = nanosPerWindow;
+  _nanosPerPixel = nanosPerPixel;
+}
+
+void TFT_eSPI::store(int32_t x, int32_t y, uint16_t color) {
+  _frame[y * _width + x] = color;
+}
+
+uint16_t TFT_eSPI::load(int32_t x, int32_t y) {
+  return _frame[y * _width + x];
+}
+
+// Busy-waits like the CPU blocked on the SPI transfer would, sleeping is far too coarse.
+void TFT_eSPI::transfer(uint32_t pixels) {
+  _windows++;
+  _pixels += pixels;
+  uint64_t nanos = _nanosPerWindow + (uint64_t)_nanosPerPixel * pixels;
+  if (nanos == 0) {
+    return;
+  }
+  auto until = std::chrono::steady_clock::now() + std::chrono::nanoseconds(nanos);
+  while (std::chrono::steady_clock::now() < until) {
+  }
+}
+
+bool TFT_eSPI::clip(int32_t &x, int32_t &y, int32_t &w, int32_t &h) {
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  w = min(w, (int32_t)_width - x);
+  h = min(h, (int32_t)_height - y);
+  return w > 0 && h > 0;
+}
+
+void TFT_eSPI::blit(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data,
+                    int32_t stride, bool swapped, bool transparent, uint16_t transparentColor) {
+  int32_t clippedX = x, clippedY = y;
+  if (!clip(clippedX, clippedY, w, h)) {
+    return;
+  }
+  data += (clippedY - y) * stride + (clippedX - x);
+  for (int32_t row = 0; row < h; row++) {
+    for (int32_t col = 0; col < w; col++) {
+      uint16_t color = swapped ? swap16(data[row * stride + col]) : data[row * stride + col];
+      if (!transparent || color != transparentColor) {
+        store(clippedX + col, clippedY + row, color);
+      }
+    }
+  }
+  transfer(w * h);
+}
+
+// With swapped bytes enabled the data holds plain colors, else the bytes are already in the
+// order they go out over SPI.
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data) {
+  blit(x, y, w, h, data, w, !_swapBytes, false, 0);
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data,
+                         uint16_t transparent) {
+  blit(x, y, w, h, data, w, !_swapBytes, true, transparent);
+}
+
+// Delivers the colors byte-swapped, the order sprites keep them in.
+void TFT_eSPI::readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data) {
+  for (int32_t row = 0; row < h; row++) {
+    for (int32_t col = 0; col < w; col++) {
+      int32_t px = x + col, py = y + row;
+      bool inside = px >= 0 && py >= 0 && px < _width && py < _height;
+      data[row * w + col] = inside ? swap16(load(px, py)) : 0;
+    }
+  }
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) {
+  if (x < 0 || y < 0 || x >= _width || y >= _height) {
+    return 0;
+  }
+  return load(x, y);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  fillRect(x, y, 1, 1, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  if (!clip(x, y, w, h)) {
+    return;
+  }
+  for (int32_t row = 0; row < h; row++) {
+    for (int32_t col = 0; col < w; col++) {
+      store(x + col, y + row, color);
+    }
+  }
+  transfer(w * h);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y + 1, h - 2, color);
+  drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+// Whether the pixel at dx, dy from the top left is inside a w x h rectangle with the given
+// corner radius.
+static bool insideRoundRect(int32_t dx, int32_t dy, int32_t w, int32_t h, int32_t radius) {
+  if (dx < 0 || dy < 0 || dx >= w || dy >= h) {
+    return false;
+  }
+  int32_t cx = dx < radius ? radius - dx : dx >= w - radius ? dx - (w - radius - 1) : 0;
+  int32_t cy = dy < radius ? radius - dy : dy >= h - radius ? dy - (h - radius - 1) : 0;
+  return cx * cx + cy * cy <= radius * radius;
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius,
+                             uint32_t color) {
+  for (int32_t row = 0; row < h; row++) {
+    for (int32_t col = 0; col < w; col++) {
+      if (insideRoundRect(col, row, w, h, radius)) {
+        drawPixel(x + col, y + row, color);
+      }
+    }
+  }
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius,
+                             uint32_t color) {
+  for (int32_t row = 0; row < h; row++) {
+    for (int32_t col = 0; col < w; col++) {
+      if (insideRoundRect(col, row, w, h, radius) &&
+          !insideRoundRect(col - 1, row - 1, w - 2, h - 2, max(radius - 1, (int32_t)0))) {
+        drawPixel(x + col, y + row, color);
+      }
+    }
+  }
+}
+
+void TFT_eSPI::fillCircle(int32_t x, int32_t y, int32_t radius, uint32_t color) {
+  for (int32_t dy = -radius; dy <= radius; dy++) {
+    for (int32_t dx = -radius; dx <= radius; dx++) {
+      if (dx * dx + dy * dy <= radius * radius + radius) {
+        drawPixel(x + dx, y + dy, color);
+      }
+    }
+  }
+}
+
+// Same rounding as the library, tests compare blended pixels exactly.
+uint16_t TFT_eSPI::alphaBlend(uint8_t alpha, uint16_t foreground, uint16_t background) {
+  uint32_t rxb = background & 0xF81F;
+  rxb += ((foreground & 0xF81F) - rxb) * (alpha >> 2) >> 6;
+  uint32_t xgx = background & 0x07E0;
+  xgx += ((foreground & 0x07E0) - xgx) * alpha >> 8;
+  return (rxb & 0xF81F) | (xgx & 0x07E0);
+}
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI *tft) : TFT_eSPI(0, 0) {
+  _tft = tft;
+}
+
+void *TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames) {
+  if (_created) {
+    return _image;
+  }
+  _image = (uint16_t *)calloc(w * h, sizeof(uint16_t));
+  if (_image == nullptr) {
+    return nullptr;
+  }
+  _width = w;
+  _height = h;
+  _created = true;
+  return _image;
+}
+
+void TFT_eSprite::deleteSprite() {
+  free(_image);
+  _image = nullptr;
+  _width = 0;
+  _height = 0;
+  _created = false;
+}
+
+void TFT_eSprite::store(int32_t x, int32_t y, uint16_t color) {
+  _image[y * _width + x] = swap16(color);
+}
+
+uint16_t TFT_eSprite::load(int32_t x, int32_t y) {
+  return swap16(_image[y * _width + x]);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+  if (_created) {
+    _tft->blit(x, y, _width, _height, _image, _width, true, false, 0);
+  }
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transparent) {
+  if (_created) {
+    _tft->blit(x, y, _width, _height, _image, _width, true, true, transparent);
+  }
+}
+
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw,
+                             int32_t sh) {
+  if (!_created) {
+    return false;
+  }
+  int32_t x = sx, y = sy;
+  if (!clip(x, y, sw, sh)) {
+    return false;
+  }
+  _tft->blit(tx + x - sx, ty + y - sy, sw, sh, _image + y * _width + x, _width, true, false, 0);
+  return true;
+}
@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "Arduino.h"
+
+/**
+ * Host stand-in for TFT_eSPI and TFT_eSprite, drawing into memory. The display keeps the colors
+ * as they appear on the screen, sprites keep them byte-swapped like the library does, so code
+ * that reads sprite memory or pushes it with setSwapBytes() behaves the same on the host.
+ *
+ * Everything that reaches the display is counted, and optionally delayed by a modeled SPI
+ * transfer time, so tests can assert how many pixels a redraw sends and measure overlap.
+ */
+
+// ILI9488 at rotation 0
+#ifndef TFT_WIDTH
+#define TFT_WIDTH 320
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 480
+#endif
+
+#define TFT_BLACK 0x0000
+#define TFT_NAVY 0x000F
+#define TFT_DARKGREEN 0x03E0
+#define TFT_DARKGREY 0x7BEF
+#define TFT_BLUE 0x001F
+#define TFT_GREEN 0x07E0
+#define TFT_CYAN 0x07FF
+#define TFT_RED 0xF800
+#define TFT_MAGENTA 0xF81F
+#define TFT_YELLOW 0xFFE0
+#define TFT_WHITE 0xFFFF
+#define TFT_ORANGE 0xFDA0
+#define TFT_LIGHTGREY 0xD69A
+#define TFT_TRANSPARENT 0x0120
+
+// the fields display.h logs
+typedef struct {
+  const char *version = "native";
+  uint8_t trans = 0;
+  uint8_t serial = 0;
+  uint16_t tft_driver = 0x9488;
+  uint16_t tft_width = TFT_WIDTH;
+  uint16_t tft_height = TFT_HEIGHT;
+  int16_t tft_spi_freq = 0;
+} setup_t;
+
+typedef struct {
+  uint32_t windows;
+  uint64_t pixels;
+} NativeTransferStats;
+
+class TFT_eSPI {
+public:
+  TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+  virtual ~TFT_eSPI() {}
+
+  void init();
+  void begin() { init(); }
+  void setRotation(uint8_t rotation);
+  uint8_t getRotation() { return _rotation; }
+  int16_t width() { return _width; }
+  int16_t height() { return _height; }
+  void getSetup(setup_t &setup) { setup = setup_t(); }
+  uint16_t fontsLoaded() { return 1 << 15; }
+
+  void setSwapBytes(bool swap) { _swapBytes = swap; }
+  bool getSwapBytes() { return _swapBytes; }
+
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data,
+                 uint16_t transparent);
+  void readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data);
+  uint16_t readPixel(int32_t x, int32_t y);
+
+  void drawPixel(int32_t x, int32_t y, uint32_t color);
+  void fillScreen(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+    fillRect(x, y, w, 1, color);
+  }
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+    fillRect(x, y, 1, h, color);
+  }
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color);
+  void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color);
+  void fillCircle(int32_t x, int32_t y, int32_t radius, uint32_t color);
+
+  uint16_t alphaBlend(uint8_t alpha, uint16_t foreground, uint16_t background);
+  uint16_t color565(uint8_t red, uint8_t green, uint8_t blue) {
+    return ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
+  }
+
+  // Native: the screen as displayed, width() * height() colors.
+  const uint16_t *nativeFrame() { return _frame.data(); }
+  NativeTransferStats nativeStats() { return {_windows.load(), _pixels.load()}; }
+  void nativeResetStats();
+  // Native: every address window and pixel sent to the display takes this long.
+  void nativeSetTransferTime(uint32_t nanosPerWindow, uint32_t nanosPerPixel);
+
+protected:
+  int16_t _width;
+  int16_t _height;
+  bool _swapBytes = false;
+
+  // colors as they appear on the screen, coordinates already clipped
+  virtual void store(int32_t x, int32_t y, uint16_t color);
+  virtual uint16_t load(int32_t x, int32_t y);
+  // accounts for an address window of the given number of pixels
+  virtual void transfer(uint32_t pixels);
+  // Copies w * h pixels from data, rows stride apart. swapped means data holds the colors with
+  // their bytes swapped. Pixels of the transparent (screen) color are skipped if transparent.
+  void blit(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, int32_t stride,
+            bool swapped, bool transparent, uint16_t transparentColor);
+  bool clip(int32_t &x, int32_t &y, int32_t &w, int32_t &h);
+
+  friend class TFT_eSprite;
+
+private:
+  int16_t _nativeWidth;
+  int16_t _nativeHeight;
+  uint8_t _rotation = 0;
+  std::vector<uint16_t> _frame;
+  std::atomic<uint32_t> _windows{0};
+  std::atomic<uint64_t> _pixels{0};
+  uint32_t _nanosPerWindow = 0;
+  uint32_t _nanosPerPixel = 0;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+  TFT_eSprite(TFT_eSPI *tft);
+  ~TFT_eSprite() { deleteSprite(); }
+
+  void *createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+  void deleteSprite();
+  bool created() { return _created; }
+  void *getPointer() { return _image; }
+  void *setColorDepth(int8_t depth) { return _image; }
+  void fillSprite(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+
+  void pushSprite(int32_t x, int32_t y);
+  void pushSprite(int32_t x, int32_t y, uint16_t transparent);
+  bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
+protected:
+  void store(int32_t x, int32_t y, uint16_t color) override;
+  uint16_t load(int32_t x, int32_t y) override;
+  void transfer(uint32_t pixels) override {}
+
+private:
+  TFT_eSPI *_tft;
+  uint16_t *_image = nullptr;
+  bool _created = false;
+};
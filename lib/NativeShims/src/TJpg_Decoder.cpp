@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "TJpg_Decoder.h"
+
+// the decoder's MCU size at full scale
+#define NATIVE_JPEG_BLOCK_SIZE 16
+
+TJpg_Decoder TJpgDec;
+
+// Finds the baseline or progressive start of frame marker and reads the size from it.
+JRESULT TJpg_Decoder::getJpgSize(uint16_t *w, uint16_t *h, const uint8_t data[], uint32_t size) {
+  if (size < 4 || data[0] != 0xFF || data[1] != 0xD8) {
+    return JDR_FMT1;
+  }
+  uint32_t position = 2;
+  while (position + 9 <= size) {
+    if (data[position] != 0xFF) {
+      return JDR_FMT1;
+    }
+    uint8_t marker = data[position + 1];
+    uint16_t length = (data[position + 2] << 8) | data[position + 3];
+    if (marker == 0xC0 || marker == 0xC2) {
+      *h = (data[position + 5] << 8) | data[position + 6];
+      *w = (data[position + 7] << 8) | data[position + 8];
+      return JDR_OK;
+    }
+    position += 2 + length;
+  }
+  return JDR_INP;
+}
+
+JRESULT TJpg_Decoder::drawJpg(int32_t x, int32_t y, const uint8_t data[], uint32_t size) {
+  uint16_t w, h;
+  JRESULT result = getJpgSize(&w, &h, data, size);
+  if (result != JDR_OK || _callback == nullptr) {
+    return result;
+  }
+  uint16_t width = (w + _scale - 1) / _scale;
+  uint16_t height = (h + _scale - 1) / _scale;
+  uint16_t block[NATIVE_JPEG_BLOCK_SIZE * NATIVE_JPEG_BLOCK_SIZE];
+  for (uint16_t top = 0; top < height; top += NATIVE_JPEG_BLOCK_SIZE) {
+    for (uint16_t left = 0; left < width; left += NATIVE_JPEG_BLOCK_SIZE) {
+      for (uint16_t row = 0; row < NATIVE_JPEG_BLOCK_SIZE; row++) {
+        for (uint16_t col = 0; col < NATIVE_JPEG_BLOCK_SIZE; col++) {
+          uint8_t gray = ((left + col) * 255 / max(width, (uint16_t)1) + (top + row)) & 0xFF;
+          uint16_t color = ((gray & 0xF8) << 8) | ((gray & 0xFC) << 3) | (gray >> 3);
+          block[row * NATIVE_JPEG_BLOCK_SIZE + col] = _swapBytes ? (color >> 8) | (color << 8)
+                                                                 : color;
+        }
+      }
+      // like the decoder, blocks along the edges reach beyond the image
+      if (!_callback(x + left, y + top, NATIVE_JPEG_BLOCK_SIZE, NATIVE_JPEG_BLOCK_SIZE, block)) {
+        return JDR_INTR;
+      }
+    }
+  }
+  return JDR_OK;
+}
@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "Arduino.h"
+
+typedef enum {
+  JDR_OK = 0,
+  JDR_INTR,
+  JDR_INP,
+  JDR_MEM1,
+  JDR_MEM2,
+  JDR_PAR,
+  JDR_FMT1,
+  JDR_FMT2,
+  JDR_FMT3
+} JRESULT;
+
+typedef bool (*SketchCallback)(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *data);
+
+/**
+ * Host stand-in for TJpg_Decoder. Only the frame header is parsed, for the size; decoding
+ * delivers 16x16 blocks of a gray gradient in the same order and at the same scale the decoder
+ * would.
+ */
+class TJpg_Decoder {
+public:
+  JRESULT getJpgSize(uint16_t *w, uint16_t *h, const uint8_t data[], uint32_t size);
+  JRESULT drawJpg(int32_t x, int32_t y, const uint8_t data[], uint32_t size);
+  void setJpgScale(uint8_t scale) { _scale = scale; }
+  void setCallback(SketchCallback callback) { _callback = callback; }
+  void setSwapBytes(bool swap) { _swapBytes = swap; }
+
+private:
+  uint8_t _scale = 1;
+  bool _swapBytes = false;
+  SketchCallback _callback = nullptr;
+};
+
+extern TJpg_Decoder TJpgDec;
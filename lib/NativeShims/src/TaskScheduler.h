@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+
+#include "Arduino.h"
+
+#define TASK_FOREVER (-1)
+
+/**
+ * Host stand-in for TaskScheduler: tasks with an interval and a callback, run from
+ * Scheduler::execute() on the simulated millis() once due.
+ */
+class Task {
+public:
+  Task(unsigned long interval, long iterations, void (*callback)()) {
+    _interval = interval;
+    _iterations = iterations;
+    _callback = callback;
+  }
+  void enable() {
+    _enabled = true;
+    _runs = 0;
+    _nextMillis = millis();
+  }
+  bool enableDelayed(unsigned long delayMillis = 0) {
+    enable();
+    _nextMillis = millis() + (delayMillis > 0 ? delayMillis : _interval);
+    return true;
+  }
+  void disable() { _enabled = false; }
+  bool isEnabled() { return _enabled; }
+
+  // Runs the callback if it's due, returns whether it did.
+  bool nativeRunIfDue() {
+    if (!_enabled || (long)(millis() - _nextMillis) < 0) {
+      return false;
+    }
+    _nextMillis += _interval;
+    _callback();
+    if (_iterations != TASK_FOREVER && ++_runs >= _iterations) {
+      _enabled = false;
+    }
+    return true;
+  }
+
+private:
+  unsigned long _interval;
+  long _iterations;
+  long _runs = 0;
+  void (*_callback)();
+  bool _enabled = false;
+  unsigned long _nextMillis = 0;
+};
+
+class Scheduler {
+public:
+  void init() { _tasks.clear(); }
+  void addTask(Task &task) { _tasks.push_back(&task); }
+  // Returns true if no task was due, as the library does when the scheduler was idle.
+  bool execute() {
+    bool idle = true;
+    for (Task *task : _tasks) {
+      if (task->nativeRunIfDue()) {
+        idle = false;
+      }
+    }
+    return idle;
+  }
+
+private:
+  std::vector<Task *> _tasks;
+};
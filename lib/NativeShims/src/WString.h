@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+
+/**
+ * Host stand-in for the Arduino String, backed by std::string. Covers the constructors and
+ * methods the sources in src/ use, with the same formatting of numbers.
+ */
+class String {
+public:
+  String(const char *value = "") : _value(value != nullptr ? value : "") {}
+  String(const std::string &value) : _value(value) {}
+  explicit String(char value) : _value(1, value) {}
+  explicit String(unsigned char value, unsigned char base = 10) { formatInteger(value, base); }
+  explicit String(int value, unsigned char base = 10) { formatInteger(value, base); }
+  explicit String(unsigned int value, unsigned char base = 10) { formatInteger(value, base); }
+  explicit String(long value, unsigned char base = 10) { formatInteger(value, base); }
+  explicit String(unsigned long value, unsigned char base = 10) { formatInteger(value, base); }
+  explicit String(float value, unsigned char decimals = 2) { formatDecimal(value, decimals); }
+  explicit String(double value, unsigned char decimals = 2) { formatDecimal(value, decimals); }
+
+  const char *c_str() const { return _value.c_str(); }
+  unsigned int length() const { return _value.length(); }
+  bool isEmpty() const { return _value.empty(); }
+  bool reserve(unsigned int size) {
+    _value.reserve(size);
+    return true;
+  }
+
+  char operator[](unsigned int index) const { return index < _value.length() ? _value[index] : 0; }
+  char charAt(unsigned int index) const { return (*this)[index]; }
+
+  String &operator+=(const String &other) {
+    _value += other._value;
+    return *this;
+  }
+  String &operator+=(const char *other) {
+    _value += other;
+    return *this;
+  }
+  String &operator+=(char other) {
+    _value += other;
+    return *this;
+  }
+  bool concat(const String &other) {
+    _value += other._value;
+    return true;
+  }
+
+  bool operator==(const String &other) const { return _value == other._value; }
+  bool operator==(const char *other) const { return _value == other; }
+  bool operator!=(const String &other) const { return _value != other._value; }
+  bool operator!=(const char *other) const { return _value != other; }
+  bool operator<(const String &other) const { return _value < other._value; }
+  bool equals(const String &other) const { return _value == other._value; }
+  bool equals(const char *other) const { return _value == other; }
+  bool startsWith(const String &prefix) const { return _value.rfind(prefix._value, 0) == 0; }
+  bool endsWith(const String &suffix) const {
+    return _value.length() >= suffix.length() &&
+           _value.compare(_value.length() - suffix.length(), suffix.length(), suffix._value) == 0;
+  }
+
+  int indexOf(char c, unsigned int from = 0) const { return position(_value.find(c, from)); }
+  int indexOf(const String &s, unsigned int from = 0) const {
+    return position(_value.find(s._value, from));
+  }
+  int lastIndexOf(char c) const { return position(_value.rfind(c)); }
+  String substring(unsigned int from) const {
+    return from < _value.length() ? String(_value.substr(from)) : String();
+  }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    return from < _value.length() ? String(_value.substr(from, to - from)) : String();
+  }
+
+  long toInt() const { return strtol(_value.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(_value.c_str(), nullptr); }
+  double toDouble() const { return strtod(_value.c_str(), nullptr); }
+  void toCharArray(char *buffer, unsigned int size) const {
+    if (size == 0) return;
+    strncpy(buffer, _value.c_str(), size - 1);
+    buffer[size - 1] = '\0';
+  }
+  void trim() {
+    size_t start = _value.find_first_not_of(" \t\r\n");
+    size_t end = _value.find_last_not_of(" \t\r\n");
+    _value = start == std::string::npos ? "" : _value.substr(start, end - start + 1);
+  }
+
+  friend String operator+(const String &a, const String &b) { return String(a._value + b._value); }
+  friend String operator+(const String &a, const char *b) { return String(a._value + b); }
+  friend String operator+(const char *a, const String &b) { return String(a + b._value); }
+  friend String operator+(const String &a, char b) { return String(a._value + b); }
+
+private:
+  std::string _value;
+
+  static int position(size_t index) { return index == std::string::npos ? -1 : (int)index; }
+
+  template <typename T> void formatInteger(T value, unsigned char base) {
+    if (base == 10) {
+      _value = std::to_string(value);
+      return;
+    }
+    char digits[8 * sizeof(T) + 1];
+    char *end = digits + sizeof(digits);
+    char *start = end;
+    unsigned long long rest = (unsigned long long)value;
+    do {
+      uint8_t digit = rest % base;
+      *--start = digit < 10 ? '0' + digit : 'A' + digit - 10;
+      rest /= base;
+    } while (rest > 0);
+    _value.assign(start, end);
+  }
+
+  void formatDecimal(double value, unsigned char decimals) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+    _value = buffer;
+  }
+};
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "WiFi.h"
+
+// what a connect typically takes on the device
+#define NATIVE_WIFI_CONNECT_MILLIS 300
+#define NATIVE_WIFI_SCAN_MILLIS 2500
+#define NATIVE_WIFI_DHCP_MILLIS 800
+
+WiFiClass WiFi;
+
+wl_status_t WiFiClass::begin(const char *ssid, const char *password, int32_t channel,
+                             const uint8_t *bssid, bool connect) {
+  if (_connectMillis == 0 && _scanMillis == 0 && _dhcpMillis == 0) {
+    nativeSetDelays(NATIVE_WIFI_CONNECT_MILLIS, NATIVE_WIFI_SCAN_MILLIS, NATIVE_WIFI_DHCP_MILLIS);
+  }
+  if (_leaseIp == 0) {
+    nativeSetLease(IPAddress(192, 168, 1, 42), IPAddress(192, 168, 1, 1),
+                   IPAddress(255, 255, 255, 0), IPAddress(192, 168, 1, 1));
+  }
+  _begins++;
+  bool directed = channel != 0 && bssid != nullptr;
+  uint32_t millisToConnect = _connectMillis;
+  if (!directed) {
+    _scans++;
+    millisToConnect += _scanMillis;
+  }
+  bool found = _available && (!directed || (channel == _channel && memcmp(bssid, _bssid, 6) == 0));
+  if (found && _staticIp == 0) {
+    _dhcpRequests++;
+    millisToConnect += _dhcpMillis;
+  }
+  _status = WL_DISCONNECTED;
+  _pending = true;
+  _pendingStatus = found ? WL_CONNECTED : WL_NO_SSID_AVAIL;
+  _readyAtMillis = millis() + millisToConnect;
+  return _status;
+}
+
+bool WiFiClass::config(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns1,
+                       IPAddress dns2) {
+  _staticIp = ip;
+  _staticGateway = gateway;
+  _staticSubnet = subnet;
+  _staticDns = dns1;
+  return true;
+}
+
+bool WiFiClass::disconnect(bool wifiOff, bool eraseAp) {
+  _pending = false;
+  _status = WL_DISCONNECTED;
+  _connectedChannel = 0;
+  memset(_connectedBssid, 0, sizeof(_connectedBssid));
+  return true;
+}
+
+wl_status_t WiFiClass::status() {
+  if (_pending && millis() >= _readyAtMillis) {
+    _pending = false;
+    _status = _pendingStatus;
+    if (_status == WL_CONNECTED) {
+      _connectedChannel = _channel;
+      memcpy(_connectedBssid, _bssid, sizeof(_connectedBssid));
+    }
+  }
+  if (_status == WL_CONNECTED && !_available) {
+    _status = WL_CONNECTION_LOST;
+  }
+  return _status;
+}
+
+IPAddress WiFiClass::localIP() {
+  return status() != WL_CONNECTED ? 0 : _staticIp != 0 ? _staticIp : _leaseIp;
+}
+
+IPAddress WiFiClass::gatewayIP() {
+  return status() != WL_CONNECTED ? 0 : _staticIp != 0 ? _staticGateway : _leaseGateway;
+}
+
+IPAddress WiFiClass::subnetMask() {
+  return status() != WL_CONNECTED ? 0 : _staticIp != 0 ? _staticSubnet : _leaseSubnet;
+}
+
+IPAddress WiFiClass::dnsIP(uint8_t index) {
+  return status() != WL_CONNECTED ? 0 : _staticIp != 0 ? _staticDns : _leaseDns;
+}
+
+void WiFiClass::nativeSetAccessPoint(bool available, int32_t channel, const uint8_t *bssid) {
+  _available = available;
+  _channel = channel;
+  if (bssid != nullptr) {
+    memcpy(_bssid, bssid, sizeof(_bssid));
+  }
+}
+
+void WiFiClass::nativeSetLease(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns) {
+  _leaseIp = ip;
+  _leaseGateway = gateway;
+  _leaseSubnet = subnet;
+  _leaseDns = dns;
+}
+
+void WiFiClass::nativeSetDelays(uint32_t connectMillis, uint32_t scanMillis, uint32_t dhcpMillis) {
+  _connectMillis = connectMillis;
+  _scanMillis = scanMillis;
+  _dhcpMillis = dhcpMillis;
+}
+
+void WiFiClass::nativeReset() {
+  *this = WiFiClass();
+}
+
+int WiFiClient::read(uint8_t *buffer, size_t size) {
+  size = min(size, _data.size() - _position);
+  memcpy(buffer, _data.data() + _position, size);
+  _position += size;
+  return size;
+}
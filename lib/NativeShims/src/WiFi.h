@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+
+#include "Arduino.h"
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+/**
+ * Host stand-in for the ESP32 WiFi, connecting to a scripted access point on the simulated clock
+ * of Arduino.h. A connect without channel and BSSID scans first, a connect without a static IP
+ * config asks for a DHCP lease; both take time. A connect to the wrong channel or BSSID, or while
+ * the access point is down, ends in WL_NO_SSID_AVAIL.
+ */
+class WiFiClass {
+public:
+  void persistent(bool persistent) {}
+  bool mode(wifi_mode_t mode) { return true; }
+  wl_status_t begin(const char *ssid, const char *password, int32_t channel = 0,
+                    const uint8_t *bssid = nullptr, bool connect = true);
+  bool config(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns1 = (uint32_t)0,
+              IPAddress dns2 = (uint32_t)0);
+  bool disconnect(bool wifiOff = false, bool eraseAp = false);
+  wl_status_t status();
+  bool isConnected() { return status() == WL_CONNECTED; }
+  IPAddress localIP();
+  IPAddress gatewayIP();
+  IPAddress subnetMask();
+  IPAddress dnsIP(uint8_t index = 0);
+  uint8_t *BSSID() { return _connectedBssid; }
+  int32_t channel() { return _connectedChannel; }
+  int8_t RSSI() { return status() == WL_CONNECTED ? -60 : 0; }
+
+  // Native: the access point, its lease and how long connecting takes.
+  void nativeSetAccessPoint(bool available, int32_t channel = 6, const uint8_t *bssid = nullptr);
+  void nativeSetLease(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns);
+  void nativeSetDelays(uint32_t connectMillis, uint32_t scanMillis, uint32_t dhcpMillis);
+  // Native: back to disconnected with the defaults, counters cleared.
+  void nativeReset();
+  uint32_t nativeBegins() { return _begins; }
+  uint32_t nativeScans() { return _scans; }
+  uint32_t nativeDhcpRequests() { return _dhcpRequests; }
+  // Native: whether the last connect used the static IP config.
+  bool nativeStaticIp() { return _staticIp != 0; }
+
+private:
+  bool _available = true;
+  int32_t _channel = 6;
+  uint8_t _bssid[6] = {0x24, 0x0A, 0xC4, 0x00, 0x00, 0x01};
+  uint32_t _leaseIp = 0, _leaseGateway = 0, _leaseSubnet = 0, _leaseDns = 0;
+  uint32_t _connectMillis = 0, _scanMillis = 0, _dhcpMillis = 0;
+
+  uint32_t _staticIp = 0, _staticGateway = 0, _staticSubnet = 0, _staticDns = 0;
+  wl_status_t _status = WL_DISCONNECTED;
+  // status() turns into _pendingStatus once the simulated clock reaches _readyAtMillis
+  bool _pending = false;
+  wl_status_t _pendingStatus = WL_DISCONNECTED;
+  unsigned long _readyAtMillis = 0;
+  uint8_t _connectedBssid[6] = {};
+  int32_t _connectedChannel = 0;
+  uint32_t _begins = 0, _scans = 0, _dhcpRequests = 0;
+};
+
+extern WiFiClass WiFi;
+
+/**
+ * Memory stream with the interface of the WiFiClient the HTTPClient hands out. Connected until
+ * all data is read.
+ */
+class WiFiClient {
+public:
+  WiFiClient(const std::string &data = "") : _data(data) {}
+  uint8_t connected() { return _position < _data.size(); }
+  int available() { return _data.size() - _position; }
+  int read() { return _position < _data.size() ? (uint8_t)_data[_position++] : -1; }
+  int read(uint8_t *buffer, size_t size);
+  void stop() { _position = _data.size(); }
+
+private:
+  std::string _data;
+  size_t _position = 0;
+};
@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <thread>
+
+#include "Wire.h"
+
+TwoWire Wire;
+
+void TwoWire::acquire() {
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  TaskHandle_t owner = _owner.exchange(self);
+  if (owner != nullptr && owner != self) {
+    _collisions++;
+  }
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+  acquire();
+  _transactions++;
+  std::lock_guard<std::mutex> lock(_mutex);
+  _address = address;
+  _pointerWritten = false;
+}
+
+size_t TwoWire::write(uint8_t value) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_pointerWritten) {
+    _pointers[_address] = value;
+    _pointerWritten = true;
+  } else {
+    _registers[_address << 8 | _pointers[_address]++] = value;
+  }
+  return 1;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+  return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t count) {
+  acquire();
+  std::lock_guard<std::mutex> lock(_mutex);
+  _readAddress = address;
+  _readLeft = count;
+  return count;
+}
+
+int TwoWire::available() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _readLeft;
+}
+
+int TwoWire::read() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_readLeft == 0) {
+    return -1;
+  }
+  if (--_readLeft == 0) {
+    _owner = nullptr;
+    _reads++;
+  }
+  return _registers[_readAddress << 8 | _pointers[_readAddress]++];
+}
+
+void TwoWire::nativeSetRegister(uint8_t address, uint8_t reg, uint8_t value) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _registers[address << 8 | reg] = value;
+}
+
+uint8_t TwoWire::nativeRegister(uint8_t address, uint8_t reg) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _registers[address << 8 | reg];
+}
+
+void TwoWire::nativeSetRegisters(uint8_t address, uint8_t reg, const uint8_t *values,
+                                 size_t count) {
+  while (true) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_readLeft == 0) {
+        for (size_t i = 0; i < count; i++) {
+          _registers[address << 8 | (uint8_t)(reg + i)] = values[i];
+        }
+        return;
+      }
+    }
+    std::this_thread::yield();
+  }
+}
+
+void TwoWire::nativeReset() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _registers.clear();
+  _pointers.clear();
+  _readLeft = 0;
+  _owner = nullptr;
+  _transactions = 0;
+  _collisions = 0;
+  _reads = 0;
+}
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+#include "Arduino.h"
+
+/**
+ * Host stand-in for the I2C bus with register based devices, as the FT6236 is: the first byte
+ * written sets the register pointer, further bytes write registers, reads continue from the
+ * pointer. Transactions of two tasks interleaving on the bus are counted as collisions.
+ */
+class TwoWire {
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) { return true; }
+  void beginTransmission(uint8_t address);
+  size_t write(uint8_t value);
+  uint8_t endTransmission(bool sendStop = true);
+  uint8_t requestFrom(uint8_t address, uint8_t count);
+  int available();
+  int read();
+
+  // Native: the register contents of a device.
+  void nativeSetRegister(uint8_t address, uint8_t reg, uint8_t value);
+  uint8_t nativeRegister(uint8_t address, uint8_t reg);
+  // Native: sets count registers from reg on at once, after a read in progress has finished, as
+  // the panel latches a new report.
+  void nativeSetRegisters(uint8_t address, uint8_t reg, const uint8_t *values, size_t count);
+  // Native: reads that got all the bytes they requested.
+  uint32_t nativeReads() { return _reads; }
+  uint32_t nativeTransactions() { return _transactions; }
+  uint32_t nativeCollisions() { return _collisions; }
+  void nativeReset();
+
+private:
+  std::mutex _mutex;
+  std::map<uint16_t, uint8_t> _registers;
+  std::map<uint8_t, uint8_t> _pointers;
+  uint8_t _address = 0;
+  bool _pointerWritten = false;
+  uint8_t _readAddress = 0;
+  uint8_t _readLeft = 0;
+  // the task owning the bus between beginTransmission() and the end of the read
+  std::atomic<TaskHandle_t> _owner{nullptr};
+  std::atomic<uint32_t> _transactions{0};
+  std::atomic<uint32_t> _collisions{0};
+  std::atomic<uint32_t> _reads{0};
+
+  void acquire();
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,49 @@
+# SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+# SPDX-License-Identifier: MIT
+
+# PlatformIO pre-script: generates font-subset.h, the UI font reduced to the glyphs the configured
+# language needs (see subset_font.py), and clock-font.h, the clock characters pre-rasterized (see
+# rasterize_font.py). Puts both on the include path of the firmware.
+
+import os
+import sys
+
+Import("env")
+
+project_dir = env.subst("$PROJECT_DIR")
+sys.path.insert(0, os.path.join(project_dir, "scripts"))
+import rasterize_font
+import subset_font
+
+FONT_HEADER = os.path.join(project_dir, "src", "fonts", "open-sans.h")
+SETTINGS = os.path.join(project_dir, "src", "settings.h")
+# the characters of the 24h and 12h (am/pm) clock, at the size drawClockCells() uses
+CLOCK_CHARACTERS = " :0123456789amp"
+CLOCK_FONT_SIZES = [48]
+
+generated_dir = os.path.join(env.subst("$BUILD_DIR"), "generated")
+output_header = os.path.join(generated_dir, "font-subset.h")
+clock_header = os.path.join(generated_dir, "clock-font.h")
+
+
+def is_outdated(output, inputs):
+    return not os.path.exists(output) or os.path.getmtime(output) < max(
+        os.path.getmtime(path) for path in inputs)
+
+
+# the language is switched in settings.h, the translation itself may change too
+_, translation = subset_font.active_translation(SETTINGS)
+inputs = [FONT_HEADER, SETTINGS, translation, subset_font.__file__]
+if is_outdated(output_header, inputs):
+    subset_font.subset_header(FONT_HEADER, SETTINGS, output_header)
+
+if is_outdated(clock_header, [FONT_HEADER, rasterize_font.__file__]):
+    try:
+        import PIL
+    except ImportError:
+        sys.exit("Pillow is needed to pre-rasterize the clock font, install it into PlatformIO's "
+                 "Python with: %s -m pip install pillow" % env.subst("$PYTHONEXE"))
+    rasterize_font.rasterize_header(FONT_HEADER, "CLOCK_FONT", CLOCK_CHARACTERS, CLOCK_FONT_SIZES,
+                                    clock_header)
+
+env.Append(CPPPATH=[generated_dir])
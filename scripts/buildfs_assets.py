@@ -0,0 +1,20 @@
+# SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+# SPDX-License-Identifier: MIT
+
+# PlatformIO pre-script: 'pio run -t buildfs|uploadfs' builds the LittleFS image from a converted
+# copy of data/ (see convert_assets.py) rather than from data/ itself.
+
+import os
+import sys
+
+Import("env")
+
+sys.path.insert(0, os.path.join(env.subst("$PROJECT_DIR"), "scripts"))
+import convert_assets
+
+FS_TARGETS = {"buildfs", "uploadfs", "uploadfsota"}
+
+if FS_TARGETS.intersection(COMMAND_LINE_TARGETS):
+    converted_data_dir = os.path.join(env.subst("$BUILD_DIR"), "data")
+    convert_assets.convert_tree(env.subst("$PROJECT_DATA_DIR"), converted_data_dir)
+    env.Replace(PROJECT_DATA_DIR=converted_data_dir)
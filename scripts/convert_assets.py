@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+# SPDX-License-Identifier: MIT
+
+"""
+Converts the 24bit BMP icons in data/ (or PNG icons such as those in assets/) to the native icon
+formats read by GfxUi::drawIcon().
+
+The device would otherwise have to convert every single pixel from BGR888 to RGB565 each time an
+icon is painted. Converted icons are stored as '<name>.icon' next to where the '<name>.bmp' or
+'<name>.png' was, all other files are copied as they are. Each icon gets whichever of the two
+formats is smaller; icons with a black background and few colors compress several-fold with the
+palette.
+
+Raw icon format (all header values little-endian):
+  offset 0: magic "R565"
+  offset 4: uint16 width
+  offset 6: uint16 height
+  offset 8: width * height RGB565 pixels, top-down, big-endian (i.e. in display byte order)
+
+Palette icon format, at most 256 colors (all header values little-endian):
+  offset 0:  magic "PRLE"
+  offset 4:  uint16 width
+  offset 6:  uint16 height
+  offset 8:  uint16 number of palette colors n
+  offset 10: n RGB565 colors, big-endian
+  then the rows top-down as packets of palette indexes, no packet crosses a row:
+    control byte c < 0x80: c + 1 indexes follow
+    control byte c >= 0x80: the next index repeated (c & 0x7F) + 1 times
+
+Finally all icons are packed into a single '/icons.atlas' with a sorted index, see
+src/IconAtlas.h for its format, and the separate icon files are left out.
+
+PNGs require Pillow ('pip install pillow'); transparent pixels become black.
+
+Usage: convert_assets.py <source dir> <destination dir>
+"""
+
+import os
+import shutil
+import struct
+import sys
+import time
+
+RAW565_MAGIC = b"R565"
+RAW565_HEADER = struct.Struct("<4sHH")
+PALETTE_RLE_MAGIC = b"PRLE"
+PALETTE_RLE_HEADER = struct.Struct("<4sHHH")
+PALETTE_RLE_MAX_COLORS = 256
+# runs shorter than this are cheaper as part of a literal packet
+PALETTE_RLE_MIN_RUN = 3
+PALETTE_RLE_MAX_PACKET = 128
+ICON_SOURCE_EXTENSIONS = (".bmp", ".png")
+ICON_ATLAS_NAME = "icons.atlas"
+ICON_ATLAS_MAGIC = b"ATL2"
+# ICON_ATLAS_MAX_PATH_SIZE in src/IconAtlas.h, including the terminating null
+ICON_ATLAS_MAX_PATH_SIZE = 64
+ICON_ATLAS_HEADER = struct.Struct("<4sI")
+ICON_ATLAS_ENTRY = struct.Struct("<III")
+
+
+def read_bmp(path):
+    """Returns (width, height, rows) with rows top-down as lists of (r, g, b) tuples."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[0:2] != b"BM":
+        raise ValueError("%s: not a BMP file" % path)
+    pixel_offset, = struct.unpack_from("<I", data, 10)
+    width, height, planes, bpp, compression = struct.unpack_from("<iiHHI", data, 18)
+    if planes != 1 or bpp != 24 or compression != 0:
+        raise ValueError("%s: only uncompressed 24bit BMPs are supported" % path)
+
+    bottom_up = height > 0
+    height = abs(height)
+    stride = (width * 3 + 3) & ~3
+    rows = []
+    for row in range(height):
+        start = pixel_offset + row * stride
+        line = data[start:start + width * 3]
+        rows.append([(line[i + 2], line[i + 1], line[i]) for i in range(0, width * 3, 3)])
+    if bottom_up:
+        rows.reverse()
+    return width, height, rows
+
+
+def read_png(path):
+    """Returns (width, height, rows) like read_bmp(), composited onto black."""
+    from PIL import Image
+
+    with Image.open(path) as image:
+        rgba = image.convert("RGBA")
+    background = Image.new("RGBA", rgba.size, (0, 0, 0, 255))
+    rgb = Image.alpha_composite(background, rgba).convert("RGB")
+    width, height = rgb.size
+    data = rgb.tobytes()
+    pixels = [tuple(data[i:i + 3]) for i in range(0, len(data), 3)]
+    return width, height, [pixels[row * width:(row + 1) * width] for row in range(height)]
+
+
+def read_icon(path):
+    if os.path.splitext(path)[1].lower() == ".png":
+        return read_png(path)
+    return read_bmp(path)
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def encode_raw565(width, height, rows):
+    out = bytearray(RAW565_HEADER.pack(RAW565_MAGIC, width, height))
+    for row in rows:
+        for r, g, b in row:
+            out += struct.pack(">H", rgb565(r, g, b))
+    return bytes(out)
+
+
+def encode_rle_row(indexes):
+    out = bytearray()
+    literals = []
+
+    def flush_literals():
+        while literals:
+            packet = literals[:PALETTE_RLE_MAX_PACKET]
+            del literals[:PALETTE_RLE_MAX_PACKET]
+            out.append(len(packet) - 1)
+            out.extend(packet)
+
+    i = 0
+    while i < len(indexes):
+        end = i
+        while (end < len(indexes) and indexes[end] == indexes[i]
+               and end - i < PALETTE_RLE_MAX_PACKET):
+            end += 1
+        if end - i >= PALETTE_RLE_MIN_RUN:
+            flush_literals()
+            out.append(0x80 | (end - i - 1))
+            out.append(indexes[i])
+            i = end
+        else:
+            literals.append(indexes[i])
+            i += 1
+    flush_literals()
+    return out
+
+
+def encode_palette_rle(width, height, rows):
+    """Returns the palette icon, or None if the image has more than 256 colors."""
+    pixels = [[rgb565(r, g, b) for r, g, b in row] for row in rows]
+    palette = sorted(set(color for row in pixels for color in row))
+    if len(palette) > PALETTE_RLE_MAX_COLORS:
+        return None
+    index = {color: i for i, color in enumerate(palette)}
+    out = bytearray(PALETTE_RLE_HEADER.pack(PALETTE_RLE_MAGIC, width, height, len(palette)))
+    for color in palette:
+        out += struct.pack(">H", color)
+    for row in pixels:
+        out += encode_rle_row([index[color] for color in row])
+    return bytes(out)
+
+
+def encode_icon(width, height, rows):
+    """Returns whichever of the two icon formats is smaller."""
+    raw = encode_raw565(width, height, rows)
+    palette = encode_palette_rle(width, height, rows)
+    return raw if palette is None or len(palette) >= len(raw) else palette
+
+
+def fnv1a(text):
+    value = 2166136261
+    for byte in text.encode("utf-8"):
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def pack_atlas(icons, path):
+    """Packs {icon path on the device: icon bytes} into a single atlas file."""
+    entries = sorted((fnv1a(name), name, data) for name, data in icons.items())
+    for (hash_a, name_a, _), (hash_b, name_b, _) in zip(entries, entries[1:]):
+        if hash_a == hash_b:
+            raise ValueError("Icon paths %s and %s have the same hash" % (name_a, name_b))
+    for _, name, _ in entries:
+        if len(name.encode("utf-8")) >= ICON_ATLAS_MAX_PATH_SIZE:
+            raise ValueError("Icon path %s is longer than %d bytes"
+                             % (name, ICON_ATLAS_MAX_PATH_SIZE - 1))
+    # each icon is preceded by its null-terminated path, the device checks it after the hash
+    records = [name.encode("utf-8") + b"\0" + data for _, name, data in entries]
+    offset = ICON_ATLAS_HEADER.size + len(entries) * ICON_ATLAS_ENTRY.size
+    out = bytearray(ICON_ATLAS_HEADER.pack(ICON_ATLAS_MAGIC, len(entries)))
+    for (hash_value, _, _), record in zip(entries, records):
+        out += ICON_ATLAS_ENTRY.pack(hash_value, offset, len(record))
+        offset += len(record)
+    for record in records:
+        out += record
+    with open(path, "wb") as f:
+        f.write(out)
+    return len(out)
+
+
+def convert_tree(src_dir, dst_dir, verbose=True):
+    """Mirrors src_dir into dst_dir, converting every BMP and PNG to an icon in the atlas."""
+    start = time.time()
+    source_bytes = icon_bytes = icons = palette_icons = 0
+    atlas = {}
+    if os.path.isdir(dst_dir):
+        shutil.rmtree(dst_dir)
+
+    for root, _, files in os.walk(src_dir):
+        target_root = os.path.join(dst_dir, os.path.relpath(root, src_dir))
+        os.makedirs(target_root, exist_ok=True)
+        for name in sorted(files):
+            src = os.path.join(root, name)
+            base, ext = os.path.splitext(name)
+            if ext.lower() not in ICON_SOURCE_EXTENSIONS:
+                shutil.copy2(src, os.path.join(target_root, name))
+                continue
+            icon = encode_icon(*read_icon(src))
+            relative = os.path.relpath(os.path.join(root, base + ".icon"), src_dir)
+            atlas["/" + relative.replace(os.sep, "/")] = icon
+            icons += 1
+            if icon.startswith(PALETTE_RLE_MAGIC):
+                palette_icons += 1
+            source_bytes += os.path.getsize(src)
+            icon_bytes += len(icon)
+
+    atlas_bytes = pack_atlas(atlas, os.path.join(dst_dir, ICON_ATLAS_NAME))
+    # directories left without files
+    for root, dirs, files in os.walk(dst_dir, topdown=False):
+        if root != dst_dir and not os.listdir(root):
+            os.rmdir(root)
+
+    if verbose:
+        print("Converted %d icons (%d bytes) to %d palette and %d RGB565 icons (%d bytes) in %.1fs"
+              " -> %s" % (icons, source_bytes, palette_icons, icons - palette_icons, icon_bytes,
+                          time.time() - start, dst_dir))
+        print("Packed them into %s (%d bytes)" % (ICON_ATLAS_NAME, atlas_bytes))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    convert_tree(sys.argv[1], sys.argv[2])
@@ -0,0 +1,32 @@
+# SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+# SPDX-License-Identifier: MIT
+
+# PlatformIO pre-script of the native env: converts data/ like 'pio run -t buildfs' does (see
+# convert_assets.py) and mounts the host's LittleFS stand-in on the result, the tests then read the
+# same icons as the device.
+
+import os
+import sys
+
+Import("env")
+
+sys.path.insert(0, os.path.join(env.subst("$PROJECT_DIR"), "scripts"))
+import convert_assets
+
+data_dir = env.subst("$PROJECT_DATA_DIR")
+converted_data_dir = os.path.join(env.subst("$BUILD_DIR"), "data")
+atlas = os.path.join(converted_data_dir, convert_assets.ICON_ATLAS_NAME)
+
+
+def newest_input():
+    newest = os.path.getmtime(convert_assets.__file__)
+    for root, _, files in os.walk(data_dir):
+        for name in files:
+            newest = max(newest, os.path.getmtime(os.path.join(root, name)))
+    return newest
+
+
+if not os.path.exists(atlas) or os.path.getmtime(atlas) < newest_input():
+    convert_assets.convert_tree(data_dir, converted_data_dir)
+
+env.Append(CPPDEFINES=[("NATIVE_FS_ROOT", env.StringifyMacro(converted_data_dir))])
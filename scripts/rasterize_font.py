@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+# SPDX-License-Identifier: MIT
+
+"""
+Pre-rasterizes a few characters of a TrueType font at fixed pixel sizes into the 4-bit
+anti-aliased bitmap font format drawn by BitmapFontRender, so the device doesn't need FreeType
+for them.
+
+Generated header, per size:
+  <NAME>_<size>_BITMAPS  4-bit coverage, 2 pixels per byte (high nibble first), rows padded to
+                         full bytes, glyph after glyph
+  <NAME>_<size>_GLYPHS   BitmapGlyph per character, sorted by codepoint
+  <NAME>_<size>          the BitmapFont
+
+Requires Pillow ('pip install pillow'), which renders with FreeType like OpenFontRender does.
+
+Usage: rasterize_font.py <font header> <name> <characters> <size>[,<size>...] <output header>
+"""
+
+import io
+import os
+import sys
+
+import subset_font
+
+
+def rasterize(font_data, size, characters):
+    """Returns a list of (codepoint, offset x, offset y, width, height, advance, packed bitmap)."""
+    from PIL import Image, ImageDraw, ImageFont
+
+    font = ImageFont.truetype(io.BytesIO(font_data), size)
+    ascent, _ = font.getmetrics()
+    margin = size
+    glyphs = []
+    for character in sorted(set(characters)):
+        canvas = Image.new("L", (3 * size, 3 * size), 0)
+        # pen at the left margin, baseline one ascent below the top of the line
+        ImageDraw.Draw(canvas).text((margin, margin + ascent), character, fill=255, font=font,
+                                    anchor="ls")
+        advance = round(font.getlength(character))
+        # fonts without a space glyph draw the .notdef box instead
+        box = None if character.isspace() else canvas.getbbox()
+        if box is None:
+            glyphs.append((ord(character), 0, 0, 0, 0, advance, b""))
+            continue
+        left, top, right, bottom = box
+        width, height = right - left, bottom - top
+        packed = bytearray()
+        for y in range(top, bottom):
+            row = [canvas.getpixel((x, y)) >> 4 for x in range(left, right)]
+            if len(row) % 2:
+                row.append(0)
+            packed += bytes((row[i] << 4) | row[i + 1] for i in range(0, len(row), 2))
+        glyphs.append((ord(character), left - margin, top - margin, width, height, advance,
+                       bytes(packed)))
+    return glyphs
+
+
+def c_array(data):
+    return ",\n".join(", ".join("0x%02X" % b for b in data[i:i + 16])
+                      for i in range(0, len(data), 16))
+
+
+def write_header(path, name, fonts, characters):
+    if os.path.dirname(path):
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("// Generated by scripts/rasterize_font.py, do not edit.\n")
+        f.write("// Characters: %s\n\n" % characters)
+        f.write("#pragma once\n\n#include \"BitmapFontRender.h\"\n")
+        for size, glyphs in fonts:
+            prefix = "%s_%d" % (name, size)
+            bitmaps = bytearray()
+            entries = []
+            for codepoint, offset_x, offset_y, width, height, advance, packed in glyphs:
+                entries.append("  {%d, %d, %d, %d, %d, %d, %d}," % (
+                    codepoint, offset_x, offset_y, width, height, advance, len(bitmaps)))
+                bitmaps += packed
+            f.write("\nconst uint8_t %s_BITMAPS[%d] = {\n%s};\n" % (prefix, len(bitmaps),
+                                                                  c_array(bitmaps)))
+            f.write("\nconst BitmapGlyph %s_GLYPHS[%d] = {\n%s\n};\n" % (prefix, len(entries),
+                                                                       "\n".join(entries)))
+            f.write("\nconst BitmapFont %s = {%d, %d, %s_GLYPHS, %s_BITMAPS};\n" % (
+                prefix, size, len(entries), prefix, prefix))
+
+
+def rasterize_header(font_header, name, characters, sizes, output_header, verbose=True):
+    _, font_data = subset_font.read_font_header(font_header)
+    fonts = [(size, rasterize(font_data, size, characters)) for size in sizes]
+    write_header(output_header, name, fonts, characters)
+    if verbose:
+        for size, glyphs in fonts:
+            print("Rasterized %d glyphs at %dpx into %d bytes -> %s"
+                  % (len(glyphs), size, sum(len(g[6]) for g in glyphs), output_header))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 6:
+        sys.exit(__doc__)
+    rasterize_header(sys.argv[1], sys.argv[2], sys.argv[3],
+                     [int(size) for size in sys.argv[4].split(",")], sys.argv[5])
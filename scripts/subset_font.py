@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+# SPDX-License-Identifier: MIT
+
+"""
+Reduces the TrueType font embedded in src/fonts/ to the glyphs the UI can actually render.
+
+These are printable ASCII (weather descriptions and city names come from OpenWeatherMap, numbers
+and units from the firmware), the characters used in the string literals of the translation
+included by src/settings.h, and the letters OpenWeatherMap may use in that language.
+
+The subset is written as a C header defining the same array as the source header, so the firmware
+doesn't notice the difference. Requires fontTools ('pip install fonttools'), the build stops
+without it rather than silently embedding the full font.
+
+Usage: subset_font.py <font header> <settings.h> <output header>
+"""
+
+import io
+import os
+import re
+import sys
+
+FONT_ARRAY = re.compile(r"const\s+unsigned\s+char\s+(\w+)\[\d*\]\s*=\s*\{(.*?)\}", re.S)
+ACTIVE_TRANSLATION = re.compile(r'^\s*#include\s+"(translations/texts_(\w+)\.h)"', re.M)
+STRING_LITERAL = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+
+PRINTABLE_ASCII = "".join(chr(c) for c in range(0x20, 0x7F))
+# used by the firmware regardless of the language
+UI_CHARACTERS = "°"
+# what OpenWeatherMap descriptions and city names may contain beyond the translation
+LANGUAGE_LETTERS = {
+    "de": "ÄÖÜäöüß",
+    "en": "",
+    "it": "ÀÈÉÌÒÙàèéìòù",
+    "nl": "ÉËÏéëïèö",
+}
+
+
+def read_font_header(path):
+    """Returns (array name, font bytes) of a header as created for OpenFontRender."""
+    with open(path, encoding="utf-8") as f:
+        match = FONT_ARRAY.search(f.read())
+    if match is None:
+        raise ValueError("%s: no font array found" % path)
+    values = re.findall(r"0x([0-9A-Fa-f]{2})", match.group(2))
+    return match.group(1), bytes(int(v, 16) for v in values)
+
+
+def write_font_header(path, name, data, characters):
+    if os.path.dirname(path):
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+    lines = [", ".join("0x%02X" % b for b in data[i:i + 10]) for i in range(0, len(data), 10)]
+    guard = "_%s_SUBSET_H_" % name.upper()
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("// Generated by scripts/subset_font.py, do not edit.\n")
+        f.write("// Characters: %s\n\n" % characters.replace("\\", "\\\\"))
+        f.write("#ifndef %s\n#define %s\n\n" % (guard, guard))
+        f.write("const unsigned char %s[%d] = {\n%s};\n\n" % (name, len(data), ",\n".join(lines)))
+        f.write("#endif\n")
+
+
+def active_translation(settings_path):
+    """Returns (language, path) of the translation settings.h includes."""
+    with open(settings_path, encoding="utf-8") as f:
+        match = ACTIVE_TRANSLATION.search(f.read())
+    if match is None:
+        raise ValueError("%s: no translation included" % settings_path)
+    return match.group(2), os.path.join(os.path.dirname(settings_path), match.group(1))
+
+
+def ui_characters(settings_path):
+    language, translation_path = active_translation(settings_path)
+    with open(translation_path, encoding="utf-8") as f:
+        literals = "".join(STRING_LITERAL.findall(f.read()))
+    characters = set(PRINTABLE_ASCII + UI_CHARACTERS + literals + LANGUAGE_LETTERS.get(language, ""))
+    return language, "".join(sorted(characters))
+
+
+def subset(font, characters):
+    """Returns (subset font, glyphs before, glyphs after)."""
+    try:
+        from fontTools import subset as ft_subset
+        from fontTools.ttLib import TTFont
+    except ImportError:
+        sys.exit("fontTools is needed to subset the UI font, install it into PlatformIO's Python "
+                 "with: %s -m pip install fonttools" % sys.executable)
+    options = ft_subset.Options()
+    # OpenFontRender only needs the outlines and metrics
+    options.layout_features = []
+    options.name_IDs = []
+    options.notdef_outline = True
+    ttf = TTFont(io.BytesIO(font))
+    glyphs_before = len(ttf.getGlyphOrder())
+    subsetter = ft_subset.Subsetter(options)
+    subsetter.populate(text=characters)
+    subsetter.subset(ttf)
+    out = io.BytesIO()
+    ttf.save(out)
+    return out.getvalue(), glyphs_before, len(ttf.getGlyphOrder())
+
+
+def subset_header(font_header, settings_path, output_header, verbose=True):
+    name, font = read_font_header(font_header)
+    language, characters = ui_characters(settings_path)
+    data, glyphs_before, glyphs_after = subset(font, characters)
+    write_font_header(output_header, name, data, characters)
+    if verbose:
+        print("Font subset for '%s': %d of %d glyphs, %d -> %d bytes (%d bytes of flash saved) -> %s"
+              % (language, glyphs_after, glyphs_before, len(font), len(data),
+                 len(font) - len(data), output_header))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 4:
+        sys.exit(__doc__)
+    subset_header(sys.argv[1], sys.argv[2], sys.argv[3])
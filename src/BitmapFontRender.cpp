@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "BitmapFontRender.h"
+
+void BitmapFontRender::setFont(const BitmapFont &font) {
+  _font = &font;
+}
+
+void BitmapFontRender::setDrawer(TFT_eSprite &sprite) {
+  _sprite = &sprite;
+  _paletteValid = false;
+}
+
+void BitmapFontRender::setFontColor(uint16_t color) {
+  if (color != _fontColor) {
+    _fontColor = color;
+    _paletteValid = false;
+  }
+}
+
+void BitmapFontRender::setBackgroundColor(uint16_t color) {
+  if (color != _backgroundColor) {
+    _backgroundColor = color;
+    _paletteValid = false;
+  }
+}
+
+void BitmapFontRender::drawString(const char *text, int32_t x, int32_t y) {
+  draw(text, x, y, false);
+}
+
+void BitmapFontRender::cdrawString(const char *text, int32_t x, int32_t y) {
+  draw(text, x, y, true);
+}
+
+uint8_t BitmapFontRender::advance(char c) {
+  const BitmapGlyph *glyph = find(c);
+  return glyph == nullptr ? 0 : glyph->advance;
+}
+
+void BitmapFontRender::logStats() {
+  log_i("Bitmap font: %d strings drawn in %llu cycles on average", _strings,
+        _strings == 0 ? 0 : _renderCycles / _strings);
+}
+
+// Characters missing from the font are skipped.
+void BitmapFontRender::draw(const char *text, int32_t x, int32_t y, bool centered) {
+  if (_font == nullptr || _sprite == nullptr) {
+    return;
+  }
+  uint32_t startCycles = ESP.getCycleCount();
+  if (!_paletteValid) {
+    buildPalette();
+  }
+
+  if (centered) {
+    // centers the ink box of the string on x, like OpenFontRender
+    int32_t pen = 0;
+    int32_t inkLeft = INT32_MAX;
+    int32_t inkRight = INT32_MIN;
+    for (const char *c = text; *c != '\0'; c++) {
+      const BitmapGlyph *glyph = find(*c);
+      if (glyph == nullptr) continue;
+      if (glyph->width > 0) {
+        inkLeft = min(inkLeft, pen + glyph->offsetX);
+        inkRight = max(inkRight, pen + glyph->offsetX + glyph->width);
+      }
+      pen += glyph->advance;
+    }
+    if (inkLeft <= inkRight) {
+      x -= (inkRight - inkLeft) / 2 + inkLeft;
+    }
+  }
+
+  for (const char *c = text; *c != '\0'; c++) {
+    const BitmapGlyph *glyph = find(*c);
+    if (glyph == nullptr) continue;
+    blend(glyph, x + glyph->offsetX, y + glyph->offsetY);
+    x += glyph->advance;
+  }
+  _strings++;
+  _renderCycles += ESP.getCycleCount() - startCycles;
+}
+
+// Writes the covered pixels directly into the sprite buffer, which holds the colors byte-swapped.
+// Assumes the default 16-bit color depth of TFT_eSprite.
+void BitmapFontRender::blend(const BitmapGlyph *glyph, int32_t x, int32_t y) {
+  if (glyph->width == 0) {
+    return;
+  }
+  uint16_t *pixels = (uint16_t *)_sprite->getPointer();
+  int32_t spriteWidth = _sprite->width();
+  int32_t spriteHeight = _sprite->height();
+  uint8_t rowBytes = (glyph->width + 1) / 2;
+  const uint8_t *coverage = _font->bitmaps + glyph->offset;
+
+  for (uint8_t row = 0; row < glyph->height; row++, coverage += rowBytes) {
+    int32_t py = y + row;
+    if (py < 0 || py >= spriteHeight) continue;
+    uint16_t *line = pixels + py * spriteWidth;
+    for (uint8_t col = 0; col < glyph->width; col++) {
+      uint8_t level = (col & 1) ? coverage[col / 2] & 0x0F : coverage[col / 2] >> 4;
+      int32_t px = x + col;
+      if (level == 0 || px < 0 || px >= spriteWidth) continue;
+      line[px] = _palette[level];
+    }
+  }
+}
+
+// Binary search, the glyphs are sorted by codepoint.
+const BitmapGlyph *BitmapFontRender::find(char c) {
+  if (_font == nullptr) {
+    return nullptr;
+  }
+  uint16_t codepoint = (uint8_t)c;
+  int16_t low = 0;
+  int16_t high = _font->glyphCount - 1;
+  while (low <= high) {
+    int16_t middle = (low + high) / 2;
+    const BitmapGlyph *glyph = &_font->glyphs[middle];
+    if (glyph->codepoint == codepoint) {
+      return glyph;
+    }
+    if (glyph->codepoint < codepoint) {
+      low = middle + 1;
+    } else {
+      high = middle - 1;
+    }
+  }
+  return nullptr;
+}
+
+void BitmapFontRender::buildPalette() {
+  for (uint8_t level = 0; level < 16; level++) {
+    // 4-bit coverage scaled to the 8-bit alpha of alphaBlend(): 15 * 17 = 255
+    uint16_t color = _sprite->alphaBlend(level * 17, _fontColor, _backgroundColor);
+    _palette[level] = (color >> 8) | (color << 8);
+  }
+  _paletteValid = true;
+}
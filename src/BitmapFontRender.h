@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// One pre-rasterized glyph of a BitmapFont
+typedef struct BitmapGlyph {
+  uint16_t codepoint;
+  // ink box relative to the pen position and the top of the text
+  int8_t offsetX;
+  int8_t offsetY;
+  uint8_t width;
+  uint8_t height;
+  uint8_t advance;
+  // of the coverage rows in BitmapFont::bitmaps
+  uint32_t offset;
+} BitmapGlyph;
+
+// A few characters of a font at one pixel size, generated at build time by
+// scripts/rasterize_font.py. Coverage is 4 bits per pixel, 2 pixels per byte (high nibble first),
+// each row padded to a full byte.
+typedef struct BitmapFont {
+  uint8_t size;
+  uint8_t glyphCount;
+  // sorted by codepoint
+  const BitmapGlyph *glyphs;
+  const uint8_t *bitmaps;
+} BitmapFont;
+
+/**
+ * Draws text in a pre-rasterized BitmapFont into a 16-bit sprite. There is no FreeType involved
+ * and no blending per pixel: the 15 coverage levels are mapped to colors once per color change
+ * and written straight into the sprite buffer. Places text like CachedFontRender and
+ * OpenFontRender do.
+ */
+class BitmapFontRender {
+public:
+  void setFont(const BitmapFont &font);
+  void setDrawer(TFT_eSprite &sprite);
+  void setFontColor(uint16_t color);
+  void setBackgroundColor(uint16_t color);
+  // Same placement as OpenFontRender::drawString() and cdrawString()
+  void drawString(const char *text, int32_t x, int32_t y);
+  void cdrawString(const char *text, int32_t x, int32_t y);
+  // Pen advance of the character, 0 if it isn't part of the font
+  uint8_t advance(char c);
+  void logStats();
+
+private:
+  const BitmapFont *_font = nullptr;
+  TFT_eSprite *_sprite = nullptr;
+  uint16_t _fontColor = TFT_WHITE;
+  uint16_t _backgroundColor = TFT_BLACK;
+  // sprite colors (byte-swapped) per coverage level, rebuilt when a color changes
+  uint16_t _palette[16];
+  bool _paletteValid = false;
+
+  uint32_t _strings = 0;
+  uint64_t _renderCycles = 0;
+
+  void draw(const char *text, int32_t x, int32_t y, bool centered);
+  void blend(const BitmapGlyph *glyph, int32_t x, int32_t y);
+  const BitmapGlyph *find(char c);
+  void buildPalette();
+};
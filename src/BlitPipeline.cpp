@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "BlitPipeline.h"
+
+BlitPipeline::BlitPipeline(TFT_eSPI *tft) {
+  _tft = tft;
+}
+
+bool BlitPipeline::begin() {
+  // internal RAM, the display task reads them while the other core writes to PSRAM
+  for (uint8_t i = 0; i < 2; i++) {
+    _buffers[i] = (uint16_t *)malloc(BLIT_PIPELINE_BUFFER_PIXELS * sizeof(uint16_t));
+  }
+  _blits = xQueueCreate(BLIT_PIPELINE_QUEUE_SIZE, sizeof(Blit));
+  _freeBuffers = xQueueCreate(2, sizeof(uint16_t *));
+  if (_buffers[0] == nullptr || _buffers[1] == nullptr || _blits == nullptr ||
+      _freeBuffers == nullptr) {
+    log_e("Not enough memory for the blit pipeline.");
+    free(_buffers[0]);
+    free(_buffers[1]);
+    _buffers[0] = _buffers[1] = nullptr;
+    return false;
+  }
+  for (uint8_t i = 0; i < 2; i++) {
+    xQueueSend(_freeBuffers, &_buffers[i], 0);
+  }
+  // loop() draws on core 1
+  xTaskCreatePinnedToCore(taskEntry, "blit", BLIT_PIPELINE_TASK_STACK_SIZE, this, 2, nullptr, 0);
+  return true;
+}
+
+uint16_t BlitPipeline::rowsPerBuffer(uint16_t w) {
+  return w > 0 ? BLIT_PIPELINE_BUFFER_PIXELS / w : 0;
+}
+
+uint16_t *BlitPipeline::buffer() {
+  uint16_t *buffer = nullptr;
+  if (_freeBuffers != nullptr) {
+    xQueueReceive(_freeBuffers, &buffer, portMAX_DELAY);
+  }
+  return buffer;
+}
+
+void BlitPipeline::push(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *pixels,
+                        bool swapBytes) {
+  if (_blits == nullptr) {
+    bool oldSwap = _tft->getSwapBytes();
+    _tft->setSwapBytes(swapBytes);
+    _tft->pushImage(x, y, w, h, pixels);
+    _tft->setSwapBytes(oldSwap);
+    return;
+  }
+  Blit blit = {x, y, w, h, pixels, swapBytes, nullptr};
+  xQueueSend(_blits, &blit, portMAX_DELAY);
+  _pending = true;
+}
+
+void BlitPipeline::discard(uint16_t *buffer) {
+  xQueueSend(_freeBuffers, &buffer, portMAX_DELAY);
+}
+
+void BlitPipeline::flush() {
+  if (!_pending) {
+    return;
+  }
+  Blit marker = {0, 0, 0, 0, nullptr, false, xTaskGetCurrentTaskHandle()};
+  xQueueSend(_blits, &marker, portMAX_DELAY);
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  _pending = false;
+  _flushes++;
+}
+
+void BlitPipeline::run() {
+  Blit blit;
+  while (true) {
+    xQueueReceive(_blits, &blit, portMAX_DELAY);
+    if (blit.pixels == nullptr) {
+      xTaskNotifyGive(blit.flushingTask);
+      continue;
+    }
+    bool oldSwap = _tft->getSwapBytes();
+    _tft->setSwapBytes(blit.swapBytes);
+    _tft->pushImage(blit.x, blit.y, blit.w, blit.h, blit.pixels);
+    _tft->setSwapBytes(oldSwap);
+    if (blit.pixels == _buffers[0] || blit.pixels == _buffers[1]) {
+      xQueueSend(_freeBuffers, &blit.pixels, portMAX_DELAY);
+    }
+  }
+}
+
+void BlitPipeline::taskEntry(void *parameter) {
+  ((BlitPipeline *)parameter)->run();
+}
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// size of each of the two pipeline buffers
+#define BLIT_PIPELINE_BUFFER_PIXELS 4096
+#define BLIT_PIPELINE_TASK_STACK_SIZE 3072
+// blocks queued for the display task, at most
+#define BLIT_PIPELINE_QUEUE_SIZE 8
+
+/**
+ * Pushes pixel blocks to the display from a task on the other core, so the next block can be
+ * read and converted while the previous one is still being sent.
+ *
+ * The ILI9488 takes 18-bit colors over SPI, TFT_eSPI converts every pixel on the CPU and has no
+ * DMA for it. The overlap therefore comes from the second core instead of a DMA engine.
+ *
+ * Between the first push() and flush() the TFT must not be used otherwise, not even its byte
+ * order. Callers therefore push everything that goes through the pipeline first and flush once
+ * before they draw to the TFT directly, typically once per frame: each flush() waits until the
+ * display task is idle, which stalls the decoding of the next image for the time the queued
+ * blocks take to send.
+ */
+class BlitPipeline {
+public:
+  BlitPipeline(TFT_eSPI *tft);
+  // Allocates the buffers and starts the display task. Without it buffer() returns nullptr and
+  // push() draws right away.
+  bool begin();
+  bool running() { return _blits != nullptr; }
+  // Rows of an image w pixels wide that fit into a buffer(), 0 if not even one does or w is 0
+  uint16_t rowsPerBuffer(uint16_t w);
+  // One of the two pipeline buffers, waits until the display task is done with it. It's handed
+  // back through push().
+  uint16_t *buffer();
+  // Queues pixels, swapBytes as for TFT_eSPI::setSwapBytes(). They must stay untouched until
+  // flush() unless they are a buffer().
+  void push(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *pixels, bool swapBytes);
+  // Hands a buffer() back without pushing it.
+  void discard(uint16_t *buffer);
+  // Waits until everything pushed is on the display.
+  void flush();
+  // flush() calls that had to wait for the display task
+  uint32_t flushes() { return _flushes; }
+
+private:
+  typedef struct Blit {
+    int32_t x;
+    int32_t y;
+    int32_t w;
+    int32_t h;
+    // nullptr: notify the flushing task
+    uint16_t *pixels;
+    bool swapBytes;
+    TaskHandle_t flushingTask;
+  } Blit;
+
+  TFT_eSPI *_tft;
+  uint16_t *_buffers[2] = {nullptr, nullptr};
+  QueueHandle_t _blits = nullptr;
+  QueueHandle_t _freeBuffers = nullptr;
+  bool _pending = false;
+  uint32_t _flushes = 0;
+
+  void run();
+  static void taskEntry(void *parameter);
+};
@@ -0,0 +1,374 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "CachedFontRender.h"
+
+CachedFontRender::CachedFontRender(TFT_eSPI *tft, OpenFontRender *ofr) : _scratch(tft) {
+  _tft = tft;
+  _ofr = ofr;
+}
+
+CachedFontRender::~CachedFontRender() {
+  clear();
+  _scratch.deleteSprite();
+}
+
+void CachedFontRender::loadFont(const unsigned char *data, size_t size) {
+  _ofr->loadFont(data, size);
+  _font = data;
+}
+
+void CachedFontRender::setBudget(size_t budgetBytes) {
+  _budgetBytes = budgetBytes;
+  if (_usedBytes > _budgetBytes) {
+    clear();
+  }
+}
+
+void CachedFontRender::setDrawer(TFT_eSPI &tft) {
+  _tft = &tft;
+  _sprite = nullptr;
+}
+
+void CachedFontRender::setDrawer(TFT_eSprite &sprite) {
+  _sprite = &sprite;
+}
+
+void CachedFontRender::setFontSize(uint8_t size) {
+  _size = size;
+}
+
+void CachedFontRender::setFontColor(uint16_t color) {
+  _fontColor = color;
+}
+
+void CachedFontRender::setBackgroundColor(uint16_t color) {
+  _backgroundColor = color;
+}
+
+void CachedFontRender::drawString(const char *text, int32_t x, int32_t y) {
+  draw(text, x, y, false);
+}
+
+void CachedFontRender::cdrawString(const char *text, int32_t x, int32_t y) {
+  draw(text, x, y, true);
+}
+
+void CachedFontRender::clear() {
+  for (uint16_t i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+    free(_slots[i]);
+    _slots[i] = nullptr;
+  }
+  _count = 0;
+  _usedBytes = 0;
+}
+
+void CachedFontRender::logStats() {
+  uint32_t lookups = _hits + _misses;
+  log_i("Glyph cache: %d glyphs, %d/%d bytes, %d hits, %d misses (%.1f%% hit rate), %d evicted",
+        _count, _usedBytes, _budgetBytes, _hits, _misses,
+        lookups == 0 ? 0.0 : 100.0 * _hits / lookups, _evictions);
+  log_i("Glyph cache: %d strings drawn in %lluus on average, %d of them uncached", _strings,
+        _strings == 0 ? 0 : _renderMicros / _strings, _uncachedStrings);
+}
+
+// Lays the string out from the cached glyph metrics, the pen moves in 26.6 fixed point and each
+// glyph is placed at the rounded pen position. Falls back to OpenFontRender for the whole string if
+// a glyph can't be cached.
+void CachedFontRender::draw(const char *text, int32_t x, int32_t y, bool centered) {
+  uint32_t startMicros = micros();
+  const Glyph *glyphs[GLYPH_MAX_STRING_LENGTH];
+  uint8_t count = 0;
+  const char *next = text;
+  while (*next != '\0') {
+    uint8_t length;
+    uint32_t codepoint = decodeUtf8(next, &length);
+    const Glyph *glyph = nullptr;
+    if (count < GLYPH_MAX_STRING_LENGTH) {
+      glyph = lookup(codepoint, next, length);
+    }
+    if (glyph == nullptr) {
+      drawUncached(text, x, y, centered);
+      return;
+    }
+    glyphs[count++] = glyph;
+    next += length;
+  }
+
+  if (centered) {
+    // OpenFontRender centers the ink box of the string on x
+    int32_t pen = 0;
+    int32_t inkLeft = INT32_MAX;
+    int32_t inkRight = INT32_MIN;
+    for (uint8_t i = 0; i < count; i++) {
+      if (glyphs[i]->width > 0) {
+        int32_t left = ((pen + 32) >> 6) + glyphs[i]->offsetX;
+        inkLeft = min(inkLeft, left);
+        inkRight = max(inkRight, (int32_t)(left + glyphs[i]->width));
+      }
+      pen += glyphs[i]->advance;
+    }
+    if (inkLeft <= inkRight) {
+      x -= (inkRight - inkLeft) / 2 + inkLeft;
+    }
+  }
+
+  int32_t pen = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    blend(glyphs[i], x + ((pen + 32) >> 6) + glyphs[i]->offsetX, y + glyphs[i]->offsetY);
+    pen += glyphs[i]->advance;
+  }
+  _strings++;
+  _renderMicros += micros() - startMicros;
+}
+
+void CachedFontRender::drawUncached(const char *text, int32_t x, int32_t y, bool centered) {
+  uint32_t startMicros = micros();
+  if (_sprite != nullptr) {
+    _ofr->setDrawer(*_sprite);
+  } else {
+    _ofr->setDrawer(*_tft);
+  }
+  _ofr->setFontSize(_size);
+  _ofr->setFontColor(_fontColor);
+  _ofr->setBackgroundColor(_backgroundColor);
+  if (centered) {
+    _ofr->cdrawString(text, x, y);
+  } else {
+    _ofr->drawString(text, x, y);
+  }
+  _strings++;
+  _uncachedStrings++;
+  _renderMicros += micros() - startMicros;
+}
+
+// Sprites are plain memory, so only the covered pixels are written. On the TFT each row goes out
+// with a single pushImage() that skips the uncovered pixels.
+void CachedFontRender::blend(const Glyph *glyph, int32_t x, int32_t y) {
+  if (glyph->width == 0) {
+    return;
+  }
+  const uint8_t *alpha = glyph->alpha;
+
+  if (_sprite != nullptr) {
+    for (uint16_t row = 0; row < glyph->height; row++) {
+      for (uint16_t col = 0; col < glyph->width; col++, alpha++) {
+        if (*alpha == 0) continue;
+        uint16_t color = *alpha == 255 ? _fontColor
+                                       : _tft->alphaBlend(*alpha, _fontColor, _backgroundColor);
+        _sprite->drawPixel(x + col, y + row, color);
+      }
+    }
+    return;
+  }
+
+  bool oldSwap = _tft->getSwapBytes();
+  _tft->setSwapBytes(true);
+  uint16_t line[glyph->width];
+  for (uint16_t row = 0; row < glyph->height; row++) {
+    // pushImage() opens an address window for each run of covered pixels
+    uint16_t covered = 0, runs = 0;
+    for (uint16_t col = 0; col < glyph->width; col++, alpha++) {
+      uint16_t color = GLYPH_TRANSPARENT_COLOR;
+      if (*alpha > 0) {
+        color = _tft->alphaBlend(*alpha, _fontColor, _backgroundColor);
+        // keep covered pixels that happen to have the marker color
+        if (color == GLYPH_TRANSPARENT_COLOR) color ^= 0x0001;
+        covered++;
+        if (col == 0 || alpha[-1] == 0) runs++;
+      }
+      line[col] = color;
+    }
+    _tft->pushImage(x, y + row, glyph->width, 1, line, GLYPH_TRANSPARENT_COLOR);
+    countPixelsPushed(covered, runs);
+  }
+  _tft->setSwapBytes(oldSwap);
+}
+
+// A glyph that doesn't fit makes room by evicting the glyphs used least recently, except the ones
+// of the string being drawn.
+const CachedFontRender::Glyph *CachedFontRender::lookup(uint32_t codepoint, const char *utf8,
+                                                        uint8_t length) {
+  uint16_t slot = slotFor(codepoint);
+  if (_slots[slot] != nullptr) {
+    _hits++;
+    _slots[slot]->lastUsed = _strings;
+    return _slots[slot];
+  }
+  _misses++;
+  if (_budgetBytes == 0) {
+    return nullptr;
+  }
+  Glyph *glyph = rasterize(codepoint, utf8, length);
+  if (glyph == nullptr) {
+    return nullptr;
+  }
+  size_t size = glyphBytes(glyph);
+  bool fits = size <= _budgetBytes;
+  while (fits && (_count >= GLYPH_CACHE_SLOTS * 3 / 4 || _usedBytes + size > _budgetBytes)) {
+    fits = evictLeastRecentlyUsed();
+  }
+  if (!fits) {
+    free(glyph);
+    return nullptr;
+  }
+  glyph->lastUsed = _strings;
+  // evicting moves glyphs around
+  _slots[slotFor(codepoint)] = glyph;
+  _count++;
+  _usedBytes += size;
+  return glyph;
+}
+
+// Removes the glyph drawn the longest ago and closes the gap in its probe sequence by moving the
+// following glyphs back (backward shift deletion, no tombstones needed). Returns false if only
+// glyphs of the current string are left.
+bool CachedFontRender::evictLeastRecentlyUsed() {
+  int16_t victim = -1;
+  for (uint16_t i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+    const Glyph *glyph = _slots[i];
+    if (glyph != nullptr && glyph->lastUsed != _strings &&
+        (victim < 0 || glyph->lastUsed < _slots[victim]->lastUsed)) {
+      victim = i;
+    }
+  }
+  if (victim < 0) {
+    return false;
+  }
+  _usedBytes -= glyphBytes(_slots[victim]);
+  free(_slots[victim]);
+  _slots[victim] = nullptr;
+  _count--;
+  _evictions++;
+
+  uint16_t gap = victim;
+  for (uint16_t next = (gap + 1) & (GLYPH_CACHE_SLOTS - 1); _slots[next] != nullptr;
+       next = (next + 1) & (GLYPH_CACHE_SLOTS - 1)) {
+    const Glyph *glyph = _slots[next];
+    uint16_t home = homeSlot(glyph->font, glyph->size, glyph->codepoint);
+    // move it unless its home lies cyclically between the gap and its slot
+    if (((next - home) & (GLYPH_CACHE_SLOTS - 1)) >= ((next - gap) & (GLYPH_CACHE_SLOTS - 1))) {
+      _slots[gap] = _slots[next];
+      _slots[next] = nullptr;
+      gap = next;
+    }
+  }
+  return true;
+}
+
+// Renders the glyph white on black with FreeType into the scratch sprite and keeps the bounding
+// box of its ink. The green channel has the most bits, it becomes the coverage value.
+CachedFontRender::Glyph *CachedFontRender::rasterize(uint32_t codepoint, const char *utf8,
+                                                     uint8_t length) {
+  if (!_scratch.created() &&
+      _scratch.createSprite(GLYPH_SCRATCH_SIZE, GLYPH_SCRATCH_SIZE) == nullptr) {
+    log_e("Failed to create the glyph scratch sprite.");
+    return nullptr;
+  }
+  char text[5] = {'\0'};
+  memcpy(text, utf8, length);
+
+  _ofr->setDrawer(_scratch);
+  _ofr->setFontSize(_size);
+  _ofr->setFontColor(TFT_WHITE);
+  _ofr->setBackgroundColor(TFT_BLACK);
+  _scratch.fillSprite(TFT_BLACK);
+  _ofr->drawString(text, GLYPH_SCRATCH_MARGIN, GLYPH_SCRATCH_MARGIN);
+
+  int16_t minX = GLYPH_SCRATCH_SIZE, minY = GLYPH_SCRATCH_SIZE, maxX = -1, maxY = -1;
+  for (int16_t py = 0; py < GLYPH_SCRATCH_SIZE; py++) {
+    for (int16_t px = 0; px < GLYPH_SCRATCH_SIZE; px++) {
+      if (_scratch.readPixel(px, py) != TFT_BLACK) {
+        minX = min(minX, px);
+        maxX = max(maxX, px);
+        minY = min(minY, py);
+        maxY = max(maxY, py);
+      }
+    }
+  }
+  bool hasInk = maxX >= 0;
+  if (hasInk && (minX == 0 || minY == 0 || maxX == GLYPH_SCRATCH_SIZE - 1 ||
+                 maxY == GLYPH_SCRATCH_SIZE - 1)) {
+    // clipped by the scratch sprite, too large to be cached
+    return nullptr;
+  }
+  uint16_t width = hasInk ? maxX - minX + 1 : 0;
+  uint16_t height = hasInk ? maxY - minY + 1 : 0;
+
+  size_t size = sizeof(Glyph) + width * height;
+  Glyph *glyph = (Glyph *)(psramFound() ? ps_malloc(size) : malloc(size));
+  if (glyph == nullptr) {
+    return nullptr;
+  }
+  glyph->font = _font;
+  glyph->codepoint = codepoint;
+  glyph->size = _size;
+  glyph->offsetX = minX - GLYPH_SCRATCH_MARGIN;
+  glyph->offsetY = minY - GLYPH_SCRATCH_MARGIN;
+  glyph->width = width;
+  glyph->height = height;
+  glyph->alpha = hasInk ? (uint8_t *)(glyph + 1) : nullptr;
+  for (uint16_t row = 0; row < height; row++) {
+    for (uint16_t col = 0; col < width; col++) {
+      uint8_t green = (_scratch.readPixel(minX + col, minY + row) >> 5) & 0x3F;
+      glyph->alpha[row * width + col] = (green << 2) | (green >> 4);
+    }
+  }
+
+  // The pen advance isn't exposed by OpenFontRender. Measuring the glyph between two bars gives
+  // it independent of the side bearings, also for glyphs without ink like the space. Over 64
+  // copies the whole pixels measured are the 26.6 advance of one, so strings don't drift by the
+  // fractions a single whole pixel advance loses.
+  char framed[GLYPH_ADVANCE_SAMPLES * 4 + 3];
+  char *end = framed;
+  *end++ = '|';
+  for (uint8_t i = 0; i < GLYPH_ADVANCE_SAMPLES; i++) {
+    memcpy(end, utf8, length);
+    end += length;
+  }
+  *end++ = '|';
+  *end = '\0';
+  glyph->advance = (_ofr->getTextWidth("%s", framed) - _ofr->getTextWidth("||")) *
+                   (64 / GLYPH_ADVANCE_SAMPLES);
+  return glyph;
+}
+
+// Open addressing with linear probing; returns the slot holding the glyph for the current font
+// and size or the empty slot it belongs in.
+uint16_t CachedFontRender::slotFor(uint32_t codepoint) {
+  uint16_t slot = homeSlot(_font, _size, codepoint);
+  while (_slots[slot] != nullptr) {
+    const Glyph *glyph = _slots[slot];
+    if (glyph->codepoint == codepoint && glyph->size == _size && glyph->font == _font) {
+      break;
+    }
+    slot = (slot + 1) & (GLYPH_CACHE_SLOTS - 1);
+  }
+  return slot;
+}
+
+uint16_t CachedFontRender::homeSlot(const unsigned char *font, uint8_t size, uint32_t codepoint) {
+  uint32_t hash = (codepoint * 2654435761u) ^ (size * 40503u) ^ (uint32_t)(uintptr_t)font;
+  return hash & (GLYPH_CACHE_SLOTS - 1);
+}
+
+size_t CachedFontRender::glyphBytes(const Glyph *glyph) {
+  return sizeof(Glyph) + glyph->width * glyph->height;
+}
+
+// Invalid sequences are taken byte by byte.
+uint32_t CachedFontRender::decodeUtf8(const char *text, uint8_t *length) {
+  uint8_t lead = text[0];
+  uint8_t extra = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+  uint32_t codepoint = extra == 0 ? lead : lead & (0x3F >> extra);
+  for (uint8_t i = 1; i <= extra; i++) {
+    uint8_t next = text[i];
+    if ((next & 0xC0) != 0x80) {
+      *length = 1;
+      return lead;
+    }
+    codepoint = (codepoint << 6) | (next & 0x3F);
+  }
+  *length = extra + 1;
+  return codepoint;
+}
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include <OpenFontRender.h>
+#include <TFT_eSPI.h>
+
+#include "RenderStats.h"
+
+// Number of hash table slots, must be a power of two. At most 3/4 of them are used.
+#define GLYPH_CACHE_SLOTS 512
+// The advance is measured over this many copies of a glyph, which gives it in 26.6 fixed point
+#define GLYPH_ADVANCE_SAMPLES 64
+// Glyphs are rasterized once into a square scratch sprite of this size, the margin leaves room
+// for ink left of and above the pen position
+#define GLYPH_SCRATCH_SIZE 96
+#define GLYPH_SCRATCH_MARGIN 16
+// Longer strings are handed to OpenFontRender directly
+#define GLYPH_MAX_STRING_LENGTH 48
+// Marks the pixels left out when blending onto the TFT; both bytes are equal so the byte order
+// doesn't matter
+#define GLYPH_TRANSPARENT_COLOR 0x0101
+
+/**
+ * Glyph cache layer around OpenFontRender. Each glyph is rasterized by FreeType only once per
+ * (font, size, codepoint) into an anti-aliased 8-bit alpha mask kept in PSRAM. Strings are then
+ * drawn by blending the cached masks with the font and background color. Mirrors the subset of
+ * the OpenFontRender API the UI uses.
+ *
+ * Strings are laid out with the 26.6 fixed point advances FreeType uses, so they come out as wide
+ * as OpenFontRender draws them. Once the budget or the slots are used up the glyphs used least
+ * recently are evicted.
+ */
+class CachedFontRender {
+public:
+  CachedFontRender(TFT_eSPI *tft, OpenFontRender *ofr);
+  ~CachedFontRender();
+  void loadFont(const unsigned char *data, size_t size);
+  void setBudget(size_t budgetBytes);
+  void setDrawer(TFT_eSPI &tft);
+  void setDrawer(TFT_eSprite &sprite);
+  void setFontSize(uint8_t size);
+  void setFontColor(uint16_t color);
+  void setBackgroundColor(uint16_t color);
+  // Same placement as OpenFontRender::drawString() and cdrawString()
+  void drawString(const char *text, int32_t x, int32_t y);
+  void cdrawString(const char *text, int32_t x, int32_t y);
+  void clear();
+  void logStats();
+
+  uint32_t hits() { return _hits; }
+  uint32_t misses() { return _misses; }
+  uint32_t evictions() { return _evictions; }
+  size_t usedBytes() { return _usedBytes; }
+
+private:
+  typedef struct Glyph {
+    const unsigned char *font;
+    uint32_t codepoint;
+    uint8_t size;
+    // ink box relative to the pen position and the top of the text
+    int16_t offsetX;
+    int16_t offsetY;
+    uint16_t width;
+    uint16_t height;
+    // in 26.6 fixed point
+    int32_t advance;
+    // _strings when the glyph was last drawn
+    uint32_t lastUsed;
+    // width * height coverage values, top-down; nullptr for glyphs without ink
+    uint8_t *alpha;
+  } Glyph;
+
+  TFT_eSPI *_tft;
+  TFT_eSprite *_sprite = nullptr;
+  TFT_eSprite _scratch;
+  OpenFontRender *_ofr;
+  const unsigned char *_font = nullptr;
+  uint8_t _size = 16;
+  uint16_t _fontColor = TFT_WHITE;
+  uint16_t _backgroundColor = TFT_BLACK;
+
+  Glyph *_slots[GLYPH_CACHE_SLOTS] = {};
+  uint16_t _count = 0;
+  size_t _budgetBytes = 0;
+  size_t _usedBytes = 0;
+  uint32_t _hits = 0;
+  uint32_t _misses = 0;
+  uint32_t _evictions = 0;
+  uint32_t _strings = 0;
+  uint32_t _uncachedStrings = 0;
+  uint64_t _renderMicros = 0;
+
+  void draw(const char *text, int32_t x, int32_t y, bool centered);
+  void drawUncached(const char *text, int32_t x, int32_t y, bool centered);
+  void blend(const Glyph *glyph, int32_t x, int32_t y);
+  const Glyph *lookup(uint32_t codepoint, const char *utf8, uint8_t length);
+  Glyph *rasterize(uint32_t codepoint, const char *utf8, uint8_t length);
+  bool evictLeastRecentlyUsed();
+  uint16_t slotFor(uint32_t codepoint);
+  uint16_t homeSlot(const unsigned char *font, uint8_t size, uint32_t codepoint);
+  static size_t glyphBytes(const Glyph *glyph);
+  static uint32_t decodeUtf8(const char *text, uint8_t *length);
+};
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+/**
+ * Hands snapshots of type T from exactly one writer task to exactly one reader task.
+ *
+ * The writer fills the slot returned by back() and publishes it. The reader acquires the most
+ * recently published slot, copies what it needs and releases it again. The reader never blocks;
+ * the writer waits in back() only while the reader still holds the slot it's about to overwrite.
+ */
+template <typename T> class DoubleBuffer {
+public:
+  // Writer: the slot that isn't published, safe to fill until publish() is called.
+  T &back() {
+    uint8_t slot = 1 - _published.load();
+    while (_reading.load() == slot) {
+      vTaskDelay(1);
+    }
+    return _slots[slot];
+  }
+
+  // Writer: makes the slot returned by back() the latest snapshot.
+  void publish() {
+    _published.store(1 - _published.load());
+    _sequence.fetch_add(1);
+  }
+
+  // Reader: returns the latest snapshot if it's newer than lastSequence (updated in that case)
+  // or nullptr. A non-null result must be handed back through release().
+  const T *acquire(uint32_t &lastSequence) {
+    uint32_t sequence = _sequence.load();
+    if (sequence == lastSequence) {
+      return nullptr;
+    }
+    uint8_t slot;
+    do {
+      slot = _published.load();
+      _reading.store(slot);
+      // the writer may have published (and started refilling) in between -> retry
+    } while (_published.load() != slot);
+    lastSequence = sequence;
+    return &_slots[slot];
+  }
+
+  // Reader: done with the snapshot returned by acquire().
+  void release() { _reading.store(-1); }
+
+private:
+  T _slots[2];
+  std::atomic<uint8_t> _published{0};
+  std::atomic<int8_t> _reading{-1};
+  std::atomic<uint32_t> _sequence{0};
+};
@@ -97,6 +97,23 @@ TS_Point FT6236::getPoint(uint8_t n)
     }
 }
 
+/* Get up to size touch points from one burst read */
+uint8_t FT6236::readTouches(TS_Point *points, uint8_t size)
+{
+    readData();
+    uint8_t n = min(touches, size);
+    for (uint8_t i = 0; i < n; i++)
+    {
+        points[i] = TS_Point(touchX[i], touchY[i], 1, _touch_width, _touch_height, _rotation);
+    }
+    return n;
+}
+
+void FT6236::setInterruptMode(uint8_t mode)
+{
+    writeRegister8(FT6236_REG_G_MODE, mode);
+}
+
 void FT6236::readData(void)
 {
 
@@ -152,19 +169,15 @@ void FT6236::writeRegister8(uint8_t reg, uint8_t val)
     Wire.endTransmission();
 }
 
-/* Debug */
+/* Debug, compiled out below the debug log level. Not while TouchInput polls, the I2C reads
+   would interleave. */
 void FT6236::debug(void)
 {
-    Serial.print("Vend ID: 0x");
-    Serial.println(readRegister8(FT6236_REG_VENDID), HEX);
-    Serial.print("Chip ID: 0x");
-    Serial.println(readRegister8(FT6236_REG_CHIPID), HEX);
-    Serial.print("Firm V: ");
-    Serial.println(readRegister8(FT6236_REG_FIRMVERS));
-    Serial.print("Point Rate Hz: ");
-    Serial.println(readRegister8(FT6236_REG_POINTRATE));
-    Serial.print("Thresh: ");
-    Serial.println(readRegister8(FT6236_REG_THRESHHOLD));
+    log_d("Vend ID: 0x%02x", readRegister8(FT6236_REG_VENDID));
+    log_d("Chip ID: 0x%02x", readRegister8(FT6236_REG_CHIPID));
+    log_d("Firm V: %d", readRegister8(FT6236_REG_FIRMVERS));
+    log_d("Point Rate Hz: %d", readRegister8(FT6236_REG_POINTRATE));
+    log_d("Thresh: %d", readRegister8(FT6236_REG_THRESHHOLD));
 }
 
 TS_Point::TS_Point(void) { x = y = z = 0; }
@@ -31,6 +31,7 @@
 #define FT6236_REG_FIRMVERS 0xA6    // Firmware version
 #define FT6236_REG_CHIPID 0xA3      // Chip selecting
 #define FT6236_REG_VENDID 0xA8      // FocalTech's panel ID
+#define FT6236_REG_G_MODE 0xA4      // Interrupt mode
 
 #define FT6236_VENDID 0x11  // FocalTech's panel ID
 #define FT5436_VENDID 0x79  // FocalTech's panel ID
@@ -41,6 +42,9 @@
 
 #define FT6236_DEFAULT_THRESHOLD 128 // Default threshold for touch detection
 
+#define FT6236_G_MODE_POLLING 0x00 // INT low as long as touched
+#define FT6236_G_MODE_TRIGGER 0x01 // INT pulse for every new report
+
 class TS_Point
 {
 public:
@@ -63,6 +67,9 @@ public:
   boolean begin(uint8_t thresh = FT6236_DEFAULT_THRESHOLD, int8_t sda = -1, int8_t scl = -1);
   uint8_t touched(void);
   TS_Point getPoint(uint8_t n = 0);
+  // Reads all touch points with a single I2C transaction, returns how many of them are valid
+  uint8_t readTouches(TS_Point *points, uint8_t size);
+  void setInterruptMode(uint8_t mode);
   // Helper functions to make the touch display aware
   void setRotation(uint8_t rotation);
 
@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "GestureRecognizer.h"
+
+GestureRecognizer::GestureRecognizer(const GestureConfig &config) {
+  _config = config;
+}
+
+void GestureRecognizer::feed(const TouchEvent &event) {
+  // whatever expired before this event comes first
+  advance(event.timeMillis);
+
+  switch (_state) {
+    case IDLE:
+    case TAPPED:
+      if (event.type == TOUCH_DOWN) {
+        if (event.points == 2) {
+          startPinch(event);
+        } else {
+          press(event);
+        }
+      }
+      break;
+    case PRESSED:
+      if (event.type == TOUCH_UP) {
+        release(event);
+      } else if (event.points == 2) {
+        startPinch(event);
+      } else if (abs(event.x - _startX) > _config.tapSlop ||
+                 abs(event.y - _startY) > _config.tapSlop) {
+        _moved = true;
+        // becomes a swipe, no double tap
+        emitFirstTap(event.timeMillis);
+      }
+      break;
+    case PINCHING:
+      if (event.points == 2) {
+        _pinchDistance = distance(event);
+      } else {
+        endPinch(event);
+        _state = event.type == TOUCH_UP ? IDLE : DONE;
+      }
+      break;
+    case DONE:
+      if (event.type == TOUCH_UP) {
+        _state = IDLE;
+      }
+      break;
+  }
+}
+
+void GestureRecognizer::advance(uint32_t nowMillis) {
+  if (_state == PRESSED && _secondTap && nowMillis - _startMillis > _config.tapMaxMillis) {
+    // held too long for a double tap, may still become a long press
+    emitFirstTap(_startMillis + _config.tapMaxMillis);
+  }
+  if (_state == PRESSED && !_moved && nowMillis - _startMillis >= _config.longPressMillis) {
+    emit(GESTURE_LONG_PRESS, _startX, _startY, _startMillis + _config.longPressMillis);
+    _state = DONE;
+  } else if (_state == TAPPED && nowMillis - _tapMillis > _config.doubleTapMillis) {
+    emit(GESTURE_TAP, _tapX, _tapY, _tapMillis + _config.doubleTapMillis);
+    _state = IDLE;
+  }
+}
+
+bool GestureRecognizer::next(Gesture &gesture) {
+  if (_gestureCount == 0) {
+    return false;
+  }
+  gesture = _gestures[_gestureHead];
+  _gestureHead = (_gestureHead + 1) % GESTURE_QUEUE_SIZE;
+  _gestureCount--;
+  return true;
+}
+
+void GestureRecognizer::press(const TouchEvent &event) {
+  // a second tap has to be close to the first one
+  _secondTap = _state == TAPPED && abs(event.x - _tapX) <= 2 * _config.tapSlop &&
+               abs(event.y - _tapY) <= 2 * _config.tapSlop;
+  if (_state == TAPPED && !_secondTap) {
+    // somewhere else, the first one was a tap of its own
+    emit(GESTURE_TAP, _tapX, _tapY, event.timeMillis);
+  }
+  _state = PRESSED;
+  _moved = false;
+  _startX = event.x;
+  _startY = event.y;
+  _startMillis = event.timeMillis;
+}
+
+void GestureRecognizer::release(const TouchEvent &event) {
+  _state = IDLE;
+  uint32_t duration = event.timeMillis - _startMillis;
+  if (!_moved && duration <= _config.tapMaxMillis) {
+    if (_secondTap) {
+      emit(GESTURE_DOUBLE_TAP, _tapX, _tapY, event.timeMillis);
+    } else {
+      _state = TAPPED;
+      _tapMillis = event.timeMillis;
+      _tapX = _startX;
+      _tapY = _startY;
+    }
+    return;
+  }
+
+  int16_t dx = event.x - _startX;
+  int16_t dy = event.y - _startY;
+  if (!_moved || duration > _config.swipeMaxMillis ||
+      max(abs(dx), abs(dy)) < _config.swipeMinDistance) {
+    return;
+  }
+  GestureType type;
+  if (abs(dx) >= abs(dy)) {
+    type = dx < 0 ? GESTURE_SWIPE_LEFT : GESTURE_SWIPE_RIGHT;
+  } else {
+    type = dy < 0 ? GESTURE_SWIPE_UP : GESTURE_SWIPE_DOWN;
+  }
+  Gesture &swipe = emit(type, _startX, _startY, event.timeMillis);
+  swipe.dx = dx;
+  swipe.dy = dy;
+}
+
+void GestureRecognizer::startPinch(const TouchEvent &event) {
+  if (_state == TAPPED) {
+    emit(GESTURE_TAP, _tapX, _tapY, event.timeMillis);
+  }
+  emitFirstTap(event.timeMillis);
+  _state = PINCHING;
+  _pinchStartDistance = distance(event);
+  _pinchDistance = _pinchStartDistance;
+  _startX = (event.x + event.x2) / 2;
+  _startY = (event.y + event.y2) / 2;
+}
+
+// Reported when the first finger goes up, the last distance of both fingers counts.
+void GestureRecognizer::endPinch(const TouchEvent &event) {
+  if (fabsf(_pinchDistance - _pinchStartDistance) < _config.pinchMinDelta ||
+      _pinchStartDistance == 0) {
+    return;
+  }
+  Gesture &pinch = emit(GESTURE_PINCH, _startX, _startY, event.timeMillis);
+  pinch.scale = _pinchDistance / _pinchStartDistance;
+}
+
+// A second contact that turns out not to be a double tap: the first one was a tap of its own and
+// the second goes on as a contact of its own.
+void GestureRecognizer::emitFirstTap(uint32_t timeMillis) {
+  if (_secondTap) {
+    emit(GESTURE_TAP, _tapX, _tapY, timeMillis);
+    _secondTap = false;
+  }
+}
+
+// The oldest gesture is dropped if nobody took them.
+Gesture &GestureRecognizer::emit(GestureType type, int16_t x, int16_t y, uint32_t timeMillis) {
+  if (_gestureCount == GESTURE_QUEUE_SIZE) {
+    _gestureHead = (_gestureHead + 1) % GESTURE_QUEUE_SIZE;
+    _gestureCount--;
+  }
+  Gesture &gesture = _gestures[(_gestureHead + _gestureCount) % GESTURE_QUEUE_SIZE];
+  gesture = {type, x, y, 0, 0, 1.0f, timeMillis};
+  _gestureCount++;
+  return gesture;
+}
+
+float GestureRecognizer::distance(const TouchEvent &event) {
+  return hypotf(event.x2 - event.x, event.y2 - event.y);
+}
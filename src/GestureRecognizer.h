@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "TouchInput.h"
+
+// recognized gestures waiting to be taken with next()
+#define GESTURE_QUEUE_SIZE 4
+
+typedef enum GestureType {
+  GESTURE_TAP,
+  GESTURE_DOUBLE_TAP,
+  GESTURE_LONG_PRESS,
+  GESTURE_SWIPE_LEFT,
+  GESTURE_SWIPE_RIGHT,
+  GESTURE_SWIPE_UP,
+  GESTURE_SWIPE_DOWN,
+  GESTURE_PINCH
+} GestureType;
+
+typedef struct Gesture {
+  GestureType type;
+  // where it started, the center between the fingers for pinches
+  int16_t x;
+  int16_t y;
+  // distance covered by swipes
+  int16_t dx;
+  int16_t dy;
+  // pinches: finger distance at the end / at the start, < 1 pinched in, > 1 spread out
+  float scale;
+  // when the gesture was certain, the latency budget counts from here
+  uint32_t timeMillis;
+} Gesture;
+
+// Distances in pixels, times in milliseconds
+typedef struct GestureConfig {
+  // movement still taken as holding still
+  uint16_t tapSlop = 12;
+  uint16_t tapMaxMillis = 250;
+  // max time between the end of the first and the start of the second tap
+  uint16_t doubleTapMillis = 250;
+  uint16_t longPressMillis = 600;
+  uint16_t swipeMinDistance = 60;
+  uint16_t swipeMaxMillis = 600;
+  // min change of the finger distance
+  uint16_t pinchMinDelta = 30;
+  // max time from timeMillis until the gesture is handled
+  uint16_t latencyBudgetMillis = 50;
+} GestureConfig;
+
+/**
+ * Turns touch events into gestures. A pure state machine: it only knows the time from the events
+ * and advance(), so it can be driven by recorded or synthetic traces as well.
+ *
+ * Taps are only reported once the double tap time has passed without a second tap, long presses
+ * while the finger is still down; call advance() regularly for both. A second contact that is
+ * held or moved reports the first tap and goes on as a long press or swipe of its own.
+ */
+class GestureRecognizer {
+public:
+  GestureRecognizer(const GestureConfig &config = GestureConfig());
+  void feed(const TouchEvent &event);
+  // Recognizes what depends on time passing without events.
+  void advance(uint32_t nowMillis);
+  // Takes the oldest recognized gesture, returns false if there is none.
+  bool next(Gesture &gesture);
+  const GestureConfig &config() { return _config; }
+
+private:
+  typedef enum State {
+    IDLE,
+    // one finger down, may become a tap, long press or swipe
+    PRESSED,
+    // a tap is done, waiting whether a second one follows
+    TAPPED,
+    // two fingers down
+    PINCHING,
+    // the gesture is over, waiting for all fingers to go up
+    DONE
+  } State;
+
+  GestureConfig _config;
+  State _state = IDLE;
+  bool _moved = false;
+  bool _secondTap = false;
+  int16_t _startX = 0;
+  int16_t _startY = 0;
+  uint32_t _startMillis = 0;
+  // end of the first tap
+  uint32_t _tapMillis = 0;
+  int16_t _tapX = 0;
+  int16_t _tapY = 0;
+  float _pinchStartDistance = 0;
+  float _pinchDistance = 0;
+
+  Gesture _gestures[GESTURE_QUEUE_SIZE];
+  uint8_t _gestureCount = 0;
+  uint8_t _gestureHead = 0;
+
+  void press(const TouchEvent &event);
+  void release(const TouchEvent &event);
+  void startPinch(const TouchEvent &event);
+  void endPinch(const TouchEvent &event);
+  void emitFirstTap(uint32_t timeMillis);
+  Gesture &emit(GestureType type, int16_t x, int16_t y, uint32_t timeMillis);
+  static float distance(const TouchEvent &event);
+};
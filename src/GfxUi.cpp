@@ -6,89 +6,171 @@
 #include "GfxUi.h"
 
 #define FS_TP_LOGO "/ThingPulse-logo-260.jpeg"
+#define FS_ICON_ATLAS "/icons.atlas"
 
-GfxUi::GfxUi(TFT_eSPI *tft, OpenFontRender *ofr) {
+GfxUi *GfxUi::_jpegTarget = nullptr;
+
+GfxUi::GfxUi(TFT_eSPI *tft, OpenFontRender *ofr, BlitPipeline *pipeline) {
   _tft = tft;
   _ofr = ofr;
+  _pipeline = pipeline;
+}
+
+void GfxUi::openIconAtlas() {
+  _atlas.begin(LittleFS, FS_ICON_ATLAS);
 }
 
-// Bodmer's streamlined x2 faster "no seek" version
-void GfxUi::drawBmp(String filename, uint16_t x, uint16_t y) {
+// Draws an icon pre-converted by scripts/convert_assets.py, in either of its formats. Raw RGB565
+// pixels are already in display byte order, top-down, so they can be streamed to the TFT without
+// any conversion. Palette icons are read in one go and expanded row by row into the block that
+// goes to the TFT. Icons come from the atlas if it has them, else from their own file.
+void GfxUi::drawIcon(String filename, uint16_t x, uint16_t y) {
 
   if ((x >= _tft->width()) || (y >= _tft->height()))
     return;
 
-  fs::File bmpFS;
+  uint32_t startMicros = micros();
+  if (drawCachedIcon(filename, x, y)) {
+    log_d("Drew cached %s in %luus", filename.c_str(), micros() - startMicros);
+    return;
+  }
+
+  size_t iconSize = 0;
+  fs::File iconFile;
+  fs::File *iconFS = _atlas.open(filename, &iconSize);
+  if (iconFS == nullptr) {
+    if (!LittleFS.exists(filename)) {
+      log_e(" File not found");
+      return;
+    }
+    iconFile = LittleFS.open(filename, "r");
+    iconSize = iconFile.size();
+    iconFS = &iconFile;
+  }
+  uint32_t magic = iconSize >= RAW565_HEADER_SIZE ? read32(*iconFS) : 0;
+  if (magic != RAW565_MAGIC && magic != PALETTE_RLE_MAGIC) {
+    log_e("Icon format of %s not recognized.", filename.c_str());
+    closeIcon(iconFS, iconFile);
+    return;
+  }
+  uint16_t w = read16(*iconFS);
+  uint16_t h = read16(*iconFS);
+  // a row of it goes onto the stack, and a block of at least one row into a pipeline buffer
+  if (w == 0 || h == 0 || w > _tft->width() || h > _tft->height()) {
+    log_e("Icon %s is %dx%d, empty or larger than the display.", filename.c_str(), w, h);
+    closeIcon(iconFS, iconFile);
+    return;
+  }
 
-  // Note: ESP32 passes "open" test even if file does not exist, whereas ESP8266
-  // returns NULL
-  if (!LittleFS.exists(filename)) {
-    log_e(" File not found");
+  // palette icons: the colors and all packets, consumed through next
+  uint16_t palette[PALETTE_RLE_MAX_COLORS];
+  uint16_t paletteSize = 0;
+  size_t headerSize = RAW565_HEADER_SIZE;
+  if (magic == PALETTE_RLE_MAGIC) {
+    paletteSize = read16(*iconFS);
+    if (paletteSize == 0 || paletteSize > PALETTE_RLE_MAX_COLORS) {
+      log_e("Palette icon %s has %d colors.", filename.c_str(), paletteSize);
+      closeIcon(iconFS, iconFile);
+      return;
+    }
+    headerSize = PALETTE_RLE_HEADER_SIZE + paletteSize * sizeof(uint16_t);
+  }
+  // the pixels of a raw icon must all be there, the packets of a palette icon take at least a byte
+  size_t minSize = magic == RAW565_MAGIC ? headerSize + w * h * sizeof(uint16_t) : headerSize + 1;
+  if (iconSize < minSize) {
+    log_e("Icon %s is truncated, %d of at least %d bytes.", filename.c_str(), iconSize, minSize);
+    closeIcon(iconFS, iconFile);
     return;
   }
 
-  // Open requested file
-  bmpFS = LittleFS.open(filename, "r");
-
-  uint32_t seekOffset;
-  uint16_t w, h, row;
-  uint8_t r, g, b;
-  bool oldSwap = false;
-
-  if (read16(bmpFS) == 0x4D42) {
-    read32(bmpFS);
-    read32(bmpFS);
-    seekOffset = read32(bmpFS);
-    read32(bmpFS);
-    w = read32(bmpFS);
-    h = read32(bmpFS);
-
-    if ((read16(bmpFS) == 1) && (read16(bmpFS) == 24) && (read32(bmpFS) == 0)) {
-      y += h - 1;
-
-      oldSwap = _tft->getSwapBytes();
-      _tft->setSwapBytes(true);
-      bmpFS.seek(seekOffset);
-
-      // Calculate padding to avoid seek
-      uint16_t padding = (4 - ((w * 3) & 3)) & 3;
-      uint8_t lineBuffer[w * 3 + padding];
-
-      for (row = 0; row < h; row++) {
-
-        bmpFS.read(lineBuffer, sizeof(lineBuffer));
-        uint8_t *bptr = lineBuffer;
-        uint16_t *tptr = (uint16_t *)lineBuffer;
-        // Convert 24 to 16 bit colours using the same line buffer for results
-        for (uint16_t col = 0; col < w; col++) {
-          b = *bptr++;
-          g = *bptr++;
-          r = *bptr++;
-          *tptr++ = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
-        }
+  uint8_t *packets = nullptr;
+  const uint8_t *next = nullptr, *end = nullptr;
+  if (magic == PALETTE_RLE_MAGIC) {
+    size_t packetsSize = iconSize - headerSize;
+    packets = (uint8_t *)(psramFound() ? ps_malloc(packetsSize) : malloc(packetsSize));
+    if (packets == nullptr ||
+        iconFS->read((uint8_t *)palette, paletteSize * sizeof(uint16_t)) !=
+            paletteSize * sizeof(uint16_t) ||
+        iconFS->read(packets, packetsSize) != packetsSize) {
+      log_e("Failed to read the palette icon %s.", filename.c_str());
+      free(packets);
+      closeIcon(iconFS, iconFile);
+      return;
+    }
+    next = packets;
+    end = packets + packetsSize;
+  }
+  uint32_t decodeMicros = micros() - startMicros;
+  uint16_t windows = 0;
 
-        // Push the pixel row to screen, pushImage will crop the line if needed
-        // y is decremented as the BMP image is drawn bottom up
-        _tft->pushImage(x, y--, w, 1, (uint16_t *)lineBuffer);
+  uint16_t lineBuffer[w];
+  // decoded as a whole only if the cache can keep it, else streamed block by block
+  uint16_t *image = psramFound() && _iconCache.fits(w, h)
+                        ? (uint16_t *)ps_malloc(w * h * sizeof(uint16_t))
+                        : nullptr;
+  uint16_t blockRows = image != nullptr || _pipeline->running() ? _pipeline->rowsPerBuffer(w)
+                                                                : 1;
+
+  bool complete = true;
+  for (uint16_t row = 0; row < h; row += blockRows) {
+    uint16_t rows = min((uint16_t)(h - row), blockRows);
+    uint16_t *block = nextBlock(image, row, w, lineBuffer);
+    uint32_t blockStartMicros = micros();
+    size_t blockSize = rows * w * sizeof(uint16_t);
+    if (magic == RAW565_MAGIC) {
+      complete = iconFS->read((uint8_t *)block, blockSize) == blockSize;
+    } else {
+      complete = expandPaletteRows(next, end, palette, paletteSize, w, rows, block);
+    }
+    decodeMicros += micros() - blockStartMicros;
+    if (!complete) {
+      log_e("Icon %s is truncated.", filename.c_str());
+      if (image == nullptr && block != lineBuffer) {
+        _pipeline->discard(block);
       }
-    } else
-      log_e("BMP format not recognized.");
+      break;
+    }
+    _pipeline->push(x, y + row, w, rows, block, false);
+    countPixelsPushed(w * rows);
+    windows++;
   }
-  _tft->setSwapBytes(oldSwap);
-  bmpFS.close();
+
+  // Streamed blocks go back to the pipeline by themselves, the caller flushes once per frame. A
+  // whole image is still being sent from, and putting it into the cache may evict an icon that is
+  // queued too.
+  if (image != nullptr) {
+    _pipeline->flush();
+    cacheOrFree(filename, image, w, h, complete);
+  }
+  free(packets);
+  closeIcon(iconFS, iconFile);
+  log_d("Drew %s icon %s in %luus (%luus reading and decoding), %d address windows",
+        magic == RAW565_MAGIC ? "RGB565" : "palette", filename.c_str(), micros() - startMicros,
+        decodeMicros, windows);
 }
 
+// Only the first call decodes the JPEG, afterwards the logo goes out from memory in a single
+// address window.
 void GfxUi::drawLogo() {
-  if (LittleFS.exists(FS_TP_LOGO)) {
-    uint16_t w = 0, h = 0;
-    TJpgDec.getFsJpgSize(&w, &h, FS_TP_LOGO, LittleFS);
-    TJpgDec.drawFsJpg((_tft->width() - w) / 2, 30, FS_TP_LOGO, LittleFS);
+  if (_logo.pixels == nullptr && !decodeLogo()) {
+    return;
   }
+  _pipeline->flush();
+  uint32_t startMicros = micros();
+  bool oldSwap = _tft->getSwapBytes();
+  // TJpgDec delivers the colors with the bytes in the order pushImage() swaps
+  _tft->setSwapBytes(true);
+  _tft->pushImage((_tft->width() - _logo.width) / 2, LOGO_Y, _logo.width, _logo.height,
+                  _logo.pixels);
+  countPixelsPushed(_logo.width * _logo.height);
+  _tft->setSwapBytes(oldSwap);
+  log_d("Pushed the logo in %luus", micros() - startMicros);
 }
 
 void GfxUi::drawProgressBar(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h,
                             uint8_t percentage, uint16_t frameColor,
                             uint16_t barColor) {
+  _pipeline->flush();
   if (percentage == 0) {
     _tft->fillRoundRect(x0, y0, w, h, 3, TFT_BLACK);
   }
@@ -96,12 +178,187 @@ void GfxUi::drawProgressBar(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h,
   uint16_t barHeight = h - 2 * margin;
   uint16_t barWidth = w - 2 * margin;
   _tft->drawRoundRect(x0, y0, w, h, 3, frameColor);
-  _tft->fillRect(x0 + margin, y0 + margin, barWidth * percentage / 100.0,
-                 barHeight, barColor);
+  uint16_t filledWidth = barWidth * percentage / 100.0;
+  _tft->fillRect(x0 + margin, y0 + margin, filledWidth, barHeight, barColor);
+  countPixelsPushed(filledWidth * barHeight);
+}
+
+void GfxUi::setIconCacheBudget(size_t budgetBytes) {
+  _iconCache.setBudget(budgetBytes);
+}
+
+void GfxUi::logIconCacheStats() {
+  _iconCache.logStats();
+}
+
+// Reads the JPEG in one go and decodes it into _logo, scaled down by TJpgDec if it's wider than
+// the display. Returns false if there is no memory for the decoded logo, it's then decoded onto
+// the display block by block.
+bool GfxUi::decodeLogo() {
+  if (!LittleFS.exists(FS_TP_LOGO)) {
+    log_e("File not found: %s", FS_TP_LOGO);
+    return false;
+  }
+  uint32_t startMicros = micros();
+  fs::File file = LittleFS.open(FS_TP_LOGO, "r");
+  size_t size = file.size();
+  uint8_t *jpeg = (uint8_t *)(psramFound() ? ps_malloc(size) : malloc(size));
+  if (jpeg == nullptr) {
+    log_e("Not enough memory to read %s.", FS_TP_LOGO);
+    file.close();
+    return false;
+  }
+  file.read(jpeg, size);
+  file.close();
+
+  uint16_t w = 0, h = 0;
+  TJpgDec.getJpgSize(&w, &h, jpeg, size);
+  uint8_t scale = 1;
+  while (w / scale > _tft->width() && scale < 8) {
+    scale *= 2;
+  }
+  _logo.width = (w + scale - 1) / scale;
+  _logo.height = (h + scale - 1) / scale;
+  size_t pixelBytes = _logo.width * _logo.height * sizeof(uint16_t);
+  _logo.pixels = (uint16_t *)(psramFound() ? ps_malloc(pixelBytes) : malloc(pixelBytes));
+  if (_logo.pixels == nullptr) {
+    log_w("Not enough memory to keep the logo, decoding it onto the display.");
+  }
+
+  _jpegTarget = this;
+  TJpgDec.setJpgScale(scale);
+  TJpgDec.setCallback(jpegBlockEntry);
+  if (_logo.pixels != nullptr) {
+    TJpgDec.drawJpg(0, 0, jpeg, size);
+  } else {
+    TJpgDec.drawJpg((_tft->width() - _logo.width) / 2, LOGO_Y, jpeg, size);
+    // the callback may have queued blocks
+    _pipeline->flush();
+  }
+  free(jpeg);
+  log_i("Decoded the %dx%d logo at 1/%d scale in %luus", _logo.width, _logo.height, scale,
+        micros() - startMicros);
+  return _logo.pixels != nullptr;
+}
+
+// Called by TJpgDec for each decoded block. Copies it into the logo or, without one, pushes it.
+bool GfxUi::drawJpegBlock(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *bitmap) {
+  if (_logo.pixels != nullptr) {
+    // the blocks along the right and bottom edge may reach beyond the image
+    uint16_t columns = min(w, (uint16_t)(_logo.width - x));
+    uint16_t rows = min(h, (uint16_t)(_logo.height - y));
+    for (uint16_t row = 0; row < rows; row++) {
+      memcpy(_logo.pixels + (y + row) * _logo.width + x, bitmap + row * w,
+             columns * sizeof(uint16_t));
+    }
+    return true;
+  }
+
+  // stop decoding, the image is running off the bottom of the screen
+  if (y >= _tft->height()) {
+    return false;
+  }
+  // The decoder reuses the bitmap for the next block, a copy goes to the pipeline.
+  if (_pipeline->running() && w * h <= BLIT_PIPELINE_BUFFER_PIXELS) {
+    uint16_t *block = _pipeline->buffer();
+    memcpy(block, bitmap, w * h * sizeof(uint16_t));
+    // TJpgDec delivers the colors with the bytes in the order pushImage() swaps
+    _pipeline->push(x, y, w, h, block, true);
+  } else {
+    _pipeline->flush();
+    _tft->pushImage(x, y, w, h, bitmap);
+  }
+  countPixelsPushed(w * h);
+  return true;
+}
+
+bool GfxUi::jpegBlockEntry(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *bitmap) {
+  return _jpegTarget->drawJpegBlock(x, y, w, h, bitmap);
+}
+
+// Pushes the icon straight from the cache if it's there, no file system access needed then. The
+// cache only evicts when drawIcon() puts an icon into it, after a flush.
+bool GfxUi::drawCachedIcon(const String &filename, uint16_t x, uint16_t y) {
+  const IconCache::Icon *icon = _iconCache.get(filename);
+  if (icon == nullptr) {
+    return false;
+  }
+  // queued like the decoded icons, nothing leaves the cache before the next flush
+  _pipeline->push(x, y, icon->width, icon->height, icon->pixels, false);
+  countPixelsPushed(icon->width * icon->height);
+  return true;
+}
+
+// Closes the icon's own file, or hands the atlas back if the icon came from there.
+void GfxUi::closeIcon(fs::File *iconFS, fs::File &iconFile) {
+  if (iconFS != &iconFile) {
+    _atlas.close();
+  } else if (iconFile) {
+    iconFile.close();
+  }
+}
+
+// Hands a completely decoded image over to the icon cache. Frees the buffer if it only holds a
+// block of the image or if the cache doesn't take it.
+void GfxUi::cacheOrFree(const String &filename, uint16_t *pixels, uint16_t w, uint16_t h,
+                        bool wholeImage) {
+  if (!wholeImage || !_iconCache.put(filename, pixels, w, h)) {
+    free(pixels);
+  }
+}
+
+// Expands the packets of the next rows of a palette icon into pixels, see
+// scripts/convert_assets.py for the format. Returns false on data that runs short or doesn't fit
+// the icon.
+bool GfxUi::expandPaletteRows(const uint8_t *&next, const uint8_t *end, const uint16_t *palette,
+                              uint16_t paletteSize, uint16_t w, uint16_t rows, uint16_t *pixels) {
+  for (uint16_t row = 0; row < rows; row++) {
+    uint16_t *out = pixels + row * w;
+    uint16_t *rowEnd = out + w;
+    while (out < rowEnd) {
+      if (next >= end) {
+        return false;
+      }
+      uint8_t control = *next++;
+      uint16_t count = (control & 0x7F) + 1;
+      if (count > rowEnd - out) {
+        return false;
+      }
+      if (control & 0x80) {
+        if (next >= end || *next >= paletteSize) {
+          return false;
+        }
+        uint16_t color = palette[*next++];
+        for (uint16_t i = 0; i < count; i++) {
+          *out++ = color;
+        }
+      } else {
+        if (count > end - next) {
+          return false;
+        }
+        for (uint16_t i = 0; i < count; i++, next++) {
+          if (*next >= paletteSize) {
+            return false;
+          }
+          *out++ = palette[*next];
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// Where the block of an image starting at row goes: into the image if it's decoded as a whole, else
+// into a pipeline buffer. The line buffer is the last resort, one row at a time.
+uint16_t *GfxUi::nextBlock(uint16_t *image, uint16_t row, uint16_t w, uint16_t *lineBuffer) {
+  if (image != nullptr) {
+    return image + row * w;
+  }
+  return _pipeline->running() ? _pipeline->buffer() : lineBuffer;
 }
 
-// These read 16- and 32-bit types from the SD card file.
-// BMP data is stored little-endian, Arduino is little-endian too.
+// These read 16- and 32-bit types from the icon file.
+// Icon headers are stored little-endian, Arduino is little-endian too.
 // May need to reverse subscript order if porting elsewhere.
 
 uint16_t GfxUi::read16(fs::File &f) {
@@ -10,26 +10,59 @@
 #include <OpenFontRender.h>
 #include <TFT_eSPI.h>
 
+#include "BlitPipeline.h"
+#include "IconAtlas.h"
+#include "IconCache.h"
+#include "RenderStats.h"
+
 // JPEG decoder library
 #include <TJpg_Decoder.h>
 
-// Maximum of 85 for BUFFPIXEL as 3 x this value is stored in an 8 bit variable!
-// 32 is an efficient size for LittleFS due to SPI hardware pipeline buffer size
-// A larger value of 80 is better for SD cards
-#define BUFFPIXEL 32
+// top of the logo on the boot screen
+#define LOGO_Y 30
+
+// "R565" and "PRLE" read as little-endian uint32, first field of the two icon formats created by
+// scripts/convert_assets.py
+#define RAW565_MAGIC 0x35363552
+#define PALETTE_RLE_MAGIC 0x454C5250
+#define PALETTE_RLE_MAX_COLORS 256
+// magic, width and height; palette icons add the palette size and the colors
+#define RAW565_HEADER_SIZE 8
+#define PALETTE_RLE_HEADER_SIZE 10
 
 class GfxUi {
 public:
-  GfxUi(TFT_eSPI *tft, OpenFontRender *render);
-  void drawBmp(String filename, uint16_t x, uint16_t y);
+  GfxUi(TFT_eSPI *tft, OpenFontRender *render, BlitPipeline *pipeline);
+  void drawIcon(String filename, uint16_t x, uint16_t y);
   void drawLogo();
   void drawProgressBar(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
                        uint8_t percentage, uint16_t frameColor,
                        uint16_t barColor);
+  // Opens the icon atlas, if there is one, once the file system is mounted.
+  void openIconAtlas();
+  void setIconCacheBudget(size_t budgetBytes);
+  void logIconCacheStats();
 
 private:
   TFT_eSPI *_tft;
   OpenFontRender *_ofr;
+  BlitPipeline *_pipeline;
+  IconAtlas _atlas;
+  IconCache _iconCache;
+  // decoded once, in the byte order TJpgDec delivers
+  IconCache::Icon _logo = {0, 0, nullptr};
+  // the instance decoding a JPEG, TJpgDec only takes a plain function as callback
+  static GfxUi *_jpegTarget;
+  bool decodeLogo();
+  bool drawJpegBlock(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
+  static bool jpegBlockEntry(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
+  bool drawCachedIcon(const String &filename, uint16_t x, uint16_t y);
+  void closeIcon(fs::File *iconFS, fs::File &iconFile);
+  void cacheOrFree(const String &filename, uint16_t *pixels, uint16_t w, uint16_t h,
+                   bool wholeImage);
+  bool expandPaletteRows(const uint8_t *&next, const uint8_t *end, const uint16_t *palette,
+                         uint16_t paletteSize, uint16_t w, uint16_t rows, uint16_t *pixels);
+  uint16_t *nextBlock(uint16_t *image, uint16_t row, uint16_t w, uint16_t *lineBuffer);
   uint16_t read16(fs::File &f);
   uint32_t read32(fs::File &f);
 };
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "IconAtlas.h"
+
+IconAtlas::~IconAtlas() {
+  free(_entries);
+  if (_file) {
+    _file.close();
+  }
+  if (_lock != nullptr) {
+    vSemaphoreDelete(_lock);
+  }
+}
+
+bool IconAtlas::begin(fs::FS &fs, const char *path) {
+  uint32_t startMicros = micros();
+  if (!fs.exists(path)) {
+    log_w("No icon atlas %s, reading the icons from separate files.", path);
+    return false;
+  }
+  _file = fs.open(path, "r");
+  size_t fileSize = _file.size();
+  uint32_t header[2];
+  if (_file.read((uint8_t *)header, sizeof(header)) != sizeof(header) ||
+      header[0] != ICON_ATLAS_MAGIC) {
+    log_e("Icon atlas %s not recognized, upload the file system of this firmware.", path);
+    return abandon();
+  }
+  // the count comes from the file, the index must fit into it
+  if (header[1] > (fileSize - sizeof(header)) / sizeof(Entry)) {
+    log_e("The index of the icon atlas %s is truncated.", path);
+    return abandon();
+  }
+  size_t indexSize = header[1] * sizeof(Entry);
+  _entries = (Entry *)malloc(indexSize);
+  if (_entries == nullptr || _file.read((uint8_t *)_entries, indexSize) != indexSize) {
+    log_e("Failed to read the index of the icon atlas %s.", path);
+    return abandon();
+  }
+  size_t recordsStart = sizeof(header) + indexSize;
+  for (uint32_t i = 0; i < header[1]; i++) {
+    const Entry &entry = _entries[i];
+    if (entry.offset < recordsStart || entry.offset > fileSize ||
+        entry.size > fileSize - entry.offset) {
+      log_e("An icon of the atlas %s lies outside of it.", path);
+      return abandon();
+    }
+  }
+  _lock = xSemaphoreCreateMutex();
+  if (_lock == nullptr) {
+    log_e("Not enough memory to open the icon atlas %s.", path);
+    return abandon();
+  }
+  _count = header[1];
+  log_i("Opened the icon atlas %s with %d icons in %luus", path, _count, micros() - startMicros);
+  return true;
+}
+
+fs::File *IconAtlas::open(const String &path, size_t *size) {
+  const Entry *entry = find(hash(path.c_str()));
+  if (entry == nullptr) {
+    return nullptr;
+  }
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  // the hash only narrows it down, the path in front of the icon decides
+  char name[ICON_ATLAS_MAX_PATH_SIZE];
+  size_t length = path.length() + 1;
+  if (length > sizeof(name) || length > entry->size || !_file.seek(entry->offset) ||
+      _file.read((uint8_t *)name, length) != length || memcmp(name, path.c_str(), length) != 0) {
+    xSemaphoreGive(_lock);
+    return nullptr;
+  }
+  *size = entry->size - length;
+  return &_file;
+}
+
+void IconAtlas::close() {
+  xSemaphoreGive(_lock);
+}
+
+// Drops what begin() got so far, the atlas isn't used.
+bool IconAtlas::abandon() {
+  free(_entries);
+  _entries = nullptr;
+  _file.close();
+  return false;
+}
+
+const IconAtlas::Entry *IconAtlas::find(uint32_t key) {
+  int32_t low = 0;
+  int32_t high = (int32_t)_count - 1;
+  while (low <= high) {
+    int32_t middle = (low + high) / 2;
+    const Entry &entry = _entries[middle];
+    if (entry.hash == key) {
+      return &entry;
+    }
+    if (entry.hash < key) {
+      low = middle + 1;
+    } else {
+      high = middle - 1;
+    }
+  }
+  return nullptr;
+}
+
+// FNV-1a, the build fails on collisions between icon paths
+uint32_t IconAtlas::hash(const char *path) {
+  uint32_t hash = 2166136261u;
+  for (const char *c = path; *c != '\0'; c++) {
+    hash = (hash ^ (uint8_t)*c) * 16777619u;
+  }
+  return hash;
+}
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+
+// "ATL2" read as little-endian uint32, first field of the atlas created by
+// scripts/convert_assets.py
+#define ICON_ATLAS_MAGIC 0x324C5441
+// longest icon path stored in the atlas, including the terminating null
+#define ICON_ATLAS_MAX_PATH_SIZE 64
+
+/**
+ * All icons packed into a single file by scripts/convert_assets.py, so drawing one doesn't cost a
+ * LittleFS directory lookup and open. The file is opened once and kept open, its index is held in
+ * memory: finding an icon is a binary search over the FNV-1a hashes of the paths plus a seek. The
+ * path stored with the icon confirms the match.
+ *
+ * Atlas format (all values little-endian):
+ *   offset 0: magic "ATL2"
+ *   offset 4: uint32 number of icons n
+ *   offset 8: n index entries sorted by hash: uint32 FNV-1a of the icon path (e.g.
+ *             "/moon/m-phase-0.icon"), uint32 offset of the icon record in the atlas, uint32 size
+ *             of the record
+ *   then the icon records: the null-terminated path followed by the icon file as it is
+ */
+class IconAtlas {
+public:
+  ~IconAtlas();
+  // Returns false if there is no atlas or it's damaged, icons are then expected as separate files.
+  bool begin(fs::FS &fs, const char *path);
+  // Positions the atlas file at the start of the icon and returns it, nullptr if the icon isn't
+  // part of the atlas. The file stays owned by the atlas, it's locked for the caller until
+  // close() though.
+  fs::File *open(const String &path, size_t *size);
+  // Hands the file returned by open() back.
+  void close();
+  uint16_t count() { return _count; }
+
+private:
+  typedef struct Entry {
+    uint32_t hash;
+    uint32_t offset;
+    uint32_t size;
+  } Entry;
+
+  fs::File _file;
+  // the tasks drawing icons share the file and its position
+  SemaphoreHandle_t _lock = nullptr;
+  Entry *_entries = nullptr;
+  uint32_t _count = 0;
+
+  bool abandon();
+  const Entry *find(uint32_t key);
+  static uint32_t hash(const char *path);
+};
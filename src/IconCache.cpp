@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "IconCache.h"
+
+IconCache::IconCache(size_t budgetBytes) {
+  _budgetBytes = budgetBytes;
+}
+
+IconCache::~IconCache() {
+  clear();
+}
+
+void IconCache::setBudget(size_t budgetBytes) {
+  _budgetBytes = budgetBytes;
+  while (_count > 0 && _usedBytes > _budgetBytes) {
+    evictLeastRecentlyUsed();
+  }
+}
+
+const IconCache::Icon *IconCache::get(const String &key) {
+  for (uint8_t i = 0; i < _count; i++) {
+    if (_entries[i].key == key) {
+      _entries[i].lastUsed = ++_tick;
+      _hits++;
+      return &_entries[i].icon;
+    }
+  }
+  _misses++;
+  return nullptr;
+}
+
+bool IconCache::fits(uint16_t width, uint16_t height) {
+  return (size_t)width * height * sizeof(uint16_t) <= _budgetBytes;
+}
+
+bool IconCache::put(const String &key, uint16_t *pixels, uint16_t width, uint16_t height) {
+  size_t size = width * height * sizeof(uint16_t);
+  if (!fits(width, height)) {
+    return false;
+  }
+  while (_count > 0 && (_count == ICON_CACHE_MAX_ENTRIES || _usedBytes + size > _budgetBytes)) {
+    evictLeastRecentlyUsed();
+  }
+
+  Entry &entry = _entries[_count++];
+  entry.key = key;
+  entry.icon = {width, height, pixels};
+  entry.lastUsed = ++_tick;
+  _usedBytes += size;
+  return true;
+}
+
+void IconCache::clear() {
+  while (_count > 0) {
+    remove(_count - 1);
+  }
+}
+
+void IconCache::logStats() {
+  log_i("Icon cache: %d icons, %d/%d bytes, %d hits, %d misses, %d evictions", _count, _usedBytes,
+        _budgetBytes, _hits, _misses, _evictions);
+}
+
+void IconCache::evictLeastRecentlyUsed() {
+  uint8_t lru = 0;
+  for (uint8_t i = 1; i < _count; i++) {
+    if (_entries[i].lastUsed < _entries[lru].lastUsed) {
+      lru = i;
+    }
+  }
+  log_d("Evicting %s from icon cache.", _entries[lru].key.c_str());
+  remove(lru);
+  _evictions++;
+}
+
+void IconCache::remove(uint8_t index) {
+  Entry &entry = _entries[index];
+  _usedBytes -= entry.icon.width * entry.icon.height * sizeof(uint16_t);
+  free(entry.icon.pixels);
+  // keep the entries compact by moving the last one into the freed slot
+  _count--;
+  if (index != _count) {
+    _entries[index] = _entries[_count];
+  }
+  _entries[_count].key = "";
+  _entries[_count].icon.pixels = nullptr;
+}
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+
+// Upper bound for the number of icons held at the same time, independent of the byte budget
+#define ICON_CACHE_MAX_ENTRIES 16
+
+/**
+ * Bounded LRU cache of decoded RGB565 icons keyed by their asset path. The pixel buffers are
+ * expected to live in PSRAM. Once the byte budget or the number of entries is exhausted the least
+ * recently used icons are evicted.
+ */
+class IconCache {
+public:
+  typedef struct Icon {
+    uint16_t width;
+    uint16_t height;
+    // RGB565 pixels in display byte order, top-down
+    uint16_t *pixels;
+  } Icon;
+
+  IconCache(size_t budgetBytes = 0);
+  ~IconCache();
+  void setBudget(size_t budgetBytes);
+  // Returns nullptr on a cache miss.
+  const Icon *get(const String &key);
+  // Whether put() can take an icon of this size at all, so callers only decode into a buffer of
+  // their own if it can be kept.
+  bool fits(uint16_t width, uint16_t height);
+  // Takes ownership of pixels (allocated with malloc/ps_malloc) if it returns true.
+  bool put(const String &key, uint16_t *pixels, uint16_t width, uint16_t height);
+  void clear();
+  void logStats();
+
+  uint32_t hits() { return _hits; }
+  uint32_t misses() { return _misses; }
+  uint32_t evictions() { return _evictions; }
+  size_t usedBytes() { return _usedBytes; }
+
+private:
+  typedef struct Entry {
+    String key;
+    Icon icon;
+    uint32_t lastUsed;
+  } Entry;
+
+  Entry _entries[ICON_CACHE_MAX_ENTRIES];
+  uint8_t _count = 0;
+  size_t _budgetBytes;
+  size_t _usedBytes = 0;
+  uint32_t _tick = 0;
+  uint32_t _hits = 0;
+  uint32_t _misses = 0;
+  uint32_t _evictions = 0;
+
+  void evictLeastRecentlyUsed();
+  void remove(uint8_t index);
+};
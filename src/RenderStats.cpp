@@ -0,0 +1,12 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "RenderStats.h"
+
+RenderStats renderStats = {0, 0};
+
+RenderStats takeRenderStats() {
+  RenderStats stats = renderStats;
+  renderStats = {0, 0};
+  return stats;
+}
@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Counts what the draw path sends to the display: pixels and address windows. Every address
+ * window is a separate SPI transaction, so the two numbers tell what a repaint costs regardless of
+ * how fast the pixels were rendered. Drawing into sprites isn't counted, pushing them is.
+ */
+typedef struct RenderStats {
+  uint32_t pixels;
+  uint32_t windows;
+} RenderStats;
+
+extern RenderStats renderStats;
+
+inline void countPixelsPushed(uint32_t pixels, uint32_t windows = 1) {
+  renderStats.pixels += pixels;
+  renderStats.windows += windows;
+}
+
+// Returns the counters accumulated since the previous call and starts over.
+RenderStats takeRenderStats();
@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+/**
+ * Lock-free FIFO of up to N - 1 items of type T from exactly one producer task to exactly one
+ * consumer task. Neither side ever blocks: push() fails if the ring is full, pop() if it's empty.
+ * N must be a power of two.
+ */
+template <typename T, uint16_t N> class SpscRing {
+  static_assert((N & (N - 1)) == 0, "N must be a power of two");
+
+public:
+  // Producer: appends the item, returns false (and drops it) if the ring is full.
+  bool push(const T &item) {
+    uint16_t head = _head.load(std::memory_order_relaxed);
+    uint16_t next = (head + 1) & (N - 1);
+    if (next == _tail.load(std::memory_order_acquire)) {
+      return false;
+    }
+    _items[head] = item;
+    _head.store(next, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer: takes the oldest item, returns false if there is none.
+  bool pop(T &item) {
+    uint16_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire)) {
+      return false;
+    }
+    item = _items[tail];
+    _tail.store((tail + 1) & (N - 1), std::memory_order_release);
+    return true;
+  }
+
+private:
+  T _items[N];
+  // next slot to write, only changed by the producer
+  std::atomic<uint16_t> _head{0};
+  // next slot to read, only changed by the consumer
+  std::atomic<uint16_t> _tail{0};
+};
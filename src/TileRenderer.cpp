@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "TileRenderer.h"
+
+TileRenderer::TileRenderer(TFT_eSPI *tft) : _frame(tft) {
+  _tft = tft;
+}
+
+TileRenderer::~TileRenderer() {
+  free(_hashes);
+}
+
+bool TileRenderer::begin() {
+  if (_hashes != nullptr) {
+    return true;
+  }
+  uint16_t columns = (_tft->width() + TILE_SIZE - 1) / TILE_SIZE;
+  uint16_t rows = (_tft->height() + TILE_SIZE - 1) / TILE_SIZE;
+  if (_frame.createSprite(_tft->width(), _tft->height()) == nullptr) {
+    return false;
+  }
+  _hashes = (uint32_t *)malloc(columns * rows * sizeof(uint32_t));
+  if (_hashes == nullptr) {
+    _frame.deleteSprite();
+    return false;
+  }
+  _columns = columns;
+  _rows = rows;
+  _valid = false;
+  return true;
+}
+
+TileStats TileRenderer::push() {
+  TileStats stats = {0, 0};
+  for (uint16_t row = 0; row < _rows; row++) {
+    int32_t y = row * TILE_SIZE;
+    int32_t h = min((int32_t)TILE_SIZE, _frame.height() - y);
+    // start of the run of changed tiles not pushed yet, -1 if there is none
+    int32_t runStart = -1;
+    for (uint16_t column = 0; column <= _columns; column++) {
+      bool changed = false;
+      if (column < _columns) {
+        uint32_t hash = hashTile(column, row);
+        uint32_t &known = _hashes[row * _columns + column];
+        changed = !_valid || hash != known;
+        known = hash;
+        if (changed) stats.pushed++;
+        else stats.skipped++;
+      }
+      if (changed && runStart < 0) {
+        runStart = column * TILE_SIZE;
+      } else if (!changed && runStart >= 0) {
+        int32_t w = min((int32_t)(column * TILE_SIZE), (int32_t)_frame.width()) - runStart;
+        _frame.pushSprite(runStart, y, runStart, y, w, h);
+        countPixelsPushed(w * h);
+        runStart = -1;
+      }
+    }
+  }
+  _valid = _hashes != nullptr;
+  return stats;
+}
+
+void TileRenderer::assume() {
+  for (uint16_t row = 0; row < _rows; row++) {
+    for (uint16_t column = 0; column < _columns; column++) {
+      _hashes[row * _columns + column] = hashTile(column, row);
+    }
+  }
+  _valid = _hashes != nullptr;
+}
+
+void TileRenderer::invalidate() {
+  _valid = false;
+}
+
+// FNV-1a over the 16-bit pixels of the tile
+uint32_t TileRenderer::hashTile(uint16_t column, uint16_t row) {
+  const uint16_t *pixels = (const uint16_t *)_frame.getPointer();
+  int32_t width = _frame.width();
+  int32_t x0 = column * TILE_SIZE;
+  int32_t y0 = row * TILE_SIZE;
+  int32_t x1 = min(x0 + TILE_SIZE, width);
+  int32_t y1 = min(y0 + TILE_SIZE, (int32_t)_frame.height());
+  uint32_t hash = 2166136261u;
+  for (int32_t y = y0; y < y1; y++) {
+    const uint16_t *pixel = pixels + y * width + x0;
+    for (int32_t x = x0; x < x1; x++, pixel++) {
+      hash = (hash ^ *pixel) * 16777619u;
+    }
+  }
+  return hash;
+}
@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#include "RenderStats.h"
+
+// edge length of the square tiles the screen is split into
+#define TILE_SIZE 32
+
+typedef struct TileStats {
+  uint16_t pushed;
+  uint16_t skipped;
+} TileStats;
+
+/**
+ * A full screen shadow framebuffer (a 16-bit sprite, in PSRAM if there is any) the pages next to
+ * the dashboard are rendered into. push() sends it tile by tile and skips the tiles whose pixels
+ * hash the same as what was pushed there last. Adjacent changed tiles of a tile row go out with a
+ * single address window.
+ *
+ * The dashboard doesn't go through it: its widgets skip unchanged inputs and the clock sends only
+ * the cells that changed, the icons are streamed through the blit pipeline.
+ */
+class TileRenderer {
+public:
+  TileRenderer(TFT_eSPI *tft);
+  ~TileRenderer();
+  // Creates the shadow framebuffer as large as the screen, once.
+  bool begin();
+  // Draw calls render into this, nothing reaches the display before push().
+  TFT_eSprite &frame() { return _frame; }
+  // Sends the tiles of frame() that changed since the last push().
+  TileStats push();
+  // Records frame() as being on screen without pushing it, e.g. after it was wiped in.
+  void assume();
+  // Something else drew on the screen, the next push() sends every tile.
+  void invalidate();
+
+private:
+  TFT_eSPI *_tft;
+  TFT_eSprite _frame;
+  uint16_t _columns = 0;
+  uint16_t _rows = 0;
+  // per tile, row by row; only meaningful if _valid
+  uint32_t *_hashes = nullptr;
+  bool _valid = false;
+
+  uint32_t hashTile(uint16_t column, uint16_t row);
+};
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "TouchInput.h"
+
+TouchInput::TouchInput(FT6236 *ts) {
+  _ts = ts;
+}
+
+void TouchInput::begin(int8_t interruptPin) {
+  _interruptPin = interruptPin;
+  if (_interruptPin >= 0) {
+    // one INT pulse per new report instead of INT held low while touched
+    _ts->setInterruptMode(FT6236_G_MODE_TRIGGER);
+    pinMode(_interruptPin, INPUT_PULLUP);
+  }
+  // above loop() so events are timestamped when they happen, not when the UI gets to them
+  xTaskCreatePinnedToCore(taskEntry, "touch", TOUCH_TASK_STACK_SIZE, this, 2, &_task, 1);
+  if (_interruptPin >= 0) {
+    attachInterruptArg(_interruptPin, onInterrupt, this, FALLING);
+    log_i("Touch events on INT pin %d.", _interruptPin);
+  } else {
+    log_i("No touch INT pin, polling every %dms.", TOUCH_POLL_INTERVAL_MILLIS);
+  }
+}
+
+bool TouchInput::poll(TouchEvent &event) {
+  return _events.pop(event);
+}
+
+void TouchInput::run() {
+  while (true) {
+    if (_interruptPin < 0) {
+      vTaskDelay(pdMS_TO_TICKS(TOUCH_POLL_INTERVAL_MILLIS));
+    } else {
+      // only wake up without an interrupt to notice a release the panel didn't report
+      ulTaskNotifyTake(pdTRUE, _points > 0 ? pdMS_TO_TICKS(TOUCH_RELEASE_TIMEOUT_MILLIS)
+                                        : portMAX_DELAY);
+    }
+    update();
+  }
+}
+
+void TouchInput::update() {
+  TS_Point touches[2];
+  uint8_t points = _ts->readTouches(touches, 2);
+  if (points > 0) {
+    bool changed = points != _points;
+    for (uint8_t i = 0; i < points; i++) {
+      changed |= touches[i] != _touches[i];
+      _touches[i] = touches[i];
+    }
+    if (_points == 0) {
+      push(TOUCH_DOWN, points);
+    } else if (changed) {
+      push(TOUCH_MOVE, points);
+    }
+  } else if (_points > 0) {
+    push(TOUCH_UP, 0);
+  }
+  _points = points;
+}
+
+void TouchInput::push(TouchEventType type, uint8_t points) {
+  TouchEvent event = {};
+  event.type = type;
+  event.points = points;
+  event.x = _touches[0].x;
+  event.y = _touches[0].y;
+  if (points == 2) {
+    event.x2 = _touches[1].x;
+    event.y2 = _touches[1].y;
+  }
+  event.timeMillis = millis();
+  if (!_events.push(event)) {
+    _droppedEvents++;
+  }
+}
+
+void TouchInput::taskEntry(void *parameter) {
+  ((TouchInput *)parameter)->run();
+}
+
+void IRAM_ATTR TouchInput::onInterrupt(void *parameter) {
+  BaseType_t higherPriorityTaskWoken = pdFALSE;
+  vTaskNotifyGiveFromISR(((TouchInput *)parameter)->_task, &higherPriorityTaskWoken);
+  portYIELD_FROM_ISR(higherPriorityTaskWoken);
+}
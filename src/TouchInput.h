@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "FT6236.h"
+#include "SpscRing.h"
+
+// must be a power of two, holds one less event
+#define TOUCH_EVENT_QUEUE_SIZE 32
+#define TOUCH_TASK_STACK_SIZE 3072
+// How often the touch task reads the panel without an INT line
+#define TOUCH_POLL_INTERVAL_MILLIS 20
+// With an INT line: while touched the panel reports at ~60-100 Hz, no report within this time
+// means the finger was lifted without an interrupt for it
+#define TOUCH_RELEASE_TIMEOUT_MILLIS 40
+
+typedef enum TouchEventType {
+  TOUCH_DOWN,
+  TOUCH_MOVE,
+  TOUCH_UP
+} TouchEventType;
+
+typedef struct TouchEvent {
+  TouchEventType type;
+  // number of touch points, 1 or 2; 0 for TOUCH_UP
+  uint8_t points;
+  // display coordinates of the first point, for TOUCH_UP those of the last TOUCH_DOWN/MOVE
+  int16_t x;
+  int16_t y;
+  // the second point if there is one
+  int16_t x2;
+  int16_t y2;
+  uint32_t timeMillis;
+} TouchEvent;
+
+/**
+ * Reads the touch panel in a task of its own and queues what happened as down/move/up events,
+ * TOUCH_MOVE also when a second finger comes or goes. The task sleeps until the panel's INT line
+ * fires and then fetches all touch registers with a single I2C burst read. Without an INT line it
+ * polls at a fixed rate.
+ *
+ * Exactly one task (the UI in loop()) may consume the events.
+ */
+class TouchInput {
+public:
+  TouchInput(FT6236 *ts);
+  // Starts the touch task, interruptPin is the GPIO of the INT line or -1 to poll.
+  void begin(int8_t interruptPin);
+  // Takes the oldest event, returns false if there is none.
+  bool poll(TouchEvent &event);
+  uint32_t droppedEvents() { return _droppedEvents; }
+
+private:
+  FT6236 *_ts;
+  int8_t _interruptPin = -1;
+  TaskHandle_t _task = nullptr;
+  SpscRing<TouchEvent, TOUCH_EVENT_QUEUE_SIZE> _events;
+  // what the last event reported
+  uint8_t _points = 0;
+  TS_Point _touches[2];
+  volatile uint32_t _droppedEvents = 0;
+
+  void run();
+  void update();
+  void push(TouchEventType type, uint8_t points);
+  static void taskEntry(void *parameter);
+  static void IRAM_ATTR onInterrupt(void *parameter);
+};
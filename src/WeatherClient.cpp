@@ -0,0 +1,381 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <JsonStreamingParser.h>
+
+#include "WeatherClient.h"
+
+#define OPEN_WEATHER_MAP_URL "http://api.openweathermap.org/data/2.5/"
+// the response buffer grows in steps of this size if the Content-Length isn't known
+#define WEATHER_BODY_CHUNK_SIZE 4096
+#define WEATHER_READ_TIMEOUT_MILLIS 10000
+
+WeatherClient::WeatherClient(bool metric, const String &language) {
+  _metric = metric;
+  _language = language;
+}
+
+FetchResult WeatherClient::updateCurrentById(CurrentWeatherData *data, const String &appId,
+                                             const String &locationId) {
+  memset(data, 0, sizeof(CurrentWeatherData));
+  _current = data;
+  FetchResult result = fetch("weather", appId, locationId, _currentCache);
+  _current = nullptr;
+
+  if (result == FETCH_UPDATED) {
+    _lastCurrent = *data;
+  } else if (_currentCache.valid) {
+    *data = _lastCurrent;
+  } else {
+    // nothing but what a failed parse left behind
+    memset(data, 0, sizeof(CurrentWeatherData));
+  }
+  return result;
+}
+
+FetchResult WeatherClient::updateForecastsById(ForecastStore *forecasts, const String &appId,
+                                               const String &locationId) {
+  FetchResult result = FETCH_UNCHANGED;
+  if (isForecastDue()) {
+    memset(forecasts, 0, sizeof(ForecastStore));
+    _forecasts = forecasts;
+    result = fetch("forecast", appId, locationId, _forecastCache);
+    _forecasts = nullptr;
+  } else {
+    log_i("Forecast fetched %lus ago is still current.",
+          (millis() - _forecastCache.fetchedAtMillis) / 1000);
+  }
+
+  if (result == FETCH_UPDATED) {
+    _lastForecasts = *forecasts;
+  } else if (_forecastCache.valid) {
+    *forecasts = _lastForecasts;
+  } else {
+    memset(forecasts, 0, sizeof(ForecastStore));
+  }
+  return result;
+}
+
+void WeatherClient::setAllowedHours(const uint8_t *hours, uint8_t count) {
+  _allowedHours = hours;
+  _allowedHoursCount = count;
+}
+
+void WeatherClient::setForecastInterval(uint32_t intervalMillis) {
+  _forecastIntervalMillis = intervalMillis;
+}
+
+// Nothing can have changed upstream while the server says the response is fresh, or within the
+// forecast interval as long as the first forecast hasn't passed (after that OWM drops it).
+bool WeatherClient::isForecastDue() {
+  if (!_forecastCache.valid || _lastForecasts.count == 0) {
+    return true;
+  }
+  uint32_t age = millis() - _forecastCache.fetchedAtMillis;
+  if (age < _forecastCache.maxAgeMillis) {
+    return false;
+  }
+  return age >= _forecastIntervalMillis || time(nullptr) >= _lastForecasts.observationTime[0];
+}
+
+FetchResult WeatherClient::fetch(const String &path, const String &appId,
+                                 const String &locationId, ResponseCache &cache) {
+  uint32_t startMillis = millis();
+  String url = OPEN_WEATHER_MAP_URL + path + "?id=" + locationId + "&appid=" + appId +
+               "&units=" + (_metric ? "metric" : "imperial") + "&lang=" + _language;
+
+  HTTPClient http;
+  http.begin(url);
+  const char *headerKeys[] = {"ETag", "Last-Modified", "Cache-Control"};
+  http.collectHeaders(headerKeys, 3);
+  if (cache.valid && cache.etag[0] != '\0') {
+    http.addHeader("If-None-Match", cache.etag);
+  }
+  if (cache.valid && cache.lastModified[0] != '\0') {
+    http.addHeader("If-Modified-Since", cache.lastModified);
+  }
+
+  int httpCode = http.GET();
+  if (httpCode == HTTP_CODE_NOT_MODIFIED) {
+    http.end();
+    cache.fetchedAtMillis = millis();
+    log_i("%s not modified, checked in %lums.", path.c_str(), millis() - startMillis);
+    return FETCH_UNCHANGED;
+  }
+  if (httpCode != HTTP_CODE_OK) {
+    log_e("Failed to fetch %s: %d %s", path.c_str(), httpCode,
+          HTTPClient::errorToString(httpCode).c_str());
+    http.end();
+    return FETCH_FAILED;
+  }
+
+  // the validators only go into the cache along with a complete payload, a conditional request
+  // for one that couldn't be read would keep the last result until the payload changes
+  ResponseCache received = {};
+  strlcpy(received.etag, http.header("ETag").c_str(), sizeof(received.etag));
+  strlcpy(received.lastModified, http.header("Last-Modified").c_str(),
+          sizeof(received.lastModified));
+  String cacheControl = http.header("Cache-Control");
+  int maxAgeIndex = cacheControl.indexOf("max-age=");
+  received.maxAgeMillis =
+      maxAgeIndex < 0 ? 0 : cacheControl.substring(maxAgeIndex + 8).toInt() * 1000;
+
+  size_t length = 0;
+  char *body = readBody(http, &length);
+  http.end();
+  if (body == nullptr) {
+    log_e("Failed to read %s.", path.c_str());
+    return FETCH_FAILED;
+  }
+  uint32_t downloadMillis = millis() - startMillis;
+  received.fetchedAtMillis = millis();
+
+  // FNV-1a
+  received.hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    received.hash = (received.hash ^ (uint8_t)body[i]) * 16777619u;
+  }
+  received.valid = true;
+  if (cache.valid && received.hash == cache.hash) {
+    free(body);
+    cache = received;
+    log_i("%s (%d bytes) unchanged, downloaded in %lums.", path.c_str(), length, downloadMillis);
+    return FETCH_UNCHANGED;
+  }
+
+  _documentEnded = false;
+  JsonStreamingParser parser;
+  parser.setListener(this);
+  for (size_t i = 0; i < length; i++) {
+    parser.parse(body[i]);
+  }
+  free(body);
+  if (!_documentEnded) {
+    log_e("Incomplete %s (%d bytes).", path.c_str(), length);
+    return FETCH_FAILED;
+  }
+  cache = received;
+
+  log_i("Fetched %s (%d bytes) in %lums, parsed in %lums.", path.c_str(), length, downloadMillis,
+        millis() - cache.fetchedAtMillis);
+  return FETCH_UPDATED;
+}
+
+// Reads the whole response into a buffer (in PSRAM if available) that the caller has to free.
+// Returns nullptr if it's empty or shorter than its Content-Length, e.g. after a timeout.
+char *WeatherClient::readBody(HTTPClient &http, size_t *length) {
+  int size = http.getSize();
+  size_t capacity = size > 0 ? size : WEATHER_BODY_CHUNK_SIZE;
+  char *body = (char *)(psramFound() ? ps_malloc(capacity) : malloc(capacity));
+  if (body == nullptr) {
+    return nullptr;
+  }
+
+  WiFiClient *stream = http.getStreamPtr();
+  uint32_t lastDataMillis = millis();
+  *length = 0;
+  while ((size < 0 || *length < (size_t)size) && (stream->connected() || stream->available()) &&
+         millis() - lastDataMillis < WEATHER_READ_TIMEOUT_MILLIS) {
+    size_t available = stream->available();
+    if (available == 0) {
+      delay(1);
+      continue;
+    }
+    if (*length == capacity) {
+      // no or wrong Content-Length
+      capacity += WEATHER_BODY_CHUNK_SIZE;
+      char *grown = (char *)(psramFound() ? ps_realloc(body, capacity) : realloc(body, capacity));
+      if (grown == nullptr) {
+        free(body);
+        return nullptr;
+      }
+      body = grown;
+    }
+    *length += stream->read((uint8_t *)body + *length, min(available, capacity - *length));
+    lastDataMillis = millis();
+  }
+  if (*length == 0 || (size > 0 && *length != (size_t)size)) {
+    log_e("Read %d of %d bytes.", *length, size);
+    free(body);
+    return nullptr;
+  }
+  return body;
+}
+
+void WeatherClient::whitespace(char c) {}
+
+void WeatherClient::startDocument() {
+  _depth = 0;
+  _key = KEY_OTHER;
+}
+
+void WeatherClient::key(String key) {
+  _key = toJsonKey(key);
+}
+
+void WeatherClient::value(String value) {
+  JsonKey parentKey = parent();
+
+  if (_current != nullptr) {
+    CurrentWeatherData *current = _current;
+    if (parentKey == KEY_COORD) {
+      if (_key == KEY_LAT) current->lat = value.toFloat();
+      if (_key == KEY_LON) current->lon = value.toFloat();
+    } else if (parentKey == KEY_WEATHER) {
+      if (_weatherIndex > 0) return;
+      if (_key == KEY_ID) current->weatherId = value.toInt();
+      if (_key == KEY_DESCRIPTION) {
+        strlcpy(current->description, value.c_str(), sizeof(current->description));
+      }
+    } else if (parentKey == KEY_MAIN) {
+      if (_key == KEY_TEMP) current->temp = value.toFloat();
+      if (_key == KEY_FEELS_LIKE) current->feelsLike = value.toFloat();
+      if (_key == KEY_PRESSURE) current->pressure = value.toInt();
+      if (_key == KEY_HUMIDITY) current->humidity = value.toInt();
+    } else if (parentKey == KEY_WIND) {
+      if (_key == KEY_SPEED) current->windSpeed = value.toFloat();
+      if (_key == KEY_DEG) current->windDeg = value.toFloat();
+    } else if (parentKey == KEY_SYS) {
+      if (_key == KEY_SUNRISE) current->sunrise = value.toInt();
+      if (_key == KEY_SUNSET) current->sunset = value.toInt();
+    } else if (_depth == 1) {
+      if (_key == KEY_DT) current->observationTime = value.toInt();
+      if (_key == KEY_NAME) strlcpy(current->cityName, value.c_str(), sizeof(current->cityName));
+    }
+  } else if (_forecasts != nullptr && _forecasts->count < NUMBER_OF_FORECASTS) {
+    uint8_t slot = _forecasts->count;
+    if (parentKey == KEY_LIST && _key == KEY_DT) {
+      _forecasts->observationTime[slot] = value.toInt();
+      _forecastAllowed = isHourAllowed(_forecasts->observationTime[slot]);
+    } else if (parentKey == KEY_MAIN && parent(1) == KEY_LIST && _key == KEY_TEMP) {
+      _forecasts->tempCenti[slot] = toCentiDegrees(value.toFloat());
+    } else if (parentKey == KEY_WIND && parent(1) == KEY_LIST && _key == KEY_SPEED) {
+      _forecasts->windSpeedCenti[slot] = toCentiUnits(value.toFloat());
+    } else if ((parentKey == KEY_RAIN || parentKey == KEY_SNOW) && parent(1) == KEY_LIST &&
+               _key == KEY_3H) {
+      _forecasts->precipitationCenti[slot] += toCentiUnits(value.toFloat());
+    } else if (parentKey == KEY_WEATHER && parent(2) == KEY_LIST && _key == KEY_ID &&
+               _weatherIndex == 0) {
+      _forecasts->weatherId[slot] = value.toInt();
+    }
+  }
+}
+
+void WeatherClient::endArray() {
+  if (_depth > 0) _depth--;
+}
+
+void WeatherClient::endObject() {
+  if (_depth == 0) {
+    return;
+  }
+  JsonKey key = parent();
+  _depth--;
+  if (key == KEY_WEATHER) {
+    _weatherIndex++;
+  } else if (key == KEY_LIST && _depth == 2 && _forecasts != nullptr) {
+    // end of a forecast in the "list" array, keep it by moving on to the next slot
+    if (_forecastAllowed && _forecasts->count < NUMBER_OF_FORECASTS) {
+      _forecasts->count++;
+    }
+  }
+}
+
+void WeatherClient::endDocument() {
+  _documentEnded = true;
+}
+
+void WeatherClient::startArray() {
+  push(true);
+  if (parent() == KEY_WEATHER) {
+    _weatherIndex = 0;
+  }
+}
+
+void WeatherClient::startObject() {
+  push(false);
+  if (parent() == KEY_LIST && _depth == 3 && _forecasts != nullptr &&
+      _forecasts->count < NUMBER_OF_FORECASTS) {
+    // the slot may still hold a forecast of a skipped hour
+    uint8_t slot = _forecasts->count;
+    _forecasts->observationTime[slot] = 0;
+    _forecasts->tempCenti[slot] = 0;
+    _forecasts->weatherId[slot] = 0;
+    _forecasts->windSpeedCenti[slot] = 0;
+    _forecasts->precipitationCenti[slot] = 0;
+    _forecastAllowed = false;
+  }
+}
+
+// Array elements inherit the key of their array, everything else is named by the last key.
+void WeatherClient::push(bool isArray) {
+  JsonKey key = _key;
+  if (_depth > 0 && _containers[min(_depth, (uint8_t)WEATHER_JSON_MAX_DEPTH) - 1].isArray) {
+    key = parent();
+  }
+  if (_depth < WEATHER_JSON_MAX_DEPTH) {
+    _containers[_depth] = {key, isArray};
+  }
+  _depth++;
+  _key = KEY_OTHER;
+}
+
+// Key of the container being parsed (level 0) or of one of its ancestors.
+WeatherClient::JsonKey WeatherClient::parent(uint8_t level) {
+  if (_depth <= level || _depth > WEATHER_JSON_MAX_DEPTH) {
+    return KEY_OTHER;
+  }
+  return _containers[_depth - 1 - level].key;
+}
+
+bool WeatherClient::isHourAllowed(uint32_t time) {
+  if (_allowedHoursCount == 0) {
+    return true;
+  }
+  time_t observationTime = time;
+  struct tm timeInfo;
+  gmtime_r(&observationTime, &timeInfo);
+  for (uint8_t i = 0; i < _allowedHoursCount; i++) {
+    if (_allowedHours[i] == timeInfo.tm_hour) {
+      return true;
+    }
+  }
+  return false;
+}
+
+WeatherClient::JsonKey WeatherClient::toJsonKey(const String &key) {
+  static const struct {
+    const char *name;
+    JsonKey key;
+  } keys[] = {
+      {"coord", KEY_COORD},
+      {"lat", KEY_LAT},
+      {"lon", KEY_LON},
+      {"weather", KEY_WEATHER},
+      {"id", KEY_ID},
+      {"description", KEY_DESCRIPTION},
+      {"main", KEY_MAIN},
+      {"temp", KEY_TEMP},
+      {"feels_like", KEY_FEELS_LIKE},
+      {"pressure", KEY_PRESSURE},
+      {"humidity", KEY_HUMIDITY},
+      {"wind", KEY_WIND},
+      {"speed", KEY_SPEED},
+      {"deg", KEY_DEG},
+      {"sys", KEY_SYS},
+      {"sunrise", KEY_SUNRISE},
+      {"sunset", KEY_SUNSET},
+      {"dt", KEY_DT},
+      {"name", KEY_NAME},
+      {"list", KEY_LIST},
+      {"rain", KEY_RAIN},
+      {"snow", KEY_SNOW},
+      {"3h", KEY_3H},
+  };
+  for (const auto &entry : keys) {
+    if (key == entry.name) {
+      return entry.key;
+    }
+  }
+  return KEY_OTHER;
+}
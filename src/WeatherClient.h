@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <JsonListener.h>
+
+// including the terminating null; longer values are truncated
+#define WEATHER_DESCRIPTION_SIZE 48
+#define CITY_NAME_SIZE 32
+// nesting of the OpenWeatherMap responses, deeper levels are ignored
+#define WEATHER_JSON_MAX_DEPTH 6
+// 5 day / 3 hour forecast data => 8 forecasts/day => 40 total
+#define NUMBER_OF_FORECASTS 40
+// sizes of the cache validators kept per endpoint, including the terminating null
+#define ETAG_SIZE 64
+#define LAST_MODIFIED_SIZE 32
+
+// The fields of the OpenWeatherMap current weather this app uses. Plain data, no heap allocations.
+typedef struct CurrentWeatherData {
+  float lat;
+  float lon;
+  float temp;
+  float feelsLike;
+  float windSpeed;
+  float windDeg;
+  uint16_t weatherId;
+  uint16_t pressure;
+  uint8_t humidity;
+  // UTC epoch seconds
+  uint32_t observationTime;
+  uint32_t sunrise;
+  uint32_t sunset;
+  char description[WEATHER_DESCRIPTION_SIZE];
+  char cityName[CITY_NAME_SIZE];
+} CurrentWeatherData;
+
+// The OpenWeatherMap 5 day / 3 hour forecast as structure of arrays, 12 bytes per forecast.
+// Time, temp and condition alone would take 8, but the hourly forecast page shows wind speed and
+// precipitation of each forecast too; those 4 bytes x 40 forecasts are cheaper than a second
+// download for the page.
+typedef struct ForecastStore {
+  uint8_t count;
+  // UTC epoch seconds
+  uint32_t observationTime[NUMBER_OF_FORECASTS];
+  // 1/100 degrees of the configured unit system
+  int16_t tempCenti[NUMBER_OF_FORECASTS];
+  uint16_t weatherId[NUMBER_OF_FORECASTS];
+  // 1/100 m/s or mph
+  uint16_t windSpeedCenti[NUMBER_OF_FORECASTS];
+  // rain and snow of the 3 hours in 1/100 mm
+  uint16_t precipitationCenti[NUMBER_OF_FORECASTS];
+} ForecastStore;
+
+inline int16_t toCentiDegrees(float temp) {
+  return (int16_t)lroundf(temp * 100);
+}
+
+inline uint16_t toCentiUnits(float value) {
+  return (uint16_t)constrain(lroundf(value * 100), 0, UINT16_MAX);
+}
+
+inline float forecastTemp(const ForecastStore &forecasts, uint8_t index) {
+  return forecasts.tempCenti[index] / 100.0f;
+}
+
+typedef enum FetchResult {
+  FETCH_FAILED,
+  // downloaded and parsed
+  FETCH_UPDATED,
+  // not downloaded or the same payload as last time, the previous result was returned
+  FETCH_UNCHANGED
+} FetchResult;
+
+/**
+ * Fetches the OpenWeatherMap current weather and forecast. Only the fields the app uses are kept,
+ * they are written straight into the fixed-size records above instead of the String-laden structs
+ * of the ESP8266 Weather Station library.
+ *
+ * The client remembers the last result of each endpoint and how fresh it is: cache validators
+ * (ETag, Last-Modified) are sent along for conditional requests, a payload identical to the
+ * previous one isn't parsed again and the forecast, which changes every 3 hours upstream, is only
+ * downloaded again when it's due.
+ */
+class WeatherClient : public JsonListener {
+public:
+  WeatherClient(bool metric, const String &language);
+  FetchResult updateCurrentById(CurrentWeatherData *data, const String &appId,
+                                const String &locationId);
+  // Stores at most NUMBER_OF_FORECASTS.
+  FetchResult updateForecastsById(ForecastStore *forecasts, const String &appId,
+                                  const String &locationId);
+  // Only keep the forecasts for these UTC hours, all of them if not set.
+  void setAllowedHours(const uint8_t *hours, uint8_t count);
+  // The forecast isn't downloaded again within this interval unless its first entry has passed.
+  void setForecastInterval(uint32_t intervalMillis);
+  bool isForecastDue();
+
+  void whitespace(char c) override;
+  void startDocument() override;
+  void key(String key) override;
+  void value(String value) override;
+  void endArray() override;
+  void endObject() override;
+  void endDocument() override;
+  void startArray() override;
+  void startObject() override;
+
+private:
+  // The keys of interest, everything else is KEY_OTHER
+  typedef enum JsonKey {
+    KEY_OTHER,
+    KEY_COORD,
+    KEY_LAT,
+    KEY_LON,
+    KEY_WEATHER,
+    KEY_ID,
+    KEY_DESCRIPTION,
+    KEY_MAIN,
+    KEY_TEMP,
+    KEY_FEELS_LIKE,
+    KEY_PRESSURE,
+    KEY_HUMIDITY,
+    KEY_WIND,
+    KEY_SPEED,
+    KEY_DEG,
+    KEY_SYS,
+    KEY_SUNRISE,
+    KEY_SUNSET,
+    KEY_DT,
+    KEY_NAME,
+    KEY_LIST,
+    KEY_RAIN,
+    KEY_SNOW,
+    KEY_3H
+  } JsonKey;
+
+  // Containers are named after the key they are the value of, array elements after the array.
+  typedef struct Container {
+    JsonKey key;
+    bool isArray;
+  } Container;
+
+  // What is known about the last response of an endpoint
+  typedef struct ResponseCache {
+    bool valid;
+    char etag[ETAG_SIZE];
+    char lastModified[LAST_MODIFIED_SIZE];
+    // FNV-1a of the payload
+    uint32_t hash;
+    uint32_t fetchedAtMillis;
+    // Cache-Control max-age, 0 if not sent
+    uint32_t maxAgeMillis;
+  } ResponseCache;
+
+  bool _metric;
+  String _language;
+  const uint8_t *_allowedHours = nullptr;
+  uint8_t _allowedHoursCount = 0;
+  uint32_t _forecastIntervalMillis = 0;
+
+  ResponseCache _currentCache = {};
+  ResponseCache _forecastCache = {};
+  CurrentWeatherData _lastCurrent;
+  ForecastStore _lastForecasts;
+
+  CurrentWeatherData *_current = nullptr;
+  // the forecast being parsed goes to the slot after the last stored one
+  ForecastStore *_forecasts = nullptr;
+  bool _forecastAllowed = false;
+
+  Container _containers[WEATHER_JSON_MAX_DEPTH];
+  uint8_t _depth = 0;
+  JsonKey _key = KEY_OTHER;
+  // index of the element in the "weather" array being parsed, only the first one counts
+  uint8_t _weatherIndex = 0;
+  // whether the parser got to the end of the top-level value, a truncated payload doesn't
+  bool _documentEnded = false;
+
+  FetchResult fetch(const String &path, const String &appId, const String &locationId,
+                    ResponseCache &cache);
+  char *readBody(HTTPClient &http, size_t *length);
+  void push(bool isArray);
+  JsonKey parent(uint8_t level = 0);
+  bool isHourAllowed(uint32_t time);
+  static JsonKey toJsonKey(const String &key);
+};
@@ -3,16 +3,240 @@
 
 #pragma once
 
+#include <LittleFS.h>
 #include <WiFi.h>
 
 #include "settings.h"
 
-void startWiFi() {
-  WiFi.begin(SSID, WIFI_PWD);
+#define WIFI_CACHE_FILE "/wifi-cache.bin"
+// "TPWF" read as little-endian uint32
+#define WIFI_CACHE_MAGIC 0x46575054
+#define WIFI_CACHE_VERSION 2
+// epoch seconds below this mean the clock hasn't been set since power up (2023-01-01)
+#define WIFI_MIN_VALID_EPOCH 1672531200
+
+// What is needed to skip the scan and DHCP on the next connect. Written as is, it never leaves
+// this device.
+typedef struct WiFiCache {
+  uint32_t magic;
+  uint16_t version;
+  // the network the entry belongs to, a changed SSID invalidates it
+  char ssid[33];
+  uint8_t bssid[6];
+  int32_t channel;
+  // the last DHCP lease, all 0 with a static IP config
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+  // UTC epoch seconds the lease was obtained at, 0 if the time wasn't known then
+  uint32_t leaseStart;
+} WiFiCache;
+
+typedef enum WiFiConnectState {
+  // to the cached access point, with the cached lease if it's still valid
+  WIFI_FAST_CONNECT,
+  // scan for the access point and ask for a new lease
+  WIFI_SCAN_CONNECT,
+  WIFI_BACKOFF,
+  WIFI_CONNECTED,
+  WIFI_GAVE_UP
+} WiFiConnectState;
+
+typedef struct WiFiStats {
+  uint32_t connects;
+  uint32_t fastConnects;
+  uint32_t failedAttempts;
+  uint32_t lastConnectMillis;
+  uint32_t maxConnectMillis;
+  uint32_t totalConnectMillis;
+} WiFiStats;
+
+WiFiStats wifiStats = {};
+// whether the connection uses the cached lease rather than one the DHCP client keeps renewing
+bool wifiLeaseReused = false;
+
+bool loadWiFiCache(WiFiCache *cache) {
+  File file = LittleFS.open(WIFI_CACHE_FILE, "r");
+  if (!file) {
+    return false;
+  }
+  bool valid = file.read((uint8_t *)cache, sizeof(WiFiCache)) == sizeof(WiFiCache) &&
+               cache->magic == WIFI_CACHE_MAGIC && cache->version == WIFI_CACHE_VERSION &&
+               strncmp(cache->ssid, SSID, sizeof(cache->ssid)) == 0;
+  file.close();
+  return valid;
+}
+
+// Only writes to flash if something changed, the entry is the same on most connects.
+void saveWiFiCache(const WiFiCache *cache) {
+  WiFiCache saved;
+  if (loadWiFiCache(&saved) && memcmp(&saved, cache, sizeof(WiFiCache)) == 0) {
+    return;
+  }
+  File file = LittleFS.open(WIFI_CACHE_FILE, "w");
+  if (!file || file.write((const uint8_t *)cache, sizeof(WiFiCache)) != sizeof(WiFiCache)) {
+    log_e("Failed to write %s.", WIFI_CACHE_FILE);
+  }
+  file.close();
+}
+
+// Whether the cached lease can be used without asking the DHCP server. Not if the time it was
+// obtained or the current time is unknown, nor if less than WIFI_LEASE_MARGIN_MINUTES of it are
+// left.
+bool isLeaseValid(const WiFiCache *cache) {
+  time_t now = time(nullptr);
+  return cache->ip != 0 && cache->leaseStart >= WIFI_MIN_VALID_EPOCH &&
+         now >= WIFI_MIN_VALID_EPOCH && now >= cache->leaseStart &&
+         now - cache->leaseStart < (WIFI_DHCP_LEASE_MINUTES - WIFI_LEASE_MARGIN_MINUTES) * 60;
+}
+
+// A reused lease is applied as a static IP config, nothing renews it while the connection lasts.
+// Once it has run out the router may hand the address to another client: the connection has to be
+// dropped and made again through DHCP before that.
+bool isReusedLeaseExpiring() {
+  WiFiCache cache;
+  return wifiLeaseReused && WiFi.status() == WL_CONNECTED && loadWiFiCache(&cache) &&
+         !isLeaseValid(&cache);
+}
+
+// Static IP from settings.h if configured, else the cached lease if given and still valid, else
+// DHCP. Reusing the lease relies on the router handing the same address to the same MAC again, as
+// most do; define WIFI_STATIC_IP if yours doesn't. See isReusedLeaseExpiring() for its end.
+void configureIp(const WiFiCache *cache) {
+#ifdef WIFI_STATIC_IP
+  IPAddress ip, gateway, subnet, dns;
+  ip.fromString(WIFI_STATIC_IP);
+  gateway.fromString(WIFI_GATEWAY);
+  subnet.fromString(WIFI_SUBNET);
+  dns.fromString(WIFI_DNS);
+  WiFi.config(ip, gateway, subnet, dns);
+#else
+  if (cache != nullptr && isLeaseValid(cache)) {
+    WiFi.config(IPAddress(cache->ip), IPAddress(cache->gateway), IPAddress(cache->subnet),
+                IPAddress(cache->dns));
+  } else {
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+  }
+#endif
+}
+
+// Gives up early if the access point isn't there (e.g. it moved to another channel).
+bool waitForWiFi(uint32_t timeoutMillis) {
+  uint32_t startMillis = millis();
+  while (millis() - startMillis < timeoutMillis) {
+    wl_status_t status = WiFi.status();
+    if (status == WL_CONNECTED) {
+      return true;
+    }
+    if (status == WL_CONNECT_FAILED || status == WL_NO_SSID_AVAIL) {
+      return false;
+    }
+    delay(50);
+  }
+  return false;
+}
+
+/**
+ * Connects to the access point and the IP config of the last connect directly, without a scan
+ * and DHCP. Falls back to a regular connect, retried with exponential backoff for at most
+ * WIFI_CONNECT_ATTEMPTS attempts. Blocks, meant to be called from weatherTask.
+ *
+ * @return false if all attempts failed
+ */
+bool startWiFi() {
+  uint32_t startMillis = millis();
+  // the IDF would write its own config to NVS on every begin()
+  WiFi.persistent(false);
+  WiFi.mode(WIFI_STA);
   log_i("Connecting to WiFi '%s'...", SSID);
-  while (WiFi.status() != WL_CONNECTED) {
-    log_i(".");
-    delay(200);
+
+  WiFiCache cache;
+  bool fast = loadWiFiCache(&cache);
+  bool leaseReused = false;
+  uint8_t attempts = 0;
+  uint32_t backoffMillis = WIFI_MIN_BACKOFF_MILLIS;
+  WiFiConnectState state = fast ? WIFI_FAST_CONNECT : WIFI_SCAN_CONNECT;
+  while (state != WIFI_CONNECTED && state != WIFI_GAVE_UP) {
+    switch (state) {
+      case WIFI_FAST_CONNECT:
+        configureIp(&cache);
+        leaseReused = isLeaseValid(&cache);
+        WiFi.begin(SSID, WIFI_PWD, cache.channel, cache.bssid);
+        if (waitForWiFi(WIFI_FAST_CONNECT_TIMEOUT_MILLIS)) {
+          state = WIFI_CONNECTED;
+        } else {
+          // the lease may be gone along with the access point
+          log_w("Fast connect to channel %d failed, scanning.", cache.channel);
+          wifiStats.failedAttempts++;
+          LittleFS.remove(WIFI_CACHE_FILE);
+          fast = false;
+          state = WIFI_SCAN_CONNECT;
+        }
+        break;
+      case WIFI_SCAN_CONNECT:
+        attempts++;
+        leaseReused = false;
+        WiFi.disconnect();
+        configureIp(nullptr);
+        WiFi.begin(SSID, WIFI_PWD);
+        if (waitForWiFi(WIFI_CONNECT_TIMEOUT_MILLIS)) {
+          state = WIFI_CONNECTED;
+        } else {
+          wifiStats.failedAttempts++;
+          state = attempts < WIFI_CONNECT_ATTEMPTS ? WIFI_BACKOFF : WIFI_GAVE_UP;
+        }
+        break;
+      case WIFI_BACKOFF:
+        log_w("Connecting to WiFi failed (status %d), retrying in %lums.", WiFi.status(),
+              backoffMillis);
+        delay(backoffMillis);
+        backoffMillis = min(backoffMillis * 2, (uint32_t)WIFI_MAX_BACKOFF_MILLIS);
+        state = WIFI_SCAN_CONNECT;
+        break;
+      default:
+        break;
+    }
   }
-  log_i("...done. IP: %s, WiFi RSSI: %d.", WiFi.localIP().toString().c_str(), WiFi.RSSI());
+  if (state == WIFI_GAVE_UP) {
+    log_e("Connecting to WiFi failed %d times (status %d), giving up.", attempts, WiFi.status());
+    WiFi.disconnect();
+    return false;
+  }
+
+  uint32_t connectMillis = millis() - startMillis;
+  wifiLeaseReused = leaseReused;
+  wifiStats.connects++;
+  if (fast) wifiStats.fastConnects++;
+  wifiStats.lastConnectMillis = connectMillis;
+  wifiStats.maxConnectMillis = max(wifiStats.maxConnectMillis, connectMillis);
+  wifiStats.totalConnectMillis += connectMillis;
+
+  uint32_t leaseStart = leaseReused ? cache.leaseStart : 0;
+  cache = {};
+  cache.magic = WIFI_CACHE_MAGIC;
+  cache.version = WIFI_CACHE_VERSION;
+  strlcpy(cache.ssid, SSID, sizeof(cache.ssid));
+  memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+  cache.channel = WiFi.channel();
+#ifndef WIFI_STATIC_IP
+  cache.ip = WiFi.localIP();
+  cache.gateway = WiFi.gatewayIP();
+  cache.subnet = WiFi.subnetMask();
+  cache.dns = WiFi.dnsIP();
+  if (!leaseReused) {
+    // a fresh lease; before the clock is set its start is unknown and it won't be reused
+    time_t now = time(nullptr);
+    leaseStart = now >= WIFI_MIN_VALID_EPOCH ? now : 0;
+  }
+  cache.leaseStart = leaseStart;
+#endif
+  saveWiFiCache(&cache);
+
+  log_i("...done in %lums (%s, %s). IP: %s, WiFi RSSI: %d.", connectMillis, fast ? "fast" : "scan",
+        leaseReused ? "cached lease" : "DHCP", WiFi.localIP().toString().c_str(), WiFi.RSSI());
+  log_i("WiFi: %d connects, %d fast, %d failed attempts, %lums on average, %lums max.",
+        wifiStats.connects, wifiStats.fastConnects, wifiStats.failedAttempts,
+        wifiStats.totalConnectMillis / wifiStats.connects, wifiStats.maxConnectMillis);
+  return true;
 }
@@ -1,1869 +0,0 @@
-// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
-// SPDX-License-Identifier: MIT
-
-// This was created as per https://github.com/takkaO/OpenFontRender/blob/master/examples/TFT_eSPI/load_from_binary/load_from_binary.ino#L1
-// The generated font supports the following characters; basic ASCII, accented chars from extended ASCII plus €:
-// !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~€ÇüéâäàåçêëèïîìÄÅÉ§ÆôöòûùÿÖÜ¢£¥₧ƒáíóúñÑ°∞
-
-#ifndef _JOSTTTF_H_
-#define _JOSTTTF_H_
-
-const unsigned char jost[18556] = {
-0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x80, 0x00, 0x03,
-0x00, 0x30, 0x63, 0x6D, 0x61, 0x70, 0xF8, 0xC0, 0x18, 0x8E,
-0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x10, 0x3C, 0x67, 0x6C,
-0x79, 0x66, 0xA5, 0x7E, 0x96, 0xCB, 0x00, 0x00, 0x10, 0xF8,
-0x00, 0x00, 0x30, 0xB0, 0x68, 0x65, 0x61, 0x64, 0x25, 0x6B,
-0x73, 0xE2, 0x00, 0x00, 0x41, 0xA8, 0x00, 0x00, 0x00, 0x36,
-0x68, 0x68, 0x65, 0x61, 0x03, 0x67, 0x04, 0x48, 0x00, 0x00,
-0x41, 0xE0, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6D, 0x74, 0x78,
-0x13, 0xA1, 0x17, 0x4B, 0x00, 0x00, 0x42, 0x04, 0x00, 0x00,
-0x02, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x00, 0x0B, 0xD2, 0x6D,
-0x00, 0x00, 0x44, 0x24, 0x00, 0x00, 0x02, 0x24, 0x6D, 0x61,
-0x78, 0x70, 0x07, 0x86, 0x11, 0x1F, 0x00, 0x00, 0x46, 0x48,
-0x00, 0x00, 0x00, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x7B, 0xB1,
-0x4F, 0xE5, 0x00, 0x00, 0x46, 0x68, 0x00, 0x00, 0x01, 0x8C,
-0x4F, 0x53, 0x2F, 0x32, 0x5F, 0x7E, 0x35, 0x3F, 0x00, 0x00,
-0x47, 0xF4, 0x00, 0x00, 0x00, 0x60, 0x70, 0x6F, 0x73, 0x74,
-0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x48, 0x54, 0x00, 0x00,
-0x00, 0x20, 0x70, 0x72, 0x65, 0x70, 0x68, 0x06, 0x8C, 0x85,
-0x00, 0x00, 0x48, 0x74, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C,
-0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7C, 0x00, 0x03,
-0x00, 0x01, 0x00, 0x00, 0x0A, 0xDC, 0x00, 0x04, 0x05, 0x60,
-0x00, 0x00, 0x01, 0x10, 0x01, 0x00, 0x00, 0x07, 0x00, 0x10,
-0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25,
-0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A,
-0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F,
-0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34,
-0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39,
-0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E,
-0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43,
-0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48,
-0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D,
-0x00, 0x4E, 0x00, 0x4F, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52,
-0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57,
-0x00, 0x58, 0x00, 0x59, 0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C,
-0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x60, 0x00, 0x61,
-0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66,
-0x00, 0x67, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6A, 0x00, 0x6B,
-0x00, 0x6C, 0x00, 0x6D, 0x00, 0x6E, 0x00, 0x6F, 0x00, 0x70,
-0x00, 0x71, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74, 0x00, 0x75,
-0x00, 0x76, 0x00, 0x77, 0x00, 0x78, 0x00, 0x79, 0x00, 0x7A,
-0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0xA2,
-0x00, 0xA3, 0x00, 0xA5, 0x00, 0xA7, 0x00, 0xB0, 0x00, 0xC4,
-0x00, 0xC5, 0x00, 0xC6, 0x00, 0xC7, 0x00, 0xC9, 0x00, 0xD1,
-0x00, 0xD6, 0x00, 0xDC, 0x00, 0xE0, 0x00, 0xE1, 0x00, 0xE2,
-0x00, 0xE4, 0x00, 0xE5, 0x00, 0xE7, 0x00, 0xE8, 0x00, 0xE9,
-0x00, 0xEA, 0x00, 0xEB, 0x00, 0xEC, 0x00, 0xED, 0x00, 0xEE,
-0x00, 0xEF, 0x00, 0xF1, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4,
-0x00, 0xF6, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB, 0x00, 0xFC,
-0x00, 0xFF, 0x01, 0x92, 0x20, 0xA7, 0x20, 0xAC, 0x22, 0x1E,
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23,
-0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28,
-0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D,
-0x00, 0x2E, 0x00, 0x2F, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32,
-0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37,
-0x00, 0x38, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C,
-0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x41,
-0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46,
-0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B,
-0x00, 0x4C, 0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F, 0x00, 0x50,
-0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55,
-0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5A,
-0x00, 0x5B, 0x00, 0x5C, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F,
-0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64,
-0x00, 0x65, 0x00, 0x66, 0x00, 0x67, 0x00, 0x68, 0x00, 0x69,
-0x00, 0x6A, 0x00, 0x6B, 0x00, 0x6C, 0x00, 0x6D, 0x00, 0x6E,
-0x00, 0x6F, 0x00, 0x70, 0x00, 0x71, 0x00, 0x72, 0x00, 0x73,
-0x00, 0x74, 0x00, 0x75, 0x00, 0x76, 0x00, 0x77, 0x00, 0x78,
-0x00, 0x79, 0x00, 0x7A, 0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D,
-0x00, 0x7E, 0x00, 0xA2, 0x00, 0xA3, 0x00, 0xA5, 0x00, 0xA7,
-0x00, 0xB0, 0x00, 0xC4, 0x00, 0xC5, 0x00, 0xC6, 0x00, 0xC7,
-0x00, 0xC9, 0x00, 0xD1, 0x00, 0xD6, 0x00, 0xDC, 0x00, 0xE0,
-0x00, 0xE1, 0x00, 0xE2, 0x00, 0xE4, 0x00, 0xE5, 0x00, 0xE7,
-0x00, 0xE8, 0x00, 0xE9, 0x00, 0xEA, 0x00, 0xEB, 0x00, 0xEC,
-0x00, 0xED, 0x00, 0xEE, 0x00, 0xEF, 0x00, 0xF1, 0x00, 0xF2,
-0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF6, 0x00, 0xF9, 0x00, 0xFA,
-0x00, 0xFB, 0x00, 0xFC, 0x00, 0xFF, 0x01, 0x92, 0x20, 0xA7,
-0x20, 0xAC, 0x22, 0x1E, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05,
-0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A,
-0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0F,
-0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
-0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19,
-0x00, 0x1A, 0x00, 0x1B, 0x00, 0x1C, 0x00, 0x1D, 0x00, 0x1E,
-0x00, 0x1F, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23,
-0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28,
-0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D,
-0x00, 0x2E, 0x00, 0x2F, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32,
-0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37,
-0x00, 0x38, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C,
-0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x41,
-0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46,
-0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B,
-0x00, 0x4C, 0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F, 0x00, 0x50,
-0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55,
-0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5A,
-0x00, 0x5B, 0x00, 0x5C, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F,
-0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64,
-0x00, 0x65, 0x00, 0x66, 0x00, 0x67, 0x00, 0x68, 0x00, 0x69,
-0x00, 0x6A, 0x00, 0x6B, 0x00, 0x6C, 0x00, 0x6D, 0x00, 0x6E,
-0x00, 0x6F, 0x00, 0x70, 0x00, 0x71, 0x00, 0x72, 0x00, 0x73,
-0x00, 0x74, 0x00, 0x75, 0x00, 0x76, 0x00, 0x77, 0x00, 0x78,
-0x00, 0x79, 0x00, 0x7A, 0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D,
-0x00, 0x7E, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x81, 0x00, 0x82,
-0x00, 0x83, 0x00, 0x84, 0x00, 0x85, 0x00, 0x86, 0x00, 0x87,
-0x00, 0x00, 0x00, 0x04, 0x05, 0x60, 0x00, 0x00, 0x01, 0x10,
-0x01, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x21, 0x00, 0x22,
-0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27,
-0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C,
-0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x30, 0x00, 0x31,
-0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
-0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B,
-0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x40,
-0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45,
-0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4A,
-0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F,
-0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54,
-0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59,
-0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C, 0x00, 0x5D, 0x00, 0x5E,
-0x00, 0x5F, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63,
-0x00, 0x64, 0x00, 0x65, 0x00, 0x66, 0x00, 0x67, 0x00, 0x68,
-0x00, 0x69, 0x00, 0x6A, 0x00, 0x6B, 0x00, 0x6C, 0x00, 0x6D,
-0x00, 0x6E, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x71, 0x00, 0x72,
-0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x76, 0x00, 0x77,
-0x00, 0x78, 0x00, 0x79, 0x00, 0x7A, 0x00, 0x7B, 0x00, 0x7C,
-0x00, 0x7D, 0x00, 0x7E, 0x00, 0xA2, 0x00, 0xA3, 0x00, 0xA5,
-0x00, 0xA7, 0x00, 0xB0, 0x00, 0xC4, 0x00, 0xC5, 0x00, 0xC6,
-0x00, 0xC7, 0x00, 0xC9, 0x00, 0xD1, 0x00, 0xD6, 0x00, 0xDC,
-0x00, 0xE0, 0x00, 0xE1, 0x00, 0xE2, 0x00, 0xE4, 0x00, 0xE5,
-0x00, 0xE7, 0x00, 0xE8, 0x00, 0xE9, 0x00, 0xEA, 0x00, 0xEB,
-0x00, 0xEC, 0x00, 0xED, 0x00, 0xEE, 0x00, 0xEF, 0x00, 0xF1,
-0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF6, 0x00, 0xF9,
-0x00, 0xFA, 0x00, 0xFB, 0x00, 0xFC, 0x00, 0xFF, 0x01, 0x92,
-0x20, 0xA7, 0x20, 0xAC, 0x22, 0x1E, 0xFF, 0xFF, 0x00, 0x00,
-0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25,
-0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A,
-0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F,
-0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34,
-0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39,
-0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E,
-0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43,
-0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48,
-0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D,
-0x00, 0x4E, 0x00, 0x4F, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52,
-0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57,
-0x00, 0x58, 0x00, 0x59, 0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C,
-0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x60, 0x00, 0x61,
-0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66,
-0x00, 0x67, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6A, 0x00, 0x6B,
-0x00, 0x6C, 0x00, 0x6D, 0x00, 0x6E, 0x00, 0x6F, 0x00, 0x70,
-0x00, 0x71, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74, 0x00, 0x75,
-0x00, 0x76, 0x00, 0x77, 0x00, 0x78, 0x00, 0x79, 0x00, 0x7A,
-0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0xA2,
-0x00, 0xA3, 0x00, 0xA5, 0x00, 0xA7, 0x00, 0xB0, 0x00, 0xC4,
-0x00, 0xC5, 0x00, 0xC6, 0x00, 0xC7, 0x00, 0xC9, 0x00, 0xD1,
-0x00, 0xD6, 0x00, 0xDC, 0x00, 0xE0, 0x00, 0xE1, 0x00, 0xE2,
-0x00, 0xE4, 0x00, 0xE5, 0x00, 0xE7, 0x00, 0xE8, 0x00, 0xE9,
-0x00, 0xEA, 0x00, 0xEB, 0x00, 0xEC, 0x00, 0xED, 0x00, 0xEE,
-0x00, 0xEF, 0x00, 0xF1, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4,
-0x00, 0xF6, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB, 0x00, 0xFC,
-0x00, 0xFF, 0x01, 0x92, 0x20, 0xA7, 0x20, 0xAC, 0x22, 0x1E,
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x00, 0x01, 0x00, 0x02,
-0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07,
-0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C,
-0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11,
-0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
-0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1A, 0x00, 0x1B,
-0x00, 0x1C, 0x00, 0x1D, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x20,
-0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25,
-0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A,
-0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F,
-0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34,
-0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39,
-0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E,
-0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43,
-0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48,
-0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D,
-0x00, 0x4E, 0x00, 0x4F, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52,
-0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57,
-0x00, 0x58, 0x00, 0x59, 0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C,
-0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x60, 0x00, 0x61,
-0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66,
-0x00, 0x67, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6A, 0x00, 0x6B,
-0x00, 0x6C, 0x00, 0x6D, 0x00, 0x6E, 0x00, 0x6F, 0x00, 0x70,
-0x00, 0x71, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74, 0x00, 0x75,
-0x00, 0x76, 0x00, 0x77, 0x00, 0x78, 0x00, 0x79, 0x00, 0x7A,
-0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0x7F,
-0x00, 0x80, 0x00, 0x81, 0x00, 0x82, 0x00, 0x83, 0x00, 0x84,
-0x00, 0x85, 0x00, 0x86, 0x00, 0x87, 0x00, 0x00, 0x00, 0x04,
-0x05, 0x60, 0x00, 0x00, 0x01, 0x10, 0x01, 0x00, 0x00, 0x07,
-0x00, 0x10, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24,
-0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29,
-0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E,
-0x00, 0x2F, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33,
-0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38,
-0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D,
-0x00, 0x3E, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42,
-0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47,
-0x00, 0x48, 0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C,
-0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F, 0x00, 0x50, 0x00, 0x51,
-0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56,
-0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5A, 0x00, 0x5B,
-0x00, 0x5C, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x60,
-0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65,
-0x00, 0x66, 0x00, 0x67, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6A,
-0x00, 0x6B, 0x00, 0x6C, 0x00, 0x6D, 0x00, 0x6E, 0x00, 0x6F,
-0x00, 0x70, 0x00, 0x71, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74,
-0x00, 0x75, 0x00, 0x76, 0x00, 0x77, 0x00, 0x78, 0x00, 0x79,
-0x00, 0x7A, 0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x7E,
-0x00, 0xA2, 0x00, 0xA3, 0x00, 0xA5, 0x00, 0xA7, 0x00, 0xB0,
-0x00, 0xC4, 0x00, 0xC5, 0x00, 0xC6, 0x00, 0xC7, 0x00, 0xC9,
-0x00, 0xD1, 0x00, 0xD6, 0x00, 0xDC, 0x00, 0xE0, 0x00, 0xE1,
-0x00, 0xE2, 0x00, 0xE4, 0x00, 0xE5, 0x00, 0xE7, 0x00, 0xE8,
-0x00, 0xE9, 0x00, 0xEA, 0x00, 0xEB, 0x00, 0xEC, 0x00, 0xED,
-0x00, 0xEE, 0x00, 0xEF, 0x00, 0xF1, 0x00, 0xF2, 0x00, 0xF3,
-0x00, 0xF4, 0x00, 0xF6, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB,
-0x00, 0xFC, 0x00, 0xFF, 0x01, 0x92, 0x20, 0xA7, 0x20, 0xAC,
-0x22, 0x1E, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x21, 0x00, 0x22,
-0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27,
-0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C,
-0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x30, 0x00, 0x31,
-0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
-0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B,
-0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x40,
-0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45,
-0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4A,
-0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F,
-0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54,
-0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59,
-0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C, 0x00, 0x5D, 0x00, 0x5E,
-0x00, 0x5F, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63,
-0x00, 0x64, 0x00, 0x65, 0x00, 0x66, 0x00, 0x67, 0x00, 0x68,
-0x00, 0x69, 0x00, 0x6A, 0x00, 0x6B, 0x00, 0x6C, 0x00, 0x6D,
-0x00, 0x6E, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x71, 0x00, 0x72,
-0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x76, 0x00, 0x77,
-0x00, 0x78, 0x00, 0x79, 0x00, 0x7A, 0x00, 0x7B, 0x00, 0x7C,
-0x00, 0x7D, 0x00, 0x7E, 0x00, 0xA2, 0x00, 0xA3, 0x00, 0xA5,
-0x00, 0xA7, 0x00, 0xB0, 0x00, 0xC4, 0x00, 0xC5, 0x00, 0xC6,
-0x00, 0xC7, 0x00, 0xC9, 0x00, 0xD1, 0x00, 0xD6, 0x00, 0xDC,
-0x00, 0xE0, 0x00, 0xE1, 0x00, 0xE2, 0x00, 0xE4, 0x00, 0xE5,
-0x00, 0xE7, 0x00, 0xE8, 0x00, 0xE9, 0x00, 0xEA, 0x00, 0xEB,
-0x00, 0xEC, 0x00, 0xED, 0x00, 0xEE, 0x00, 0xEF, 0x00, 0xF1,
-0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF6, 0x00, 0xF9,
-0x00, 0xFA, 0x00, 0xFB, 0x00, 0xFC, 0x00, 0xFF, 0x01, 0x92,
-0x20, 0xA7, 0x20, 0xAC, 0x22, 0x1E, 0xFF, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
-0x01, 0x10, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04,
-0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09,
-0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0D, 0x00, 0x0E,
-0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13,
-0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18,
-0x00, 0x19, 0x00, 0x1A, 0x00, 0x1B, 0x00, 0x1C, 0x00, 0x1D,
-0x00, 0x1E, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22,
-0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27,
-0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C,
-0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x30, 0x00, 0x31,
-0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
-0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B,
-0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x40,
-0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45,
-0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4A,
-0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F,
-0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54,
-0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59,
-0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C, 0x00, 0x5D, 0x00, 0x5E,
-0x00, 0x5F, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63,
-0x00, 0x64, 0x00, 0x65, 0x00, 0x66, 0x00, 0x67, 0x00, 0x68,
-0x00, 0x69, 0x00, 0x6A, 0x00, 0x6B, 0x00, 0x6C, 0x00, 0x6D,
-0x00, 0x6E, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x71, 0x00, 0x72,
-0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x76, 0x00, 0x77,
-0x00, 0x78, 0x00, 0x79, 0x00, 0x7A, 0x00, 0x7B, 0x00, 0x7C,
-0x00, 0x7D, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x81,
-0x00, 0x82, 0x00, 0x83, 0x00, 0x84, 0x00, 0x85, 0x00, 0x86,
-0x00, 0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-0x02, 0x58, 0x08, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xFD, 0xAD, 0x02, 0x4E,
-0x00, 0x00, 0xFD, 0xB2, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-0xF8, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x5F, 0xFF, 0xF1, 0x00, 0xCD, 0x02, 0xBC,
-0x00, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x13, 0x13, 0x33, 0x13,
-0x03, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-0x22, 0x06, 0x64, 0x14, 0x3C, 0x14, 0x69, 0x21, 0x16, 0x17,
-0x20, 0x20, 0x17, 0x16, 0x21, 0x02, 0xBC, 0xFE, 0x0C, 0x01,
-0xF4, 0xFD, 0x6C, 0x16, 0x21, 0x21, 0x16, 0x17, 0x20, 0x20,
-0x00, 0x02, 0x00, 0x50, 0x01, 0x90, 0x01, 0x95, 0x02, 0xBC,
-0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x13, 0x03, 0x33, 0x13,
-0x33, 0x03, 0x33, 0x13, 0x82, 0x32, 0x37, 0x5A, 0x55, 0x32,
-0x37, 0x5A, 0x02, 0xBC, 0xFE, 0xD4, 0x01, 0x2C, 0xFE, 0xD4,
-0x01, 0x2C, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x02, 0x3A,
-0x02, 0xBC, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x17, 0x00, 0x1F,
-0x00, 0x00, 0x13, 0x3B, 0x04, 0x35, 0x21, 0x03, 0x21, 0x35,
-0x2B, 0x04, 0x01, 0x0F, 0x04, 0x33, 0x13, 0x21, 0x03, 0x33,
-0x3F, 0x04, 0x4B, 0x87, 0x0E, 0xC0, 0x0E, 0x8C, 0xFE, 0x11,
-0x28, 0x01, 0xEF, 0x80, 0x14, 0xC8, 0x10, 0x83, 0x01, 0xA4,
-0x36, 0x04, 0x34, 0x05, 0x37, 0x4B, 0xAA, 0xFE, 0xE3, 0xAA,
-0x4B, 0x37, 0x04, 0x36, 0x04, 0x35, 0x01, 0xB8, 0x41, 0xFE,
-0xCF, 0x41, 0x01, 0xB3, 0xDE, 0x10, 0xD8, 0x12, 0xE4, 0x02,
-0xBC, 0xFD, 0x44, 0xE2, 0x12, 0xDE, 0x10, 0xDA, 0x00, 0x03,
-0x00, 0x37, 0xFF, 0x90, 0x02, 0x06, 0x03, 0x32, 0x00, 0x03,
-0x00, 0x07, 0x00, 0x3B, 0x00, 0x00, 0x01, 0x15, 0x33, 0x35,
-0x03, 0x15, 0x33, 0x35, 0x13, 0x37, 0x2E, 0x02, 0x23, 0x22,
-0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x1E, 0x02, 0x15,
-0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x07, 0x1E,
-0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x02, 0x27,
-0x2E, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-0x01, 0x03, 0x4A, 0x4A, 0x4A, 0x6B, 0x45, 0x0E, 0x3B, 0x56,
-0x39, 0x39, 0x5C, 0x36, 0x23, 0x36, 0x3D, 0x1A, 0x28, 0x4B,
-0x31, 0x1B, 0x35, 0x28, 0x2B, 0x43, 0x34, 0x15, 0x48, 0x16,
-0x49, 0x62, 0x39, 0x46, 0x5E, 0x31, 0x22, 0x36, 0x3E, 0x1B,
-0x2A, 0x4A, 0x2E, 0x18, 0x33, 0x28, 0x27, 0x36, 0x26, 0x03,
-0x32, 0x96, 0x96, 0xFC, 0xFE, 0xA0, 0xA0, 0x01, 0xD2, 0x2E,
-0x24, 0x45, 0x2D, 0x2D, 0x4D, 0x30, 0x30, 0x44, 0x2F, 0x1E,
-0x09, 0x0E, 0x26, 0x3A, 0x2D, 0x23, 0x33, 0x1B, 0x26, 0x46,
-0x30, 0x2B, 0x3A, 0x56, 0x31, 0x32, 0x5B, 0x3B, 0x30, 0x45,
-0x2F, 0x20, 0x0A, 0x10, 0x23, 0x31, 0x26, 0x1F, 0x2A, 0x16,
-0x21, 0x35, 0x00, 0x05, 0x00, 0x23, 0xFF, 0xF6, 0x02, 0xCC,
-0x02, 0xC6, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x3F,
-0x00, 0x43, 0x00, 0x00, 0x13, 0x14, 0x16, 0x16, 0x33, 0x32,
-0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
-0x17, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
-0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x01, 0x14, 0x16, 0x16,
-0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
-0x06, 0x06, 0x17, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x13, 0x01,
-0x33, 0x01, 0x23, 0x27, 0x48, 0x2F, 0x30, 0x47, 0x27, 0x27,
-0x47, 0x30, 0x2F, 0x48, 0x27, 0x47, 0x15, 0x27, 0x1B, 0x1C,
-0x26, 0x15, 0x15, 0x26, 0x1C, 0x1B, 0x27, 0x15, 0x01, 0x26,
-0x27, 0x48, 0x2F, 0x30, 0x47, 0x27, 0x27, 0x47, 0x30, 0x2F,
-0x48, 0x27, 0x47, 0x15, 0x27, 0x1B, 0x1C, 0x26, 0x15, 0x15,
-0x26, 0x1C, 0x1B, 0x27, 0x15, 0x5C, 0xFE, 0x3E, 0x4B, 0x01,
-0xC2, 0x02, 0x26, 0x2C, 0x49, 0x2B, 0x2B, 0x49, 0x2C, 0x2D,
-0x48, 0x2B, 0x2B, 0x48, 0x2D, 0x1A, 0x2B, 0x1A, 0x1A, 0x2B,
-0x1A, 0x19, 0x2C, 0x1A, 0x1A, 0x2C, 0xFE, 0x89, 0x2C, 0x49,
-0x2B, 0x2B, 0x49, 0x2C, 0x2D, 0x48, 0x2B, 0x2B, 0x48, 0x2D,
-0x1A, 0x2B, 0x1A, 0x1A, 0x2B, 0x1A, 0x19, 0x2C, 0x1A, 0x1A,
-0x2C, 0x02, 0x3F, 0xFD, 0x44, 0x02, 0xBC, 0x00, 0x01, 0x00,
-0x28, 0xFF, 0xF6, 0x02, 0x98, 0x02, 0xC7, 0x00, 0x3E, 0x00,
-0x00, 0x13, 0x01, 0x33, 0x01, 0x26, 0x26, 0x35, 0x34, 0x36,
-0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07, 0x0E, 0x04,
-0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x37, 0x27,
-0x0E, 0x03, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02,
-0x37, 0x3E, 0x03, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-0x06, 0x15, 0x14, 0x16, 0x16, 0xDF, 0x01, 0x50, 0x60, 0xFE,
-0x8E, 0x1E, 0x36, 0x2E, 0x29, 0x1C, 0x26, 0x15, 0x41, 0x38,
-0x14, 0x38, 0x3A, 0x31, 0x1F, 0x41, 0x67, 0x39, 0x43, 0x70,
-0x60, 0x54, 0x28, 0x3E, 0x24, 0x4D, 0x52, 0x59, 0x30, 0x28,
-0x42, 0x27, 0x24, 0x39, 0x40, 0x1B, 0x23, 0x36, 0x26, 0x14,
-0x28, 0x4B, 0x35, 0x32, 0x4D, 0x2C, 0x27, 0x33, 0x01, 0x80,
-0xFE, 0x80, 0x01, 0xA9, 0x23, 0x3E, 0x22, 0x26, 0x2E, 0x16,
-0x26, 0x1A, 0x22, 0x47, 0x20, 0x0B, 0x1B, 0x24, 0x32, 0x42,
-0x2C, 0x3B, 0x57, 0x2F, 0x32, 0x52, 0x67, 0x34, 0x27, 0x31,
-0x5A, 0x47, 0x2A, 0x1E, 0x38, 0x26, 0x26, 0x36, 0x29, 0x21,
-0x10, 0x15, 0x2B, 0x2F, 0x30, 0x19, 0x2A, 0x47, 0x2C, 0x26,
-0x46, 0x2F, 0x26, 0x40, 0x33, 0x00, 0x01, 0x00, 0x50, 0x01,
-0x90, 0x00, 0xE1, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x00, 0x13,
-0x03, 0x33, 0x13, 0x82, 0x32, 0x37, 0x5A, 0x02, 0xBC, 0xFE,
-0xD4, 0x01, 0x2C, 0x00, 0x01, 0x00, 0x5A, 0xFF, 0x38, 0x01,
-0x18, 0x03, 0x0C, 0x00, 0x0D, 0x00, 0x00, 0x13, 0x06, 0x06,
-0x15, 0x14, 0x16, 0x17, 0x33, 0x26, 0x26, 0x35, 0x34, 0x36,
-0x37, 0xCD, 0x3C, 0x37, 0x37, 0x3C, 0x4B, 0x34, 0x30, 0x30,
-0x34, 0x03, 0x0C, 0x70, 0xFA, 0x80, 0x7F, 0xFA, 0x71, 0x71,
-0xFA, 0x7F, 0x80, 0xFA, 0x70, 0x00, 0x01, 0x00, 0x1E, 0xFF,
-0x38, 0x00, 0xDC, 0x03, 0x0C, 0x00, 0x0D, 0x00, 0x00, 0x17,
-0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x23, 0x16, 0x16, 0x15,
-0x14, 0x06, 0x07, 0x69, 0x3C, 0x37, 0x37, 0x3C, 0x4B, 0x35,
-0x2F, 0x2F, 0x35, 0xC8, 0x71, 0xFA, 0x7F, 0x80, 0xFA, 0x70,
-0x70, 0xFA, 0x80, 0x7F, 0xFA, 0x71, 0x00, 0x05, 0x00, 0x64,
-0x01, 0x47, 0x01, 0xEC, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07,
-0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x00, 0x01, 0x07,
-0x17, 0x37, 0x07, 0x27, 0x07, 0x17, 0x23, 0x37, 0x27, 0x07,
-0x27, 0x17, 0x37, 0x27, 0x37, 0x17, 0x33, 0x37, 0x01, 0xD7,
-0xB7, 0x10, 0xBC, 0x35, 0x7B, 0x28, 0x6A, 0xAC, 0x6A, 0x28,
-0x7B, 0x35, 0xBC, 0x10, 0xB7, 0x8C, 0x0A, 0x32, 0x0A, 0x02,
-0x57, 0x46, 0x30, 0x33, 0xA4, 0x98, 0x1E, 0xA3, 0xA3, 0x1E,
-0x98, 0xA4, 0x33, 0x30, 0x46, 0x65, 0xC3, 0xC3, 0x00, 0x02,
-0x00, 0x41, 0x00, 0x0A, 0x02, 0x26, 0x01, 0xF4, 0x00, 0x03,
-0x00, 0x07, 0x00, 0x00, 0x37, 0x21, 0x35, 0x21, 0x37, 0x11,
-0x33, 0x11, 0x41, 0x01, 0xE5, 0xFE, 0x1B, 0xC8, 0x55, 0xD7,
-0x50, 0xCD, 0xFE, 0x16, 0x01, 0xEA, 0x00, 0x01, 0x00, 0x3C,
-0xFF, 0x56, 0x00, 0xE4, 0x00, 0x6E, 0x00, 0x03, 0x00, 0x00,
-0x37, 0x03, 0x17, 0x37, 0x94, 0x58, 0x3A, 0x6E, 0x6E, 0xFE,
-0xFD, 0x15, 0xFA, 0x00, 0x01, 0x00, 0x05, 0x00, 0xC8, 0x00,
-0xCD, 0x01, 0x13, 0x00, 0x03, 0x00, 0x00, 0x37, 0x33, 0x35,
-0x23, 0x05, 0xC8, 0xC8, 0xC8, 0x4B, 0x00, 0x01, 0x00, 0x5F,
-0xFF, 0xF1, 0x00, 0xCD, 0x00, 0x5F, 0x00, 0x0B, 0x00, 0x00,
-0x37, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-0x22, 0x06, 0x5F, 0x21, 0x16, 0x17, 0x20, 0x20, 0x17, 0x16,
-0x21, 0x28, 0x16, 0x21, 0x21, 0x16, 0x17, 0x20, 0x20, 0x00,
-0x01, 0x00, 0x0F, 0xFF, 0x6A, 0x01, 0xF4, 0x02, 0xBC, 0x00,
-0x03, 0x00, 0x00, 0x01, 0x01, 0x33, 0x01, 0x01, 0xA4, 0xFE,
-0x6B, 0x50, 0x01, 0x95, 0x02, 0xBC, 0xFC, 0xAE, 0x03, 0x52,
-0x00, 0x02, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x30, 0x02, 0xC6,
-0x00, 0x13, 0x00, 0x23, 0x00, 0x00, 0x13, 0x34, 0x3E, 0x02,
-0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22,
-0x2E, 0x02, 0x27, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x7D, 0x18,
-0x2E, 0x41, 0x28, 0x29, 0x40, 0x2E, 0x18, 0x18, 0x2E, 0x40,
-0x29, 0x28, 0x41, 0x2E, 0x18, 0x55, 0x42, 0x75, 0x4D, 0x4D,
-0x75, 0x42, 0x42, 0x75, 0x4D, 0x4D, 0x75, 0x42, 0x01, 0x5E,
-0x3D, 0x67, 0x4B, 0x29, 0x29, 0x4B, 0x67, 0x3D, 0x3D, 0x67,
-0x4B, 0x29, 0x29, 0x4B, 0x67, 0x3D, 0x69, 0xA2, 0x5D, 0x5D,
-0xA2, 0x69, 0x69, 0xA2, 0x5D, 0x5D, 0xA2, 0x00, 0x01, 0x00,
-0x50, 0x00, 0x00, 0x01, 0x40, 0x02, 0xC6, 0x00, 0x05, 0x00,
-0x00, 0x13, 0x37, 0x11, 0x33, 0x11, 0x07, 0x50, 0x9B, 0x55,
-0xF0, 0x02, 0x32, 0x2E, 0xFD, 0xA0, 0x02, 0xC6, 0x3C, 0x00,
-0x01, 0x00, 0x14, 0x00, 0x00, 0x02, 0x02, 0x02, 0xC7, 0x00,
-0x1E, 0x00, 0x00, 0x33, 0x21, 0x35, 0x21, 0x37, 0x36, 0x36,
-0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x33,
-0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x06,
-0x06, 0x07, 0x14, 0x01, 0xEE, 0xFE, 0xC1, 0xDF, 0x29, 0x34,
-0x1A, 0x36, 0x54, 0x3A, 0x48, 0x67, 0x36, 0x55, 0x22, 0x41,
-0x2D, 0x20, 0x32, 0x23, 0x12, 0x11, 0x21, 0x17, 0x50, 0xE3,
-0x2A, 0x6A, 0x36, 0x20, 0x46, 0x3D, 0x27, 0x3F, 0x71, 0x4B,
-0x35, 0x4D, 0x29, 0x16, 0x24, 0x2C, 0x17, 0x1C, 0x33, 0x31,
-0x19, 0x00, 0x02, 0x00, 0x3C, 0xFF, 0xF6, 0x01, 0xF5, 0x02,
-0xC6, 0x00, 0x19, 0x00, 0x36, 0x00, 0x00, 0x13, 0x32, 0x36,
-0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-0x33, 0x34, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E,
-0x02, 0x23, 0x13, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x02,
-0x23, 0x15, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x23,
-0x22, 0x26, 0x26, 0x35, 0x23, 0x14, 0x1E, 0x02, 0xFD, 0x44,
-0x66, 0x3A, 0x2F, 0x57, 0x3C, 0x39, 0x59, 0x33, 0x51, 0x44,
-0x31, 0x23, 0x2F, 0x18, 0x13, 0x24, 0x34, 0x22, 0x1E, 0x3F,
-0x62, 0x39, 0x27, 0x45, 0x59, 0x33, 0x22, 0x3A, 0x2C, 0x19,
-0x20, 0x3B, 0x28, 0x28, 0x3E, 0x23, 0x56, 0x20, 0x3A, 0x52,
-0x01, 0x59, 0x30, 0x52, 0x31, 0x32, 0x54, 0x34, 0x2F, 0x52,
-0x37, 0x2E, 0x3D, 0x1C, 0x33, 0x21, 0x19, 0x2C, 0x21, 0x13,
-0xFE, 0x66, 0x30, 0x58, 0x3B, 0x34, 0x4A, 0x2F, 0x16, 0x37,
-0x10, 0x21, 0x31, 0x20, 0x26, 0x38, 0x1F, 0x1E, 0x34, 0x21,
-0x29, 0x47, 0x35, 0x1E, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00,
-0x02, 0x29, 0x02, 0xBC, 0x00, 0x0C, 0x00, 0x00, 0x37, 0x21,
-0x35, 0x2B, 0x02, 0x13, 0x11, 0x15, 0x15, 0x33, 0x11, 0x23,
-0x14, 0x02, 0x15, 0x8F, 0x11, 0xE9, 0xC6, 0x55, 0x23, 0x8C,
-0x4B, 0x01, 0x28, 0xFE, 0xBC, 0x0B, 0xB0, 0x02, 0xBC, 0x00,
-0x01, 0x00, 0x1E, 0xFF, 0xF6, 0x02, 0x0C, 0x02, 0xBC, 0x00,
-0x25, 0x00, 0x00, 0x25, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-0x07, 0x37, 0x21, 0x35, 0x21, 0x03, 0x3E, 0x02, 0x33, 0x32,
-0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
-0x27, 0x07, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x02, 0x0C,
-0x36, 0x5F, 0x3C, 0x1A, 0x35, 0x19, 0x2F, 0x01, 0x08, 0xFE,
-0xB6, 0x5C, 0x24, 0x37, 0x37, 0x21, 0x2D, 0x47, 0x29, 0x25,
-0x46, 0x32, 0x26, 0x46, 0x35, 0x10, 0x48, 0x17, 0x43, 0x5F,
-0x40, 0x33, 0x58, 0x44, 0x26, 0xE6, 0x46, 0x6A, 0x3C, 0x0D,
-0x0D, 0xB9, 0x4B, 0xFE, 0x8B, 0x19, 0x1B, 0x0B, 0x28, 0x48,
-0x30, 0x30, 0x48, 0x28, 0x21, 0x35, 0x1E, 0x31, 0x28, 0x43,
-0x28, 0x1E, 0x3C, 0x5A, 0x00, 0x02, 0x00, 0x32, 0xFF, 0xF6,
-0x02, 0x0E, 0x02, 0xBC, 0x00, 0x0F, 0x00, 0x26, 0x00, 0x00,
-0x37, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
-0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x13, 0x03, 0x06, 0x06,
-0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34,
-0x2E, 0x02, 0x23, 0x22, 0x06, 0x07, 0x17, 0x13, 0x83, 0x29,
-0x47, 0x2D, 0x2D, 0x47, 0x29, 0x29, 0x47, 0x2D, 0x2D, 0x47,
-0x29, 0xC7, 0xEC, 0x14, 0x18, 0x3F, 0x6C, 0x43, 0x44, 0x6B,
-0x3F, 0x20, 0x39, 0x4B, 0x2B, 0x22, 0x35, 0x14, 0x06, 0xDB,
-0xE6, 0x30, 0x4B, 0x2A, 0x2A, 0x4B, 0x30, 0x30, 0x49, 0x2A,
-0x2A, 0x49, 0x02, 0x06, 0xFE, 0xBB, 0x1C, 0x4A, 0x2B, 0x48,
-0x6C, 0x3C, 0x3C, 0x6C, 0x48, 0x30, 0x53, 0x3E, 0x22, 0x10,
-0x19, 0x05, 0x01, 0x21, 0x00, 0x01, 0x00, 0x1E, 0x00, 0x00,
-0x02, 0x08, 0x02, 0xBC, 0x00, 0x05, 0x00, 0x00, 0x13, 0x21,
-0x01, 0x33, 0x01, 0x21, 0x1E, 0x01, 0x6B, 0xFE, 0xD7, 0x59,
-0x01, 0x4F, 0xFE, 0x16, 0x02, 0x6C, 0xFD, 0x94, 0x02, 0xBC,
-0x00, 0x04, 0x00, 0x37, 0xFF, 0xF6, 0x01, 0xEB, 0x02, 0xC6,
-0x00, 0x11, 0x00, 0x21, 0x00, 0x35, 0x00, 0x45, 0x00, 0x00,
-0x13, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34,
-0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x17, 0x34, 0x36, 0x36,
-0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22,
-0x26, 0x26, 0x03, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02,
-0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x17, 0x34,
-0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
-0x23, 0x22, 0x26, 0x26, 0x50, 0x1C, 0x33, 0x47, 0x2B, 0x2B,
-0x47, 0x33, 0x1C, 0x33, 0x57, 0x37, 0x37, 0x57, 0x33, 0x51,
-0x1D, 0x33, 0x20, 0x21, 0x32, 0x1D, 0x1F, 0x33, 0x1E, 0x1E,
-0x33, 0x1F, 0x6A, 0x21, 0x3B, 0x4F, 0x2F, 0x2F, 0x4F, 0x3B,
-0x21, 0x23, 0x3D, 0x4F, 0x2B, 0x2B, 0x4F, 0x3D, 0x23, 0x51,
-0x27, 0x3F, 0x23, 0x23, 0x3F, 0x27, 0x27, 0x3F, 0x23, 0x23,
-0x3F, 0x27, 0x02, 0x13, 0x29, 0x41, 0x2E, 0x18, 0x18, 0x2E,
-0x41, 0x29, 0x32, 0x51, 0x30, 0x30, 0x51, 0x3C, 0x21, 0x34,
-0x1D, 0x1D, 0x34, 0x21, 0x21, 0x32, 0x1C, 0x1C, 0x32, 0xFE,
-0xD6, 0x29, 0x48, 0x38, 0x1F, 0x1F, 0x38, 0x48, 0x29, 0x30,
-0x4B, 0x33, 0x1A, 0x1A, 0x33, 0x4B, 0x26, 0x26, 0x3D, 0x24,
-0x24, 0x3D, 0x26, 0x2B, 0x3C, 0x20, 0x20, 0x3C, 0x00, 0x02,
-0x00, 0x32, 0x00, 0x00, 0x02, 0x0E, 0x02, 0xC6, 0x00, 0x0F,
-0x00, 0x26, 0x00, 0x00, 0x01, 0x14, 0x06, 0x06, 0x23, 0x22,
-0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-0x03, 0x13, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
-0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x37,
-0x27, 0x03, 0x01, 0xBD, 0x29, 0x47, 0x2D, 0x2D, 0x47, 0x29,
-0x29, 0x47, 0x2D, 0x2D, 0x47, 0x29, 0xC7, 0xEC, 0x14, 0x18,
-0x3F, 0x6B, 0x44, 0x43, 0x6C, 0x3F, 0x20, 0x39, 0x4B, 0x2B,
-0x22, 0x35, 0x14, 0x06, 0xDB, 0x01, 0xD6, 0x30, 0x4A, 0x2B,
-0x2B, 0x4A, 0x30, 0x30, 0x49, 0x2A, 0x2A, 0x49, 0xFD, 0xFA,
-0x01, 0x45, 0x1C, 0x4A, 0x2B, 0x48, 0x6C, 0x3C, 0x3C, 0x6C,
-0x48, 0x30, 0x53, 0x3E, 0x22, 0x10, 0x19, 0x05, 0xFE, 0xDF,
-0x00, 0x02, 0x00, 0x5F, 0xFF, 0xF1, 0x00, 0xCD, 0x01, 0xDB,
-0x00, 0x0B, 0x00, 0x17, 0x00, 0x00, 0x37, 0x14, 0x16, 0x33,
-0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x11, 0x14,
-0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-0x5F, 0x21, 0x16, 0x17, 0x20, 0x20, 0x17, 0x16, 0x21, 0x21,
-0x16, 0x17, 0x20, 0x20, 0x17, 0x16, 0x21, 0x28, 0x16, 0x21,
-0x21, 0x16, 0x17, 0x20, 0x20, 0x01, 0x65, 0x16, 0x21, 0x21,
-0x16, 0x17, 0x20, 0x20, 0x00, 0x02, 0x00, 0x3C, 0xFF, 0x56,
-0x00, 0xEB, 0x01, 0xDB, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00,
-0x13, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-0x22, 0x06, 0x13, 0x03, 0x17, 0x37, 0x7D, 0x21, 0x16, 0x17,
-0x20, 0x20, 0x17, 0x16, 0x21, 0x17, 0x58, 0x3A, 0x6E, 0x01,
-0xA4, 0x16, 0x21, 0x21, 0x16, 0x17, 0x20, 0x20, 0xFE, 0xB3,
-0xFE, 0xFD, 0x15, 0xFA, 0x00, 0x01, 0x00, 0x41, 0x00, 0x0F,
-0x02, 0x3F, 0x01, 0xF4, 0x00, 0x06, 0x00, 0x00, 0x13, 0x25,
-0x35, 0x05, 0x15, 0x05, 0x35, 0xC5, 0x01, 0x7A, 0xFE, 0x02,
-0x01, 0xFE, 0x01, 0x06, 0x9E, 0x50, 0xDC, 0x2D, 0xDC, 0x50,
-0x00, 0x02, 0x00, 0x41, 0x00, 0x8C, 0x02, 0x26, 0x01, 0x6D,
-0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x37, 0x21, 0x35, 0x21,
-0x35, 0x21, 0x35, 0x21, 0x41, 0x01, 0xE5, 0xFE, 0x1B, 0x01,
-0xE5, 0xFE, 0x1B, 0x8C, 0x4B, 0x4B, 0x4B, 0x00, 0x01, 0x00,
-0x41, 0x00, 0x0F, 0x02, 0x3F, 0x01, 0xF4, 0x00, 0x06, 0x00,
-0x00, 0x25, 0x05, 0x15, 0x25, 0x35, 0x25, 0x15, 0x01, 0xBB,
-0xFE, 0x86, 0x01, 0xFE, 0xFE, 0x02, 0xFD, 0x9E, 0x50, 0xDC,
-0x2D, 0xDC, 0x50, 0x00, 0x02, 0x00, 0x3C, 0xFF, 0xF1, 0x01,
-0xF1, 0x02, 0xC6, 0x00, 0x1C, 0x00, 0x28, 0x00, 0x00, 0x01,
-0x14, 0x06, 0x06, 0x23, 0x23, 0x17, 0x33, 0x37, 0x3E, 0x02,
-0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x07, 0x17,
-0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x03, 0x14, 0x16, 0x33,
-0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x01, 0xA0,
-0x2E, 0x56, 0x3C, 0x1A, 0x14, 0x3C, 0x07, 0x38, 0x60, 0x3C,
-0x21, 0x3B, 0x4F, 0x2F, 0x3B, 0x51, 0x38, 0x17, 0x41, 0x17,
-0x47, 0x32, 0x2D, 0x42, 0x24, 0xDD, 0x21, 0x16, 0x17, 0x20,
-0x20, 0x17, 0x16, 0x21, 0x01, 0xF4, 0x26, 0x47, 0x2E, 0xAF,
-0x78, 0x03, 0x39, 0x5D, 0x39, 0x2D, 0x4C, 0x39, 0x20, 0x1D,
-0x35, 0x23, 0x29, 0x26, 0x2D, 0x20, 0x3C, 0xFE, 0x09, 0x16,
-0x21, 0x21, 0x16, 0x17, 0x20, 0x20, 0x00, 0x03, 0x00, 0x23,
-0xFF, 0xF6, 0x02, 0xDF, 0x02, 0xC6, 0x00, 0x0E, 0x00, 0x1E,
-0x00, 0x59, 0x00, 0x00, 0x01, 0x34, 0x36, 0x36, 0x33, 0x32,
-0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27,
-0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
-0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x14, 0x16, 0x16, 0x33,
-0x32, 0x36, 0x37, 0x27, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
-0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14,
-0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37,
-0x37, 0x23, 0x07, 0x33, 0x06, 0x16, 0x16, 0x33, 0x32, 0x3E,
-0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x01,
-0x0A, 0x21, 0x34, 0x1B, 0x19, 0x27, 0x17, 0x26, 0x36, 0x19,
-0x29, 0x29, 0x4C, 0x27, 0x3F, 0x24, 0x30, 0x4E, 0x2F, 0x1A,
-0x36, 0x2B, 0x2A, 0x57, 0x3B, 0x9B, 0x4C, 0x93, 0x6B, 0x56,
-0x69, 0x2D, 0x23, 0x31, 0x63, 0x35, 0x4F, 0x75, 0x40, 0x2C,
-0x51, 0x73, 0x46, 0x3F, 0x5E, 0x3E, 0x1F, 0x25, 0x2F, 0x0F,
-0x10, 0x11, 0x06, 0x01, 0x01, 0x29, 0x4B, 0x24, 0x07, 0x05,
-0x14, 0x2D, 0x1E, 0x1C, 0x3E, 0x37, 0x22, 0x28, 0x50, 0x78,
-0x50, 0x54, 0x8B, 0x66, 0x37, 0x01, 0x40, 0x2B, 0x3F, 0x22,
-0x16, 0x28, 0x1C, 0x35, 0x3D, 0x1A, 0x30, 0x27, 0x31, 0x47,
-0x25, 0x2F, 0x5E, 0x45, 0x28, 0x49, 0x2F, 0x31, 0x5E, 0x43,
-0x63, 0x95, 0x52, 0x21, 0x1B, 0x39, 0x1F, 0x15, 0x41, 0x77,
-0x51, 0x45, 0x76, 0x58, 0x32, 0x2A, 0x48, 0x5B, 0x32, 0x3F,
-0x4D, 0x22, 0x0D, 0x15, 0x0C, 0x06, 0x10, 0x05, 0xE7, 0xFA,
-0x21, 0x36, 0x21, 0x1A, 0x38, 0x5C, 0x42, 0x3C, 0x72, 0x5C,
-0x36, 0x3C, 0x6A, 0x8E, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00,
-0x02, 0x8F, 0x02, 0xDF, 0x00, 0x03, 0x00, 0x0D, 0x00, 0x00,
-0x37, 0x21, 0x27, 0x21, 0x37, 0x13, 0x17, 0x17, 0x33, 0x01,
-0x01, 0x33, 0x37, 0x37, 0x93, 0x01, 0x72, 0x1E, 0xFE, 0xCA,
-0x99, 0x78, 0x08, 0x66, 0x5F, 0xFE, 0xBB, 0xFE, 0xBB, 0x5F,
-0x68, 0x08, 0xD2, 0x50, 0xFC, 0xFE, 0xE6, 0x14, 0xF0, 0x02,
-0xDF, 0xFD, 0x21, 0xF6, 0x12, 0x00, 0x01, 0x00, 0x50, 0x00,
-0x00, 0x01, 0xFC, 0x02, 0xBC, 0x00, 0x2C, 0x00, 0x00, 0x13,
-0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23,
-0x11, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x02, 0x23,
-0x23, 0x15, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06,
-0x23, 0x23, 0x11, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x06,
-0x23, 0x23, 0x93, 0x71, 0x3F, 0x5D, 0x34, 0x34, 0x5D, 0x3F,
-0xB4, 0xBE, 0x44, 0x6B, 0x3F, 0x24, 0x41, 0x56, 0x33, 0x7B,
-0x7B, 0x22, 0x38, 0x29, 0x16, 0x27, 0x45, 0x2D, 0x69, 0x5F,
-0x35, 0x46, 0x20, 0x38, 0x23, 0x71, 0x01, 0x72, 0x24, 0x46,
-0x31, 0x3C, 0x4D, 0x26, 0xFD, 0x44, 0x2D, 0x5B, 0x45, 0x30,
-0x46, 0x2D, 0x16, 0x2F, 0x11, 0x22, 0x32, 0x20, 0x2B, 0x3C,
-0x20, 0x02, 0x26, 0x37, 0x32, 0x21, 0x2E, 0x18, 0x00, 0x01,
-0x00, 0x28, 0xFF, 0xF6, 0x02, 0x67, 0x02, 0xC6, 0x00, 0x21,
-0x00, 0x00, 0x13, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-0x17, 0x35, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14,
-0x1E, 0x02, 0x33, 0x32, 0x36, 0x37, 0x35, 0x0E, 0x02, 0x23,
-0x22, 0x26, 0x26, 0x82, 0x49, 0x76, 0x45, 0x32, 0x53, 0x44,
-0x18, 0x2C, 0x68, 0x4D, 0x49, 0x7F, 0x60, 0x36, 0x36, 0x60,
-0x7F, 0x49, 0x4D, 0x68, 0x2C, 0x18, 0x44, 0x53, 0x32, 0x45,
-0x76, 0x49, 0x01, 0x5E, 0x52, 0x7B, 0x46, 0x1A, 0x2F, 0x1F,
-0x70, 0x27, 0x26, 0x35, 0x61, 0x84, 0x4E, 0x4E, 0x84, 0x61,
-0x35, 0x26, 0x27, 0x70, 0x1F, 0x2F, 0x1A, 0x46, 0x7C, 0x00,
-0x02, 0x00, 0x50, 0x00, 0x00, 0x02, 0x80, 0x02, 0xBC, 0x00,
-0x03, 0x00, 0x1B, 0x00, 0x00, 0x13, 0x11, 0x33, 0x11, 0x13,
-0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x15,
-0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x23,
-0x15, 0x50, 0x55, 0x7D, 0x66, 0x9E, 0x5A, 0x5A, 0x9E, 0x66,
-0xA3, 0xA3, 0x3B, 0x62, 0x46, 0x26, 0x26, 0x46, 0x62, 0x3B,
-0xA3, 0x02, 0xBC, 0xFD, 0x44, 0x02, 0xBC, 0xFD, 0x44, 0x58,
-0x9D, 0x69, 0x69, 0x9D, 0x58, 0x55, 0x25, 0x45, 0x62, 0x3D,
-0x3D, 0x62, 0x45, 0x25, 0x55, 0x00, 0x04, 0x00, 0x50, 0x00,
-0x00, 0x01, 0xE0, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00,
-0x0B, 0x00, 0x0F, 0x00, 0x00, 0x33, 0x21, 0x35, 0x21, 0x11,
-0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x03, 0x11, 0x33,
-0x11, 0x7F, 0x01, 0x61, 0xFE, 0x9F, 0x01, 0x61, 0xFE, 0x9F,
-0x01, 0x4D, 0xFE, 0xB3, 0x2F, 0x55, 0x50, 0x02, 0x1C, 0x50,
-0xFE, 0x98, 0x50, 0x01, 0x18, 0xFD, 0x44, 0x02, 0xBC, 0x00,
-0x03, 0x00, 0x50, 0x00, 0x00, 0x01, 0xB8, 0x02, 0xBC, 0x00,
-0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x13, 0x21, 0x35,
-0x21, 0x11, 0x21, 0x35, 0x21, 0x03, 0x11, 0x33, 0x11, 0x7F,
-0x01, 0x39, 0xFE, 0xC7, 0x01, 0x2F, 0xFE, 0xD1, 0x2F, 0x55,
-0x02, 0x6C, 0x50, 0xFE, 0x98, 0x50, 0x01, 0x18, 0xFD, 0x44,
-0x02, 0xBC, 0x00, 0x01, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0xDA,
-0x02, 0xC6, 0x00, 0x26, 0x00, 0x00, 0x01, 0x33, 0x0E, 0x03,
-0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
-0x16, 0x17, 0x37, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15,
-0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x21, 0x01,
-0x95, 0xE9, 0x09, 0x27, 0x3C, 0x53, 0x34, 0x4A, 0x78, 0x47,
-0x47, 0x78, 0x4A, 0x50, 0x76, 0x21, 0x3C, 0x1E, 0x57, 0x6D,
-0x41, 0x4C, 0x82, 0x60, 0x35, 0x35, 0x60, 0x82, 0x4C, 0x50,
-0x7D, 0x56, 0x2C, 0xFE, 0xBB, 0x01, 0x13, 0x29, 0x48, 0x38,
-0x1F, 0x46, 0x7C, 0x51, 0x52, 0x7B, 0x46, 0x3F, 0x38, 0x37,
-0x31, 0x42, 0x22, 0x35, 0x61, 0x84, 0x4E, 0x4E, 0x84, 0x61,
-0x35, 0x3B, 0x66, 0x83, 0x49, 0x00, 0x03, 0x00, 0x50, 0x00,
-0x00, 0x02, 0x7B, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00,
-0x0B, 0x00, 0x00, 0x13, 0x21, 0x35, 0x21, 0x01, 0x11, 0x33,
-0x11, 0x21, 0x11, 0x33, 0x11, 0x7F, 0x01, 0xE0, 0xFE, 0x20,
-0x01, 0xA7, 0x55, 0xFD, 0xD5, 0x55, 0x01, 0x54, 0x50, 0x01,
-0x18, 0xFD, 0x44, 0x02, 0xBC, 0xFD, 0x44, 0x02, 0xBC, 0x00,
-0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0xA5, 0x02, 0xBC, 0x00,
-0x03, 0x00, 0x00, 0x13, 0x11, 0x33, 0x11, 0x50, 0x55, 0x02,
-0xBC, 0xFD, 0x44, 0x02, 0xBC, 0x00, 0x01, 0xFF, 0x91, 0xFF,
-0x24, 0x00, 0xA0, 0x02, 0xBC, 0x00, 0x12, 0x00, 0x00, 0x07,
-0x07, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x11, 0x23,
-0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x43, 0x2C, 0x08, 0x23,
-0x31, 0x1A, 0x23, 0x39, 0x28, 0x15, 0x50, 0x2D, 0x17, 0x1B,
-0x29, 0x68, 0x42, 0x0A, 0x17, 0x11, 0x13, 0x28, 0x3C, 0x29,
-0x02, 0xF8, 0xFD, 0x12, 0x31, 0x29, 0x13, 0x00, 0x02, 0x00,
-0x50, 0x00, 0x00, 0x02, 0x30, 0x02, 0xBC, 0x00, 0x03, 0x00,
-0x09, 0x00, 0x00, 0x13, 0x11, 0x33, 0x11, 0x21, 0x01, 0x01,
-0x33, 0x01, 0x01, 0x50, 0x55, 0x01, 0x13, 0xFE, 0xD3, 0x01,
-0x3C, 0x69, 0xFE, 0xC2, 0x01, 0x2F, 0x02, 0xBC, 0xFD, 0x44,
-0x02, 0xBC, 0xFE, 0xB6, 0xFE, 0x8E, 0x01, 0x74, 0x01, 0x48,
-0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x01, 0xB8, 0x02, 0xBC,
-0x00, 0x05, 0x00, 0x00, 0x13, 0x11, 0x21, 0x35, 0x21, 0x11,
-0x50, 0x01, 0x68, 0xFE, 0xED, 0x02, 0xBC, 0xFD, 0x44, 0x50,
-0x02, 0x6C, 0x00, 0x01, 0x00, 0x28, 0x00, 0x00, 0x03, 0x02,
-0x02, 0xDF, 0x00, 0x09, 0x00, 0x00, 0x1B, 0x03, 0x33, 0x03,
-0x01, 0x01, 0x03, 0x33, 0xB1, 0xE4, 0xE4, 0x34, 0x55, 0x55,
-0xFE, 0xE8, 0xFE, 0xE8, 0x55, 0x55, 0x01, 0xD9, 0xFE, 0x68,
-0x01, 0x98, 0xFE, 0x27, 0x02, 0xDF, 0xFE, 0x05, 0x01, 0xFB,
-0xFD, 0x21, 0x00, 0x01, 0x00, 0x50, 0xFF, 0xDD, 0x02, 0xB7,
-0x02, 0xDF, 0x00, 0x07, 0x00, 0x00, 0x01, 0x11, 0x01, 0x11,
-0x33, 0x11, 0x01, 0x11, 0x02, 0x62, 0xFD, 0xEE, 0x55, 0x02,
-0x12, 0x02, 0xBC, 0xFD, 0xF7, 0x02, 0x2C, 0xFD, 0x21, 0x02,
-0x09, 0xFD, 0xD4, 0x02, 0xDF, 0x00, 0x02, 0x00, 0x28, 0xFF,
-0xF6, 0x02, 0xEE, 0x02, 0xC6, 0x00, 0x0F, 0x00, 0x23, 0x00,
-0x00, 0x13, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
-0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x14, 0x1E,
-0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23,
-0x22, 0x0E, 0x02, 0x82, 0x45, 0x78, 0x4C, 0x4D, 0x77, 0x45,
-0x45, 0x77, 0x4D, 0x4C, 0x78, 0x45, 0x5A, 0x35, 0x60, 0x82,
-0x4C, 0x4D, 0x81, 0x60, 0x35, 0x35, 0x60, 0x81, 0x4D, 0x4C,
-0x82, 0x60, 0x35, 0x01, 0x5E, 0x4F, 0x7C, 0x48, 0x48, 0x7C,
-0x4F, 0x4F, 0x7C, 0x48, 0x48, 0x7C, 0x4F, 0x4C, 0x84, 0x61,
-0x37, 0x37, 0x61, 0x84, 0x4C, 0x4D, 0x83, 0x61, 0x37, 0x37,
-0x61, 0x83, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x01, 0xFC,
-0x02, 0xBC, 0x00, 0x03, 0x00, 0x17, 0x00, 0x00, 0x13, 0x11,
-0x33, 0x11, 0x07, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
-0x23, 0x15, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
-0x23, 0x23, 0x50, 0x55, 0x26, 0x8F, 0x44, 0x55, 0x55, 0x44,
-0x8F, 0x8F, 0x44, 0x6B, 0x3F, 0x3F, 0x6B, 0x44, 0x8F, 0x02,
-0xBC, 0xFD, 0x44, 0x02, 0xBC, 0x50, 0x41, 0x41, 0x40, 0x42,
-0x50, 0x33, 0x5F, 0x40, 0x41, 0x5E, 0x33, 0x00, 0x03, 0x00,
-0x28, 0xFF, 0xF6, 0x03, 0x15, 0x02, 0xC6, 0x00, 0x0F, 0x00,
-0x23, 0x00, 0x27, 0x00, 0x00, 0x13, 0x34, 0x36, 0x36, 0x33,
-0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
-0x26, 0x27, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35,
-0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x05, 0x01, 0x33,
-0x01, 0x82, 0x45, 0x78, 0x4C, 0x4D, 0x77, 0x45, 0x45, 0x77,
-0x4D, 0x4C, 0x78, 0x45, 0x5A, 0x35, 0x60, 0x82, 0x4C, 0x4D,
-0x81, 0x60, 0x35, 0x35, 0x60, 0x81, 0x4D, 0x4C, 0x82, 0x60,
-0x35, 0x01, 0x53, 0x01, 0x2C, 0x6E, 0xFE, 0xD4, 0x01, 0x5E,
-0x4F, 0x7C, 0x48, 0x48, 0x7C, 0x4F, 0x4F, 0x7C, 0x48, 0x48,
-0x7C, 0x4F, 0x4C, 0x84, 0x61, 0x37, 0x37, 0x61, 0x84, 0x4C,
-0x4D, 0x83, 0x61, 0x37, 0x37, 0x61, 0x83, 0x7F, 0xFE, 0xD4,
-0x01, 0x2C, 0x00, 0x03, 0x00, 0x50, 0x00, 0x00, 0x02, 0x26,
-0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1D, 0x00, 0x00,
-0x13, 0x13, 0x33, 0x03, 0x03, 0x11, 0x33, 0x11, 0x07, 0x33,
-0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x15,
-0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23,
-0xCD, 0xF0, 0x69, 0xFA, 0xDC, 0x55, 0x26, 0x8F, 0x2D, 0x45,
-0x27, 0x27, 0x45, 0x2D, 0x8F, 0x8F, 0x44, 0x6B, 0x3F, 0x3F,
-0x6B, 0x44, 0x8F, 0x01, 0x59, 0xFE, 0xA7, 0x01, 0x59, 0x01,
-0x63, 0xFD, 0x44, 0x02, 0xBC, 0x4B, 0x20, 0x3C, 0x2B, 0x2B,
-0x3C, 0x20, 0x4B, 0x33, 0x5F, 0x40, 0x41, 0x5E, 0x33, 0x00,
-0x01, 0x00, 0x26, 0xFF, 0xF6, 0x01, 0xF7, 0x02, 0xC6, 0x00,
-0x32, 0x00, 0x00, 0x37, 0x07, 0x1E, 0x02, 0x33, 0x32, 0x3E,
-0x02, 0x35, 0x34, 0x2E, 0x02, 0x27, 0x2E, 0x02, 0x35, 0x34,
-0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x37, 0x2E, 0x02, 0x23,
-0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x1E, 0x02,
-0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x26, 0x6A, 0x44, 0x17,
-0x49, 0x61, 0x39, 0x2A, 0x4D, 0x3D, 0x23, 0x22, 0x35, 0x3E,
-0x1C, 0x3D, 0x47, 0x1E, 0x34, 0x39, 0x29, 0x39, 0x28, 0x0D,
-0x49, 0x11, 0x3C, 0x55, 0x39, 0x3B, 0x5C, 0x34, 0x25, 0x3A,
-0x40, 0x1A, 0x28, 0x47, 0x2C, 0x44, 0x38, 0x2A, 0x42, 0x35,
-0xD4, 0x2E, 0x2E, 0x51, 0x31, 0x1C, 0x34, 0x4A, 0x2E, 0x30,
-0x45, 0x31, 0x20, 0x0A, 0x15, 0x2B, 0x31, 0x1D, 0x22, 0x37,
-0x20, 0x32, 0x1A, 0x2A, 0x25, 0x43, 0x2B, 0x2F, 0x52, 0x34,
-0x30, 0x42, 0x2D, 0x1D, 0x09, 0x0E, 0x23, 0x38, 0x2F, 0x30,
-0x3E, 0x24, 0x40, 0x00, 0x01, 0x00, 0x0A, 0x00, 0x00, 0x01,
-0xC7, 0x02, 0xBC, 0x00, 0x07, 0x00, 0x00, 0x13, 0x33, 0x11,
-0x33, 0x11, 0x33, 0x35, 0x21, 0x0A, 0xB4, 0x55, 0xB4, 0xFE,
-0x43, 0x02, 0x6C, 0xFD, 0x94, 0x02, 0x6C, 0x50, 0x00, 0x01,
-0x00, 0x4B, 0xFF, 0xF6, 0x02, 0x27, 0x02, 0xBC, 0x00, 0x15,
-0x00, 0x00, 0x13, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E,
-0x02, 0x35, 0x11, 0x23, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26,
-0x35, 0x11, 0x4B, 0x21, 0x3F, 0x58, 0x36, 0x36, 0x58, 0x3F,
-0x21, 0x55, 0x4E, 0x4B, 0x4B, 0x4E, 0x02, 0xBC, 0xFE, 0x2A,
-0x34, 0x58, 0x40, 0x24, 0x24, 0x40, 0x58, 0x34, 0x01, 0xD6,
-0xFE, 0x2A, 0x48, 0x58, 0x58, 0x48, 0x01, 0xD6, 0x00, 0x01,
-0x00, 0x05, 0xFF, 0xDD, 0x02, 0x8F, 0x02, 0xBC, 0x00, 0x05,
-0x00, 0x00, 0x25, 0x03, 0x23, 0x01, 0x01, 0x23, 0x01, 0x4A,
-0xE6, 0x5F, 0x01, 0x45, 0x01, 0x45, 0x5F, 0x9E, 0x02, 0x1E,
-0xFD, 0x21, 0x02, 0xDF, 0x00, 0x01, 0x00, 0x0A, 0xFF, 0xDD,
-0x03, 0xD4, 0x02, 0xDF, 0x00, 0x09, 0x00, 0x00, 0x25, 0x0B,
-0x02, 0x23, 0x01, 0x13, 0x13, 0x01, 0x23, 0x02, 0xBF, 0xD0,
-0xCC, 0xBA, 0x5F, 0x01, 0x13, 0xD2, 0xD2, 0x01, 0x13, 0x5F,
-0xB9, 0x02, 0x26, 0xFD, 0xDA, 0x02, 0x03, 0xFD, 0x21, 0x02,
-0x20, 0xFD, 0xE0, 0x02, 0xDF, 0x00, 0x01, 0x00, 0x0A, 0x00,
-0x00, 0x02, 0x21, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x00, 0x01,
-0x03, 0x03, 0x23, 0x13, 0x03, 0x33, 0x13, 0x13, 0x33, 0x03,
-0x13, 0x01, 0xAE, 0x95, 0x92, 0x64, 0xCB, 0xE4, 0x64, 0xAA,
-0xA5, 0x64, 0xDE, 0xCF, 0x02, 0xBC, 0xFE, 0xFD, 0x01, 0x03,
-0xFE, 0xB3, 0xFE, 0x91, 0x01, 0x25, 0xFE, 0xDB, 0x01, 0x6F,
-0x01, 0x4D, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x02, 0x2C,
-0x02, 0xBC, 0x00, 0x08, 0x00, 0x00, 0x01, 0x03, 0x03, 0x23,
-0x13, 0x11, 0x33, 0x11, 0x13, 0x01, 0xCD, 0xB5, 0xB4, 0x5F,
-0xE9, 0x55, 0xE9, 0x02, 0xBC, 0xFE, 0xBC, 0x01, 0x44, 0xFE,
-0x71, 0xFE, 0xD3, 0x01, 0x2E, 0x01, 0x8E, 0x00, 0x01, 0x00,
-0x0F, 0x00, 0x00, 0x02, 0x0D, 0x02, 0xBC, 0x00, 0x07, 0x00,
-0x00, 0x13, 0x21, 0x01, 0x21, 0x35, 0x21, 0x01, 0x21, 0x23,
-0x01, 0x5C, 0xFE, 0x90, 0x01, 0xEA, 0xFE, 0xA4, 0x01, 0x70,
-0xFE, 0x16, 0x02, 0x6C, 0xFD, 0x94, 0x50, 0x02, 0x6C, 0x00,
-0x01, 0x00, 0x64, 0xFF, 0x24, 0x01, 0x18, 0x03, 0x0C, 0x00,
-0x07, 0x00, 0x00, 0x13, 0x33, 0x35, 0x23, 0x11, 0x33, 0x35,
-0x23, 0xB3, 0x65, 0xB4, 0xB4, 0x65, 0x02, 0xC1, 0x4B, 0xFC,
-0x18, 0x4B, 0x00, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF4,
-0x02, 0xBC, 0x00, 0x03, 0x00, 0x00, 0x13, 0x01, 0x33, 0x01,
-0x0F, 0x01, 0x90, 0x55, 0xFE, 0x70, 0x02, 0xBC, 0xFD, 0x44,
-0x02, 0xBC, 0x00, 0x01, 0x00, 0x14, 0xFF, 0x24, 0x00, 0xC8,
-0x03, 0x0C, 0x00, 0x07, 0x00, 0x00, 0x17, 0x23, 0x15, 0x33,
-0x11, 0x23, 0x15, 0x33, 0x79, 0x65, 0xB4, 0xB4, 0x65, 0x91,
-0x4B, 0x03, 0xE8, 0x4B, 0x00, 0x01, 0x00, 0x41, 0x01, 0xCC,
-0x01, 0xBD, 0x02, 0xC6, 0x00, 0x06, 0x00, 0x00, 0x13, 0x17,
-0x33, 0x27, 0x23, 0x07, 0x33, 0xFF, 0x6E, 0x50, 0xAA, 0x28,
-0xAA, 0x50, 0x02, 0x6D, 0xA1, 0xFA, 0xFA, 0x00, 0x01, 0x00,
-0x00, 0xFF, 0x7B, 0x01, 0xF4, 0xFF, 0xB2, 0x00, 0x03, 0x00,
-0x00, 0x15, 0x21, 0x35, 0x21, 0x01, 0xF4, 0xFE, 0x0C, 0x85,
-0x37, 0x00, 0x01, 0x00, 0x4B, 0x01, 0xFE, 0x01, 0x2C, 0x02,
-0xBC, 0x00, 0x03, 0x00, 0x00, 0x13, 0x17, 0x37, 0x27, 0x4B,
-0xB4, 0x2D, 0x96, 0x02, 0x94, 0x96, 0x1E, 0xA0, 0x00, 0x02,
-0x00, 0x1E, 0xFF, 0xF6, 0x01, 0xA5, 0x01, 0xD6, 0x00, 0x1F,
-0x00, 0x33, 0x00, 0x00, 0x37, 0x34, 0x36, 0x36, 0x33, 0x32,
-0x16, 0x17, 0x35, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x15, 0x14,
-0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x27, 0x14, 0x06,
-0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x3E, 0x02, 0x33, 0x32,
-0x1E, 0x02, 0x15, 0x11, 0x33, 0x11, 0x34, 0x26, 0x26, 0x23,
-0x22, 0x06, 0x07, 0x6F, 0x18, 0x31, 0x27, 0x2A, 0x4A, 0x23,
-0x07, 0x28, 0x43, 0x32, 0x55, 0x5F, 0x2C, 0x49, 0x2A, 0x26,
-0x4D, 0x35, 0x10, 0x23, 0x3B, 0x25, 0x1D, 0x2D, 0x19, 0x0C,
-0x0B, 0x26, 0x37, 0x22, 0x15, 0x26, 0x1D, 0x10, 0x50, 0x2D,
-0x51, 0x36, 0x40, 0x5B, 0x1A, 0x8E, 0x19, 0x24, 0x14, 0x15,
-0x18, 0x2F, 0x09, 0x1D, 0x17, 0x51, 0x43, 0x2F, 0x42, 0x23,
-0x1C, 0x3A, 0x2C, 0x3C, 0x24, 0x37, 0x1E, 0x13, 0x26, 0xEE,
-0x08, 0x16, 0x10, 0x08, 0x12, 0x1F, 0x18, 0xFE, 0xC1, 0x01,
-0x4A, 0x2D, 0x3E, 0x21, 0x26, 0x13, 0x00, 0x03, 0x00, 0x46,
-0xFF, 0xF6, 0x02, 0x17, 0x03, 0x0C, 0x00, 0x03, 0x00, 0x13,
-0x00, 0x23, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x25, 0x34,
-0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
-0x33, 0x32, 0x36, 0x36, 0x27, 0x14, 0x06, 0x06, 0x23, 0x22,
-0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-0x96, 0x50, 0x50, 0x01, 0x81, 0x3E, 0x67, 0x3F, 0x39, 0x57,
-0x31, 0x31, 0x57, 0x39, 0x3F, 0x67, 0x3E, 0x51, 0x2B, 0x47,
-0x2B, 0x23, 0x44, 0x2C, 0x2C, 0x44, 0x23, 0x2B, 0x47, 0x2B,
-0x03, 0x0C, 0xFC, 0xF4, 0xE6, 0x4B, 0x6B, 0x3A, 0x3A, 0x6B,
-0x4B, 0x4A, 0x6C, 0x3A, 0x3A, 0x6C, 0x4A, 0x35, 0x4A, 0x26,
-0x26, 0x4A, 0x35, 0x35, 0x4A, 0x26, 0x26, 0x4A, 0x00, 0x01,
-0x00, 0x1E, 0xFF, 0xF6, 0x01, 0xAC, 0x01, 0xD6, 0x00, 0x1F,
-0x00, 0x00, 0x37, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-0x17, 0x35, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
-0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x35, 0x0E, 0x02, 0x23,
-0x22, 0x26, 0x26, 0x6F, 0x29, 0x47, 0x2D, 0x25, 0x41, 0x30,
-0x0A, 0x18, 0x59, 0x2F, 0x43, 0x6C, 0x3F, 0x3F, 0x6C, 0x43,
-0x2F, 0x59, 0x18, 0x0A, 0x30, 0x41, 0x25, 0x2D, 0x47, 0x29,
-0xE6, 0x30, 0x4B, 0x2A, 0x17, 0x26, 0x17, 0x64, 0x1C, 0x1F,
-0x3E, 0x6C, 0x46, 0x45, 0x6D, 0x3E, 0x1F, 0x1C, 0x64, 0x16,
-0x27, 0x17, 0x2B, 0x4A, 0x00, 0x03, 0x00, 0x23, 0xFF, 0xF6,
-0x01, 0xF4, 0x03, 0x0C, 0x00, 0x03, 0x00, 0x13, 0x00, 0x23,
-0x00, 0x00, 0x01, 0x11, 0x33, 0x11, 0x01, 0x14, 0x16, 0x16,
-0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
-0x06, 0x06, 0x17, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x01, 0xA4,
-0x50, 0xFE, 0x2F, 0x3E, 0x68, 0x3E, 0x3A, 0x56, 0x31, 0x31,
-0x56, 0x3A, 0x3E, 0x68, 0x3E, 0x51, 0x2B, 0x48, 0x2A, 0x23,
-0x44, 0x2C, 0x2C, 0x44, 0x23, 0x2A, 0x48, 0x2B, 0x03, 0x0C,
-0xFC, 0xF4, 0x03, 0x0C, 0xFD, 0xDA, 0x4A, 0x6C, 0x3A, 0x3A,
-0x6C, 0x4A, 0x4B, 0x6B, 0x3A, 0x3A, 0x6B, 0x4B, 0x35, 0x4A,
-0x26, 0x26, 0x4A, 0x35, 0x35, 0x4A, 0x26, 0x26, 0x4A, 0x00,
-0x01, 0x00, 0x23, 0xFF, 0xF6, 0x01, 0xE0, 0x01, 0xD6, 0x00,
-0x28, 0x00, 0x00, 0x17, 0x32, 0x36, 0x37, 0x27, 0x06, 0x06,
-0x23, 0x22, 0x26, 0x26, 0x35, 0x3E, 0x02, 0x33, 0x32, 0x16,
-0x16, 0x15, 0x14, 0x06, 0x07, 0x37, 0x21, 0x15, 0x21, 0x34,
-0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-0x14, 0x16, 0x16, 0xFD, 0x4A, 0x6D, 0x24, 0x41, 0x19, 0x48,
-0x2F, 0x2F, 0x42, 0x22, 0x01, 0x23, 0x41, 0x2E, 0x27, 0x3A,
-0x21, 0x06, 0x03, 0x20, 0xFE, 0xB6, 0x01, 0x89, 0x01, 0x34,
-0x61, 0x44, 0x44, 0x67, 0x39, 0x37, 0x63, 0x0A, 0x3B, 0x3A,
-0x29, 0x2A, 0x29, 0x28, 0x4C, 0x36, 0x35, 0x49, 0x27, 0x22,
-0x3C, 0x29, 0x07, 0x15, 0x05, 0x2E, 0x44, 0x02, 0x0F, 0x07,
-0x49, 0x6A, 0x39, 0x3C, 0x6C, 0x48, 0x47, 0x6C, 0x3D, 0x00,
-0x02, 0x00, 0x28, 0x00, 0x00, 0x01, 0x32, 0x03, 0x16, 0x00,
-0x03, 0x00, 0x16, 0x00, 0x00, 0x13, 0x15, 0x33, 0x35, 0x27,
-0x37, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11, 0x33,
-0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x28, 0xE6, 0x08,
-0x2C, 0x07, 0x19, 0x22, 0x16, 0x2A, 0x3B, 0x20, 0x50, 0x0C,
-0x15, 0x0F, 0x0C, 0x1B, 0x01, 0xCC, 0x4B, 0x4B, 0xE0, 0x42,
-0x0A, 0x12, 0x0C, 0x23, 0x46, 0x37, 0xFD, 0x8A, 0x02, 0x6C,
-0x21, 0x28, 0x11, 0x09, 0x00, 0x03, 0x00, 0x23, 0xFF, 0x1A,
-0x01, 0xF4, 0x01, 0xD6, 0x00, 0x13, 0x00, 0x23, 0x00, 0x34,
-0x00, 0x00, 0x17, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-0x35, 0x11, 0x23, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
-0x26, 0x35, 0x03, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x17, 0x34,
-0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06,
-0x23, 0x22, 0x26, 0x26, 0x2C, 0x3A, 0x67, 0x43, 0x3A, 0x68,
-0x42, 0x50, 0x2D, 0x44, 0x23, 0x2D, 0x42, 0x24, 0x5A, 0x3E,
-0x68, 0x3E, 0x3A, 0x56, 0x31, 0x31, 0x56, 0x3A, 0x3E, 0x68,
-0x3E, 0x51, 0x2B, 0x48, 0x2A, 0x1A, 0x34, 0x2B, 0x1A, 0x2C,
-0x44, 0x23, 0x2A, 0x48, 0x2B, 0x1E, 0x3B, 0x5B, 0x32, 0x36,
-0x6B, 0x4F, 0x01, 0xC2, 0xFE, 0x3E, 0x3A, 0x49, 0x22, 0x23,
-0x39, 0x21, 0x01, 0x04, 0x4A, 0x6C, 0x3A, 0x3A, 0x6C, 0x4A,
-0x4B, 0x6B, 0x3A, 0x3A, 0x6B, 0x4B, 0x35, 0x4A, 0x26, 0x16,
-0x2A, 0x3D, 0x28, 0x35, 0x4A, 0x26, 0x26, 0x4A, 0x00, 0x02,
-0x00, 0x4B, 0x00, 0x00, 0x01, 0xC2, 0x03, 0x0C, 0x00, 0x03,
-0x00, 0x16, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x13, 0x11,
-0x33, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-0x33, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x9B, 0x50, 0x50,
-0xD7, 0x50, 0x27, 0x47, 0x30, 0x30, 0x49, 0x2A, 0x1A, 0x1D,
-0x35, 0x23, 0x31, 0x31, 0x03, 0x0C, 0xFC, 0xF4, 0x01, 0x18,
-0xFE, 0xE8, 0x01, 0x22, 0x3C, 0x50, 0x28, 0x32, 0x55, 0x37,
-0x21, 0x34, 0x1E, 0x3A, 0x00, 0x02, 0x00, 0x4B, 0x00, 0x00,
-0x00, 0xB9, 0x02, 0xC1, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00,
-0x13, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-0x22, 0x06, 0x17, 0x11, 0x33, 0x11, 0x4B, 0x21, 0x16, 0x17,
-0x20, 0x20, 0x17, 0x16, 0x21, 0x0F, 0x50, 0x02, 0x8A, 0x16,
-0x21, 0x21, 0x16, 0x17, 0x20, 0x20, 0xD5, 0xFE, 0x34, 0x01,
-0xCC, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x24, 0x00, 0xAA, 0x02,
-0xC0, 0x00, 0x0B, 0x00, 0x1E, 0x00, 0x00, 0x13, 0x14, 0x16,
-0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x03,
-0x07, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x23,
-0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x3E, 0x20, 0x16,
-0x17, 0x1F, 0x1F, 0x17, 0x16, 0x20, 0x4F, 0x2C, 0x0A, 0x1A,
-0x20, 0x14, 0x2A, 0x3C, 0x1F, 0x50, 0x0A, 0x15, 0x11, 0x10,
-0x19, 0x02, 0x8A, 0x16, 0x20, 0x20, 0x16, 0x17, 0x1F, 0x1F,
-0xFC, 0xED, 0x42, 0x0D, 0x12, 0x09, 0x26, 0x48, 0x32, 0x02,
-0x08, 0xFE, 0x02, 0x20, 0x28, 0x12, 0x0E, 0x00, 0x02, 0x00,
-0x46, 0x00, 0x00, 0x01, 0xB8, 0x03, 0x0C, 0x00, 0x03, 0x00,
-0x09, 0x00, 0x00, 0x13, 0x11, 0x33, 0x11, 0x13, 0x07, 0x13,
-0x33, 0x03, 0x37, 0x46, 0x50, 0xAA, 0xC8, 0xDC, 0x64, 0xDC,
-0xC8, 0x03, 0x0C, 0xFC, 0xF4, 0x03, 0x0C, 0xFE, 0xC0, 0xBE,
-0xFE, 0xF2, 0x01, 0x0E, 0xBE, 0x00, 0x01, 0x00, 0x4B, 0x00,
-0x00, 0x00, 0x9B, 0x03, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x13,
-0x11, 0x33, 0x11, 0x4B, 0x50, 0x03, 0x0C, 0xFC, 0xF4, 0x03,
-0x0C, 0x00, 0x01, 0x00, 0x4B, 0x00, 0x00, 0x02, 0xC1, 0x01,
-0xD6, 0x00, 0x25, 0x00, 0x00, 0x01, 0x34, 0x26, 0x26, 0x23,
-0x22, 0x06, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35,
-0x23, 0x11, 0x33, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-0x15, 0x11, 0x33, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-0x15, 0x11, 0x33, 0x02, 0xC1, 0x23, 0x42, 0x2F, 0x2E, 0x48,
-0x18, 0x10, 0x45, 0x30, 0x2B, 0x3F, 0x15, 0x50, 0x50, 0x1A,
-0x30, 0x21, 0x2D, 0x2B, 0x50, 0x1A, 0x30, 0x21, 0x2D, 0x2B,
-0x50, 0x01, 0x22, 0x39, 0x51, 0x2A, 0x2B, 0x2B, 0x29, 0x2D,
-0x26, 0x27, 0x43, 0xFE, 0x34, 0x01, 0x18, 0x24, 0x34, 0x1B,
-0x38, 0x3B, 0xFE, 0xE8, 0x01, 0x18, 0x24, 0x34, 0x1B, 0x38,
-0x3B, 0xFE, 0xE8, 0x00, 0x01, 0x00, 0x4B, 0x00, 0x00, 0x01,
-0xC2, 0x01, 0xD6, 0x00, 0x14, 0x00, 0x00, 0x01, 0x11, 0x33,
-0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x23, 0x11,
-0x33, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x01, 0x72,
-0x50, 0x55, 0x49, 0x2D, 0x45, 0x17, 0x50, 0x50, 0x1D, 0x35,
-0x23, 0x30, 0x32, 0x01, 0x18, 0xFE, 0xE8, 0x01, 0x22, 0x53,
-0x61, 0x28, 0x2A, 0x48, 0xFE, 0x34, 0x01, 0x18, 0x22, 0x34,
-0x1D, 0x3A, 0x00, 0x02, 0x00, 0x23, 0xFF, 0xF6, 0x01, 0xFF,
-0x01, 0xD6, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x37, 0x14,
-0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
-0x23, 0x22, 0x06, 0x06, 0x17, 0x34, 0x36, 0x36, 0x33, 0x32,
-0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
-0x23, 0x3F, 0x6C, 0x43, 0x44, 0x6B, 0x3F, 0x3F, 0x6B, 0x44,
-0x43, 0x6C, 0x3F, 0x51, 0x29, 0x47, 0x2D, 0x2D, 0x47, 0x29,
-0x29, 0x47, 0x2D, 0x2D, 0x47, 0x29, 0xE6, 0x45, 0x6D, 0x3E,
-0x3E, 0x6D, 0x45, 0x46, 0x6C, 0x3E, 0x3E, 0x6C, 0x46, 0x30,
-0x4B, 0x2A, 0x2A, 0x4B, 0x30, 0x30, 0x4A, 0x2B, 0x2B, 0x4A,
-0x00, 0x03, 0x00, 0x46, 0xFF, 0x24, 0x02, 0x17, 0x01, 0xD6,
-0x00, 0x03, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00, 0x17, 0x11,
-0x23, 0x11, 0x01, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
-0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x27, 0x14,
-0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
-0x33, 0x32, 0x16, 0x16, 0x96, 0x50, 0x01, 0xD1, 0x3E, 0x67,
-0x3F, 0x39, 0x57, 0x31, 0x31, 0x57, 0x39, 0x3F, 0x67, 0x3E,
-0x51, 0x2B, 0x47, 0x2B, 0x23, 0x44, 0x2C, 0x2C, 0x44, 0x23,
-0x2B, 0x47, 0x2B, 0xDC, 0x02, 0xA8, 0xFD, 0x58, 0x01, 0xC2,
-0x4B, 0x6B, 0x3A, 0x3A, 0x6B, 0x4B, 0x4A, 0x6C, 0x3A, 0x3A,
-0x6C, 0x4A, 0x35, 0x4A, 0x26, 0x26, 0x4A, 0x35, 0x35, 0x4A,
-0x26, 0x26, 0x4A, 0x00, 0x03, 0x00, 0x23, 0xFF, 0x24, 0x01,
-0xF4, 0x01, 0xD6, 0x00, 0x03, 0x00, 0x13, 0x00, 0x23, 0x00,
-0x00, 0x05, 0x33, 0x11, 0x23, 0x05, 0x14, 0x16, 0x16, 0x33,
-0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-0x06, 0x17, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
-0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x01, 0xA4, 0x50,
-0x50, 0xFE, 0x7F, 0x3E, 0x68, 0x3E, 0x3A, 0x56, 0x31, 0x31,
-0x56, 0x3A, 0x3E, 0x68, 0x3E, 0x51, 0x2B, 0x48, 0x2A, 0x23,
-0x44, 0x2C, 0x2C, 0x44, 0x23, 0x2A, 0x48, 0x2B, 0xDC, 0x02,
-0xA8, 0xE6, 0x4A, 0x6C, 0x3A, 0x3A, 0x6C, 0x4A, 0x4B, 0x6B,
-0x3A, 0x3A, 0x6B, 0x4B, 0x35, 0x4A, 0x26, 0x26, 0x4A, 0x35,
-0x35, 0x4A, 0x26, 0x26, 0x4A, 0x00, 0x02, 0x00, 0x4B, 0x00,
-0x00, 0x01, 0x52, 0x01, 0xD6, 0x00, 0x03, 0x00, 0x13, 0x00,
-0x00, 0x13, 0x23, 0x11, 0x33, 0x13, 0x37, 0x26, 0x26, 0x23,
-0x22, 0x06, 0x06, 0x15, 0x33, 0x34, 0x36, 0x36, 0x33, 0x32,
-0x16, 0x9B, 0x50, 0x50, 0x8B, 0x2C, 0x12, 0x2B, 0x19, 0x20,
-0x3E, 0x27, 0x24, 0x0D, 0x22, 0x1E, 0x14, 0x1A, 0x01, 0xCC,
-0xFE, 0x34, 0x01, 0x74, 0x42, 0x13, 0x0D, 0x32, 0x55, 0x37,
-0x21, 0x34, 0x1E, 0x0B, 0x00, 0x01, 0x00, 0x1F, 0xFF, 0xF6,
-0x01, 0x75, 0x01, 0xD6, 0x00, 0x2D, 0x00, 0x00, 0x37, 0x07,
-0x1E, 0x02, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x27,
-0x2E, 0x02, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x37,
-0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
-0x17, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x26,
-0x5E, 0x3F, 0x0D, 0x33, 0x4A, 0x2E, 0x47, 0x57, 0x27, 0x42,
-0x28, 0x18, 0x2C, 0x1C, 0x24, 0x19, 0x24, 0x39, 0x13, 0x40,
-0x0E, 0x32, 0x41, 0x25, 0x25, 0x45, 0x2B, 0x29, 0x3D, 0x1E,
-0x1B, 0x30, 0x1F, 0x27, 0x22, 0x1C, 0x2F, 0x24, 0x8D, 0x27,
-0x1B, 0x34, 0x21, 0x50, 0x3C, 0x29, 0x34, 0x25, 0x10, 0x0A,
-0x16, 0x1C, 0x12, 0x17, 0x16, 0x22, 0x1A, 0x29, 0x1A, 0x28,
-0x18, 0x1A, 0x36, 0x29, 0x28, 0x35, 0x21, 0x0C, 0x0A, 0x17,
-0x21, 0x18, 0x1B, 0x1F, 0x15, 0x24, 0x00, 0x02, 0x00, 0x05,
-0x00, 0x00, 0x00, 0xEB, 0x02, 0x6C, 0x00, 0x03, 0x00, 0x07,
-0x00, 0x00, 0x13, 0x15, 0x33, 0x35, 0x27, 0x11, 0x33, 0x11,
-0x05, 0xE6, 0x9B, 0x50, 0x01, 0xCC, 0x4B, 0x4B, 0xA0, 0xFD,
-0x94, 0x02, 0x6C, 0x00, 0x01, 0x00, 0x4B, 0xFF, 0xF6, 0x01,
-0xC2, 0x01, 0xCC, 0x00, 0x14, 0x00, 0x00, 0x37, 0x11, 0x23,
-0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x33, 0x11,
-0x23, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x9B, 0x50,
-0x56, 0x48, 0x2E, 0x44, 0x17, 0x50, 0x50, 0x1D, 0x35, 0x23,
-0x30, 0x32, 0xB4, 0x01, 0x18, 0xFE, 0xDE, 0x52, 0x62, 0x29,
-0x29, 0x48, 0x01, 0xCC, 0xFE, 0xE8, 0x22, 0x34, 0x1D, 0x3C,
-0x00, 0x01, 0x00, 0x00, 0xFF, 0xDD, 0x01, 0xB8, 0x01, 0xCC,
-0x00, 0x05, 0x00, 0x00, 0x11, 0x13, 0x13, 0x23, 0x03, 0x03,
-0xDC, 0xDC, 0x5A, 0x82, 0x82, 0x01, 0xCC, 0xFE, 0x11, 0x01,
-0xEF, 0xFE, 0xBB, 0x01, 0x45, 0x00, 0x01, 0x00, 0x05, 0xFF,
-0xDD, 0x02, 0xA3, 0x01, 0xEF, 0x00, 0x09, 0x00, 0x00, 0x1B,
-0x04, 0x23, 0x0B, 0x03, 0x05, 0xC8, 0x83, 0x8B, 0xC8, 0x5A,
-0x74, 0x86, 0x7D, 0x73, 0x01, 0xCC, 0xFE, 0x11, 0x01, 0x4F,
-0xFE, 0xB1, 0x01, 0xEF, 0xFE, 0xD3, 0x01, 0x50, 0xFE, 0xB2,
-0x01, 0x2B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4,
-0x01, 0xCC, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x07, 0x27, 0x23,
-0x17, 0x07, 0x33, 0x37, 0x17, 0x33, 0x27, 0x37, 0x01, 0x40,
-0x6E, 0x6E, 0x5A, 0x9D, 0xA7, 0x5A, 0x78, 0x78, 0x5A, 0xA7,
-0x9D, 0x01, 0xCC, 0xA0, 0xA0, 0xDF, 0xED, 0xAE, 0xAE, 0xED,
-0xDF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x24, 0x01, 0xB8, 0x01,
-0xCC, 0x00, 0x08, 0x00, 0x00, 0x01, 0x23, 0x03, 0x17, 0x03,
-0x23, 0x13, 0x03, 0x33, 0x01, 0xB8, 0x5A, 0x8E, 0x21, 0x92,
-0x5F, 0xB0, 0x7E, 0x5A, 0x01, 0xCC, 0xFE, 0x9C, 0x04, 0x01,
-0x68, 0xFE, 0x75, 0xFE, 0xE3, 0x00, 0x01, 0x00, 0x0F, 0x00,
-0x00, 0x01, 0xBD, 0x01, 0xCC, 0x00, 0x07, 0x00, 0x00, 0x01,
-0x01, 0x21, 0x35, 0x21, 0x01, 0x21, 0x15, 0x01, 0x2C, 0xFE,
-0xE3, 0x01, 0x9A, 0xFE, 0xF7, 0x01, 0x1D, 0xFE, 0x70, 0x01,
-0x81, 0xFE, 0x7F, 0x4B, 0x01, 0x81, 0x4B, 0x00, 0x01, 0x00,
-0x32, 0xFF, 0x38, 0x01, 0x05, 0x03, 0x0C, 0x00, 0x29, 0x00,
-0x00, 0x13, 0x34, 0x36, 0x33, 0x33, 0x35, 0x23, 0x22, 0x06,
-0x06, 0x15, 0x15, 0x14, 0x06, 0x07, 0x15, 0x16, 0x16, 0x15,
-0x15, 0x14, 0x16, 0x16, 0x33, 0x33, 0x35, 0x23, 0x22, 0x26,
-0x35, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x15, 0x32, 0x3E, 0x02,
-0x35, 0xB2, 0x1A, 0x16, 0x23, 0x3C, 0x16, 0x30, 0x21, 0x19,
-0x17, 0x17, 0x19, 0x21, 0x30, 0x16, 0x3C, 0x23, 0x16, 0x1A,
-0x05, 0x15, 0x2E, 0x29, 0x29, 0x2E, 0x15, 0x05, 0x02, 0x94,
-0x14, 0x1E, 0x46, 0x1D, 0x3D, 0x32, 0xD2, 0x39, 0x2D, 0x08,
-0x3C, 0x07, 0x2E, 0x39, 0xD2, 0x31, 0x3E, 0x1D, 0x46, 0x1F,
-0x13, 0xAA, 0x21, 0x4A, 0x3F, 0x28, 0x14, 0x28, 0x3F, 0x4A,
-0x21, 0x00, 0x01, 0x00, 0x64, 0xFF, 0x29, 0x00, 0xAE, 0x03,
-0x11, 0x00, 0x03, 0x00, 0x00, 0x13, 0x11, 0x33, 0x11, 0x64,
-0x4A, 0x03, 0x11, 0xFC, 0x18, 0x03, 0xE8, 0x00, 0x01, 0x00,
-0x3B, 0xFF, 0x38, 0x01, 0x0E, 0x03, 0x0C, 0x00, 0x29, 0x00,
-0x00, 0x17, 0x14, 0x06, 0x23, 0x23, 0x15, 0x33, 0x32, 0x36,
-0x36, 0x35, 0x35, 0x34, 0x36, 0x37, 0x35, 0x26, 0x26, 0x35,
-0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x15, 0x33, 0x32, 0x16,
-0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x35, 0x22, 0x0E, 0x02,
-0x15, 0x8E, 0x19, 0x17, 0x23, 0x3C, 0x16, 0x30, 0x21, 0x1A,
-0x16, 0x16, 0x1A, 0x21, 0x30, 0x16, 0x3C, 0x23, 0x17, 0x19,
-0x05, 0x15, 0x2E, 0x29, 0x29, 0x2E, 0x15, 0x05, 0x50, 0x13,
-0x1F, 0x46, 0x1D, 0x3E, 0x31, 0xD2, 0x39, 0x2E, 0x07, 0x3C,
-0x08, 0x2D, 0x39, 0xD2, 0x32, 0x3D, 0x1D, 0x46, 0x1E, 0x14,
-0xAA, 0x21, 0x4A, 0x3F, 0x28, 0x14, 0x28, 0x3F, 0x4A, 0x21,
-0x00, 0x01, 0x00, 0x41, 0x00, 0xAC, 0x01, 0xFE, 0x01, 0x47,
-0x00, 0x2C, 0x00, 0x00, 0x37, 0x26, 0x26, 0x35, 0x34, 0x36,
-0x33, 0x32, 0x16, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
-0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x27, 0x16, 0x16,
-0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x2E, 0x02, 0x23,
-0x22, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x17, 0x8E, 0x02,
-0x02, 0x1C, 0x1B, 0x0D, 0x1C, 0x1E, 0x0F, 0x20, 0x3A, 0x19,
-0x1B, 0x30, 0x13, 0x0D, 0x09, 0x02, 0x02, 0x4F, 0x03, 0x02,
-0x14, 0x16, 0x0D, 0x25, 0x17, 0x15, 0x2A, 0x28, 0x14, 0x1F,
-0x36, 0x14, 0x0D, 0x0B, 0x03, 0xB0, 0x06, 0x0B, 0x05, 0x1A,
-0x1D, 0x07, 0x0E, 0x0C, 0x18, 0x18, 0x16, 0x19, 0x11, 0x27,
-0x0F, 0x08, 0x0E, 0x06, 0x05, 0x07, 0x0E, 0x06, 0x18, 0x19,
-0x0F, 0x11, 0x10, 0x15, 0x0B, 0x1A, 0x1A, 0x12, 0x24, 0x10,
-0x0D, 0x0B, 0x00, 0x03, 0x00, 0x51, 0xFF, 0x90, 0x01, 0xDF,
-0x02, 0x42, 0x00, 0x03, 0x00, 0x21, 0x00, 0x25, 0x00, 0x00,
-0x25, 0x15, 0x33, 0x35, 0x27, 0x34, 0x36, 0x36, 0x33, 0x32,
-0x16, 0x17, 0x35, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x35, 0x06, 0x06,
-0x23, 0x22, 0x26, 0x26, 0x13, 0x15, 0x33, 0x35, 0x01, 0x18,
-0x40, 0xB6, 0x29, 0x47, 0x2D, 0x38, 0x58, 0x10, 0x18, 0x59,
-0x2F, 0x43, 0x6C, 0x3F, 0x3F, 0x6C, 0x43, 0x2F, 0x59, 0x18,
-0x10, 0x58, 0x38, 0x2D, 0x47, 0x29, 0x76, 0x40, 0x26, 0x96,
-0x96, 0xC0, 0x30, 0x4B, 0x2A, 0x32, 0x22, 0x64, 0x1C, 0x1F,
-0x3E, 0x6C, 0x46, 0x45, 0x6D, 0x3E, 0x1F, 0x1C, 0x64, 0x22,
-0x32, 0x2B, 0x4A, 0x01, 0x8C, 0x96, 0x96, 0x00, 0x02, 0x00,
-0x40, 0x00, 0x00, 0x02, 0x09, 0x02, 0xC6, 0x00, 0x03, 0x00,
-0x2F, 0x00, 0x00, 0x13, 0x15, 0x21, 0x35, 0x37, 0x37, 0x2E,
-0x03, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x03, 0x15,
-0x14, 0x06, 0x06, 0x07, 0x21, 0x35, 0x21, 0x07, 0x3E, 0x03,
-0x35, 0x34, 0x2E, 0x03, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
-0x1E, 0x02, 0x43, 0x01, 0x68, 0x17, 0x47, 0x02, 0x1A, 0x30,
-0x4A, 0x32, 0x3B, 0x5D, 0x35, 0x14, 0x1F, 0x1E, 0x14, 0x24,
-0x44, 0x31, 0x01, 0xC5, 0xFE, 0x95, 0x02, 0x1C, 0x34, 0x2A,
-0x18, 0x13, 0x1C, 0x1D, 0x13, 0x22, 0x36, 0x1E, 0x20, 0x30,
-0x1F, 0x11, 0x01, 0x72, 0x4B, 0x4B, 0x6D, 0x1D, 0x1E, 0x46,
-0x3E, 0x28, 0x2E, 0x56, 0x3C, 0x29, 0x3D, 0x31, 0x2C, 0x2E,
-0x1C, 0x2C, 0x4B, 0x4F, 0x33, 0x50, 0x1E, 0x08, 0x26, 0x39,
-0x47, 0x28, 0x22, 0x32, 0x2A, 0x2B, 0x34, 0x23, 0x26, 0x2F,
-0x15, 0x19, 0x2A, 0x35, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x00,
-0x02, 0x35, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00, 0x10,
-0x00, 0x00, 0x13, 0x21, 0x35, 0x21, 0x15, 0x21, 0x35, 0x21,
-0x01, 0x03, 0x03, 0x23, 0x13, 0x11, 0x33, 0x11, 0x13, 0x2D,
-0x01, 0xE5, 0xFE, 0x1B, 0x01, 0xE5, 0xFE, 0x1B, 0x01, 0xAA,
-0xB5, 0xB4, 0x5F, 0xE9, 0x56, 0xE7, 0x01, 0x22, 0x4B, 0xE1,
-0x4B, 0x01, 0xE5, 0xFE, 0xBC, 0x01, 0x44, 0xFE, 0x73, 0xFE,
-0xD1, 0x01, 0x32, 0x01, 0x8A, 0x00, 0x02, 0x00, 0x1E, 0xFF,
-0xF6, 0x01, 0x7A, 0x02, 0xC6, 0x00, 0x2C, 0x00, 0x59, 0x00,
-0x00, 0x01, 0x37, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15,
-0x14, 0x1E, 0x02, 0x17, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06,
-0x23, 0x15, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x27,
-0x2E, 0x03, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-0x03, 0x07, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34,
-0x26, 0x26, 0x27, 0x2E, 0x03, 0x35, 0x34, 0x36, 0x36, 0x37,
-0x35, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x16, 0x17, 0x1E,
-0x02, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x01,
-0x36, 0x40, 0x09, 0x33, 0x45, 0x25, 0x25, 0x44, 0x2C, 0x17,
-0x27, 0x2E, 0x18, 0x1B, 0x2F, 0x1E, 0x16, 0x26, 0x19, 0x25,
-0x3E, 0x2D, 0x18, 0x24, 0x3A, 0x21, 0x13, 0x28, 0x21, 0x14,
-0x12, 0x20, 0x14, 0x13, 0x27, 0x21, 0xCC, 0x42, 0x07, 0x35,
-0x4E, 0x2A, 0x25, 0x3E, 0x2D, 0x18, 0x24, 0x3A, 0x21, 0x13,
-0x28, 0x21, 0x14, 0x13, 0x28, 0x1E, 0x2B, 0x3F, 0x2A, 0x15,
-0x28, 0x3D, 0x1F, 0x1B, 0x2F, 0x1E, 0x13, 0x24, 0x19, 0x1C,
-0x32, 0x23, 0x02, 0x43, 0x29, 0x1A, 0x28, 0x18, 0x1D, 0x36,
-0x26, 0x1D, 0x2A, 0x1F, 0x17, 0x09, 0x0A, 0x18, 0x21, 0x19,
-0x14, 0x29, 0x1B, 0x23, 0x0D, 0x1E, 0x32, 0x25, 0x22, 0x33,
-0x26, 0x0D, 0x08, 0x12, 0x14, 0x18, 0x0D, 0x10, 0x13, 0x0A,
-0x0C, 0x18, 0xFE, 0x4B, 0x26, 0x25, 0x3D, 0x23, 0x10, 0x22,
-0x35, 0x25, 0x22, 0x33, 0x26, 0x0D, 0x08, 0x10, 0x15, 0x21,
-0x19, 0x15, 0x1E, 0x18, 0x0A, 0x1A, 0x10, 0x20, 0x2C, 0x1D,
-0x26, 0x38, 0x25, 0x0D, 0x0A, 0x18, 0x21, 0x19, 0x14, 0x1A,
-0x0C, 0x19, 0x2B, 0x00, 0x02, 0x00, 0x14, 0x01, 0xE0, 0x01,
-0x02, 0x02, 0xD0, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x00, 0x13,
-0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
-0x06, 0x17, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
-0x23, 0x22, 0x26, 0x14, 0x44, 0x33, 0x33, 0x44, 0x44, 0x33,
-0x33, 0x44, 0x28, 0x2D, 0x22, 0x22, 0x2D, 0x2D, 0x22, 0x22,
-0x2D, 0x02, 0x58, 0x34, 0x44, 0x44, 0x34, 0x35, 0x43, 0x43,
-0x35, 0x24, 0x2E, 0x2E, 0x24, 0x24, 0x2E, 0x2E, 0x00, 0x04,
-0x00, 0x05, 0x00, 0x00, 0x02, 0x8F, 0x03, 0x89, 0x00, 0x03,
-0x00, 0x0D, 0x00, 0x19, 0x00, 0x25, 0x00, 0x00, 0x37, 0x21,
-0x27, 0x21, 0x37, 0x13, 0x17, 0x17, 0x33, 0x01, 0x01, 0x33,
-0x37, 0x37, 0x13, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34,
-0x26, 0x23, 0x22, 0x06, 0x07, 0x14, 0x16, 0x33, 0x32, 0x36,
-0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x93, 0x01, 0x72, 0x1E,
-0xFE, 0xCA, 0x99, 0x78, 0x08, 0x66, 0x5F, 0xFE, 0xBB, 0xFE,
-0xBB, 0x5F, 0x68, 0x08, 0xA3, 0x21, 0x16, 0x17, 0x20, 0x20,
-0x17, 0x16, 0x21, 0xC8, 0x21, 0x16, 0x17, 0x20, 0x20, 0x17,
-0x16, 0x21, 0xD2, 0x50, 0xFC, 0xFE, 0xE6, 0x14, 0xF0, 0x02,
-0xDF, 0xFD, 0x21, 0xF6, 0x12, 0x02, 0x4A, 0x16, 0x21, 0x21,
-0x16, 0x17, 0x20, 0x20, 0x17, 0x16, 0x21, 0x21, 0x16, 0x17,
-0x20, 0x20, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x02, 0x8F,
-0x03, 0x82, 0x00, 0x03, 0x00, 0x0D, 0x00, 0x19, 0x00, 0x25,
-0x00, 0x00, 0x37, 0x21, 0x27, 0x21, 0x37, 0x13, 0x17, 0x17,
-0x33, 0x01, 0x01, 0x33, 0x37, 0x37, 0x13, 0x14, 0x16, 0x33,
-0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x17, 0x34,
-0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26,
-0x93, 0x01, 0x72, 0x1E, 0xFE, 0xCA, 0x99, 0x78, 0x08, 0x66,
-0x5F, 0xFE, 0xBB, 0xFE, 0xBB, 0x5F, 0x68, 0x08, 0x10, 0x3F,
-0x27, 0x27, 0x3F, 0x3F, 0x27, 0x27, 0x3F, 0x33, 0x20, 0x13,
-0x13, 0x20, 0x20, 0x13, 0x13, 0x20, 0xD2, 0x50, 0xFC, 0xFE,
-0xE6, 0x14, 0xF0, 0x02, 0xDF, 0xFD, 0x21, 0xF6, 0x12, 0x02,
-0x16, 0x2D, 0x37, 0x37, 0x2D, 0x2D, 0x37, 0x37, 0x2D, 0x19,
-0x1C, 0x1C, 0x19, 0x19, 0x1C, 0x1C, 0x00, 0x06, 0x00, 0x05,
-0x00, 0x00, 0x03, 0x7A, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07,
-0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
-0x37, 0x21, 0x35, 0x21, 0x13, 0x01, 0x33, 0x01, 0x13, 0x21,
-0x35, 0x21, 0x13, 0x21, 0x35, 0x21, 0x13, 0x21, 0x35, 0x21,
-0x03, 0x11, 0x33, 0x11, 0xD9, 0x01, 0x2C, 0xFE, 0xD4, 0xDA,
-0xFE, 0x52, 0x5F, 0x01, 0x94, 0x21, 0x01, 0x61, 0xFE, 0x9F,
-0x08, 0x01, 0x59, 0xFE, 0x39, 0x66, 0x01, 0x4D, 0xFE, 0xB3,
-0x2F, 0x55, 0xD2, 0x50, 0x01, 0x9A, 0xFD, 0x44, 0x02, 0x94,
-0xFD, 0x6C, 0x50, 0x02, 0x1C, 0x50, 0xFE, 0x98, 0x50, 0x01,
-0x18, 0xFD, 0x44, 0x02, 0xBC, 0x00, 0x02, 0x00, 0x28, 0xFF,
-0x23, 0x02, 0x67, 0x02, 0xC6, 0x00, 0x21, 0x00, 0x3F, 0x00,
-0x00, 0x13, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17,
-0x35, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E,
-0x02, 0x33, 0x32, 0x36, 0x37, 0x35, 0x0E, 0x02, 0x23, 0x22,
-0x26, 0x26, 0x17, 0x07, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15,
-0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x07, 0x16, 0x16, 0x33,
-0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x22,
-0x23, 0x37, 0x82, 0x49, 0x76, 0x45, 0x32, 0x53, 0x44, 0x18,
-0x2C, 0x68, 0x4D, 0x49, 0x7F, 0x60, 0x36, 0x36, 0x60, 0x7F,
-0x49, 0x4D, 0x68, 0x2C, 0x18, 0x44, 0x53, 0x32, 0x45, 0x76,
-0x49, 0xFA, 0x56, 0x10, 0x23, 0x07, 0x1A, 0x18, 0x18, 0x1A,
-0x13, 0x17, 0x0E, 0x22, 0x15, 0x29, 0x1C, 0x1C, 0x30, 0x1E,
-0x16, 0x21, 0x11, 0x02, 0x05, 0x02, 0x3F, 0x01, 0x5E, 0x52,
-0x7B, 0x46, 0x1A, 0x2F, 0x1F, 0x70, 0x27, 0x26, 0x35, 0x61,
-0x84, 0x4E, 0x4E, 0x84, 0x61, 0x35, 0x26, 0x27, 0x70, 0x1F,
-0x2F, 0x1A, 0x46, 0x7C, 0xD2, 0xA8, 0x0B, 0x07, 0x12, 0x12,
-0x12, 0x16, 0x0C, 0x0C, 0x28, 0x15, 0x11, 0x16, 0x2A, 0x1E,
-0x19, 0x20, 0x11, 0x70, 0x00, 0x05, 0x00, 0x50, 0x00, 0x00,
-0x01, 0xE0, 0x03, 0xC0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
-0x00, 0x0F, 0x00, 0x13, 0x00, 0x00, 0x33, 0x21, 0x35, 0x21,
-0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x03, 0x11,
-0x33, 0x11, 0x37, 0x27, 0x07, 0x17, 0x7F, 0x01, 0x61, 0xFE,
-0x9F, 0x01, 0x61, 0xFE, 0x9F, 0x01, 0x4D, 0xFE, 0xB3, 0x2F,
-0x55, 0xF5, 0x4B, 0x96, 0x2D, 0x50, 0x02, 0x1C, 0x50, 0xFE,
-0x98, 0x50, 0x01, 0x18, 0xFD, 0x44, 0x02, 0xBC, 0xDC, 0x28,
-0xA0, 0x1E, 0x00, 0x02, 0x00, 0x50, 0xFF, 0xDD, 0x02, 0xB7,
-0x03, 0x6B, 0x00, 0x07, 0x00, 0x21, 0x00, 0x00, 0x01, 0x11,
-0x01, 0x11, 0x33, 0x11, 0x01, 0x11, 0x25, 0x17, 0x34, 0x36,
-0x36, 0x33, 0x32, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37,
-0x27, 0x06, 0x06, 0x23, 0x22, 0x2E, 0x02, 0x23, 0x22, 0x06,
-0x06, 0x02, 0x62, 0xFD, 0xEE, 0x55, 0x02, 0x12, 0xFE, 0x20,
-0x35, 0x08, 0x16, 0x14, 0x17, 0x21, 0x26, 0x1B, 0x19, 0x2A,
-0x1F, 0x08, 0x2E, 0x0F, 0x1B, 0x0E, 0x14, 0x1A, 0x17, 0x1F,
-0x18, 0x16, 0x2D, 0x20, 0x02, 0xBC, 0xFD, 0xF7, 0x02, 0x2C,
-0xFD, 0x21, 0x02, 0x09, 0xFD, 0xD4, 0x02, 0xDF, 0x5C, 0x25,
-0x08, 0x18, 0x13, 0x17, 0x18, 0x15, 0x22, 0x12, 0x2B, 0x18,
-0x18, 0x0E, 0x13, 0x0E, 0x15, 0x24, 0x00, 0x04, 0x00, 0x28,
-0xFF, 0xF6, 0x02, 0xEE, 0x03, 0x70, 0x00, 0x0F, 0x00, 0x23,
-0x00, 0x2F, 0x00, 0x3B, 0x00, 0x00, 0x13, 0x34, 0x36, 0x36,
-0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22,
-0x26, 0x26, 0x27, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02,
-0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x01, 0x14,
-0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-0x07, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-0x22, 0x06, 0x82, 0x45, 0x78, 0x4C, 0x4D, 0x77, 0x45, 0x45,
-0x77, 0x4D, 0x4C, 0x78, 0x45, 0x5A, 0x35, 0x60, 0x82, 0x4C,
-0x4D, 0x81, 0x60, 0x35, 0x35, 0x60, 0x81, 0x4D, 0x4C, 0x82,
-0x60, 0x35, 0x01, 0x90, 0x21, 0x16, 0x17, 0x20, 0x20, 0x17,
-0x16, 0x21, 0xC8, 0x21, 0x16, 0x17, 0x20, 0x20, 0x17, 0x16,
-0x21, 0x01, 0x5E, 0x4F, 0x7C, 0x48, 0x48, 0x7C, 0x4F, 0x4F,
-0x7C, 0x48, 0x48, 0x7C, 0x4F, 0x4C, 0x84, 0x61, 0x37, 0x37,
-0x61, 0x84, 0x4C, 0x4D, 0x83, 0x61, 0x37, 0x37, 0x61, 0x83,
-0x01, 0x8E, 0x16, 0x21, 0x21, 0x16, 0x17, 0x20, 0x20, 0x17,
-0x16, 0x21, 0x21, 0x16, 0x17, 0x20, 0x20, 0x00, 0x03, 0x00,
-0x4B, 0xFF, 0xF6, 0x02, 0x27, 0x03, 0x70, 0x00, 0x15, 0x00,
-0x21, 0x00, 0x2D, 0x00, 0x00, 0x13, 0x11, 0x14, 0x1E, 0x02,
-0x33, 0x32, 0x3E, 0x02, 0x35, 0x11, 0x23, 0x11, 0x14, 0x06,
-0x23, 0x22, 0x26, 0x35, 0x11, 0x37, 0x14, 0x16, 0x33, 0x32,
-0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x14, 0x16,
-0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x4B,
-0x21, 0x3F, 0x58, 0x36, 0x36, 0x58, 0x3F, 0x21, 0x55, 0x4E,
-0x4B, 0x4B, 0x4E, 0xC6, 0x21, 0x16, 0x17, 0x20, 0x20, 0x17,
-0x16, 0x21, 0xC8, 0x21, 0x16, 0x17, 0x20, 0x20, 0x17, 0x16,
-0x21, 0x02, 0xBC, 0xFE, 0x2A, 0x34, 0x58, 0x40, 0x24, 0x24,
-0x40, 0x58, 0x34, 0x01, 0xD6, 0xFE, 0x2A, 0x48, 0x58, 0x58,
-0x48, 0x01, 0xD6, 0x7D, 0x16, 0x21, 0x21, 0x16, 0x17, 0x20,
-0x20, 0x17, 0x16, 0x21, 0x21, 0x16, 0x17, 0x20, 0x20, 0x00,
-0x03, 0x00, 0x1E, 0xFF, 0xF6, 0x01, 0xA9, 0x02, 0xD0, 0x00,
-0x20, 0x00, 0x32, 0x00, 0x36, 0x00, 0x00, 0x37, 0x34, 0x36,
-0x36, 0x33, 0x32, 0x16, 0x17, 0x35, 0x2E, 0x02, 0x23, 0x22,
-0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-0x35, 0x27, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
-0x3E, 0x02, 0x33, 0x32, 0x16, 0x15, 0x11, 0x33, 0x11, 0x34,
-0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x13, 0x17, 0x37, 0x27,
-0x6F, 0x1A, 0x35, 0x28, 0x2C, 0x46, 0x22, 0x07, 0x26, 0x3F,
-0x2C, 0x37, 0x59, 0x34, 0x27, 0x48, 0x2F, 0x30, 0x4E, 0x2F,
-0x10, 0x23, 0x3E, 0x28, 0x20, 0x2B, 0x16, 0x0B, 0x27, 0x36,
-0x21, 0x26, 0x3B, 0x50, 0x2D, 0x4F, 0x35, 0x3E, 0x58, 0x1A,
-0x10, 0xB4, 0x2D, 0x96, 0x87, 0x1C, 0x28, 0x16, 0x17, 0x18,
-0x2F, 0x09, 0x1D, 0x17, 0x24, 0x47, 0x36, 0x2A, 0x3C, 0x21,
-0x21, 0x3F, 0x2C, 0x32, 0x2B, 0x34, 0x18, 0x11, 0x21, 0xF1,
-0x08, 0x17, 0x11, 0x23, 0x23, 0xFE, 0xB6, 0x01, 0x4A, 0x2D,
-0x3E, 0x21, 0x26, 0x13, 0x01, 0x0B, 0x96, 0x1E, 0xA0, 0x00,
-0x03, 0x00, 0x1E, 0xFF, 0xF6, 0x01, 0xA9, 0x02, 0xD0, 0x00,
-0x20, 0x00, 0x32, 0x00, 0x36, 0x00, 0x00, 0x37, 0x34, 0x36,
-0x36, 0x33, 0x32, 0x16, 0x17, 0x35, 0x2E, 0x02, 0x23, 0x22,
-0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-0x35, 0x27, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
-0x3E, 0x02, 0x33, 0x32, 0x16, 0x15, 0x11, 0x33, 0x11, 0x34,
-0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x01, 0x27, 0x07, 0x17,
-0x6F, 0x1A, 0x35, 0x28, 0x2C, 0x46, 0x22, 0x07, 0x26, 0x3F,
-0x2C, 0x37, 0x59, 0x34, 0x27, 0x48, 0x2F, 0x30, 0x4E, 0x2F,
-0x10, 0x23, 0x3E, 0x28, 0x20, 0x2B, 0x16, 0x0B, 0x27, 0x36,
-0x21, 0x26, 0x3B, 0x50, 0x2D, 0x4F, 0x35, 0x3E, 0x58, 0x1A,
-0x01, 0x50, 0x4B, 0x96, 0x2D, 0x87, 0x1C, 0x28, 0x16, 0x17,
-0x18, 0x2F, 0x09, 0x1D, 0x17, 0x24, 0x47, 0x36, 0x2A, 0x3C,
-0x21, 0x21, 0x3F, 0x2C, 0x32, 0x2B, 0x34, 0x18, 0x11, 0x21,
-0xF1, 0x08, 0x17, 0x11, 0x23, 0x23, 0xFE, 0xB6, 0x01, 0x4A,
-0x2D, 0x3E, 0x21, 0x26, 0x13, 0x01, 0x0B, 0x28, 0xA0, 0x1E,
-0x00, 0x03, 0x00, 0x1E, 0xFF, 0xF6, 0x01, 0xA9, 0x02, 0xC6,
-0x00, 0x20, 0x00, 0x32, 0x00, 0x38, 0x00, 0x00, 0x37, 0x34,
-0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x35, 0x2E, 0x02, 0x23,
-0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36,
-0x36, 0x35, 0x27, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
-0x35, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x15, 0x11, 0x33, 0x11,
-0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x37, 0x17, 0x37,
-0x27, 0x07, 0x17, 0x6F, 0x1A, 0x35, 0x28, 0x2C, 0x46, 0x22,
-0x07, 0x26, 0x3F, 0x2C, 0x37, 0x59, 0x34, 0x27, 0x48, 0x2F,
-0x30, 0x4E, 0x2F, 0x10, 0x23, 0x3E, 0x28, 0x20, 0x2B, 0x16,
-0x0B, 0x27, 0x36, 0x21, 0x26, 0x3B, 0x50, 0x2D, 0x4F, 0x35,
-0x3E, 0x58, 0x1A, 0xB0, 0x6E, 0x32, 0xA0, 0xA0, 0x32, 0x87,
-0x1C, 0x28, 0x16, 0x17, 0x18, 0x2F, 0x09, 0x1D, 0x17, 0x24,
-0x47, 0x36, 0x2A, 0x3C, 0x21, 0x21, 0x3F, 0x2C, 0x32, 0x2B,
-0x34, 0x18, 0x11, 0x21, 0xF1, 0x08, 0x17, 0x11, 0x23, 0x23,
-0xFE, 0xB6, 0x01, 0x4A, 0x2D, 0x3E, 0x21, 0x26, 0x13, 0xD4,
-0x5F, 0x28, 0x8C, 0x8C, 0x28, 0x00, 0x04, 0x00, 0x1E, 0xFF,
-0xF6, 0x01, 0xA9, 0x02, 0x80, 0x00, 0x20, 0x00, 0x32, 0x00,
-0x3E, 0x00, 0x4A, 0x00, 0x00, 0x37, 0x34, 0x36, 0x36, 0x33,
-0x32, 0x16, 0x17, 0x35, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06,
-0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x27,
-0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x3E, 0x02,
-0x33, 0x32, 0x16, 0x15, 0x11, 0x33, 0x11, 0x34, 0x26, 0x26,
-0x23, 0x22, 0x06, 0x07, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36,
-0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x14, 0x16, 0x33,
-0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x6F, 0x1A,
-0x35, 0x28, 0x2C, 0x46, 0x22, 0x07, 0x26, 0x3F, 0x2C, 0x37,
-0x59, 0x34, 0x27, 0x48, 0x2F, 0x30, 0x4E, 0x2F, 0x10, 0x23,
-0x3E, 0x28, 0x20, 0x2B, 0x16, 0x0B, 0x27, 0x36, 0x21, 0x26,
-0x3B, 0x50, 0x2D, 0x4F, 0x35, 0x3E, 0x58, 0x1A, 0xDD, 0x21,
-0x16, 0x17, 0x20, 0x20, 0x17, 0x16, 0x21, 0xC8, 0x21, 0x16,
-0x17, 0x20, 0x20, 0x17, 0x16, 0x21, 0x87, 0x1C, 0x28, 0x16,
-0x17, 0x18, 0x2F, 0x09, 0x1D, 0x17, 0x24, 0x47, 0x36, 0x2A,
-0x3C, 0x21, 0x21, 0x3F, 0x2C, 0x32, 0x2B, 0x34, 0x18, 0x11,
-0x21, 0xF1, 0x08, 0x17, 0x11, 0x23, 0x23, 0xFE, 0xB6, 0x01,
-0x4A, 0x2D, 0x3E, 0x21, 0x26, 0x13, 0xAC, 0x16, 0x21, 0x21,
-0x16, 0x17, 0x20, 0x20, 0x17, 0x16, 0x21, 0x21, 0x16, 0x17,
-0x20, 0x20, 0x00, 0x04, 0x00, 0x1E, 0xFF, 0xF6, 0x01, 0xA9,
-0x02, 0xDA, 0x00, 0x20, 0x00, 0x32, 0x00, 0x3E, 0x00, 0x4A,
-0x00, 0x00, 0x37, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17,
-0x35, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
-0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x27, 0x14, 0x06, 0x06,
-0x23, 0x22, 0x26, 0x26, 0x35, 0x3E, 0x02, 0x33, 0x32, 0x16,
-0x15, 0x11, 0x33, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-0x07, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26,
-0x23, 0x22, 0x06, 0x17, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
-0x14, 0x06, 0x23, 0x22, 0x26, 0x6F, 0x1A, 0x35, 0x28, 0x2C,
-0x46, 0x22, 0x07, 0x26, 0x3F, 0x2C, 0x37, 0x59, 0x34, 0x27,
-0x48, 0x2F, 0x30, 0x4E, 0x2F, 0x10, 0x23, 0x3E, 0x28, 0x20,
-0x2B, 0x16, 0x0B, 0x27, 0x36, 0x21, 0x26, 0x3B, 0x50, 0x2D,
-0x4F, 0x35, 0x3E, 0x58, 0x1A, 0x4A, 0x3F, 0x27, 0x27, 0x3F,
-0x3F, 0x27, 0x27, 0x3F, 0x33, 0x20, 0x13, 0x13, 0x20, 0x20,
-0x13, 0x13, 0x20, 0x87, 0x1C, 0x28, 0x16, 0x17, 0x18, 0x2F,
-0x09, 0x1D, 0x17, 0x24, 0x47, 0x36, 0x2A, 0x3C, 0x21, 0x21,
-0x3F, 0x2C, 0x32, 0x2B, 0x34, 0x18, 0x11, 0x21, 0xF1, 0x08,
-0x17, 0x11, 0x23, 0x23, 0xFE, 0xB6, 0x01, 0x4A, 0x2D, 0x3E,
-0x21, 0x26, 0x13, 0xD9, 0x2D, 0x37, 0x37, 0x2D, 0x2D, 0x37,
-0x37, 0x2D, 0x19, 0x1C, 0x1C, 0x19, 0x19, 0x1C, 0x1C, 0x00,
-0x02, 0x00, 0x1E, 0xFF, 0x23, 0x01, 0xAC, 0x01, 0xD6, 0x00,
-0x1F, 0x00, 0x3D, 0x00, 0x00, 0x37, 0x34, 0x36, 0x36, 0x33,
-0x32, 0x16, 0x16, 0x17, 0x35, 0x26, 0x26, 0x23, 0x22, 0x06,
-0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x35,
-0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x17, 0x07, 0x36, 0x36,
-0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27,
-0x07, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
-0x26, 0x23, 0x22, 0x22, 0x23, 0x37, 0x6F, 0x29, 0x47, 0x2D,
-0x25, 0x41, 0x30, 0x0A, 0x18, 0x59, 0x2F, 0x43, 0x6C, 0x3F,
-0x3F, 0x6C, 0x43, 0x2F, 0x59, 0x18, 0x0A, 0x30, 0x41, 0x25,
-0x2D, 0x47, 0x29, 0x93, 0x56, 0x10, 0x23, 0x07, 0x1A, 0x18,
-0x18, 0x1A, 0x13, 0x17, 0x0E, 0x22, 0x15, 0x29, 0x1C, 0x1C,
-0x30, 0x1E, 0x16, 0x21, 0x11, 0x02, 0x05, 0x02, 0x3F, 0xE6,
-0x30, 0x4B, 0x2A, 0x17, 0x26, 0x17, 0x64, 0x1C, 0x1F, 0x3E,
-0x6C, 0x46, 0x45, 0x6D, 0x3E, 0x1F, 0x1C, 0x64, 0x16, 0x27,
-0x17, 0x2B, 0x4A, 0x7B, 0xA8, 0x0B, 0x07, 0x12, 0x12, 0x12,
-0x16, 0x0C, 0x0C, 0x28, 0x15, 0x11, 0x16, 0x2A, 0x1E, 0x19,
-0x20, 0x11, 0x70, 0x00, 0x02, 0x00, 0x23, 0xFF, 0xF6, 0x01,
-0xE0, 0x02, 0xDA, 0x00, 0x2A, 0x00, 0x2E, 0x00, 0x00, 0x37,
-0x21, 0x36, 0x34, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
-0x36, 0x36, 0x37, 0x27, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26,
-0x35, 0x37, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17,
-0x21, 0x13, 0x17, 0x37, 0x27, 0x56, 0x01, 0x89, 0x01, 0x36,
-0x62, 0x41, 0x3B, 0x5F, 0x3C, 0x0A, 0x02, 0x02, 0x39, 0x63,
-0x3E, 0x3C, 0x50, 0x38, 0x17, 0x41, 0x0F, 0x2A, 0x35, 0x22,
-0x2D, 0x42, 0x24, 0x02, 0x27, 0x42, 0x28, 0x28, 0x37, 0x1F,
-0x04, 0xFE, 0xCD, 0x25, 0xB4, 0x2D, 0x96, 0xD2, 0x06, 0x0C,
-0x06, 0x49, 0x69, 0x3A, 0x30, 0x56, 0x39, 0x0C, 0x18, 0x0D,
-0x45, 0x6D, 0x3E, 0x1D, 0x35, 0x23, 0x29, 0x19, 0x25, 0x15,
-0x26, 0x4A, 0x35, 0x1E, 0x2B, 0x3F, 0x22, 0x1F, 0x37, 0x24,
-0x01, 0x9C, 0x96, 0x1E, 0xA0, 0x00, 0x02, 0x00, 0x23, 0xFF,
-0xF6, 0x01, 0xE0, 0x02, 0xDA, 0x00, 0x2A, 0x00, 0x2E, 0x00,
-0x00, 0x37, 0x21, 0x36, 0x34, 0x35, 0x34, 0x26, 0x26, 0x23,
-0x22, 0x06, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
-0x33, 0x32, 0x36, 0x36, 0x37, 0x27, 0x0E, 0x02, 0x23, 0x22,
-0x26, 0x26, 0x35, 0x37, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-0x16, 0x17, 0x21, 0x01, 0x27, 0x07, 0x17, 0x56, 0x01, 0x89,
-0x01, 0x36, 0x62, 0x41, 0x3B, 0x5F, 0x3C, 0x0A, 0x02, 0x02,
-0x39, 0x63, 0x3E, 0x3C, 0x50, 0x38, 0x17, 0x41, 0x0F, 0x2A,
-0x35, 0x22, 0x2D, 0x42, 0x24, 0x02, 0x27, 0x42, 0x28, 0x28,
-0x37, 0x1F, 0x04, 0xFE, 0xCD, 0x01, 0x51, 0x4B, 0x96, 0x2D,
-0xD2, 0x06, 0x0C, 0x06, 0x49, 0x69, 0x3A, 0x30, 0x56, 0x39,
-0x0C, 0x18, 0x0D, 0x45, 0x6D, 0x3E, 0x1D, 0x35, 0x23, 0x29,
-0x19, 0x25, 0x15, 0x26, 0x4A, 0x35, 0x1E, 0x2B, 0x3F, 0x22,
-0x1F, 0x37, 0x24, 0x01, 0x9C, 0x28, 0xA0, 0x1E, 0x00, 0x02,
-0x00, 0x23, 0xFF, 0xF6, 0x01, 0xE0, 0x02, 0xC6, 0x00, 0x2A,
-0x00, 0x30, 0x00, 0x00, 0x37, 0x21, 0x36, 0x34, 0x35, 0x34,
-0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x06, 0x06, 0x15,
-0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x27, 0x0E,
-0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x37, 0x34, 0x36, 0x36,
-0x33, 0x32, 0x16, 0x16, 0x17, 0x21, 0x13, 0x17, 0x37, 0x27,
-0x07, 0x17, 0x56, 0x01, 0x89, 0x01, 0x36, 0x62, 0x41, 0x3B,
-0x5F, 0x3C, 0x0A, 0x02, 0x02, 0x39, 0x63, 0x3E, 0x3C, 0x50,
-0x38, 0x17, 0x41, 0x0F, 0x2A, 0x35, 0x22, 0x2D, 0x42, 0x24,
-0x02, 0x27, 0x42, 0x28, 0x28, 0x37, 0x1F, 0x04, 0xFE, 0xCD,
-0xB1, 0x6E, 0x32, 0xA0, 0xA0, 0x32, 0xD2, 0x06, 0x0C, 0x06,
-0x49, 0x69, 0x3A, 0x30, 0x56, 0x39, 0x0C, 0x18, 0x0D, 0x45,
-0x6D, 0x3E, 0x1D, 0x35, 0x23, 0x29, 0x19, 0x25, 0x15, 0x26,
-0x4A, 0x35, 0x1E, 0x2B, 0x3F, 0x22, 0x1F, 0x37, 0x24, 0x01,
-0x5B, 0x5F, 0x28, 0x8C, 0x8C, 0x28, 0x00, 0x03, 0x00, 0x23,
-0xFF, 0xF6, 0x01, 0xE0, 0x02, 0x80, 0x00, 0x2A, 0x00, 0x36,
-0x00, 0x42, 0x00, 0x00, 0x37, 0x21, 0x36, 0x34, 0x35, 0x34,
-0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x06, 0x06, 0x15,
-0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x27, 0x0E,
-0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x37, 0x34, 0x36, 0x36,
-0x33, 0x32, 0x16, 0x16, 0x17, 0x21, 0x13, 0x14, 0x16, 0x33,
-0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x14,
-0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-0x56, 0x01, 0x89, 0x01, 0x36, 0x62, 0x41, 0x3B, 0x5F, 0x3C,
-0x0A, 0x02, 0x02, 0x39, 0x63, 0x3E, 0x3C, 0x50, 0x38, 0x17,
-0x41, 0x0F, 0x2A, 0x35, 0x22, 0x2D, 0x42, 0x24, 0x02, 0x27,
-0x42, 0x28, 0x28, 0x37, 0x1F, 0x04, 0xFE, 0xCD, 0xDE, 0x21,
-0x16, 0x17, 0x20, 0x20, 0x17, 0x16, 0x21, 0xC8, 0x21, 0x16,
-0x17, 0x20, 0x20, 0x17, 0x16, 0x21, 0xD2, 0x06, 0x0C, 0x06,
-0x49, 0x69, 0x3A, 0x30, 0x56, 0x39, 0x0C, 0x18, 0x0D, 0x45,
-0x6D, 0x3E, 0x1D, 0x35, 0x23, 0x29, 0x19, 0x25, 0x15, 0x26,
-0x4A, 0x35, 0x1E, 0x2B, 0x3F, 0x22, 0x1F, 0x37, 0x24, 0x01,
-0x33, 0x16, 0x21, 0x21, 0x16, 0x17, 0x20, 0x20, 0x17, 0x16,
-0x21, 0x21, 0x16, 0x17, 0x20, 0x20, 0x00, 0x02, 0xFF, 0xE2,
-0x00, 0x00, 0x00, 0xC3, 0x02, 0xE4, 0x00, 0x03, 0x00, 0x07,
-0x00, 0x00, 0x13, 0x11, 0x33, 0x11, 0x27, 0x17, 0x37, 0x27,
-0x5A, 0x50, 0xC8, 0xB4, 0x2D, 0x96, 0x01, 0xCC, 0xFE, 0x34,
-0x01, 0xCC, 0xF0, 0x96, 0x1E, 0xA0, 0x00, 0x02, 0x00, 0x41,
-0x00, 0x00, 0x01, 0x22, 0x02, 0xE4, 0x00, 0x03, 0x00, 0x07,
-0x00, 0x00, 0x13, 0x11, 0x33, 0x11, 0x37, 0x27, 0x07, 0x17,
-0x5A, 0x50, 0x78, 0x4B, 0x96, 0x2D, 0x01, 0xCC, 0xFE, 0x34,
-0x01, 0xCC, 0xF0, 0x28, 0xA0, 0x1E, 0x00, 0x02, 0xFF, 0xE2,
-0x00, 0x00, 0x01, 0x22, 0x02, 0xD0, 0x00, 0x03, 0x00, 0x09,
-0x00, 0x00, 0x13, 0x11, 0x33, 0x11, 0x27, 0x17, 0x37, 0x27,
-0x07, 0x17, 0x5A, 0x50, 0x28, 0x6E, 0x32, 0xA0, 0xA0, 0x32,
-0x01, 0xCC, 0xFE, 0x34, 0x01, 0xCC, 0xAF, 0x5F, 0x28, 0x8C,
-0x8C, 0x28, 0x00, 0x03, 0xFF, 0xE7, 0x00, 0x00, 0x01, 0x1D,
-0x02, 0x9E, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x00,
-0x13, 0x11, 0x33, 0x11, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36,
-0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x14, 0x16, 0x33,
-0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x5A, 0x50,
-0x05, 0x21, 0x16, 0x17, 0x20, 0x20, 0x17, 0x16, 0x21, 0xC8,
-0x21, 0x16, 0x17, 0x20, 0x20, 0x17, 0x16, 0x21, 0x01, 0xCC,
-0xFE, 0x34, 0x01, 0xCC, 0x9B, 0x16, 0x21, 0x21, 0x16, 0x17,
-0x20, 0x20, 0x17, 0x16, 0x21, 0x21, 0x16, 0x17, 0x20, 0x20,
-0x00, 0x03, 0x00, 0x4B, 0x00, 0x00, 0x01, 0xC2, 0x02, 0x8A,
-0x00, 0x03, 0x00, 0x15, 0x00, 0x2F, 0x00, 0x00, 0x13, 0x23,
-0x11, 0x33, 0x13, 0x11, 0x33, 0x11, 0x34, 0x26, 0x23, 0x22,
-0x06, 0x06, 0x15, 0x33, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-0x25, 0x17, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x33,
-0x32, 0x36, 0x36, 0x37, 0x27, 0x06, 0x06, 0x23, 0x22, 0x2E,
-0x02, 0x23, 0x22, 0x06, 0x06, 0x9B, 0x50, 0x50, 0xD7, 0x50,
-0x57, 0x47, 0x30, 0x4E, 0x2F, 0x24, 0x1D, 0x35, 0x23, 0x31,
-0x31, 0xFE, 0xF0, 0x35, 0x08, 0x16, 0x14, 0x17, 0x21, 0x26,
-0x1B, 0x19, 0x2A, 0x1F, 0x08, 0x2E, 0x0F, 0x1B, 0x0E, 0x14,
-0x1A, 0x17, 0x1F, 0x18, 0x16, 0x2D, 0x20, 0x01, 0xCC, 0xFE,
-0x34, 0x01, 0x18, 0xFE, 0xE8, 0x01, 0x22, 0x59, 0x5B, 0x32,
-0x55, 0x37, 0x21, 0x34, 0x1E, 0x3A, 0xE6, 0x25, 0x08, 0x18,
-0x13, 0x17, 0x18, 0x15, 0x22, 0x12, 0x2B, 0x18, 0x18, 0x0E,
-0x13, 0x0E, 0x15, 0x24, 0x00, 0x03, 0x00, 0x23, 0xFF, 0xF6,
-0x01, 0xFF, 0x02, 0xE4, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x23,
-0x00, 0x00, 0x37, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x17, 0x34,
-0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
-0x23, 0x22, 0x26, 0x26, 0x03, 0x17, 0x37, 0x27, 0x23, 0x3F,
-0x6C, 0x43, 0x44, 0x6B, 0x3F, 0x3F, 0x6B, 0x44, 0x43, 0x6C,
-0x3F, 0x51, 0x29, 0x47, 0x2D, 0x2D, 0x47, 0x29, 0x29, 0x47,
-0x2D, 0x2D, 0x47, 0x29, 0x03, 0xB4, 0x2D, 0x96, 0xE6, 0x45,
-0x6D, 0x3E, 0x3E, 0x6D, 0x45, 0x46, 0x6C, 0x3E, 0x3E, 0x6C,
-0x46, 0x30, 0x4B, 0x2A, 0x2A, 0x4B, 0x30, 0x30, 0x4A, 0x2B,
-0x2B, 0x4A, 0x02, 0x06, 0x96, 0x1E, 0xA0, 0x00, 0x03, 0x00,
-0x23, 0xFF, 0xF6, 0x01, 0xFF, 0x02, 0xE4, 0x00, 0x0F, 0x00,
-0x1F, 0x00, 0x23, 0x00, 0x00, 0x37, 0x14, 0x16, 0x16, 0x33,
-0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-0x06, 0x17, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
-0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x01, 0x27, 0x07,
-0x17, 0x23, 0x3F, 0x6C, 0x43, 0x44, 0x6B, 0x3F, 0x3F, 0x6B,
-0x44, 0x43, 0x6C, 0x3F, 0x51, 0x29, 0x47, 0x2D, 0x2D, 0x47,
-0x29, 0x29, 0x47, 0x2D, 0x2D, 0x47, 0x29, 0x01, 0x3D, 0x4B,
-0x96, 0x2D, 0xE6, 0x45, 0x6D, 0x3E, 0x3E, 0x6D, 0x45, 0x46,
-0x6C, 0x3E, 0x3E, 0x6C, 0x46, 0x30, 0x4B, 0x2A, 0x2A, 0x4B,
-0x30, 0x30, 0x4A, 0x2B, 0x2B, 0x4A, 0x02, 0x06, 0x28, 0xA0,
-0x1E, 0x00, 0x03, 0x00, 0x23, 0xFF, 0xF6, 0x01, 0xFF, 0x02,
-0xDA, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x25, 0x00, 0x00, 0x37,
-0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
-0x26, 0x23, 0x22, 0x06, 0x06, 0x17, 0x34, 0x36, 0x36, 0x33,
-0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
-0x26, 0x13, 0x17, 0x37, 0x27, 0x07, 0x17, 0x23, 0x3F, 0x6C,
-0x43, 0x44, 0x6B, 0x3F, 0x3F, 0x6B, 0x44, 0x43, 0x6C, 0x3F,
-0x51, 0x29, 0x47, 0x2D, 0x2D, 0x47, 0x29, 0x29, 0x47, 0x2D,
-0x2D, 0x47, 0x29, 0x9D, 0x6E, 0x32, 0xA0, 0xA0, 0x32, 0xE6,
-0x45, 0x6D, 0x3E, 0x3E, 0x6D, 0x45, 0x46, 0x6C, 0x3E, 0x3E,
-0x6C, 0x46, 0x30, 0x4B, 0x2A, 0x2A, 0x4B, 0x30, 0x30, 0x4A,
-0x2B, 0x2B, 0x4A, 0x01, 0xCF, 0x5F, 0x28, 0x8C, 0x8C, 0x28,
-0x00, 0x04, 0x00, 0x23, 0xFF, 0xF6, 0x01, 0xFF, 0x02, 0x9E,
-0x00, 0x0F, 0x00, 0x1F, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x00,
-0x37, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34,
-0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x17, 0x34, 0x36, 0x36,
-0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22,
-0x26, 0x26, 0x13, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34,
-0x26, 0x23, 0x22, 0x06, 0x07, 0x14, 0x16, 0x33, 0x32, 0x36,
-0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x23, 0x3F, 0x6C, 0x43,
-0x44, 0x6B, 0x3F, 0x3F, 0x6B, 0x44, 0x43, 0x6C, 0x3F, 0x51,
-0x29, 0x47, 0x2D, 0x2D, 0x47, 0x29, 0x29, 0x47, 0x2D, 0x2D,
-0x47, 0x29, 0xCA, 0x21, 0x16, 0x17, 0x20, 0x20, 0x17, 0x16,
-0x21, 0xC8, 0x21, 0x16, 0x17, 0x20, 0x20, 0x17, 0x16, 0x21,
-0xE6, 0x45, 0x6D, 0x3E, 0x3E, 0x6D, 0x45, 0x46, 0x6C, 0x3E,
-0x3E, 0x6C, 0x46, 0x30, 0x4B, 0x2A, 0x2A, 0x4B, 0x30, 0x30,
-0x4A, 0x2B, 0x2B, 0x4A, 0x01, 0xB1, 0x16, 0x21, 0x21, 0x16,
-0x17, 0x20, 0x20, 0x17, 0x16, 0x21, 0x21, 0x16, 0x17, 0x20,
-0x20, 0x00, 0x03, 0x00, 0x4B, 0xFF, 0xF6, 0x01, 0xC2, 0x02,
-0xE4, 0x00, 0x03, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x21,
-0x33, 0x11, 0x23, 0x03, 0x11, 0x23, 0x11, 0x14, 0x16, 0x33,
-0x32, 0x36, 0x36, 0x35, 0x23, 0x14, 0x06, 0x06, 0x23, 0x22,
-0x26, 0x03, 0x17, 0x37, 0x27, 0x01, 0x72, 0x50, 0x50, 0xD7,
-0x50, 0x57, 0x47, 0x30, 0x4E, 0x2F, 0x24, 0x1D, 0x35, 0x23,
-0x31, 0x31, 0x0D, 0xB4, 0x2E, 0x96, 0x01, 0xCC, 0xFE, 0xE8,
-0x01, 0x18, 0xFE, 0xDE, 0x59, 0x5B, 0x32, 0x55, 0x37, 0x21,
-0x34, 0x1E, 0x3A, 0x02, 0x41, 0x96, 0x1E, 0xA0, 0x00, 0x03,
-0x00, 0x4B, 0xFF, 0xF6, 0x01, 0xC2, 0x02, 0xE4, 0x00, 0x03,
-0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x21, 0x33, 0x11, 0x23,
-0x03, 0x11, 0x23, 0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x36,
-0x35, 0x23, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x13, 0x27,
-0x07, 0x17, 0x01, 0x72, 0x50, 0x50, 0xD7, 0x50, 0x57, 0x47,
-0x30, 0x4E, 0x2F, 0x24, 0x1D, 0x35, 0x23, 0x31, 0x31, 0xE3,
-0x4A, 0x96, 0x2C, 0x01, 0xCC, 0xFE, 0xE8, 0x01, 0x18, 0xFE,
-0xDE, 0x59, 0x5B, 0x32, 0x55, 0x37, 0x21, 0x34, 0x1E, 0x3A,
-0x02, 0x41, 0x28, 0xA0, 0x1E, 0x00, 0x03, 0x00, 0x4B, 0xFF,
-0xF6, 0x01, 0xC2, 0x02, 0xDA, 0x00, 0x03, 0x00, 0x15, 0x00,
-0x1B, 0x00, 0x00, 0x21, 0x33, 0x11, 0x23, 0x03, 0x11, 0x23,
-0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x23, 0x14,
-0x06, 0x06, 0x23, 0x22, 0x26, 0x13, 0x17, 0x37, 0x27, 0x07,
-0x17, 0x01, 0x72, 0x50, 0x50, 0xD7, 0x50, 0x57, 0x47, 0x30,
-0x4E, 0x2F, 0x24, 0x1D, 0x35, 0x23, 0x31, 0x31, 0x6B, 0x6E,
-0x32, 0xA0, 0xA0, 0x32, 0x01, 0xCC, 0xFE, 0xE8, 0x01, 0x18,
-0xFE, 0xDE, 0x59, 0x5B, 0x32, 0x55, 0x37, 0x21, 0x34, 0x1E,
-0x3A, 0x02, 0x0A, 0x5F, 0x28, 0x8C, 0x8C, 0x28, 0x00, 0x04,
-0x00, 0x4B, 0xFF, 0xF6, 0x01, 0xC2, 0x02, 0x94, 0x00, 0x03,
-0x00, 0x15, 0x00, 0x21, 0x00, 0x2D, 0x00, 0x00, 0x21, 0x33,
-0x11, 0x23, 0x03, 0x11, 0x23, 0x11, 0x14, 0x16, 0x33, 0x32,
-0x36, 0x36, 0x35, 0x23, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
-0x13, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-0x22, 0x06, 0x07, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34,
-0x26, 0x23, 0x22, 0x06, 0x01, 0x72, 0x50, 0x50, 0xD7, 0x50,
-0x57, 0x47, 0x30, 0x4E, 0x2F, 0x24, 0x1D, 0x35, 0x23, 0x31,
-0x31, 0x99, 0x20, 0x16, 0x17, 0x21, 0x21, 0x17, 0x16, 0x20,
-0xC8, 0x20, 0x16, 0x17, 0x21, 0x21, 0x17, 0x16, 0x20, 0x01,
-0xCC, 0xFE, 0xE8, 0x01, 0x18, 0xFE, 0xDE, 0x59, 0x5B, 0x32,
-0x55, 0x37, 0x21, 0x34, 0x1E, 0x3A, 0x01, 0xE2, 0x16, 0x21,
-0x21, 0x16, 0x17, 0x20, 0x20, 0x17, 0x16, 0x21, 0x21, 0x16,
-0x17, 0x20, 0x20, 0x00, 0x03, 0x00, 0x00, 0xFF, 0x24, 0x01,
-0xB8, 0x02, 0x80, 0x00, 0x08, 0x00, 0x14, 0x00, 0x20, 0x00,
-0x00, 0x01, 0x23, 0x03, 0x17, 0x03, 0x23, 0x13, 0x03, 0x33,
-0x13, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-0x22, 0x06, 0x07, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34,
-0x26, 0x23, 0x22, 0x06, 0x01, 0xB8, 0x5A, 0x8E, 0x21, 0x92,
-0x5F, 0xB0, 0x7E, 0x5A, 0x7D, 0x21, 0x16, 0x17, 0x20, 0x20,
-0x17, 0x16, 0x21, 0xC8, 0x21, 0x16, 0x17, 0x20, 0x20, 0x17,
-0x16, 0x21, 0x01, 0xCC, 0xFE, 0x9C, 0x04, 0x01, 0x68, 0xFE,
-0x75, 0xFE, 0xE3, 0x03, 0x25, 0x16, 0x21, 0x21, 0x16, 0x17,
-0x20, 0x20, 0x17, 0x16, 0x21, 0x21, 0x16, 0x17, 0x20, 0x20,
-0x00, 0x01, 0x00, 0x73, 0xFF, 0x37, 0x01, 0xFF, 0x03, 0x17,
-0x00, 0x24, 0x00, 0x00, 0x17, 0x16, 0x36, 0x36, 0x37, 0x13,
-0x33, 0x37, 0x23, 0x37, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17,
-0x37, 0x26, 0x26, 0x27, 0x26, 0x06, 0x07, 0x07, 0x23, 0x07,
-0x33, 0x03, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x07, 0x16,
-0x16, 0xCC, 0x25, 0x39, 0x22, 0x03, 0x17, 0x4E, 0x06, 0x50,
-0x0A, 0x03, 0x1B, 0x16, 0x09, 0x13, 0x10, 0x2B, 0x19, 0x29,
-0x17, 0x38, 0x46, 0x05, 0x09, 0x3C, 0x06, 0x3E, 0x18, 0x03,
-0x1A, 0x17, 0x09, 0x13, 0x10, 0x2B, 0x1A, 0x29, 0xC8, 0x01,
-0x27, 0x49, 0x33, 0x01, 0xA7, 0x4B, 0xA0, 0x2C, 0x2F, 0x0B,
-0x0F, 0x3E, 0x17, 0x12, 0x01, 0x02, 0x58, 0x4D, 0xA6, 0x4B,
-0xFE, 0x5F, 0x2B, 0x2F, 0x0B, 0x0F, 0x3E, 0x16, 0x13, 0x00,
-0x03, 0x00, 0x0F, 0xFF, 0xF6, 0x02, 0x08, 0x02, 0xC6, 0x00,
-0x03, 0x00, 0x07, 0x00, 0x24, 0x00, 0x00, 0x13, 0x21, 0x35,
-0x21, 0x15, 0x21, 0x35, 0x21, 0x37, 0x34, 0x36, 0x36, 0x33,
-0x32, 0x17, 0x35, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15,
-0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x35, 0x06, 0x23,
-0x22, 0x26, 0x26, 0x0F, 0x01, 0xF5, 0xFE, 0x0B, 0x01, 0xDB,
-0xFE, 0x25, 0x8C, 0x36, 0x61, 0x40, 0x56, 0x40, 0x22, 0x4B,
-0x29, 0x41, 0x6E, 0x51, 0x2C, 0x4E, 0x87, 0x57, 0x29, 0x4B,
-0x22, 0x40, 0x56, 0x40, 0x61, 0x36, 0x01, 0x97, 0x30, 0xA8,
-0x30, 0x0F, 0x52, 0x7E, 0x48, 0x3E, 0x65, 0x14, 0x15, 0x35,
-0x61, 0x84, 0x4E, 0x69, 0xA2, 0x5D, 0x16, 0x13, 0x65, 0x3E,
-0x48, 0x7F, 0x00, 0x03, 0x00, 0x16, 0x00, 0x30, 0x02, 0xD8,
-0x01, 0x9A, 0x00, 0x18, 0x00, 0x26, 0x00, 0x34, 0x00, 0x00,
-0x37, 0x32, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35,
-0x34, 0x26, 0x26, 0x23, 0x22, 0x07, 0x26, 0x23, 0x22, 0x06,
-0x06, 0x15, 0x14, 0x16, 0x16, 0x37, 0x22, 0x26, 0x26, 0x35,
-0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x06, 0x06, 0x21,
-0x22, 0x26, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
-0x14, 0x06, 0x06, 0xBF, 0x5B, 0x5E, 0x2F, 0x5B, 0x2E, 0x2D,
-0x4D, 0x2E, 0x2E, 0x4D, 0x2D, 0x5B, 0x5D, 0x5D, 0x5C, 0x2D,
-0x4D, 0x2F, 0x2F, 0x4D, 0x38, 0x19, 0x2C, 0x1B, 0x1B, 0x2C,
-0x19, 0x21, 0x44, 0x1E, 0x1F, 0x43, 0x01, 0x3A, 0x21, 0x44,
-0x1E, 0x1E, 0x44, 0x21, 0x19, 0x2B, 0x1B, 0x1B, 0x2B, 0x30,
-0x78, 0x3C, 0x3C, 0x33, 0x53, 0x30, 0x31, 0x51, 0x32, 0x78,
-0x78, 0x32, 0x51, 0x31, 0x30, 0x53, 0x33, 0x4E, 0x1E, 0x2F,
-0x1B, 0x1C, 0x2E, 0x1D, 0x35, 0x32, 0x32, 0x36, 0x37, 0x31,
-0x32, 0x35, 0x1D, 0x2E, 0x1C, 0x1B, 0x2F, 0x1E, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x28, 0x17, 0x17,
-0x5F, 0x0F, 0x3C, 0xF5, 0x00, 0x03, 0x08, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xE0, 0x80, 0x16, 0x1F, 0x00, 0x00, 0x00, 0x00,
-0xE0, 0x80, 0x16, 0x1F, 0xFF, 0x91, 0xFE, 0xA2, 0x05, 0xC4,
-0x04, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x02, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x03, 0xDE, 0xFF, 0x91, 0xFF, 0xE2,
-0x03, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
-0x02, 0x58, 0x00, 0x00, 0x01, 0x2C, 0x00, 0x5F, 0x01, 0xD1,
-0x00, 0x50, 0x02, 0x5D, 0x00, 0x23, 0x02, 0x44, 0x00, 0x37,
-0x02, 0xEF, 0x00, 0x23, 0x02, 0xA3, 0x00, 0x28, 0x01, 0x1D,
-0x00, 0x50, 0x01, 0x36, 0x00, 0x5A, 0x01, 0x36, 0x00, 0x1E,
-0x02, 0x50, 0x00, 0x64, 0x02, 0x67, 0x00, 0x41, 0x01, 0x34,
-0x00, 0x3C, 0x00, 0xD2, 0x00, 0x05, 0x01, 0x2C, 0x00, 0x5F,
-0x02, 0x03, 0x00, 0x0F, 0x02, 0x58, 0x00, 0x28, 0x01, 0xC2,
-0x00, 0x50, 0x02, 0x39, 0x00, 0x14, 0x02, 0x22, 0x00, 0x3C,
-0x02, 0x47, 0x00, 0x14, 0x02, 0x34, 0x00, 0x1E, 0x02, 0x40,
-0x00, 0x32, 0x02, 0x0D, 0x00, 0x1E, 0x02, 0x22, 0x00, 0x37,
-0x02, 0x40, 0x00, 0x32, 0x01, 0x2C, 0x00, 0x5F, 0x01, 0x4A,
-0x00, 0x3C, 0x02, 0x80, 0x00, 0x41, 0x02, 0x67, 0x00, 0x41,
-0x02, 0x80, 0x00, 0x41, 0x02, 0x2D, 0x00, 0x3C, 0x03, 0x02,
-0x00, 0x23, 0x02, 0x94, 0x00, 0x05, 0x02, 0x2E, 0x00, 0x50,
-0x02, 0xAD, 0x00, 0x28, 0x02, 0xA8, 0x00, 0x50, 0x02, 0x26,
-0x00, 0x50, 0x01, 0xF4, 0x00, 0x50, 0x03, 0x07, 0x00, 0x28,
-0x02, 0xCB, 0x00, 0x50, 0x00, 0xF5, 0x00, 0x50, 0x00, 0xF0,
-0xFF, 0x91, 0x02, 0x35, 0x00, 0x50, 0x01, 0xC2, 0x00, 0x50,
-0x03, 0x2A, 0x00, 0x28, 0x03, 0x07, 0x00, 0x50, 0x03, 0x16,
-0x00, 0x28, 0x02, 0x24, 0x00, 0x50, 0x03, 0x16, 0x00, 0x28,
-0x02, 0x30, 0x00, 0x50, 0x02, 0x24, 0x00, 0x26, 0x01, 0xD1,
-0x00, 0x0A, 0x02, 0x72, 0x00, 0x4B, 0x02, 0x94, 0x00, 0x05,
-0x03, 0xDE, 0x00, 0x0A, 0x02, 0x2B, 0x00, 0x0A, 0x02, 0x31,
-0x00, 0x05, 0x02, 0x21, 0x00, 0x0F, 0x01, 0x2C, 0x00, 0x64,
-0x02, 0x03, 0x00, 0x0F, 0x01, 0x2C, 0x00, 0x14, 0x01, 0xFE,
-0x00, 0x41, 0x01, 0xF4, 0x00, 0x00, 0x01, 0x77, 0x00, 0x4B,
-0x01, 0xE1, 0x00, 0x1E, 0x02, 0x3A, 0x00, 0x46, 0x01, 0xDE,
-0x00, 0x1E, 0x02, 0x3A, 0x00, 0x23, 0x02, 0x03, 0x00, 0x23,
-0x01, 0x1E, 0x00, 0x28, 0x02, 0x3A, 0x00, 0x23, 0x02, 0x0D,
-0x00, 0x4B, 0x01, 0x04, 0x00, 0x4B, 0x00, 0xFA, 0xFF, 0xC3,
-0x01, 0xB8, 0x00, 0x46, 0x00, 0xE6, 0x00, 0x4B, 0x03, 0x0C,
-0x00, 0x4B, 0x02, 0x0D, 0x00, 0x4B, 0x02, 0x22, 0x00, 0x23,
-0x02, 0x3A, 0x00, 0x46, 0x02, 0x3A, 0x00, 0x23, 0x01, 0x57,
-0x00, 0x4B, 0x01, 0x93, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x05,
-0x02, 0x0D, 0x00, 0x4B, 0x01, 0xB8, 0x00, 0x00, 0x02, 0xA8,
-0x00, 0x05, 0x01, 0xA4, 0x00, 0x00, 0x01, 0xB8, 0x00, 0x00,
-0x01, 0xCC, 0x00, 0x0F, 0x01, 0x37, 0x00, 0x32, 0x01, 0x12,
-0x00, 0x64, 0x01, 0x37, 0x00, 0x3B, 0x02, 0x3F, 0x00, 0x41,
-0x02, 0x44, 0x00, 0x51, 0x02, 0x44, 0x00, 0x40, 0x02, 0x44,
-0x00, 0x0F, 0x01, 0x98, 0x00, 0x1E, 0x01, 0x16, 0x00, 0x14,
-0x02, 0x94, 0x00, 0x05, 0x02, 0x94, 0x00, 0x05, 0x03, 0xC0,
-0x00, 0x05, 0x02, 0xAD, 0x00, 0x28, 0x02, 0x26, 0x00, 0x50,
-0x03, 0x07, 0x00, 0x50, 0x03, 0x16, 0x00, 0x28, 0x02, 0x72,
-0x00, 0x4B, 0x01, 0xE5, 0x00, 0x1E, 0x01, 0xE5, 0x00, 0x1E,
-0x01, 0xE5, 0x00, 0x1E, 0x01, 0xE5, 0x00, 0x1E, 0x01, 0xE5,
-0x00, 0x1E, 0x01, 0xDE, 0x00, 0x1E, 0x02, 0x03, 0x00, 0x23,
-0x02, 0x03, 0x00, 0x23, 0x02, 0x03, 0x00, 0x23, 0x02, 0x03,
-0x00, 0x23, 0x01, 0x04, 0xFF, 0xE2, 0x01, 0x04, 0x00, 0x41,
-0x01, 0x04, 0xFF, 0xE2, 0x01, 0x04, 0xFF, 0xE7, 0x02, 0x0D,
-0x00, 0x4B, 0x02, 0x22, 0x00, 0x23, 0x02, 0x22, 0x00, 0x23,
-0x02, 0x22, 0x00, 0x23, 0x02, 0x22, 0x00, 0x23, 0x02, 0x0D,
-0x00, 0x4B, 0x02, 0x0D, 0x00, 0x4B, 0x02, 0x0D, 0x00, 0x4B,
-0x02, 0x0D, 0x00, 0x4B, 0x01, 0xB8, 0x00, 0x00, 0x02, 0x58,
-0x00, 0x73, 0x01, 0xF4, 0x00, 0x00, 0x02, 0x44, 0x00, 0x0F,
-0x02, 0xEE, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x38, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x9E,
-0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xAC, 0x00, 0x00,
-0x02, 0x79, 0x00, 0x00, 0x03, 0x2B, 0x00, 0x00, 0x03, 0x47,
-0x00, 0x00, 0x03, 0x7B, 0x00, 0x00, 0x03, 0xAE, 0x00, 0x00,
-0x04, 0x00, 0x00, 0x00, 0x04, 0x26, 0x00, 0x00, 0x04, 0x41,
-0x00, 0x00, 0x04, 0x58, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00,
-0x04, 0xA2, 0x00, 0x00, 0x05, 0x0D, 0x00, 0x00, 0x05, 0x2D,
-0x00, 0x00, 0x05, 0x89, 0x00, 0x00, 0x06, 0x22, 0x00, 0x00,
-0x06, 0x4F, 0x00, 0x00, 0x06, 0xC2, 0x00, 0x00, 0x07, 0x3A,
-0x00, 0x00, 0x07, 0x5E, 0x00, 0x00, 0x08, 0x24, 0x00, 0x00,
-0x08, 0x9E, 0x00, 0x00, 0x08, 0xE8, 0x00, 0x00, 0x09, 0x24,
-0x00, 0x00, 0x09, 0x48, 0x00, 0x00, 0x09, 0x6D, 0x00, 0x00,
-0x09, 0x91, 0x00, 0x00, 0x0A, 0x0C, 0x00, 0x00, 0x0B, 0x04,
-0x00, 0x00, 0x0B, 0x41, 0x00, 0x00, 0x0B, 0xBC, 0x00, 0x00,
-0x0C, 0x21, 0x00, 0x00, 0x0C, 0x77, 0x00, 0x00, 0x0C, 0xB7,
-0x00, 0x00, 0x0C, 0xEC, 0x00, 0x00, 0x0D, 0x5D, 0x00, 0x00,
-0x0D, 0x93, 0x00, 0x00, 0x0D, 0xAD, 0x00, 0x00, 0x0D, 0xEB,
-0x00, 0x00, 0x0E, 0x20, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00,
-0x0E, 0x72, 0x00, 0x00, 0x0E, 0x9D, 0x00, 0x00, 0x0F, 0x08,
-0x00, 0x00, 0x0F, 0x53, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-0x10, 0x31, 0x00, 0x00, 0x10, 0xC1, 0x00, 0x00, 0x10, 0xE4,
-0x00, 0x00, 0x11, 0x2A, 0x00, 0x00, 0x11, 0x4E, 0x00, 0x00,
-0x11, 0x81, 0x00, 0x00, 0x11, 0xBA, 0x00, 0x00, 0x11, 0xE7,
-0x00, 0x00, 0x12, 0x11, 0x00, 0x00, 0x12, 0x32, 0x00, 0x00,
-0x12, 0x50, 0x00, 0x00, 0x12, 0x70, 0x00, 0x00, 0x12, 0x91,
-0x00, 0x00, 0x12, 0xA9, 0x00, 0x00, 0x12, 0xC4, 0x00, 0x00,
-0x13, 0x58, 0x00, 0x00, 0x13, 0xC8, 0x00, 0x00, 0x14, 0x28,
-0x00, 0x00, 0x14, 0x9B, 0x00, 0x00, 0x15, 0x13, 0x00, 0x00,
-0x15, 0x5E, 0x00, 0x00, 0x15, 0xF8, 0x00, 0x00, 0x16, 0x44,
-0x00, 0x00, 0x16, 0x7D, 0x00, 0x00, 0x16, 0xDD, 0x00, 0x00,
-0x17, 0x0D, 0x00, 0x00, 0x17, 0x27, 0x00, 0x00, 0x17, 0x97,
-0x00, 0x00, 0x17, 0xDC, 0x00, 0x00, 0x18, 0x3E, 0x00, 0x00,
-0x18, 0xAF, 0x00, 0x00, 0x19, 0x1F, 0x00, 0x00, 0x19, 0x64,
-0x00, 0x00, 0x19, 0xE8, 0x00, 0x00, 0x1A, 0x0D, 0x00, 0x00,
-0x1A, 0x50, 0x00, 0x00, 0x1A, 0x73, 0x00, 0x00, 0x1A, 0xA2,
-0x00, 0x00, 0x1A, 0xD3, 0x00, 0x00, 0x1A, 0xFF, 0x00, 0x00,
-0x1B, 0x29, 0x00, 0x00, 0x1B, 0x9B, 0x00, 0x00, 0x1B, 0xB5,
-0x00, 0x00, 0x1C, 0x26, 0x00, 0x00, 0x1C, 0xAA, 0x00, 0x00,
-0x1D, 0x1D, 0x00, 0x00, 0x1D, 0xA6, 0x00, 0x00, 0x1D, 0xED,
-0x00, 0x00, 0x1E, 0xE5, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00,
-0x1F, 0xAC, 0x00, 0x00, 0x20, 0x28, 0x00, 0x00, 0x20, 0x8B,
-0x00, 0x00, 0x21, 0x3E, 0x00, 0x00, 0x21, 0x8C, 0x00, 0x00,
-0x21, 0xFE, 0x00, 0x00, 0x22, 0xA9, 0x00, 0x00, 0x23, 0x2D,
-0x00, 0x00, 0x23, 0xCD, 0x00, 0x00, 0x24, 0x6E, 0x00, 0x00,
-0x25, 0x13, 0x00, 0x00, 0x25, 0xE2, 0x00, 0x00, 0x26, 0xB1,
-0x00, 0x00, 0x27, 0x5F, 0x00, 0x00, 0x27, 0xED, 0x00, 0x00,
-0x28, 0x7C, 0x00, 0x00, 0x29, 0x10, 0x00, 0x00, 0x29, 0xCE,
-0x00, 0x00, 0x29, 0xF6, 0x00, 0x00, 0x2A, 0x1E, 0x00, 0x00,
-0x2A, 0x4C, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x2B, 0x34,
-0x00, 0x00, 0x2B, 0xA5, 0x00, 0x00, 0x2C, 0x17, 0x00, 0x00,
-0x2C, 0x8E, 0x00, 0x00, 0x2D, 0x2F, 0x00, 0x00, 0x2D, 0x86,
-0x00, 0x00, 0x2D, 0xDD, 0x00, 0x00, 0x2E, 0x3A, 0x00, 0x00,
-0x2E, 0xC1, 0x00, 0x00, 0x2F, 0x2C, 0x00, 0x00, 0x2F, 0xA3,
-0x00, 0x00, 0x2F, 0xA3, 0x00, 0x00, 0x30, 0x14, 0x00, 0x00,
-0x30, 0xB0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x88, 0x10, 0x00,
-0x04, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xFF, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x96,
-0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x07, 0x00, 0x0D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x03, 0x00, 0x21, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x0D, 0x00, 0x35, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x42,
-0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0D,
-0x00, 0x45, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01,
-0x00, 0x1A, 0x00, 0x52, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-0x00, 0x02, 0x00, 0x0E, 0x00, 0x6C, 0x00, 0x03, 0x00, 0x01,
-0x04, 0x09, 0x00, 0x03, 0x00, 0x42, 0x00, 0x7A, 0x00, 0x03,
-0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x1A, 0x00, 0xBC,
-0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x06,
-0x00, 0xD6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06,
-0x00, 0x1A, 0x00, 0xDC, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61,
-0x74, 0x65, 0x64, 0x46, 0x6F, 0x6E, 0x74, 0x52, 0x65, 0x67,
-0x75, 0x6C, 0x61, 0x72, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61,
-0x74, 0x65, 0x64, 0x46, 0x6F, 0x6E, 0x74, 0x20, 0x52, 0x65,
-0x67, 0x75, 0x6C, 0x61, 0x72, 0x3A, 0x56, 0x65, 0x72, 0x73,
-0x69, 0x6F, 0x6E, 0x20, 0x31, 0x2E, 0x30, 0x47, 0x65, 0x6E,
-0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x46, 0x6F, 0x6E, 0x74,
-0x31, 0x2E, 0x30, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74,
-0x65, 0x64, 0x46, 0x6F, 0x6E, 0x74, 0x00, 0x47, 0x00, 0x65,
-0x00, 0x6E, 0x00, 0x65, 0x00, 0x72, 0x00, 0x61, 0x00, 0x74,
-0x00, 0x65, 0x00, 0x64, 0x00, 0x46, 0x00, 0x6F, 0x00, 0x6E,
-0x00, 0x74, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75,
-0x00, 0x6C, 0x00, 0x61, 0x00, 0x72, 0x00, 0x47, 0x00, 0x65,
-0x00, 0x6E, 0x00, 0x65, 0x00, 0x72, 0x00, 0x61, 0x00, 0x74,
-0x00, 0x65, 0x00, 0x64, 0x00, 0x46, 0x00, 0x6F, 0x00, 0x6E,
-0x00, 0x74, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67,
-0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x72, 0x00, 0x3A,
-0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69,
-0x00, 0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2E,
-0x00, 0x30, 0x00, 0x47, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x65,
-0x00, 0x72, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64,
-0x00, 0x46, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x31,
-0x00, 0x2E, 0x00, 0x30, 0x00, 0x47, 0x00, 0x65, 0x00, 0x6E,
-0x00, 0x65, 0x00, 0x72, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65,
-0x00, 0x64, 0x00, 0x46, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74,
-0x00, 0x04, 0x02, 0x22, 0x01, 0x90, 0x00, 0x05, 0x00, 0x08,
-0x02, 0x8A, 0x02, 0x58, 0x00, 0x00, 0x00, 0x4B, 0x02, 0x8A,
-0x02, 0x58, 0x00, 0x00, 0x01, 0x5E, 0x00, 0x32, 0x01, 0x14,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xA0, 0x00, 0x02, 0xEF, 0x00, 0x00, 0x20, 0x5B,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x69, 0x74,
-0x2A, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xFF, 0x19, 0x04, 0x2E,
-0xFE, 0x89, 0x00, 0x00, 0x04, 0x2E, 0x01, 0x77, 0x20, 0x00,
-0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCC, 0x02, 0xBC,
-0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01,
-0xFF, 0x85, 0xB0, 0x04, 0x8D, 0x00, };
-
-#endif
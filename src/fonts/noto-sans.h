@@ -1,1797 +0,0 @@
-// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
-// SPDX-License-Identifier: MIT
-
-// This was created as per https://github.com/takkaO/OpenFontRender/blob/master/examples/TFT_eSPI/load_from_binary/load_from_binary.ino#L1
-// The generated font supports the following characters; basic ASCII, accented chars from extended ASCII plus €:
-// !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~€ÇüéâäàåçêëèïîìÄÅÉ§ÆôöòûùÿÖÜ¢£¥₧ƒáíóúñÑ°∞
-
-#ifndef _NOTOSANSTTF_H_
-#define _NOTOSANSTTF_H_
-
-const unsigned char notosans[17836] = {
-0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x80, 0x00, 0x03,
-0x00, 0x30, 0x63, 0x6D, 0x61, 0x70, 0x7C, 0xEA, 0x97, 0x47,
-0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x12, 0xEE, 0x67, 0x6C,
-0x79, 0x66, 0x3C, 0xA3, 0xF9, 0x63, 0x00, 0x00, 0x13, 0xAC,
-0x00, 0x00, 0x2A, 0x3A, 0x68, 0x65, 0x61, 0x64, 0x28, 0x97,
-0x68, 0xCF, 0x00, 0x00, 0x3D, 0xE8, 0x00, 0x00, 0x00, 0x36,
-0x68, 0x68, 0x65, 0x61, 0x03, 0x49, 0x04, 0x22, 0x00, 0x00,
-0x3E, 0x20, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6D, 0x74, 0x78,
-0x65, 0x54, 0x21, 0x2E, 0x00, 0x00, 0x3E, 0x44, 0x00, 0x00,
-0x02, 0x98, 0x6C, 0x6F, 0x63, 0x61, 0x00, 0x0E, 0xE4, 0x47,
-0x00, 0x00, 0x40, 0xDC, 0x00, 0x00, 0x02, 0x9C, 0x6D, 0x61,
-0x78, 0x70, 0x07, 0xA4, 0x11, 0x1F, 0x00, 0x00, 0x43, 0x78,
-0x00, 0x00, 0x00, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x7B, 0xB1,
-0x4F, 0xE5, 0x00, 0x00, 0x43, 0x98, 0x00, 0x00, 0x01, 0x8C,
-0x4F, 0x53, 0x2F, 0x32, 0x0E, 0x5D, 0x86, 0xE0, 0x00, 0x00,
-0x45, 0x24, 0x00, 0x00, 0x00, 0x60, 0x70, 0x6F, 0x73, 0x74,
-0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x45, 0x84, 0x00, 0x00,
-0x00, 0x20, 0x70, 0x72, 0x65, 0x70, 0x68, 0x06, 0x8C, 0x85,
-0x00, 0x00, 0x45, 0xA4, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C,
-0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x62, 0x00, 0x03,
-0x00, 0x01, 0x00, 0x00, 0x0C, 0xA8, 0x00, 0x04, 0x06, 0x46,
-0x00, 0x00, 0x01, 0x3E, 0x01, 0x00, 0x00, 0x07, 0x00, 0x3E,
-0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25,
-0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A,
-0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F,
-0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34,
-0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39,
-0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E,
-0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43,
-0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48,
-0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D,
-0x00, 0x4E, 0x00, 0x4F, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52,
-0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57,
-0x00, 0x58, 0x00, 0x59, 0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C,
-0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x60, 0x00, 0x61,
-0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66,
-0x00, 0x67, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6A, 0x00, 0x6B,
-0x00, 0x6C, 0x00, 0x6D, 0x00, 0x6E, 0x00, 0x6F, 0x00, 0x70,
-0x00, 0x71, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74, 0x00, 0x75,
-0x00, 0x76, 0x00, 0x77, 0x00, 0x78, 0x00, 0x79, 0x00, 0x7A,
-0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0xC0,
-0x00, 0xC1, 0x00, 0xC2, 0x00, 0xC3, 0x00, 0xC4, 0x00, 0xC5,
-0x00, 0xC6, 0x00, 0xC7, 0x00, 0xC8, 0x00, 0xC9, 0x00, 0xCA,
-0x00, 0xCB, 0x00, 0xCC, 0x00, 0xCD, 0x00, 0xCE, 0x00, 0xCF,
-0x00, 0xD0, 0x00, 0xD1, 0x00, 0xD2, 0x00, 0xD3, 0x00, 0xD4,
-0x00, 0xD5, 0x00, 0xD6, 0x00, 0xD7, 0x00, 0xD8, 0x00, 0xD9,
-0x00, 0xDA, 0x00, 0xDB, 0x00, 0xDC, 0x00, 0xDD, 0x00, 0xDE,
-0x00, 0xDF, 0x00, 0xE0, 0x00, 0xE1, 0x00, 0xE2, 0x00, 0xE3,
-0x00, 0xE4, 0x00, 0xE5, 0x00, 0xE6, 0x00, 0xE7, 0x00, 0xE8,
-0x00, 0xE9, 0x00, 0xEA, 0x00, 0xEB, 0x00, 0xEC, 0x00, 0xED,
-0x00, 0xEE, 0x00, 0xEF, 0x00, 0xF0, 0x00, 0xF1, 0x00, 0xF2,
-0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF5, 0x00, 0xF6, 0x00, 0xF7,
-0x00, 0xF8, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB, 0x00, 0xFC,
-0x00, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25,
-0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A,
-0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F,
-0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34,
-0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39,
-0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E,
-0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43,
-0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48,
-0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D,
-0x00, 0x4E, 0x00, 0x4F, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52,
-0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57,
-0x00, 0x58, 0x00, 0x59, 0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C,
-0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x60, 0x00, 0x61,
-0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66,
-0x00, 0x67, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6A, 0x00, 0x6B,
-0x00, 0x6C, 0x00, 0x6D, 0x00, 0x6E, 0x00, 0x6F, 0x00, 0x70,
-0x00, 0x71, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74, 0x00, 0x75,
-0x00, 0x76, 0x00, 0x77, 0x00, 0x78, 0x00, 0x79, 0x00, 0x7A,
-0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0xC0,
-0x00, 0xC1, 0x00, 0xC2, 0x00, 0xC3, 0x00, 0xC4, 0x00, 0xC5,
-0x00, 0xC6, 0x00, 0xC7, 0x00, 0xC8, 0x00, 0xC9, 0x00, 0xCA,
-0x00, 0xCB, 0x00, 0xCC, 0x00, 0xCD, 0x00, 0xCE, 0x00, 0xCF,
-0x00, 0xD0, 0x00, 0xD1, 0x00, 0xD2, 0x00, 0xD3, 0x00, 0xD4,
-0x00, 0xD5, 0x00, 0xD6, 0x00, 0xD7, 0x00, 0xD8, 0x00, 0xD9,
-0x00, 0xDA, 0x00, 0xDB, 0x00, 0xDC, 0x00, 0xDD, 0x00, 0xDE,
-0x00, 0xDF, 0x00, 0xE0, 0x00, 0xE1, 0x00, 0xE2, 0x00, 0xE3,
-0x00, 0xE4, 0x00, 0xE5, 0x00, 0xE6, 0x00, 0xE7, 0x00, 0xE8,
-0x00, 0xE9, 0x00, 0xEA, 0x00, 0xEB, 0x00, 0xEC, 0x00, 0xED,
-0x00, 0xEE, 0x00, 0xEF, 0x00, 0xF0, 0x00, 0xF1, 0x00, 0xF2,
-0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF5, 0x00, 0xF6, 0x00, 0xF7,
-0x00, 0xF8, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB, 0x00, 0xFC,
-0x00, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03,
-0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08,
-0x00, 0x09, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0D,
-0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12,
-0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17,
-0x00, 0x18, 0x00, 0x19, 0x00, 0x1A, 0x00, 0x1B, 0x00, 0x1C,
-0x00, 0x1D, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x21,
-0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26,
-0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B,
-0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x30,
-0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35,
-0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3A,
-0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3F,
-0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44,
-0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49,
-0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D, 0x00, 0x4E,
-0x00, 0x4F, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53,
-0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58,
-0x00, 0x59, 0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C, 0x00, 0x5D,
-0x00, 0x5E, 0x00, 0x5F, 0x00, 0x61, 0x00, 0x63, 0x00, 0x65,
-0x00, 0x67, 0x00, 0x69, 0x00, 0x6A, 0x00, 0x6C, 0x00, 0x6D,
-0x00, 0x6E, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x71, 0x00, 0x72,
-0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x76, 0x00, 0x77,
-0x00, 0x78, 0x00, 0x79, 0x00, 0x7A, 0x00, 0x7B, 0x00, 0x7C,
-0x00, 0x7D, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x81,
-0x00, 0x82, 0x00, 0x83, 0x00, 0x84, 0x00, 0x85, 0x00, 0x86,
-0x00, 0x87, 0x00, 0x88, 0x00, 0x89, 0x00, 0x8A, 0x00, 0x8B,
-0x00, 0x8C, 0x00, 0x8D, 0x00, 0x8E, 0x00, 0x8F, 0x00, 0x90,
-0x00, 0x92, 0x00, 0x93, 0x00, 0x94, 0x00, 0x95, 0x00, 0x96,
-0x00, 0x97, 0x00, 0x98, 0x00, 0x99, 0x00, 0x9A, 0x00, 0x9B,
-0x00, 0x9C, 0x00, 0x9D, 0x00, 0x9E, 0x00, 0x9F, 0x00, 0xA0,
-0x00, 0xA1, 0x00, 0xA2, 0x00, 0xA3, 0x00, 0xA4, 0x00, 0xA5,
-0x00, 0x00, 0x00, 0x04, 0x06, 0x46, 0x00, 0x00, 0x01, 0x3E,
-0x01, 0x00, 0x00, 0x07, 0x00, 0x3E, 0x00, 0x21, 0x00, 0x22,
-0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27,
-0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C,
-0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x30, 0x00, 0x31,
-0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
-0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B,
-0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x40,
-0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45,
-0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4A,
-0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F,
-0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54,
-0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59,
-0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C, 0x00, 0x5D, 0x00, 0x5E,
-0x00, 0x5F, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63,
-0x00, 0x64, 0x00, 0x65, 0x00, 0x66, 0x00, 0x67, 0x00, 0x68,
-0x00, 0x69, 0x00, 0x6A, 0x00, 0x6B, 0x00, 0x6C, 0x00, 0x6D,
-0x00, 0x6E, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x71, 0x00, 0x72,
-0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x76, 0x00, 0x77,
-0x00, 0x78, 0x00, 0x79, 0x00, 0x7A, 0x00, 0x7B, 0x00, 0x7C,
-0x00, 0x7D, 0x00, 0x7E, 0x00, 0xC0, 0x00, 0xC1, 0x00, 0xC2,
-0x00, 0xC3, 0x00, 0xC4, 0x00, 0xC5, 0x00, 0xC6, 0x00, 0xC7,
-0x00, 0xC8, 0x00, 0xC9, 0x00, 0xCA, 0x00, 0xCB, 0x00, 0xCC,
-0x00, 0xCD, 0x00, 0xCE, 0x00, 0xCF, 0x00, 0xD0, 0x00, 0xD1,
-0x00, 0xD2, 0x00, 0xD3, 0x00, 0xD4, 0x00, 0xD5, 0x00, 0xD6,
-0x00, 0xD7, 0x00, 0xD8, 0x00, 0xD9, 0x00, 0xDA, 0x00, 0xDB,
-0x00, 0xDC, 0x00, 0xDD, 0x00, 0xDE, 0x00, 0xDF, 0x00, 0xE0,
-0x00, 0xE1, 0x00, 0xE2, 0x00, 0xE3, 0x00, 0xE4, 0x00, 0xE5,
-0x00, 0xE6, 0x00, 0xE7, 0x00, 0xE8, 0x00, 0xE9, 0x00, 0xEA,
-0x00, 0xEB, 0x00, 0xEC, 0x00, 0xED, 0x00, 0xEE, 0x00, 0xEF,
-0x00, 0xF0, 0x00, 0xF1, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4,
-0x00, 0xF5, 0x00, 0xF6, 0x00, 0xF7, 0x00, 0xF8, 0x00, 0xF9,
-0x00, 0xFA, 0x00, 0xFB, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0xFE,
-0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x21, 0x00, 0x22,
-0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27,
-0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C,
-0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x30, 0x00, 0x31,
-0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
-0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B,
-0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x40,
-0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45,
-0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4A,
-0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F,
-0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54,
-0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59,
-0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C, 0x00, 0x5D, 0x00, 0x5E,
-0x00, 0x5F, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63,
-0x00, 0x64, 0x00, 0x65, 0x00, 0x66, 0x00, 0x67, 0x00, 0x68,
-0x00, 0x69, 0x00, 0x6A, 0x00, 0x6B, 0x00, 0x6C, 0x00, 0x6D,
-0x00, 0x6E, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x71, 0x00, 0x72,
-0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x76, 0x00, 0x77,
-0x00, 0x78, 0x00, 0x79, 0x00, 0x7A, 0x00, 0x7B, 0x00, 0x7C,
-0x00, 0x7D, 0x00, 0x7E, 0x00, 0xC0, 0x00, 0xC1, 0x00, 0xC2,
-0x00, 0xC3, 0x00, 0xC4, 0x00, 0xC5, 0x00, 0xC6, 0x00, 0xC7,
-0x00, 0xC8, 0x00, 0xC9, 0x00, 0xCA, 0x00, 0xCB, 0x00, 0xCC,
-0x00, 0xCD, 0x00, 0xCE, 0x00, 0xCF, 0x00, 0xD0, 0x00, 0xD1,
-0x00, 0xD2, 0x00, 0xD3, 0x00, 0xD4, 0x00, 0xD5, 0x00, 0xD6,
-0x00, 0xD7, 0x00, 0xD8, 0x00, 0xD9, 0x00, 0xDA, 0x00, 0xDB,
-0x00, 0xDC, 0x00, 0xDD, 0x00, 0xDE, 0x00, 0xDF, 0x00, 0xE0,
-0x00, 0xE1, 0x00, 0xE2, 0x00, 0xE3, 0x00, 0xE4, 0x00, 0xE5,
-0x00, 0xE6, 0x00, 0xE7, 0x00, 0xE8, 0x00, 0xE9, 0x00, 0xEA,
-0x00, 0xEB, 0x00, 0xEC, 0x00, 0xED, 0x00, 0xEE, 0x00, 0xEF,
-0x00, 0xF0, 0x00, 0xF1, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4,
-0x00, 0xF5, 0x00, 0xF6, 0x00, 0xF7, 0x00, 0xF8, 0x00, 0xF9,
-0x00, 0xFA, 0x00, 0xFB, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0xFE,
-0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05,
-0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A,
-0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0F,
-0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
-0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19,
-0x00, 0x1A, 0x00, 0x1B, 0x00, 0x1C, 0x00, 0x1D, 0x00, 0x1E,
-0x00, 0x1F, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23,
-0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28,
-0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D,
-0x00, 0x2E, 0x00, 0x2F, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32,
-0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37,
-0x00, 0x38, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C,
-0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x41,
-0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46,
-0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B,
-0x00, 0x4C, 0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F, 0x00, 0x50,
-0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55,
-0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5A,
-0x00, 0x5B, 0x00, 0x5C, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F,
-0x00, 0x61, 0x00, 0x63, 0x00, 0x65, 0x00, 0x67, 0x00, 0x69,
-0x00, 0x6A, 0x00, 0x6C, 0x00, 0x6D, 0x00, 0x6E, 0x00, 0x6F,
-0x00, 0x70, 0x00, 0x71, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74,
-0x00, 0x75, 0x00, 0x76, 0x00, 0x77, 0x00, 0x78, 0x00, 0x79,
-0x00, 0x7A, 0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x7E,
-0x00, 0x7F, 0x00, 0x80, 0x00, 0x81, 0x00, 0x82, 0x00, 0x83,
-0x00, 0x84, 0x00, 0x85, 0x00, 0x86, 0x00, 0x87, 0x00, 0x88,
-0x00, 0x89, 0x00, 0x8A, 0x00, 0x8B, 0x00, 0x8C, 0x00, 0x8D,
-0x00, 0x8E, 0x00, 0x8F, 0x00, 0x90, 0x00, 0x92, 0x00, 0x93,
-0x00, 0x94, 0x00, 0x95, 0x00, 0x96, 0x00, 0x97, 0x00, 0x98,
-0x00, 0x99, 0x00, 0x9A, 0x00, 0x9B, 0x00, 0x9C, 0x00, 0x9D,
-0x00, 0x9E, 0x00, 0x9F, 0x00, 0xA0, 0x00, 0xA1, 0x00, 0xA2,
-0x00, 0xA3, 0x00, 0xA4, 0x00, 0xA5, 0x00, 0x00, 0x00, 0x04,
-0x06, 0x46, 0x00, 0x00, 0x01, 0x3E, 0x01, 0x00, 0x00, 0x07,
-0x00, 0x3E, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24,
-0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29,
-0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E,
-0x00, 0x2F, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33,
-0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38,
-0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D,
-0x00, 0x3E, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42,
-0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47,
-0x00, 0x48, 0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C,
-0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F, 0x00, 0x50, 0x00, 0x51,
-0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56,
-0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5A, 0x00, 0x5B,
-0x00, 0x5C, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x60,
-0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65,
-0x00, 0x66, 0x00, 0x67, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6A,
-0x00, 0x6B, 0x00, 0x6C, 0x00, 0x6D, 0x00, 0x6E, 0x00, 0x6F,
-0x00, 0x70, 0x00, 0x71, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74,
-0x00, 0x75, 0x00, 0x76, 0x00, 0x77, 0x00, 0x78, 0x00, 0x79,
-0x00, 0x7A, 0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x7E,
-0x00, 0xC0, 0x00, 0xC1, 0x00, 0xC2, 0x00, 0xC3, 0x00, 0xC4,
-0x00, 0xC5, 0x00, 0xC6, 0x00, 0xC7, 0x00, 0xC8, 0x00, 0xC9,
-0x00, 0xCA, 0x00, 0xCB, 0x00, 0xCC, 0x00, 0xCD, 0x00, 0xCE,
-0x00, 0xCF, 0x00, 0xD0, 0x00, 0xD1, 0x00, 0xD2, 0x00, 0xD3,
-0x00, 0xD4, 0x00, 0xD5, 0x00, 0xD6, 0x00, 0xD7, 0x00, 0xD8,
-0x00, 0xD9, 0x00, 0xDA, 0x00, 0xDB, 0x00, 0xDC, 0x00, 0xDD,
-0x00, 0xDE, 0x00, 0xDF, 0x00, 0xE0, 0x00, 0xE1, 0x00, 0xE2,
-0x00, 0xE3, 0x00, 0xE4, 0x00, 0xE5, 0x00, 0xE6, 0x00, 0xE7,
-0x00, 0xE8, 0x00, 0xE9, 0x00, 0xEA, 0x00, 0xEB, 0x00, 0xEC,
-0x00, 0xED, 0x00, 0xEE, 0x00, 0xEF, 0x00, 0xF0, 0x00, 0xF1,
-0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF5, 0x00, 0xF6,
-0x00, 0xF7, 0x00, 0xF8, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB,
-0x00, 0xFC, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0xFF, 0xFF,
-0x00, 0x00, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24,
-0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29,
-0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E,
-0x00, 0x2F, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33,
-0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38,
-0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D,
-0x00, 0x3E, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42,
-0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47,
-0x00, 0x48, 0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C,
-0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F, 0x00, 0x50, 0x00, 0x51,
-0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56,
-0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5A, 0x00, 0x5B,
-0x00, 0x5C, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x60,
-0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65,
-0x00, 0x66, 0x00, 0x67, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6A,
-0x00, 0x6B, 0x00, 0x6C, 0x00, 0x6D, 0x00, 0x6E, 0x00, 0x6F,
-0x00, 0x70, 0x00, 0x71, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74,
-0x00, 0x75, 0x00, 0x76, 0x00, 0x77, 0x00, 0x78, 0x00, 0x79,
-0x00, 0x7A, 0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x7E,
-0x00, 0xC0, 0x00, 0xC1, 0x00, 0xC2, 0x00, 0xC3, 0x00, 0xC4,
-0x00, 0xC5, 0x00, 0xC6, 0x00, 0xC7, 0x00, 0xC8, 0x00, 0xC9,
-0x00, 0xCA, 0x00, 0xCB, 0x00, 0xCC, 0x00, 0xCD, 0x00, 0xCE,
-0x00, 0xCF, 0x00, 0xD0, 0x00, 0xD1, 0x00, 0xD2, 0x00, 0xD3,
-0x00, 0xD4, 0x00, 0xD5, 0x00, 0xD6, 0x00, 0xD7, 0x00, 0xD8,
-0x00, 0xD9, 0x00, 0xDA, 0x00, 0xDB, 0x00, 0xDC, 0x00, 0xDD,
-0x00, 0xDE, 0x00, 0xDF, 0x00, 0xE0, 0x00, 0xE1, 0x00, 0xE2,
-0x00, 0xE3, 0x00, 0xE4, 0x00, 0xE5, 0x00, 0xE6, 0x00, 0xE7,
-0x00, 0xE8, 0x00, 0xE9, 0x00, 0xEA, 0x00, 0xEB, 0x00, 0xEC,
-0x00, 0xED, 0x00, 0xEE, 0x00, 0xEF, 0x00, 0xF0, 0x00, 0xF1,
-0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF5, 0x00, 0xF6,
-0x00, 0xF7, 0x00, 0xF8, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB,
-0x00, 0xFC, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0xFF, 0xFF,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E,
-0x01, 0x3E, 0x01, 0x3E, 0x01, 0x3E, 0x00, 0x01, 0x00, 0x02,
-0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07,
-0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C,
-0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11,
-0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
-0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1A, 0x00, 0x1B,
-0x00, 0x1C, 0x00, 0x1D, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x20,
-0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25,
-0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A,
-0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F,
-0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34,
-0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39,
-0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E,
-0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43,
-0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48,
-0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D,
-0x00, 0x4E, 0x00, 0x4F, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52,
-0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57,
-0x00, 0x58, 0x00, 0x59, 0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C,
-0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x61, 0x00, 0x63,
-0x00, 0x65, 0x00, 0x67, 0x00, 0x69, 0x00, 0x6A, 0x00, 0x6C,
-0x00, 0x6D, 0x00, 0x6E, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x71,
-0x00, 0x72, 0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x76,
-0x00, 0x77, 0x00, 0x78, 0x00, 0x79, 0x00, 0x7A, 0x00, 0x7B,
-0x00, 0x7C, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x80,
-0x00, 0x81, 0x00, 0x82, 0x00, 0x83, 0x00, 0x84, 0x00, 0x85,
-0x00, 0x86, 0x00, 0x87, 0x00, 0x88, 0x00, 0x89, 0x00, 0x8A,
-0x00, 0x8B, 0x00, 0x8C, 0x00, 0x8D, 0x00, 0x8E, 0x00, 0x8F,
-0x00, 0x90, 0x00, 0x92, 0x00, 0x93, 0x00, 0x94, 0x00, 0x95,
-0x00, 0x96, 0x00, 0x97, 0x00, 0x98, 0x00, 0x99, 0x00, 0x9A,
-0x00, 0x9B, 0x00, 0x9C, 0x00, 0x9D, 0x00, 0x9E, 0x00, 0x9F,
-0x00, 0xA0, 0x00, 0xA1, 0x00, 0xA2, 0x00, 0xA3, 0x00, 0xA4,
-0x00, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-0x00, 0x00, 0x02, 0x58, 0x08, 0x00, 0x00, 0x03, 0x00, 0x07,
-0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0xFD, 0xAD,
-0x02, 0x4E, 0x00, 0x00, 0xFD, 0xB2, 0x00, 0x00, 0x08, 0x00,
-0x00, 0x00, 0xF8, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xF6,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x48, 0xFF, 0xF2, 0x00, 0xC4,
-0x02, 0xCA, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x37, 0x23,
-0x03, 0x33, 0x03, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
-0x06, 0x23, 0x22, 0x26, 0xA3, 0x39, 0x19, 0x6B, 0x74, 0x24,
-0x1A, 0x19, 0x25, 0x25, 0x19, 0x1A, 0x24, 0xC9, 0x02, 0x01,
-0xFD, 0x6C, 0x25, 0x1E, 0x1E, 0x25, 0x24, 0x20, 0x20, 0x00,
-0x02, 0x00, 0x41, 0x01, 0xC8, 0x01, 0x57, 0x02, 0xCA, 0x00,
-0x03, 0x00, 0x07, 0x00, 0x00, 0x13, 0x03, 0x23, 0x03, 0x21,
-0x03, 0x23, 0x03, 0xA0, 0x14, 0x37, 0x14, 0x01, 0x16, 0x14,
-0x37, 0x14, 0x02, 0xCA, 0xFE, 0xFE, 0x01, 0x02, 0xFE, 0xFE,
-0x01, 0x02, 0x00, 0x02, 0x00, 0x19, 0x00, 0x00, 0x02, 0x6C,
-0x02, 0xCA, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x07,
-0x33, 0x15, 0x23, 0x07, 0x23, 0x37, 0x23, 0x07, 0x23, 0x37,
-0x23, 0x35, 0x33, 0x37, 0x23, 0x35, 0x33, 0x37, 0x33, 0x07,
-0x33, 0x37, 0x33, 0x07, 0x33, 0x15, 0x05, 0x33, 0x37, 0x23,
-0x01, 0xE0, 0x1F, 0x89, 0x96, 0x29, 0x47, 0x29, 0x8F, 0x27,
-0x46, 0x26, 0x7E, 0x8B, 0x20, 0x86, 0x92, 0x28, 0x48, 0x28,
-0x90, 0x28, 0x45, 0x28, 0x7F, 0xFE, 0x7F, 0x8F, 0x1F, 0x8F,
-0x01, 0xB4, 0xA0, 0x43, 0xD1, 0xD1, 0xD1, 0xD1, 0x43, 0xA0,
-0x42, 0xD4, 0xD4, 0xD4, 0xD4, 0x42, 0xA0, 0xA0, 0x00, 0x03,
-0x00, 0x3E, 0xFF, 0xC6, 0x02, 0x04, 0x02, 0xF7, 0x00, 0x22,
-0x00, 0x29, 0x00, 0x30, 0x00, 0x00, 0x37, 0x26, 0x26, 0x27,
-0x35, 0x16, 0x16, 0x17, 0x35, 0x26, 0x26, 0x35, 0x34, 0x36,
-0x37, 0x35, 0x33, 0x15, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26,
-0x27, 0x15, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x07, 0x15, 0x23,
-0x11, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x13, 0x36, 0x36,
-0x35, 0x34, 0x26, 0x27, 0xFD, 0x37, 0x68, 0x20, 0x22, 0x6A,
-0x33, 0x63, 0x5C, 0x67, 0x58, 0x40, 0x35, 0x57, 0x24, 0x1B,
-0x20, 0x4D, 0x28, 0x42, 0x58, 0x2D, 0x68, 0x5F, 0x40, 0x36,
-0x33, 0x2D, 0x3C, 0x40, 0x3B, 0x36, 0x30, 0x41, 0x31, 0x01,
-0x11, 0x0F, 0x55, 0x10, 0x18, 0x01, 0xCA, 0x1B, 0x52, 0x47,
-0x4A, 0x54, 0x05, 0x58, 0x57, 0x01, 0x15, 0x0F, 0x4A, 0x0D,
-0x13, 0x03, 0xC9, 0x13, 0x2B, 0x3F, 0x32, 0x46, 0x57, 0x0A,
-0x6F, 0x02, 0x8C, 0x04, 0x2A, 0x21, 0x28, 0x2B, 0x0F, 0xFE,
-0xE2, 0x06, 0x2B, 0x22, 0x26, 0x27, 0x10, 0x00, 0x05, 0x00,
-0x31, 0xFF, 0xF6, 0x03, 0x0E, 0x02, 0xD4, 0x00, 0x0B, 0x00,
-0x0F, 0x00, 0x19, 0x00, 0x25, 0x00, 0x2F, 0x00, 0x00, 0x13,
-0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34,
-0x36, 0x05, 0x01, 0x23, 0x01, 0x05, 0x22, 0x06, 0x15, 0x14,
-0x16, 0x33, 0x32, 0x35, 0x34, 0x05, 0x32, 0x16, 0x15, 0x14,
-0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x17, 0x22, 0x06,
-0x15, 0x14, 0x16, 0x33, 0x32, 0x35, 0x34, 0xC3, 0x4A, 0x4C,
-0x49, 0x4D, 0x47, 0x4B, 0x46, 0x02, 0x15, 0xFE, 0x74, 0x4D,
-0x01, 0x8C, 0xFE, 0x84, 0x26, 0x23, 0x23, 0x26, 0x4D, 0x01,
-0x68, 0x49, 0x4D, 0x49, 0x4D, 0x47, 0x4B, 0x46, 0x4C, 0x26,
-0x23, 0x23, 0x26, 0x4D, 0x02, 0xD4, 0x75, 0x6A, 0x6A, 0x77,
-0x77, 0x6A, 0x6A, 0x75, 0x0A, 0xFD, 0x36, 0x02, 0xCA, 0x34,
-0x51, 0x50, 0x50, 0x52, 0xA2, 0xA1, 0xE0, 0x75, 0x6A, 0x6A,
-0x77, 0x77, 0x6A, 0x6A, 0x75, 0x3F, 0x50, 0x50, 0x51, 0x51,
-0xA2, 0xA0, 0x00, 0x03, 0x00, 0x35, 0xFF, 0xF6, 0x02, 0xDA,
-0x02, 0xD5, 0x00, 0x1F, 0x00, 0x2B, 0x00, 0x35, 0x00, 0x00,
-0x01, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x17, 0x36, 0x36,
-0x37, 0x33, 0x06, 0x06, 0x07, 0x17, 0x23, 0x27, 0x06, 0x06,
-0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x26, 0x26, 0x35,
-0x34, 0x36, 0x17, 0x22, 0x06, 0x15, 0x14, 0x16, 0x17, 0x36,
-0x36, 0x35, 0x34, 0x26, 0x03, 0x06, 0x06, 0x15, 0x14, 0x16,
-0x33, 0x32, 0x36, 0x37, 0x01, 0x30, 0x50, 0x5D, 0x51, 0x3E,
-0xC1, 0x1A, 0x21, 0x0B, 0x59, 0x10, 0x30, 0x26, 0x92, 0x77,
-0x57, 0x2F, 0x74, 0x53, 0x67, 0x7A, 0x53, 0x47, 0x20, 0x37,
-0x63, 0x52, 0x2A, 0x35, 0x26, 0x24, 0x3B, 0x33, 0x30, 0x52,
-0x36, 0x3D, 0x4A, 0x3E, 0x40, 0x5C, 0x1F, 0x02, 0xD5, 0x51,
-0x49, 0x3F, 0x58, 0x24, 0xBA, 0x1F, 0x51, 0x2F, 0x40, 0x6E,
-0x29, 0x8E, 0x54, 0x2A, 0x34, 0x66, 0x5E, 0x4D, 0x5D, 0x28,
-0x24, 0x52, 0x37, 0x4A, 0x52, 0x48, 0x2C, 0x27, 0x24, 0x3D,
-0x25, 0x22, 0x3D, 0x28, 0x24, 0x2E, 0xFE, 0xC8, 0x20, 0x42,
-0x36, 0x37, 0x42, 0x2A, 0x1D, 0x00, 0x01, 0x00, 0x41, 0x01,
-0xC8, 0x00, 0xA0, 0x02, 0xCA, 0x00, 0x03, 0x00, 0x00, 0x13,
-0x03, 0x23, 0x03, 0xA0, 0x14, 0x37, 0x14, 0x02, 0xCA, 0xFE,
-0xFE, 0x01, 0x02, 0x00, 0x01, 0x00, 0x28, 0xFF, 0x62, 0x01,
-0x0E, 0x02, 0xCA, 0x00, 0x0D, 0x00, 0x00, 0x13, 0x34, 0x36,
-0x37, 0x33, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x23, 0x26,
-0x26, 0x28, 0x47, 0x4C, 0x53, 0x46, 0x47, 0x47, 0x45, 0x52,
-0x4C, 0x47, 0x01, 0x12, 0x7A, 0xE3, 0x5B, 0x5E, 0xE2, 0x77,
-0x74, 0xDF, 0x5E, 0x58, 0xDF, 0x00, 0x01, 0x00, 0x1E, 0xFF,
-0x62, 0x01, 0x04, 0x02, 0xCA, 0x00, 0x0D, 0x00, 0x00, 0x01,
-0x14, 0x06, 0x07, 0x23, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27,
-0x33, 0x16, 0x16, 0x01, 0x04, 0x47, 0x4C, 0x52, 0x45, 0x47,
-0x47, 0x46, 0x53, 0x4C, 0x47, 0x01, 0x12, 0x79, 0xDF, 0x58,
-0x5E, 0xDF, 0x74, 0x77, 0xE2, 0x5E, 0x5B, 0xE3, 0x00, 0x01,
-0x00, 0x29, 0x01, 0x36, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x0E,
-0x00, 0x00, 0x01, 0x07, 0x37, 0x17, 0x07, 0x17, 0x07, 0x27,
-0x07, 0x27, 0x37, 0x27, 0x37, 0x17, 0x27, 0x01, 0x42, 0x14,
-0xC0, 0x0E, 0xB8, 0x77, 0x56, 0x55, 0x4D, 0x59, 0x75, 0xB6,
-0x0E, 0xBE, 0x15, 0x02, 0xF8, 0xC0, 0x36, 0x5C, 0x0F, 0x9E,
-0x2F, 0xAF, 0xAF, 0x2F, 0x9E, 0x0F, 0x5C, 0x36, 0xC0, 0x00,
-0x01, 0x00, 0x32, 0x00, 0x6F, 0x02, 0x08, 0x02, 0x53, 0x00,
-0x0B, 0x00, 0x00, 0x01, 0x33, 0x15, 0x23, 0x15, 0x23, 0x35,
-0x23, 0x35, 0x33, 0x35, 0x33, 0x01, 0x41, 0xC7, 0xC7, 0x48,
-0xC7, 0xC7, 0x48, 0x01, 0x84, 0x47, 0xCE, 0xCE, 0x47, 0xCF,
-0x00, 0x01, 0x00, 0x29, 0xFF, 0x7F, 0x00, 0xC0, 0x00, 0x74,
-0x00, 0x08, 0x00, 0x00, 0x37, 0x06, 0x06, 0x07, 0x23, 0x36,
-0x36, 0x37, 0x33, 0xC0, 0x0D, 0x31, 0x18, 0x41, 0x0E, 0x1D,
-0x07, 0x5E, 0x69, 0x35, 0x7F, 0x36, 0x39, 0x88, 0x34, 0x00,
-0x01, 0x00, 0x28, 0x00, 0xE5, 0x01, 0x1A, 0x01, 0x33, 0x00,
-0x03, 0x00, 0x00, 0x37, 0x35, 0x33, 0x15, 0x28, 0xF2, 0xE5,
-0x4E, 0x4E, 0x00, 0x01, 0x00, 0x48, 0xFF, 0xF2, 0x00, 0xC4,
-0x00, 0x79, 0x00, 0x0B, 0x00, 0x00, 0x37, 0x34, 0x36, 0x33,
-0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x48, 0x24,
-0x19, 0x1A, 0x25, 0x25, 0x1A, 0x19, 0x24, 0x36, 0x25, 0x1E,
-0x1E, 0x25, 0x24, 0x20, 0x20, 0x00, 0x01, 0x00, 0x0A, 0x00,
-0x00, 0x01, 0x6A, 0x02, 0xCA, 0x00, 0x03, 0x00, 0x00, 0x01,
-0x01, 0x23, 0x01, 0x01, 0x6A, 0xFE, 0xF6, 0x56, 0x01, 0x0A,
-0x02, 0xCA, 0xFD, 0x36, 0x02, 0xCA, 0x00, 0x02, 0x00, 0x31,
-0xFF, 0xF6, 0x02, 0x0B, 0x02, 0xD5, 0x00, 0x0D, 0x00, 0x19,
-0x00, 0x00, 0x01, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35,
-0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x05, 0x14, 0x16, 0x33,
-0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x02, 0x0B,
-0x30, 0x68, 0x56, 0x79, 0x73, 0x2F, 0x68, 0x55, 0x78, 0x76,
-0xFE, 0x7E, 0x43, 0x51, 0x50, 0x45, 0x45, 0x50, 0x51, 0x43,
-0x01, 0x66, 0x73, 0xA5, 0x58, 0xC3, 0xAD, 0x74, 0xA4, 0x57,
-0xC1, 0xAE, 0x93, 0x92, 0x91, 0x94, 0x92, 0x92, 0x92, 0x00,
-0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x63, 0x02, 0xCA, 0x00,
-0x0C, 0x00, 0x00, 0x21, 0x23, 0x11, 0x34, 0x36, 0x37, 0x06,
-0x06, 0x07, 0x07, 0x27, 0x37, 0x33, 0x01, 0x63, 0x56, 0x02,
-0x02, 0x10, 0x1A, 0x14, 0x4C, 0x2E, 0xC1, 0x49, 0x01, 0xF3,
-0x2B, 0x34, 0x1C, 0x10, 0x16, 0x11, 0x3E, 0x3B, 0x96, 0x00,
-0x01, 0x00, 0x30, 0x00, 0x00, 0x02, 0x08, 0x02, 0xD4, 0x00,
-0x1B, 0x00, 0x00, 0x21, 0x21, 0x35, 0x37, 0x3E, 0x02, 0x35,
-0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33,
-0x32, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x07, 0x15, 0x21,
-0x02, 0x08, 0xFE, 0x28, 0xBB, 0x36, 0x4A, 0x26, 0x46, 0x38,
-0x34, 0x4F, 0x29, 0x2F, 0x2A, 0x6D, 0x44, 0x64, 0x74, 0x2E,
-0x52, 0x37, 0x95, 0x01, 0x69, 0x49, 0xBD, 0x36, 0x54, 0x51,
-0x30, 0x3B, 0x3D, 0x24, 0x20, 0x3B, 0x23, 0x31, 0x65, 0x59,
-0x38, 0x62, 0x5F, 0x36, 0x93, 0x04, 0x00, 0x01, 0x00, 0x2D,
-0xFF, 0xF6, 0x02, 0x03, 0x02, 0xD4, 0x00, 0x2A, 0x00, 0x00,
-0x01, 0x14, 0x06, 0x07, 0x15, 0x16, 0x16, 0x15, 0x14, 0x06,
-0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32,
-0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x35, 0x33, 0x32, 0x36,
-0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36,
-0x33, 0x32, 0x16, 0x01, 0xED, 0x50, 0x44, 0x56, 0x54, 0x3A,
-0x79, 0x5F, 0x38, 0x60, 0x2C, 0x2D, 0x68, 0x30, 0x60, 0x55,
-0x69, 0x5F, 0x45, 0x46, 0x58, 0x5B, 0x46, 0x3C, 0x3A, 0x52,
-0x28, 0x2C, 0x26, 0x71, 0x48, 0x70, 0x6D, 0x02, 0x23, 0x48,
-0x55, 0x0E, 0x04, 0x0A, 0x58, 0x47, 0x3E, 0x61, 0x36, 0x11,
-0x16, 0x52, 0x16, 0x19, 0x4B, 0x42, 0x43, 0x3B, 0x4B, 0x4A,
-0x3D, 0x34, 0x39, 0x22, 0x1A, 0x3C, 0x1E, 0x2C, 0x64, 0x00,
-0x02, 0x00, 0x15, 0x00, 0x00, 0x02, 0x28, 0x02, 0xCE, 0x00,
-0x0A, 0x00, 0x14, 0x00, 0x00, 0x25, 0x23, 0x15, 0x23, 0x35,
-0x21, 0x35, 0x01, 0x33, 0x11, 0x33, 0x27, 0x34, 0x36, 0x37,
-0x23, 0x06, 0x06, 0x07, 0x03, 0x21, 0x02, 0x28, 0x68, 0x55,
-0xFE, 0xAA, 0x01, 0x50, 0x5B, 0x68, 0xBD, 0x04, 0x01, 0x04,
-0x08, 0x18, 0x0B, 0xD6, 0x01, 0x00, 0xA2, 0xA2, 0xA2, 0x4B,
-0x01, 0xE1, 0xFE, 0x23, 0xE1, 0x34, 0x49, 0x21, 0x13, 0x2C,
-0x0F, 0xFE, 0xCF, 0x00, 0x01, 0x00, 0x3F, 0xFF, 0xF6, 0x02,
-0x03, 0x02, 0xCA, 0x00, 0x1E, 0x00, 0x00, 0x01, 0x32, 0x16,
-0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16,
-0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07,
-0x27, 0x13, 0x21, 0x15, 0x21, 0x07, 0x36, 0x36, 0x01, 0x13,
-0x6E, 0x82, 0x8D, 0x7E, 0x37, 0x61, 0x21, 0x24, 0x67, 0x2F,
-0x4F, 0x61, 0x56, 0x5D, 0x1C, 0x48, 0x16, 0x2C, 0x1B, 0x01,
-0x66, 0xFE, 0xE5, 0x11, 0x11, 0x3A, 0x01, 0xB6, 0x6E, 0x64,
-0x6F, 0x7F, 0x14, 0x13, 0x53, 0x16, 0x19, 0x4B, 0x4F, 0x46,
-0x4B, 0x0A, 0x05, 0x1C, 0x01, 0x51, 0x50, 0xCF, 0x03, 0x08,
-0x00, 0x02, 0x00, 0x37, 0xFF, 0xF6, 0x02, 0x0D, 0x02, 0xD4,
-0x00, 0x1E, 0x00, 0x2C, 0x00, 0x00, 0x13, 0x34, 0x3E, 0x02,
-0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x0E,
-0x02, 0x07, 0x33, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
-0x06, 0x23, 0x22, 0x26, 0x26, 0x17, 0x32, 0x36, 0x35, 0x34,
-0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x37,
-0x1B, 0x47, 0x80, 0x65, 0x15, 0x33, 0x10, 0x12, 0x2D, 0x17,
-0x45, 0x5C, 0x35, 0x18, 0x03, 0x06, 0x17, 0x52, 0x40, 0x5D,
-0x72, 0x7B, 0x68, 0x44, 0x6E, 0x41, 0xF2, 0x3F, 0x4E, 0x45,
-0x45, 0x2F, 0x46, 0x27, 0x22, 0x44, 0x01, 0x31, 0x4D, 0x95,
-0x79, 0x48, 0x04, 0x05, 0x4B, 0x06, 0x06, 0x2E, 0x50, 0x68,
-0x3B, 0x23, 0x31, 0x71, 0x68, 0x70, 0x80, 0x44, 0x8C, 0x86,
-0x51, 0x55, 0x44, 0x50, 0x27, 0x3C, 0x20, 0x2B, 0x55, 0x37,
-0x00, 0x01, 0x00, 0x2C, 0x00, 0x00, 0x02, 0x0B, 0x02, 0xCA,
-0x00, 0x06, 0x00, 0x00, 0x33, 0x01, 0x21, 0x35, 0x21, 0x15,
-0x01, 0x88, 0x01, 0x25, 0xFE, 0x7F, 0x01, 0xDF, 0xFE, 0xDE,
-0x02, 0x7A, 0x50, 0x44, 0xFD, 0x7A, 0x00, 0x03, 0x00, 0x31,
-0xFF, 0xF6, 0x02, 0x0A, 0x02, 0xD4, 0x00, 0x1B, 0x00, 0x28,
-0x00, 0x35, 0x00, 0x00, 0x01, 0x32, 0x16, 0x15, 0x14, 0x06,
-0x06, 0x07, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26,
-0x35, 0x34, 0x36, 0x36, 0x37, 0x26, 0x26, 0x35, 0x34, 0x36,
-0x36, 0x17, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x17, 0x36,
-0x36, 0x35, 0x34, 0x26, 0x03, 0x14, 0x16, 0x33, 0x32, 0x36,
-0x35, 0x34, 0x26, 0x27, 0x27, 0x06, 0x06, 0x01, 0x1D, 0x5E,
-0x78, 0x25, 0x3E, 0x25, 0x2C, 0x48, 0x2B, 0x7F, 0x6B, 0x73,
-0x7C, 0x29, 0x44, 0x27, 0x34, 0x49, 0x38, 0x60, 0x3C, 0x37,
-0x47, 0x23, 0x3C, 0x24, 0x34, 0x47, 0x46, 0xCF, 0x4A, 0x4D,
-0x49, 0x4D, 0x52, 0x44, 0x10, 0x42, 0x45, 0x02, 0xD4, 0x58,
-0x53, 0x2B, 0x40, 0x31, 0x13, 0x15, 0x35, 0x46, 0x31, 0x5A,
-0x69, 0x65, 0x5B, 0x31, 0x48, 0x34, 0x12, 0x1E, 0x55, 0x42,
-0x37, 0x4B, 0x28, 0x47, 0x35, 0x32, 0x25, 0x32, 0x23, 0x10,
-0x16, 0x3E, 0x36, 0x32, 0x35, 0xFE, 0x28, 0x34, 0x45, 0x45,
-0x37, 0x34, 0x45, 0x1A, 0x06, 0x1C, 0x49, 0x00, 0x02, 0x00,
-0x32, 0xFF, 0xF6, 0x02, 0x08, 0x02, 0xD4, 0x00, 0x1E, 0x00,
-0x2C, 0x00, 0x00, 0x01, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x26,
-0x27, 0x35, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x37, 0x23, 0x06,
-0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
-0x16, 0x16, 0x27, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32,
-0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x02, 0x08, 0x1B, 0x47,
-0x81, 0x65, 0x14, 0x35, 0x11, 0x27, 0x31, 0x46, 0x5B, 0x36,
-0x18, 0x02, 0x06, 0x16, 0x53, 0x41, 0x5C, 0x71, 0x39, 0x66,
-0x45, 0x44, 0x6E, 0x40, 0xF2, 0x3E, 0x4F, 0x43, 0x46, 0x30,
-0x46, 0x27, 0x22, 0x44, 0x01, 0x99, 0x4D, 0x95, 0x79, 0x48,
-0x05, 0x05, 0x4B, 0x0D, 0x2E, 0x4F, 0x69, 0x3A, 0x22, 0x31,
-0x71, 0x67, 0x4B, 0x6C, 0x3A, 0x45, 0x8B, 0x86, 0x52, 0x54,
-0x45, 0x4F, 0x27, 0x3C, 0x20, 0x2B, 0x54, 0x38, 0x00, 0x02,
-0x00, 0x48, 0xFF, 0xF2, 0x00, 0xC4, 0x02, 0x26, 0x00, 0x0B,
-0x00, 0x17, 0x00, 0x00, 0x13, 0x34, 0x36, 0x33, 0x32, 0x16,
-0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x11, 0x34, 0x36, 0x33,
-0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x48, 0x24,
-0x19, 0x1A, 0x25, 0x25, 0x1A, 0x19, 0x24, 0x24, 0x19, 0x1A,
-0x25, 0x25, 0x1A, 0x19, 0x24, 0x01, 0xE2, 0x26, 0x1E, 0x1E,
-0x26, 0x24, 0x20, 0x20, 0xFE, 0x78, 0x25, 0x1E, 0x1E, 0x25,
-0x24, 0x20, 0x20, 0x00, 0x02, 0x00, 0x1F, 0xFF, 0x7F, 0x00,
-0xC2, 0x02, 0x26, 0x00, 0x0B, 0x00, 0x15, 0x00, 0x00, 0x13,
-0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
-0x26, 0x13, 0x06, 0x06, 0x07, 0x23, 0x3E, 0x02, 0x37, 0x33,
-0x46, 0x24, 0x19, 0x1A, 0x25, 0x25, 0x1A, 0x19, 0x24, 0x71,
-0x0D, 0x31, 0x18, 0x42, 0x0A, 0x13, 0x11, 0x05, 0x5E, 0x01,
-0xE2, 0x26, 0x1E, 0x1E, 0x26, 0x24, 0x20, 0x20, 0xFE, 0xAB,
-0x34, 0x81, 0x35, 0x26, 0x57, 0x55, 0x23, 0x00, 0x01, 0x00,
-0x32, 0x00, 0x74, 0x02, 0x09, 0x02, 0x60, 0x00, 0x06, 0x00,
-0x00, 0x25, 0x25, 0x35, 0x25, 0x15, 0x05, 0x05, 0x02, 0x09,
-0xFE, 0x29, 0x01, 0xD7, 0xFE, 0x87, 0x01, 0x79, 0x74, 0xCF,
-0x32, 0xEB, 0x4E, 0xB2, 0x9E, 0x00, 0x02, 0x00, 0x38, 0x00,
-0xD9, 0x02, 0x02, 0x01, 0xE7, 0x00, 0x03, 0x00, 0x07, 0x00,
-0x00, 0x13, 0x35, 0x21, 0x15, 0x05, 0x35, 0x21, 0x15, 0x38,
-0x01, 0xCA, 0xFE, 0x36, 0x01, 0xCA, 0x01, 0xA0, 0x47, 0x47,
-0xC7, 0x47, 0x47, 0x00, 0x01, 0x00, 0x32, 0x00, 0x74, 0x02,
-0x09, 0x02, 0x60, 0x00, 0x06, 0x00, 0x00, 0x37, 0x25, 0x25,
-0x35, 0x05, 0x15, 0x05, 0x32, 0x01, 0x79, 0xFE, 0x87, 0x01,
-0xD7, 0xFE, 0x29, 0xC2, 0x9D, 0xB3, 0x4E, 0xEB, 0x32, 0xCF,
-0x00, 0x02, 0x00, 0x0C, 0xFF, 0xF2, 0x01, 0x98, 0x02, 0xD4,
-0x00, 0x1F, 0x00, 0x2B, 0x00, 0x00, 0x37, 0x34, 0x36, 0x36,
-0x37, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07,
-0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x06,
-0x07, 0x0E, 0x02, 0x15, 0x15, 0x23, 0x07, 0x34, 0x36, 0x33,
-0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x8C, 0x0F,
-0x25, 0x20, 0x27, 0x2B, 0x12, 0x3E, 0x3B, 0x31, 0x4C, 0x23,
-0x1F, 0x28, 0x61, 0x3C, 0x5F, 0x68, 0x1D, 0x35, 0x24, 0x21,
-0x23, 0x0C, 0x46, 0x17, 0x23, 0x1B, 0x19, 0x24, 0x24, 0x19,
-0x1B, 0x23, 0xE4, 0x26, 0x37, 0x32, 0x1B, 0x21, 0x2C, 0x2A,
-0x1E, 0x30, 0x34, 0x19, 0x11, 0x46, 0x15, 0x1C, 0x5E, 0x51,
-0x2D, 0x3F, 0x35, 0x1E, 0x1C, 0x2A, 0x29, 0x1D, 0x11, 0x93,
-0x25, 0x1E, 0x1E, 0x25, 0x24, 0x20, 0x20, 0x00, 0x02, 0x00,
-0x3A, 0xFF, 0xA7, 0x03, 0x49, 0x02, 0xCA, 0x00, 0x3F, 0x00,
-0x4D, 0x00, 0x00, 0x01, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x26,
-0x27, 0x23, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36,
-0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x06, 0x14, 0x15, 0x14,
-0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37,
-0x15, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E,
-0x02, 0x33, 0x32, 0x16, 0x16, 0x05, 0x14, 0x16, 0x33, 0x32,
-0x36, 0x37, 0x37, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x03,
-0x49, 0x15, 0x2C, 0x40, 0x2C, 0x2E, 0x35, 0x06, 0x05, 0x12,
-0x46, 0x35, 0x4C, 0x53, 0x34, 0x5F, 0x41, 0x2C, 0x55, 0x18,
-0x0A, 0x01, 0x25, 0x19, 0x1F, 0x2B, 0x17, 0x4B, 0x83, 0x53,
-0x72, 0x9D, 0x51, 0x9C, 0x93, 0x3D, 0x6F, 0x2B, 0x2B, 0x6B,
-0x41, 0x76, 0xA8, 0x59, 0x3A, 0x6E, 0x9D, 0x63, 0x68, 0xA2,
-0x5D, 0xFE, 0x07, 0x33, 0x2B, 0x38, 0x31, 0x04, 0x06, 0x0D,
-0x28, 0x15, 0x31, 0x3C, 0x1A, 0x01, 0x65, 0x2E, 0x58, 0x47,
-0x2B, 0x35, 0x22, 0x25, 0x32, 0x66, 0x54, 0x42, 0x65, 0x3A,
-0x0F, 0x09, 0xCB, 0x12, 0x0F, 0x03, 0x34, 0x22, 0x33, 0x55,
-0x33, 0x5D, 0x81, 0x44, 0x5E, 0xA5, 0x6A, 0x94, 0x9E, 0x1B,
-0x10, 0x44, 0x12, 0x17, 0x58, 0xA5, 0x74, 0x5D, 0x9F, 0x75,
-0x41, 0x56, 0xA0, 0xAF, 0x40, 0x3A, 0x54, 0x43, 0x7D, 0x04,
-0x06, 0x30, 0x4B, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02,
-0x7E, 0x02, 0xCD, 0x00, 0x07, 0x00, 0x11, 0x00, 0x00, 0x21,
-0x27, 0x21, 0x07, 0x23, 0x01, 0x33, 0x01, 0x01, 0x2E, 0x02,
-0x27, 0x06, 0x06, 0x07, 0x07, 0x33, 0x02, 0x21, 0x56, 0xFE,
-0xE5, 0x55, 0x5B, 0x01, 0x17, 0x51, 0x01, 0x16, 0xFE, 0xE2,
-0x03, 0x0E, 0x0D, 0x04, 0x07, 0x12, 0x06, 0x51, 0xE2, 0xDD,
-0xDD, 0x02, 0xCD, 0xFD, 0x33, 0x02, 0x05, 0x08, 0x2A, 0x2D,
-0x0C, 0x1F, 0x3B, 0x11, 0xD8, 0x00, 0x03, 0x00, 0x61, 0x00,
-0x00, 0x02, 0x54, 0x02, 0xCA, 0x00, 0x10, 0x00, 0x19, 0x00,
-0x22, 0x00, 0x00, 0x01, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07,
-0x15, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x23, 0x23, 0x11, 0x13,
-0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x15, 0x15, 0x11,
-0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x01, 0x2D, 0x86,
-0x89, 0x46, 0x42, 0x2D, 0x49, 0x2A, 0x85, 0x73, 0xFB, 0xDE,
-0x5C, 0x44, 0x53, 0x5B, 0x76, 0x90, 0x5F, 0x4A, 0x4D, 0x63,
-0x02, 0xCA, 0x4F, 0x62, 0x3F, 0x53, 0x0C, 0x05, 0x07, 0x26,
-0x46, 0x38, 0x61, 0x6A, 0x02, 0xCA, 0xFE, 0xD0, 0x3B, 0x3A,
-0x3B, 0x33, 0xE3, 0x4B, 0xFE, 0xFD, 0x4A, 0x3C, 0x38, 0x45,
-0x00, 0x01, 0x00, 0x3D, 0xFF, 0xF6, 0x02, 0x59, 0x02, 0xD4,
-0x00, 0x1A, 0x00, 0x00, 0x01, 0x22, 0x06, 0x15, 0x14, 0x16,
-0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23, 0x22, 0x26,
-0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x17, 0x07, 0x26,
-0x26, 0x01, 0x93, 0x73, 0x84, 0x7B, 0x7B, 0x2F, 0x54, 0x28,
-0x28, 0x55, 0x3B, 0x6D, 0x92, 0x49, 0x4F, 0x9A, 0x6E, 0x71,
-0x54, 0x24, 0x21, 0x51, 0x02, 0x85, 0x9A, 0x86, 0x85, 0x9B,
-0x10, 0x0C, 0x4E, 0x0F, 0x0E, 0x5A, 0xA6, 0x70, 0x6C, 0xA5,
-0x5D, 0x2A, 0x4C, 0x0F, 0x18, 0x00, 0x02, 0x00, 0x61, 0x00,
-0x00, 0x02, 0x9D, 0x02, 0xCA, 0x00, 0x09, 0x00, 0x11, 0x00,
-0x00, 0x01, 0x14, 0x06, 0x23, 0x23, 0x11, 0x33, 0x32, 0x16,
-0x16, 0x07, 0x34, 0x26, 0x23, 0x23, 0x11, 0x33, 0x20, 0x02,
-0x9D, 0xC5, 0xB0, 0xC7, 0xDC, 0x6C, 0x9E, 0x56, 0x5F, 0x8D,
-0x81, 0x75, 0x61, 0x01, 0x22, 0x01, 0x6C, 0xB5, 0xB7, 0x02,
-0xCA, 0x50, 0x9B, 0x76, 0x8F, 0x85, 0xFD, 0xD0, 0x00, 0x01,
-0x00, 0x61, 0x00, 0x00, 0x01, 0xF0, 0x02, 0xCA, 0x00, 0x0B,
-0x00, 0x00, 0x21, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21,
-0x15, 0x21, 0x15, 0x21, 0x01, 0xF0, 0xFE, 0x71, 0x01, 0x8F,
-0xFE, 0xCB, 0x01, 0x23, 0xFE, 0xDD, 0x01, 0x35, 0x02, 0xCA,
-0x4F, 0xDF, 0x4E, 0xFF, 0x00, 0x01, 0x00, 0x61, 0x00, 0x00,
-0x01, 0xF0, 0x02, 0xCA, 0x00, 0x09, 0x00, 0x00, 0x33, 0x23,
-0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0xBB, 0x5A,
-0x01, 0x8F, 0xFE, 0xCB, 0x01, 0x22, 0xFE, 0xDE, 0x02, 0xCA,
-0x4F, 0xFD, 0x4F, 0x00, 0x01, 0x00, 0x3D, 0xFF, 0xF6, 0x02,
-0x8E, 0x02, 0xD4, 0x00, 0x20, 0x00, 0x00, 0x01, 0x33, 0x11,
-0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
-0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06,
-0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x35, 0x23,
-0x01, 0x97, 0xF7, 0x3A, 0x76, 0x4B, 0x6F, 0x98, 0x4F, 0x58,
-0xA5, 0x75, 0x3C, 0x6B, 0x2E, 0x22, 0x26, 0x5F, 0x33, 0x80,
-0x8F, 0x37, 0x76, 0x60, 0x2F, 0x42, 0x1B, 0x9D, 0x01, 0x79,
-0xFE, 0xA2, 0x13, 0x12, 0x59, 0xA5, 0x71, 0x70, 0xA4, 0x5B,
-0x16, 0x14, 0x4E, 0x11, 0x18, 0x9A, 0x86, 0x55, 0x83, 0x49,
-0x0A, 0x07, 0xD4, 0x00, 0x01, 0x00, 0x61, 0x00, 0x00, 0x02,
-0x83, 0x02, 0xCA, 0x00, 0x0B, 0x00, 0x00, 0x21, 0x23, 0x11,
-0x21, 0x11, 0x23, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x02,
-0x83, 0x5A, 0xFE, 0x92, 0x5A, 0x5A, 0x01, 0x6E, 0x5A, 0x01,
-0x4D, 0xFE, 0xB3, 0x02, 0xCA, 0xFE, 0xD2, 0x01, 0x2E, 0x00,
-0x01, 0x00, 0x28, 0x00, 0x00, 0x01, 0x2A, 0x02, 0xCA, 0x00,
-0x0B, 0x00, 0x00, 0x21, 0x21, 0x35, 0x37, 0x11, 0x27, 0x35,
-0x21, 0x15, 0x07, 0x11, 0x17, 0x01, 0x2A, 0xFE, 0xFE, 0x54,
-0x54, 0x01, 0x02, 0x54, 0x54, 0x34, 0x13, 0x02, 0x3B, 0x14,
-0x34, 0x34, 0x14, 0xFD, 0xC5, 0x13, 0x00, 0x01, 0xFF, 0xB2,
-0xFF, 0x42, 0x00, 0xB6, 0x02, 0xCA, 0x00, 0x10, 0x00, 0x00,
-0x07, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36,
-0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x06, 0x04, 0x18, 0x24,
-0x0E, 0x10, 0x24, 0x14, 0x19, 0x2D, 0x1C, 0x5A, 0x66, 0xBE,
-0x07, 0x06, 0x4C, 0x04, 0x06, 0x14, 0x32, 0x2D, 0x02, 0xC6,
-0xFD, 0x41, 0x67, 0x62, 0x00, 0x01, 0x00, 0x61, 0x00, 0x00,
-0x02, 0x6B, 0x02, 0xCA, 0x00, 0x0E, 0x00, 0x00, 0x21, 0x23,
-0x03, 0x07, 0x11, 0x23, 0x11, 0x33, 0x11, 0x36, 0x36, 0x37,
-0x37, 0x33, 0x01, 0x02, 0x6B, 0x6A, 0xFD, 0x49, 0x5A, 0x5A,
-0x1E, 0x3E, 0x1F, 0xC1, 0x69, 0xFE, 0xE5, 0x01, 0x55, 0x40,
-0xFE, 0xEB, 0x02, 0xCA, 0xFE, 0xA0, 0x22, 0x44, 0x22, 0xD8,
-0xFE, 0xC9, 0x00, 0x01, 0x00, 0x61, 0x00, 0x00, 0x01, 0xF3,
-0x02, 0xCA, 0x00, 0x05, 0x00, 0x00, 0x33, 0x11, 0x33, 0x11,
-0x21, 0x15, 0x61, 0x5A, 0x01, 0x38, 0x02, 0xCA, 0xFD, 0x86,
-0x50, 0x00, 0x01, 0x00, 0x61, 0x00, 0x00, 0x03, 0x2A, 0x02,
-0xCA, 0x00, 0x15, 0x00, 0x00, 0x21, 0x03, 0x23, 0x16, 0x16,
-0x15, 0x11, 0x23, 0x11, 0x33, 0x13, 0x33, 0x13, 0x33, 0x11,
-0x23, 0x11, 0x34, 0x36, 0x37, 0x23, 0x03, 0x01, 0x9C, 0xEB,
-0x04, 0x03, 0x04, 0x53, 0x85, 0xDC, 0x04, 0xE0, 0x84, 0x59,
-0x05, 0x02, 0x04, 0xEE, 0x02, 0x72, 0x1F, 0x69, 0x39, 0xFE,
-0x4F, 0x02, 0xCA, 0xFD, 0xB7, 0x02, 0x49, 0xFD, 0x36, 0x01,
-0xB7, 0x34, 0x66, 0x20, 0xFD, 0x8F, 0x00, 0x01, 0x00, 0x61,
-0x00, 0x00, 0x02, 0x97, 0x02, 0xCA, 0x00, 0x12, 0x00, 0x00,
-0x21, 0x23, 0x01, 0x23, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11,
-0x33, 0x01, 0x33, 0x2E, 0x02, 0x35, 0x11, 0x33, 0x02, 0x97,
-0x69, 0xFE, 0x82, 0x04, 0x02, 0x06, 0x53, 0x68, 0x01, 0x7D,
-0x04, 0x01, 0x03, 0x03, 0x54, 0x02, 0x51, 0x23, 0x68, 0x37,
-0xFE, 0x71, 0x02, 0xCA, 0xFD, 0xB1, 0x10, 0x40, 0x4C, 0x20,
-0x01, 0x93, 0x00, 0x02, 0x00, 0x3D, 0xFF, 0xF6, 0x02, 0xD0,
-0x02, 0xD5, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x00, 0x01, 0x14,
-0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
-0x33, 0x32, 0x16, 0x16, 0x05, 0x14, 0x16, 0x33, 0x32, 0x36,
-0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x02, 0xD0, 0x4B, 0x92,
-0x6C, 0x6F, 0x93, 0x48, 0x48, 0x93, 0x70, 0x6B, 0x92, 0x4B,
-0xFD, 0xCC, 0x72, 0x79, 0x7A, 0x70, 0x70, 0x79, 0x79, 0x73,
-0x01, 0x66, 0x6F, 0xA5, 0x5C, 0x5C, 0xA6, 0x6F, 0x6E, 0xA4,
-0x5C, 0x5B, 0xA5, 0x6F, 0x87, 0x9B, 0x9B, 0x87, 0x87, 0x99,
-0x99, 0x00, 0x02, 0x00, 0x61, 0x00, 0x00, 0x02, 0x2A, 0x02,
-0xCA, 0x00, 0x0B, 0x00, 0x14, 0x00, 0x00, 0x01, 0x32, 0x16,
-0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x11, 0x23, 0x11, 0x17,
-0x23, 0x11, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x01, 0x1E,
-0x8C, 0x80, 0x35, 0x7D, 0x6B, 0x52, 0x5A, 0xB5, 0x5B, 0x48,
-0x66, 0x64, 0x58, 0x02, 0xCA, 0x6E, 0x64, 0x3B, 0x67, 0x40,
-0xFE, 0xEA, 0x02, 0xCA, 0x4D, 0xFE, 0xE6, 0x42, 0x4F, 0x45,
-0x44, 0x00, 0x02, 0x00, 0x3D, 0xFF, 0x56, 0x02, 0xD0, 0x02,
-0xD5, 0x00, 0x14, 0x00, 0x20, 0x00, 0x00, 0x01, 0x14, 0x06,
-0x07, 0x17, 0x23, 0x27, 0x22, 0x06, 0x23, 0x22, 0x26, 0x26,
-0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x05, 0x14,
-0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-0x02, 0xD0, 0x69, 0x67, 0xAB, 0x81, 0x8A, 0x06, 0x0D, 0x06,
-0x6F, 0x93, 0x48, 0x48, 0x93, 0x70, 0x6B, 0x92, 0x4B, 0xFD,
-0xCC, 0x72, 0x79, 0x7A, 0x70, 0x70, 0x79, 0x79, 0x73, 0x01,
-0x66, 0x83, 0xB8, 0x23, 0xB2, 0xA1, 0x01, 0x5C, 0xA6, 0x6F,
-0x6E, 0xA4, 0x5C, 0x5B, 0xA5, 0x6F, 0x87, 0x9B, 0x9B, 0x87,
-0x87, 0x99, 0x99, 0x00, 0x02, 0x00, 0x61, 0x00, 0x00, 0x02,
-0x5F, 0x02, 0xCA, 0x00, 0x0E, 0x00, 0x17, 0x00, 0x00, 0x01,
-0x32, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x13, 0x23, 0x03,
-0x23, 0x11, 0x23, 0x11, 0x17, 0x23, 0x11, 0x33, 0x32, 0x36,
-0x35, 0x34, 0x26, 0x01, 0x26, 0x85, 0x7F, 0x2A, 0x41, 0x24,
-0xC4, 0x69, 0xAD, 0x8E, 0x5A, 0xC0, 0x66, 0x6B, 0x57, 0x50,
-0x54, 0x02, 0xCA, 0x65, 0x66, 0x39, 0x4C, 0x2D, 0x0D, 0xFE,
-0xC0, 0x01, 0x27, 0xFE, 0xD9, 0x02, 0xCA, 0x4E, 0xFE, 0xF7,
-0x45, 0x43, 0x46, 0x3B, 0x00, 0x01, 0x00, 0x33, 0xFF, 0xF6,
-0x01, 0xF6, 0x02, 0xD4, 0x00, 0x29, 0x00, 0x00, 0x25, 0x14,
-0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32,
-0x36, 0x35, 0x34, 0x26, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34,
-0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23,
-0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x17, 0x1E, 0x02, 0x01,
-0xF6, 0x8A, 0x75, 0x3C, 0x66, 0x22, 0x24, 0x6B, 0x39, 0x50,
-0x51, 0x1E, 0x49, 0x41, 0x5B, 0x5D, 0x3A, 0x67, 0x43, 0x3B,
-0x62, 0x28, 0x1C, 0x25, 0x57, 0x2F, 0x43, 0x44, 0x1E, 0x44,
-0x3A, 0x3F, 0x57, 0x2D, 0xBF, 0x5F, 0x6A, 0x12, 0x10, 0x56,
-0x10, 0x1A, 0x3E, 0x35, 0x23, 0x30, 0x29, 0x17, 0x21, 0x60,
-0x53, 0x39, 0x51, 0x2C, 0x16, 0x12, 0x4D, 0x10, 0x16, 0x39,
-0x2F, 0x24, 0x30, 0x26, 0x16, 0x17, 0x35, 0x4A, 0x00, 0x01,
-0x00, 0x0A, 0x00, 0x00, 0x02, 0x21, 0x02, 0xCA, 0x00, 0x07,
-0x00, 0x00, 0x21, 0x23, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23,
-0x01, 0x43, 0x5A, 0xDF, 0x02, 0x17, 0xDE, 0x02, 0x7B, 0x4F,
-0x4F, 0x00, 0x01, 0x00, 0x5A, 0xFF, 0xF6, 0x02, 0x80, 0x02,
-0xCA, 0x00, 0x12, 0x00, 0x00, 0x25, 0x14, 0x06, 0x06, 0x23,
-0x22, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x33, 0x32,
-0x36, 0x35, 0x11, 0x33, 0x02, 0x80, 0x3C, 0x7B, 0x5F, 0x85,
-0x8B, 0x5A, 0x5D, 0x5E, 0x61, 0x57, 0x59, 0xFC, 0x4A, 0x77,
-0x45, 0x91, 0x77, 0x01, 0xCC, 0xFE, 0x31, 0x57, 0x60, 0x67,
-0x51, 0x01, 0xCE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02,
-0x58, 0x02, 0xCA, 0x00, 0x0C, 0x00, 0x00, 0x01, 0x03, 0x23,
-0x03, 0x33, 0x13, 0x16, 0x16, 0x17, 0x36, 0x36, 0x37, 0x13,
-0x02, 0x58, 0xFF, 0x5A, 0xFF, 0x5E, 0xA1, 0x10, 0x16, 0x07,
-0x07, 0x16, 0x10, 0xA0, 0x02, 0xCA, 0xFD, 0x36, 0x02, 0xCA,
-0xFE, 0x36, 0x2C, 0x4D, 0x23, 0x23, 0x4E, 0x2D, 0x01, 0xC8,
-0x00, 0x01, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x95, 0x02, 0xCA,
-0x00, 0x1F, 0x00, 0x00, 0x01, 0x03, 0x23, 0x03, 0x2E, 0x02,
-0x27, 0x06, 0x06, 0x07, 0x03, 0x23, 0x03, 0x33, 0x13, 0x16,
-0x16, 0x17, 0x36, 0x36, 0x37, 0x13, 0x33, 0x13, 0x16, 0x16,
-0x17, 0x36, 0x36, 0x37, 0x13, 0x03, 0x95, 0xBE, 0x5B, 0x8B,
-0x08, 0x10, 0x0A, 0x02, 0x01, 0x13, 0x0E, 0x87, 0x5B, 0xBD,
-0x5E, 0x6F, 0x0C, 0x11, 0x05, 0x05, 0x14, 0x0D, 0x7E, 0x5D,
-0x83, 0x0E, 0x14, 0x05, 0x05, 0x12, 0x0C, 0x6E, 0x02, 0xCA,
-0xFD, 0x36, 0x01, 0xD4, 0x1D, 0x3A, 0x2D, 0x09, 0x0D, 0x55,
-0x2E, 0xFE, 0x2F, 0x02, 0xCA, 0xFE, 0x4C, 0x2E, 0x56, 0x26,
-0x27, 0x5C, 0x2C, 0x01, 0xAF, 0xFE, 0x4E, 0x2E, 0x5B, 0x23,
-0x25, 0x57, 0x2F, 0x01, 0xB3, 0x00, 0x01, 0x00, 0x04, 0x00,
-0x00, 0x02, 0x46, 0x02, 0xCA, 0x00, 0x0B, 0x00, 0x00, 0x21,
-0x23, 0x03, 0x03, 0x23, 0x13, 0x03, 0x33, 0x13, 0x13, 0x33,
-0x03, 0x02, 0x46, 0x66, 0xBD, 0xC0, 0x5F, 0xED, 0xDE, 0x64,
-0xAF, 0xB0, 0x5F, 0xDD, 0x01, 0x36, 0xFE, 0xCA, 0x01, 0x74,
-0x01, 0x56, 0xFE, 0xE8, 0x01, 0x18, 0xFE, 0xAC, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x02, 0x36, 0x02, 0xCA, 0x00, 0x08,
-0x00, 0x00, 0x01, 0x13, 0x33, 0x03, 0x11, 0x23, 0x11, 0x03,
-0x33, 0x01, 0x1B, 0xBA, 0x61, 0xEE, 0x5A, 0xEE, 0x62, 0x01,
-0x6B, 0x01, 0x5F, 0xFE, 0x4B, 0xFE, 0xEB, 0x01, 0x11, 0x01,
-0xB9, 0x00, 0x01, 0x00, 0x26, 0x00, 0x00, 0x02, 0x15, 0x02,
-0xCA, 0x00, 0x09, 0x00, 0x00, 0x21, 0x21, 0x35, 0x01, 0x21,
-0x35, 0x21, 0x15, 0x01, 0x21, 0x02, 0x15, 0xFE, 0x11, 0x01,
-0x78, 0xFE, 0x94, 0x01, 0xD9, 0xFE, 0x88, 0x01, 0x82, 0x44,
-0x02, 0x36, 0x50, 0x44, 0xFD, 0xCA, 0x00, 0x01, 0x00, 0x50,
-0xFF, 0x62, 0x01, 0x30, 0x02, 0xCA, 0x00, 0x07, 0x00, 0x00,
-0x05, 0x23, 0x11, 0x33, 0x15, 0x23, 0x11, 0x33, 0x01, 0x30,
-0xE0, 0xE0, 0x8A, 0x8A, 0x9E, 0x03, 0x68, 0x48, 0xFD, 0x28,
-0x00, 0x01, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x6B, 0x02, 0xCA,
-0x00, 0x03, 0x00, 0x00, 0x13, 0x01, 0x23, 0x01, 0x60, 0x01,
-0x0B, 0x57, 0xFE, 0xF6, 0x02, 0xCA, 0xFD, 0x36, 0x02, 0xCA,
-0x00, 0x01, 0x00, 0x19, 0xFF, 0x62, 0x00, 0xF9, 0x02, 0xCA,
-0x00, 0x07, 0x00, 0x00, 0x17, 0x33, 0x11, 0x23, 0x35, 0x33,
-0x11, 0x23, 0x19, 0x8A, 0x8A, 0xE0, 0xE0, 0x56, 0x02, 0xD8,
-0x48, 0xFC, 0x98, 0x00, 0x01, 0x00, 0x26, 0x01, 0x0B, 0x02,
-0x16, 0x02, 0xCF, 0x00, 0x06, 0x00, 0x00, 0x13, 0x13, 0x33,
-0x13, 0x23, 0x03, 0x03, 0x26, 0xD4, 0x32, 0xEA, 0x4E, 0xB4,
-0xA0, 0x01, 0x0B, 0x01, 0xC4, 0xFE, 0x3C, 0x01, 0x67, 0xFE,
-0x99, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0x66, 0x01, 0xBE, 0xFF,
-0xA6, 0x00, 0x03, 0x00, 0x00, 0x05, 0x21, 0x35, 0x21, 0x01,
-0xBE, 0xFE, 0x40, 0x01, 0xC0, 0x9A, 0x40, 0x00, 0x01, 0x00,
-0x28, 0x02, 0x5E, 0x00, 0xF1, 0x02, 0xFE, 0x00, 0x0B, 0x00,
-0x00, 0x13, 0x1E, 0x02, 0x17, 0x15, 0x23, 0x2E, 0x02, 0x27,
-0x35, 0x91, 0x0B, 0x21, 0x25, 0x0F, 0x3B, 0x17, 0x3A, 0x31,
-0x0C, 0x02, 0xFE, 0x16, 0x37, 0x34, 0x13, 0x0C, 0x12, 0x39,
-0x39, 0x12, 0x0A, 0x00, 0x02, 0x00, 0x2E, 0xFF, 0xF6, 0x01,
-0xE0, 0x02, 0x21, 0x00, 0x1B, 0x00, 0x26, 0x00, 0x00, 0x01,
-0x32, 0x16, 0x15, 0x11, 0x23, 0x27, 0x23, 0x06, 0x06, 0x23,
-0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x37, 0x35, 0x34, 0x26,
-0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x13, 0x06, 0x06,
-0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x35, 0x01, 0x20,
-0x62, 0x5E, 0x40, 0x11, 0x04, 0x23, 0x4D, 0x44, 0x49, 0x60,
-0x7E, 0x83, 0x5B, 0x3A, 0x35, 0x2A, 0x4C, 0x21, 0x1B, 0x23,
-0x60, 0x4E, 0x64, 0x4D, 0x37, 0x2B, 0x44, 0x5A, 0x02, 0x21,
-0x56, 0x5E, 0xFE, 0x93, 0x4C, 0x2C, 0x2A, 0x4D, 0x52, 0x50,
-0x57, 0x04, 0x03, 0x20, 0x43, 0x34, 0x19, 0x10, 0x42, 0x13,
-0x1B, 0xFE, 0xE2, 0x04, 0x38, 0x33, 0x2D, 0x2A, 0x4B, 0x4E,
-0x30, 0x00, 0x02, 0x00, 0x55, 0xFF, 0xF6, 0x02, 0x30, 0x02,
-0xF8, 0x00, 0x15, 0x00, 0x21, 0x00, 0x00, 0x13, 0x14, 0x06,
-0x07, 0x33, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
-0x23, 0x22, 0x26, 0x27, 0x23, 0x07, 0x23, 0x11, 0x33, 0x13,
-0x22, 0x06, 0x15, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35,
-0x34, 0xAD, 0x03, 0x02, 0x05, 0x17, 0x50, 0x3F, 0x64, 0x79,
-0x7A, 0x63, 0x3F, 0x50, 0x17, 0x07, 0x12, 0x3F, 0x58, 0x97,
-0x55, 0x42, 0x41, 0x58, 0x48, 0x47, 0x02, 0x3F, 0x22, 0x3B,
-0x11, 0x22, 0x2E, 0x8B, 0x8A, 0x8A, 0x8C, 0x2E, 0x20, 0x44,
-0x02, 0xF8, 0xFE, 0xE0, 0x62, 0x67, 0x04, 0x63, 0x69, 0x6A,
-0x64, 0xCB, 0x00, 0x01, 0x00, 0x37, 0xFF, 0xF6, 0x01, 0xBF,
-0x02, 0x22, 0x00, 0x1A, 0x00, 0x00, 0x05, 0x22, 0x26, 0x26,
-0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26,
-0x26, 0x23, 0x22, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37,
-0x15, 0x06, 0x06, 0x01, 0x2C, 0x47, 0x6F, 0x3F, 0x42, 0x71,
-0x48, 0x29, 0x4C, 0x18, 0x1B, 0x18, 0x40, 0x1C, 0x9E, 0x4D,
-0x4C, 0x2C, 0x43, 0x1C, 0x1B, 0x41, 0x0A, 0x3A, 0x7A, 0x5F,
-0x63, 0x7C, 0x3A, 0x11, 0x0C, 0x49, 0x09, 0x10, 0xCB, 0x61,
-0x67, 0x12, 0x0D, 0x4E, 0x0E, 0x0F, 0x00, 0x02, 0x00, 0x37,
-0xFF, 0xF6, 0x02, 0x12, 0x02, 0xF8, 0x00, 0x15, 0x00, 0x22,
-0x00, 0x00, 0x05, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
-0x16, 0x17, 0x33, 0x26, 0x26, 0x35, 0x35, 0x33, 0x11, 0x23,
-0x27, 0x23, 0x06, 0x06, 0x27, 0x32, 0x36, 0x35, 0x35, 0x34,
-0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x01, 0x13, 0x64,
-0x78, 0x79, 0x64, 0x3E, 0x4F, 0x19, 0x06, 0x01, 0x05, 0x58,
-0x47, 0x0D, 0x04, 0x18, 0x50, 0x31, 0x55, 0x45, 0x42, 0x59,
-0x47, 0x47, 0x47, 0x0A, 0x8B, 0x8A, 0x8A, 0x8D, 0x2E, 0x21,
-0x0D, 0x33, 0x0F, 0xD6, 0xFD, 0x08, 0x48, 0x22, 0x30, 0x49,
-0x5D, 0x5E, 0x10, 0x64, 0x6B, 0x71, 0x5F, 0x60, 0x6A, 0x00,
-0x02, 0x00, 0x37, 0xFF, 0xF6, 0x02, 0x01, 0x02, 0x22, 0x00,
-0x17, 0x00, 0x1E, 0x00, 0x00, 0x01, 0x32, 0x16, 0x16, 0x15,
-0x15, 0x21, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06,
-0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x17,
-0x22, 0x06, 0x07, 0x21, 0x26, 0x26, 0x01, 0x24, 0x45, 0x63,
-0x35, 0xFE, 0x91, 0x02, 0x59, 0x50, 0x33, 0x4F, 0x2A, 0x29,
-0x50, 0x37, 0x4C, 0x75, 0x41, 0x3B, 0x6B, 0x46, 0x3F, 0x49,
-0x07, 0x01, 0x11, 0x01, 0x3E, 0x02, 0x22, 0x3C, 0x6D, 0x49,
-0x35, 0x5B, 0x5F, 0x13, 0x12, 0x4D, 0x12, 0x11, 0x3E, 0x7B,
-0x59, 0x58, 0x7E, 0x44, 0x48, 0x51, 0x48, 0x44, 0x55, 0x00,
-0x01, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x83, 0x02, 0xFD, 0x00,
-0x17, 0x00, 0x00, 0x01, 0x23, 0x11, 0x23, 0x11, 0x23, 0x35,
-0x37, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26,
-0x26, 0x23, 0x22, 0x06, 0x15, 0x15, 0x33, 0x01, 0x4C, 0x87,
-0x58, 0x5E, 0x5E, 0x5C, 0x52, 0x20, 0x35, 0x13, 0x17, 0x10,
-0x2A, 0x16, 0x2C, 0x2B, 0x87, 0x01, 0xD4, 0xFE, 0x2C, 0x01,
-0xD4, 0x29, 0x1E, 0x1F, 0x68, 0x5B, 0x0B, 0x07, 0x45, 0x05,
-0x0A, 0x3B, 0x3F, 0x23, 0x00, 0x02, 0x00, 0x37, 0xFF, 0x10,
-0x02, 0x12, 0x02, 0x22, 0x00, 0x1E, 0x00, 0x2B, 0x00, 0x00,
-0x01, 0x32, 0x16, 0x17, 0x33, 0x37, 0x33, 0x11, 0x14, 0x06,
-0x23, 0x22, 0x27, 0x35, 0x16, 0x33, 0x32, 0x36, 0x35, 0x35,
-0x34, 0x36, 0x37, 0x23, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34,
-0x36, 0x17, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36,
-0x35, 0x35, 0x34, 0x26, 0x01, 0x13, 0x35, 0x55, 0x1E, 0x05,
-0x0C, 0x46, 0x75, 0x7B, 0x76, 0x4B, 0x4F, 0x77, 0x45, 0x4F,
-0x02, 0x01, 0x04, 0x36, 0x70, 0x68, 0x75, 0x75, 0x73, 0x43,
-0x4A, 0x49, 0x46, 0x51, 0x4A, 0x4C, 0x02, 0x22, 0x28, 0x29,
-0x47, 0xFD, 0xDF, 0x73, 0x74, 0x22, 0x51, 0x2A, 0x51, 0x46,
-0x15, 0x0C, 0x2D, 0x09, 0x51, 0x92, 0x83, 0x80, 0x97, 0x4A,
-0x6B, 0x63, 0x63, 0x69, 0x57, 0x61, 0x15, 0x6E, 0x5F, 0x00,
-0x01, 0x00, 0x55, 0x00, 0x00, 0x02, 0x19, 0x02, 0xF8, 0x00,
-0x15, 0x00, 0x00, 0x13, 0x14, 0x07, 0x33, 0x36, 0x36, 0x33,
-0x32, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x23, 0x22, 0x06,
-0x15, 0x11, 0x23, 0x11, 0x33, 0xAD, 0x05, 0x06, 0x1A, 0x59,
-0x34, 0x62, 0x62, 0x57, 0x78, 0x5A, 0x43, 0x58, 0x58, 0x02,
-0x19, 0x28, 0x23, 0x29, 0x2A, 0x5D, 0x67, 0xFE, 0xA3, 0x01,
-0x57, 0x81, 0x65, 0x5E, 0xFE, 0xEB, 0x02, 0xF8, 0x00, 0x02,
-0x00, 0x4E, 0x00, 0x00, 0x00, 0xB5, 0x02, 0xE1, 0x00, 0x0B,
-0x00, 0x0F, 0x00, 0x00, 0x13, 0x32, 0x16, 0x15, 0x14, 0x06,
-0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x17, 0x11, 0x23, 0x11,
-0x82, 0x14, 0x1F, 0x1F, 0x14, 0x16, 0x1E, 0x1E, 0x41, 0x58,
-0x02, 0xE1, 0x1B, 0x1D, 0x1C, 0x1C, 0x1C, 0x1C, 0x1D, 0x1B,
-0xC9, 0xFD, 0xE8, 0x02, 0x18, 0x00, 0x02, 0xFF, 0xC9, 0xFF,
-0x10, 0x00, 0xB5, 0x02, 0xE1, 0x00, 0x0B, 0x00, 0x1B, 0x00,
-0x00, 0x13, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
-0x23, 0x22, 0x26, 0x03, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16,
-0x33, 0x32, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x06, 0x4E,
-0x1E, 0x16, 0x14, 0x1F, 0x1F, 0x14, 0x16, 0x1E, 0x38, 0x19,
-0x26, 0x0E, 0x0F, 0x20, 0x13, 0x20, 0x2A, 0x58, 0x48, 0x02,
-0xA9, 0x1D, 0x1B, 0x1B, 0x1D, 0x1C, 0x1C, 0x1C, 0xFC, 0x83,
-0x07, 0x05, 0x47, 0x04, 0x06, 0x23, 0x31, 0x02, 0x6B, 0xFD,
-0x98, 0x4B, 0x55, 0x00, 0x01, 0x00, 0x55, 0x00, 0x00, 0x02,
-0x0D, 0x02, 0xF8, 0x00, 0x13, 0x00, 0x00, 0x13, 0x14, 0x06,
-0x07, 0x33, 0x3E, 0x02, 0x37, 0x37, 0x33, 0x07, 0x13, 0x23,
-0x27, 0x07, 0x15, 0x23, 0x11, 0x33, 0xAC, 0x03, 0x01, 0x04,
-0x06, 0x18, 0x19, 0x09, 0xAB, 0x67, 0xD9, 0xE8, 0x6A, 0xBA,
-0x3D, 0x57, 0x57, 0x01, 0x6B, 0x10, 0x34, 0x13, 0x08, 0x1E,
-0x1F, 0x0A, 0xB5, 0xE5, 0xFE, 0xCD, 0xFA, 0x35, 0xC5, 0x02,
-0xF8, 0x00, 0x01, 0x00, 0x55, 0x00, 0x00, 0x00, 0xAD, 0x02,
-0xF8, 0x00, 0x03, 0x00, 0x00, 0x33, 0x23, 0x11, 0x33, 0xAD,
-0x58, 0x58, 0x02, 0xF8, 0x00, 0x01, 0x00, 0x55, 0x00, 0x00,
-0x03, 0x56, 0x02, 0x22, 0x00, 0x21, 0x00, 0x00, 0x01, 0x32,
-0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x23, 0x22, 0x06, 0x15,
-0x11, 0x23, 0x11, 0x34, 0x23, 0x22, 0x06, 0x15, 0x11, 0x23,
-0x11, 0x33, 0x17, 0x33, 0x36, 0x36, 0x33, 0x32, 0x17, 0x33,
-0x36, 0x36, 0x02, 0xA1, 0x5B, 0x5A, 0x57, 0x6D, 0x4E, 0x43,
-0x57, 0x6E, 0x51, 0x3E, 0x58, 0x47, 0x0D, 0x05, 0x19, 0x55,
-0x30, 0x7E, 0x26, 0x05, 0x1B, 0x5D, 0x02, 0x22, 0x5D, 0x68,
-0xFE, 0xA3, 0x01, 0x59, 0x7F, 0x5A, 0x56, 0xFE, 0xD8, 0x01,
-0x59, 0x7F, 0x64, 0x5E, 0xFE, 0xEA, 0x02, 0x18, 0x49, 0x2A,
-0x29, 0x5A, 0x2E, 0x2C, 0x00, 0x01, 0x00, 0x55, 0x00, 0x00,
-0x02, 0x19, 0x02, 0x22, 0x00, 0x13, 0x00, 0x00, 0x01, 0x32,
-0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x23, 0x22, 0x06, 0x15,
-0x11, 0x23, 0x11, 0x33, 0x17, 0x33, 0x36, 0x36, 0x01, 0x57,
-0x60, 0x62, 0x57, 0x78, 0x59, 0x44, 0x58, 0x47, 0x0D, 0x05,
-0x1A, 0x5C, 0x02, 0x22, 0x5D, 0x68, 0xFE, 0xA3, 0x01, 0x57,
-0x81, 0x64, 0x5E, 0xFE, 0xEA, 0x02, 0x18, 0x49, 0x2A, 0x29,
-0x00, 0x02, 0x00, 0x37, 0xFF, 0xF6, 0x02, 0x27, 0x02, 0x22,
-0x00, 0x0D, 0x00, 0x19, 0x00, 0x00, 0x01, 0x14, 0x06, 0x23,
-0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x16,
-0x05, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-0x22, 0x06, 0x02, 0x27, 0x87, 0x73, 0x47, 0x6F, 0x40, 0x86,
-0x73, 0x49, 0x6F, 0x3F, 0xFE, 0x6B, 0x4B, 0x52, 0x51, 0x4C,
-0x4C, 0x52, 0x52, 0x4A, 0x01, 0x0D, 0x85, 0x92, 0x41, 0x7D,
-0x59, 0x85, 0x90, 0x41, 0x7B, 0x59, 0x5F, 0x6F, 0x6F, 0x5F,
-0x5F, 0x6C, 0x6C, 0x00, 0x02, 0x00, 0x55, 0xFF, 0x10, 0x02,
-0x30, 0x02, 0x22, 0x00, 0x15, 0x00, 0x23, 0x00, 0x00, 0x01,
-0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x23,
-0x16, 0x16, 0x15, 0x15, 0x23, 0x11, 0x33, 0x17, 0x33, 0x36,
-0x36, 0x17, 0x22, 0x06, 0x07, 0x15, 0x14, 0x16, 0x33, 0x32,
-0x36, 0x36, 0x35, 0x34, 0x26, 0x01, 0x54, 0x63, 0x79, 0x79,
-0x64, 0x3E, 0x51, 0x17, 0x06, 0x02, 0x04, 0x58, 0x48, 0x0C,
-0x04, 0x18, 0x4E, 0x31, 0x52, 0x43, 0x02, 0x41, 0x58, 0x31,
-0x3F, 0x1F, 0x47, 0x02, 0x22, 0x8A, 0x8B, 0x89, 0x8E, 0x2F,
-0x1F, 0x11, 0x34, 0x13, 0xDC, 0x03, 0x08, 0x49, 0x23, 0x30,
-0x4A, 0x5C, 0x5E, 0x11, 0x63, 0x6B, 0x36, 0x5D, 0x3C, 0x5C,
-0x6E, 0x00, 0x02, 0x00, 0x37, 0xFF, 0x10, 0x02, 0x12, 0x02,
-0x22, 0x00, 0x15, 0x00, 0x22, 0x00, 0x00, 0x05, 0x34, 0x36,
-0x37, 0x23, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36,
-0x33, 0x32, 0x16, 0x17, 0x33, 0x37, 0x33, 0x11, 0x23, 0x03,
-0x32, 0x36, 0x37, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
-0x14, 0x16, 0x01, 0xBA, 0x02, 0x03, 0x06, 0x17, 0x51, 0x40,
-0x61, 0x79, 0x7B, 0x62, 0x3F, 0x50, 0x18, 0x04, 0x0D, 0x46,
-0x58, 0x98, 0x53, 0x45, 0x01, 0x44, 0x57, 0x48, 0x46, 0x47,
-0x0B, 0x12, 0x30, 0x11, 0x22, 0x30, 0x8B, 0x8A, 0x8A, 0x8D,
-0x30, 0x23, 0x49, 0xFC, 0xF8, 0x01, 0x2F, 0x5B, 0x5E, 0x12,
-0x66, 0x69, 0x71, 0x5F, 0x5F, 0x6B, 0x00, 0x01, 0x00, 0x55,
-0x00, 0x00, 0x01, 0x8E, 0x02, 0x22, 0x00, 0x13, 0x00, 0x00,
-0x01, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06,
-0x06, 0x15, 0x11, 0x23, 0x11, 0x33, 0x17, 0x33, 0x36, 0x36,
-0x01, 0x4F, 0x0F, 0x23, 0x0D, 0x0B, 0x0D, 0x1F, 0x0E, 0x29,
-0x48, 0x2B, 0x58, 0x48, 0x0A, 0x04, 0x1A, 0x52, 0x02, 0x22,
-0x03, 0x03, 0x51, 0x03, 0x04, 0x2D, 0x51, 0x36, 0xFE, 0xE2,
-0x02, 0x18, 0x62, 0x2C, 0x40, 0x00, 0x01, 0x00, 0x33, 0xFF,
-0xF6, 0x01, 0xB2, 0x02, 0x22, 0x00, 0x29, 0x00, 0x00, 0x25,
-0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33,
-0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x27, 0x2E, 0x02, 0x35,
-0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23,
-0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x17, 0x1E, 0x02, 0x01,
-0xB2, 0x74, 0x62, 0x38, 0x51, 0x1F, 0x20, 0x5B, 0x2F, 0x43,
-0x3C, 0x16, 0x39, 0x35, 0x34, 0x4A, 0x28, 0x6F, 0x5A, 0x31,
-0x55, 0x25, 0x1E, 0x22, 0x4A, 0x27, 0x36, 0x39, 0x1A, 0x3D,
-0x33, 0x33, 0x48, 0x26, 0x94, 0x4E, 0x50, 0x12, 0x10, 0x50,
-0x10, 0x1B, 0x2B, 0x24, 0x14, 0x20, 0x20, 0x14, 0x14, 0x28,
-0x38, 0x2C, 0x44, 0x4A, 0x13, 0x11, 0x46, 0x0E, 0x14, 0x23,
-0x1E, 0x16, 0x1F, 0x1D, 0x14, 0x13, 0x28, 0x39, 0x00, 0x01,
-0x00, 0x10, 0xFF, 0xF6, 0x01, 0x53, 0x02, 0x93, 0x00, 0x18,
-0x00, 0x00, 0x25, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23,
-0x22, 0x26, 0x26, 0x35, 0x11, 0x23, 0x35, 0x37, 0x37, 0x33,
-0x15, 0x33, 0x15, 0x23, 0x11, 0x14, 0x16, 0x01, 0x08, 0x14,
-0x2A, 0x0D, 0x0E, 0x34, 0x18, 0x2A, 0x47, 0x2C, 0x4C, 0x4D,
-0x23, 0x34, 0x9B, 0x9B, 0x2F, 0x3E, 0x07, 0x04, 0x43, 0x07,
-0x09, 0x1D, 0x48, 0x41, 0x01, 0x38, 0x2A, 0x23, 0x72, 0x7B,
-0x44, 0xFE, 0xCA, 0x31, 0x2F, 0x00, 0x01, 0x00, 0x4F, 0xFF,
-0xF6, 0x02, 0x15, 0x02, 0x18, 0x00, 0x13, 0x00, 0x00, 0x01,
-0x11, 0x23, 0x27, 0x23, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35,
-0x11, 0x33, 0x11, 0x14, 0x33, 0x32, 0x36, 0x35, 0x11, 0x02,
-0x15, 0x48, 0x0D, 0x04, 0x1A, 0x5C, 0x34, 0x61, 0x62, 0x59,
-0x77, 0x59, 0x45, 0x02, 0x18, 0xFD, 0xE8, 0x47, 0x2A, 0x27,
-0x5D, 0x66, 0x01, 0x5F, 0xFE, 0xA7, 0x80, 0x64, 0x5E, 0x01,
-0x17, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x02,
-0x18, 0x00, 0x0F, 0x00, 0x00, 0x33, 0x03, 0x33, 0x13, 0x1E,
-0x02, 0x17, 0x33, 0x3E, 0x02, 0x37, 0x13, 0x33, 0x03, 0xCB,
-0xCB, 0x5E, 0x72, 0x08, 0x12, 0x0E, 0x03, 0x04, 0x04, 0x0F,
-0x13, 0x07, 0x72, 0x5E, 0xCC, 0x02, 0x18, 0xFE, 0xC4, 0x16,
-0x36, 0x31, 0x11, 0x11, 0x32, 0x36, 0x15, 0x01, 0x3C, 0xFD,
-0xE8, 0x00, 0x01, 0x00, 0x0B, 0x00, 0x01, 0x03, 0x07, 0x02,
-0x19, 0x00, 0x22, 0x00, 0x00, 0x01, 0x26, 0x26, 0x27, 0x23,
-0x06, 0x06, 0x07, 0x03, 0x23, 0x03, 0x33, 0x13, 0x16, 0x16,
-0x17, 0x33, 0x3E, 0x02, 0x37, 0x13, 0x33, 0x13, 0x16, 0x16,
-0x17, 0x33, 0x36, 0x36, 0x37, 0x13, 0x33, 0x03, 0x23, 0x01,
-0xAF, 0x0D, 0x13, 0x05, 0x04, 0x04, 0x12, 0x0E, 0x60, 0x64,
-0x93, 0x5B, 0x4A, 0x0B, 0x14, 0x04, 0x04, 0x04, 0x0B, 0x0E,
-0x07, 0x5F, 0x60, 0x5C, 0x0B, 0x15, 0x04, 0x04, 0x03, 0x15,
-0x0C, 0x4B, 0x5A, 0x95, 0x67, 0x01, 0x2F, 0x29, 0x4F, 0x16,
-0x16, 0x4F, 0x2A, 0xFE, 0xD3, 0x02, 0x18, 0xFE, 0xE2, 0x2B,
-0x58, 0x1D, 0x11, 0x32, 0x37, 0x16, 0x01, 0x2E, 0xFE, 0xD2,
-0x22, 0x50, 0x1D, 0x19, 0x58, 0x2E, 0x01, 0x1E, 0xFD, 0xE8,
-0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x18,
-0x00, 0x0B, 0x00, 0x00, 0x13, 0x03, 0x33, 0x17, 0x37, 0x33,
-0x03, 0x13, 0x23, 0x27, 0x07, 0x23, 0xD4, 0xB9, 0x64, 0x8A,
-0x89, 0x63, 0xB9, 0xC3, 0x64, 0x92, 0x94, 0x63, 0x01, 0x12,
-0x01, 0x06, 0xCA, 0xCA, 0xFE, 0xFA, 0xFE, 0xEE, 0xD6, 0xD6,
-0x00, 0x01, 0x00, 0x01, 0xFF, 0x10, 0x01, 0xFE, 0x02, 0x18,
-0x00, 0x1A, 0x00, 0x00, 0x13, 0x33, 0x13, 0x16, 0x16, 0x17,
-0x33, 0x36, 0x36, 0x37, 0x13, 0x33, 0x03, 0x06, 0x06, 0x23,
-0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37,
-0x37, 0x01, 0x5E, 0x74, 0x0F, 0x18, 0x06, 0x04, 0x06, 0x1A,
-0x0E, 0x6D, 0x5F, 0xE7, 0x1C, 0x59, 0x4E, 0x18, 0x24, 0x0D,
-0x0B, 0x1F, 0x11, 0x2E, 0x39, 0x10, 0x1C, 0x02, 0x18, 0xFE,
-0xCF, 0x28, 0x49, 0x21, 0x19, 0x51, 0x29, 0x01, 0x30, 0xFD,
-0x9E, 0x4C, 0x5A, 0x05, 0x03, 0x46, 0x02, 0x04, 0x34, 0x2B,
-0x47, 0x00, 0x01, 0x00, 0x27, 0x00, 0x00, 0x01, 0xAF, 0x02,
-0x18, 0x00, 0x09, 0x00, 0x00, 0x21, 0x21, 0x35, 0x01, 0x21,
-0x35, 0x21, 0x15, 0x01, 0x21, 0x01, 0xAF, 0xFE, 0x78, 0x01,
-0x20, 0xFE, 0xF1, 0x01, 0x70, 0xFE, 0xE4, 0x01, 0x23, 0x3A,
-0x01, 0x9A, 0x44, 0x42, 0xFE, 0x6E, 0x00, 0x01, 0x00, 0x1C,
-0xFF, 0x62, 0x01, 0x5C, 0x02, 0xCA, 0x00, 0x1D, 0x00, 0x00,
-0x05, 0x26, 0x26, 0x35, 0x35, 0x34, 0x26, 0x23, 0x35, 0x36,
-0x36, 0x35, 0x35, 0x34, 0x36, 0x33, 0x15, 0x06, 0x06, 0x15,
-0x15, 0x14, 0x07, 0x15, 0x16, 0x15, 0x15, 0x14, 0x16, 0x17,
-0x01, 0x5C, 0x5C, 0x6A, 0x3F, 0x3B, 0x3B, 0x3F, 0x6E, 0x58,
-0x34, 0x3B, 0x6D, 0x6D, 0x3A, 0x35, 0x9E, 0x01, 0x4E, 0x50,
-0x93, 0x33, 0x2B, 0x49, 0x01, 0x2A, 0x32, 0x94, 0x50, 0x4E,
-0x48, 0x01, 0x2C, 0x31, 0x90, 0x67, 0x13, 0x06, 0x13, 0x67,
-0x93, 0x31, 0x2B, 0x01, 0x00, 0x01, 0x00, 0xEF, 0xFF, 0x0F,
-0x01, 0x38, 0x02, 0xF8, 0x00, 0x03, 0x00, 0x00, 0x13, 0x33,
-0x11, 0x23, 0xEF, 0x49, 0x49, 0x02, 0xF8, 0xFC, 0x17, 0x00,
-0x01, 0x00, 0x20, 0xFF, 0x62, 0x01, 0x60, 0x02, 0xCA, 0x00,
-0x1D, 0x00, 0x00, 0x17, 0x36, 0x36, 0x35, 0x35, 0x34, 0x37,
-0x35, 0x26, 0x35, 0x35, 0x34, 0x26, 0x27, 0x35, 0x16, 0x16,
-0x15, 0x15, 0x14, 0x16, 0x33, 0x15, 0x06, 0x06, 0x15, 0x15,
-0x14, 0x06, 0x23, 0x20, 0x34, 0x3B, 0x6D, 0x6D, 0x3A, 0x35,
-0x5C, 0x6A, 0x3F, 0x3B, 0x3B, 0x3F, 0x6E, 0x58, 0x56, 0x02,
-0x2B, 0x31, 0x91, 0x67, 0x13, 0x06, 0x13, 0x67, 0x92, 0x31,
-0x2B, 0x01, 0x48, 0x01, 0x4E, 0x50, 0x92, 0x33, 0x2B, 0x49,
-0x01, 0x2A, 0x32, 0x95, 0x4F, 0x4F, 0x00, 0x01, 0x00, 0x32,
-0x01, 0x1F, 0x02, 0x09, 0x01, 0xA2, 0x00, 0x17, 0x00, 0x00,
-0x01, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x33,
-0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15,
-0x06, 0x23, 0x22, 0x26, 0x01, 0x0D, 0x24, 0x2F, 0x16, 0x1C,
-0x3E, 0x18, 0x30, 0x48, 0x1D, 0x39, 0x2E, 0x24, 0x2F, 0x15,
-0x1D, 0x3E, 0x18, 0x31, 0x47, 0x1C, 0x3B, 0x01, 0x3F, 0x10,
-0x0B, 0x22, 0x19, 0x4E, 0x35, 0x0C, 0x14, 0x10, 0x0B, 0x22,
-0x19, 0x4D, 0x36, 0x0D, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-0x02, 0x7E, 0x03, 0xB0, 0x00, 0xA2, 0x00, 0x21, 0x00, 0x00,
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x83,
-0x00, 0x40, 0x00, 0x94, 0x00, 0xB2, 0x40, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x28, 0x02, 0x5E,
-0x00, 0xF1, 0x02, 0xFE, 0x00, 0x0B, 0x00, 0x00, 0x13, 0x0E,
-0x02, 0x07, 0x23, 0x35, 0x3E, 0x02, 0x37, 0x33, 0xF1, 0x0C,
-0x32, 0x39, 0x18, 0x3A, 0x0F, 0x23, 0x22, 0x0B, 0x6A, 0x02,
-0xF4, 0x12, 0x39, 0x39, 0x12, 0x0C, 0x13, 0x34, 0x37, 0x16,
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7E, 0x03, 0xB0,
-0x00, 0xA2, 0x00, 0x21, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x83, 0x00, 0x60, 0x00, 0xE1,
-0x00, 0xB2, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x01, 0x00, 0x28, 0x02, 0x5E, 0x01, 0x7A, 0x02, 0xFE,
-0x00, 0x12, 0x00, 0x00, 0x13, 0x1E, 0x02, 0x17, 0x15, 0x23,
-0x26, 0x26, 0x27, 0x06, 0x06, 0x07, 0x23, 0x35, 0x3E, 0x02,
-0x37, 0xFD, 0x0C, 0x2D, 0x31, 0x13, 0x3E, 0x1A, 0x38, 0x1B,
-0x1B, 0x36, 0x1A, 0x3C, 0x13, 0x2F, 0x2C, 0x0D, 0x02, 0xFE,
-0x16, 0x37, 0x35, 0x13, 0x0B, 0x10, 0x2F, 0x1B, 0x1B, 0x2E,
-0x11, 0x0B, 0x14, 0x34, 0x37, 0x16, 0xFF, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0x02, 0x7E, 0x03, 0xB0, 0x00, 0xA2, 0x00, 0x21,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x62, 0x00, 0x6D, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x28,
-0x02, 0x5E, 0x01, 0x97, 0x02, 0xDF, 0x00, 0x15, 0x00, 0x00,
-0x13, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x33, 0x32, 0x36,
-0x37, 0x33, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x23, 0x22,
-0x06, 0x07, 0x28, 0x06, 0x39, 0x2F, 0x1E, 0x35, 0x30, 0x15,
-0x17, 0x19, 0x07, 0x32, 0x06, 0x38, 0x2F, 0x1C, 0x35, 0x31,
-0x16, 0x18, 0x18, 0x07, 0x02, 0x5E, 0x3B, 0x45, 0x1D, 0x1C,
-0x1D, 0x1D, 0x3A, 0x46, 0x1C, 0x1D, 0x1D, 0x1D, 0xFF, 0xFF,
-0x00, 0x00, 0x00, 0x00, 0x02, 0x7E, 0x03, 0x91, 0x00, 0xA2,
-0x00, 0x21, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x40, 0x00, 0x00, 0x83, 0x00, 0x64, 0x00, 0x5F, 0x00, 0xB2,
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02,
-0x00, 0x95, 0x02, 0x77, 0x01, 0xAE, 0x02, 0xDA, 0x00, 0x0B,
-0x00, 0x17, 0x00, 0x00, 0x13, 0x34, 0x36, 0x33, 0x32, 0x16,
-0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x37, 0x34, 0x36, 0x33,
-0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x95, 0x1C,
-0x13, 0x13, 0x1C, 0x1C, 0x13, 0x13, 0x1C, 0xBC, 0x1B, 0x13,
-0x13, 0x1C, 0x1C, 0x13, 0x13, 0x1B, 0x02, 0xA9, 0x1A, 0x17,
-0x17, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x17, 0x17, 0x1A,
-0x19, 0x19, 0x19, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02,
-0x7E, 0x03, 0x8C, 0x00, 0xA2, 0x00, 0x21, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x83, 0x00,
-0x66, 0x00, 0x1D, 0x00, 0xB2, 0x40, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x40, 0x00, 0x00, 0x02, 0x00, 0x28, 0x02, 0x5E, 0x01,
-0x04, 0x03, 0x31, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x00, 0x13,
-0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
-0x06, 0x27, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-0x15, 0x14, 0x16, 0x95, 0x31, 0x3C, 0x3C, 0x31, 0x2F, 0x40,
-0x3F, 0x30, 0x19, 0x1F, 0x20, 0x18, 0x18, 0x20, 0x1D, 0x02,
-0x5E, 0x38, 0x32, 0x32, 0x37, 0x37, 0x31, 0x33, 0x38, 0x32,
-0x1E, 0x1A, 0x1A, 0x1E, 0x1E, 0x1A, 0x1A, 0x1E, 0xFF, 0xFF,
-0x00, 0x00, 0x00, 0x00, 0x02, 0x7E, 0x03, 0x6E, 0x00, 0xA2,
-0x00, 0x21, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x40, 0x00, 0x00, 0x83, 0x00, 0x68, 0x00, 0xA8, 0x00, 0x3D,
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02,
-0xFF, 0xFF, 0x00, 0x00, 0x03, 0x35, 0x02, 0xCA, 0x00, 0x0F,
-0x00, 0x13, 0x00, 0x00, 0x21, 0x21, 0x35, 0x23, 0x07, 0x23,
-0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21,
-0x25, 0x33, 0x11, 0x23, 0x03, 0x35, 0xFE, 0x8C, 0xFA, 0x6B,
-0x5D, 0x01, 0x53, 0x01, 0xE3, 0xFE, 0xE6, 0x01, 0x07, 0xFE,
-0xF9, 0x01, 0x1A, 0xFD, 0xB5, 0xD7, 0x3A, 0xDD, 0xDD, 0x02,
-0xCA, 0x4F, 0xDF, 0x4E, 0xFF, 0xDE, 0x01, 0x4D, 0x00, 0x01,
-0x00, 0x0E, 0xFF, 0x10, 0x00, 0xD4, 0x00, 0x00, 0x00, 0x14,
-0x00, 0x00, 0x17, 0x14, 0x06, 0x23, 0x22, 0x27, 0x35, 0x16,
-0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x27, 0x37, 0x33,
-0x07, 0x16, 0x16, 0xD4, 0x4A, 0x4A, 0x20, 0x12, 0x09, 0x1E,
-0x0E, 0x24, 0x26, 0x35, 0x26, 0x2B, 0x3A, 0x1A, 0x24, 0x33,
-0x8B, 0x30, 0x35, 0x05, 0x37, 0x02, 0x03, 0x13, 0x19, 0x1A,
-0x18, 0x05, 0x56, 0x35, 0x08, 0x28, 0xFF, 0xFF, 0x00, 0x3D,
-0xFF, 0x10, 0x02, 0x59, 0x02, 0xD4, 0x00, 0xA2, 0x00, 0x23,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x6B, 0x01, 0x05, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x61,
-0x00, 0x00, 0x01, 0xF0, 0x03, 0xB0, 0x00, 0xA2, 0x00, 0x25,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x40, 0x00, 0x87, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x61,
-0x00, 0x00, 0x01, 0xF0, 0x03, 0xB0, 0x00, 0xA2, 0x00, 0x25,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x60, 0x00, 0xD4, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x61,
-0x00, 0x00, 0x01, 0xF0, 0x03, 0xB0, 0x00, 0xA2, 0x00, 0x25,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x62, 0x00, 0x60, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x61,
-0x00, 0x00, 0x01, 0xF0, 0x03, 0x8C, 0x00, 0xA2, 0x00, 0x25,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x66, 0x00, 0x10, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x28,
-0x00, 0x00, 0x01, 0x2A, 0x03, 0xB0, 0x00, 0xA2, 0x00, 0x29,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x40, 0x00, 0x00, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x28,
-0x00, 0x00, 0x01, 0x3E, 0x03, 0xB0, 0x00, 0xA2, 0x00, 0x29,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x60, 0x00, 0x4D, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x01,
-0x00, 0x00, 0x01, 0x53, 0x03, 0xB0, 0x00, 0xA2, 0x00, 0x29,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x62, 0xFF, 0xD9, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x1E,
-0x00, 0x00, 0x01, 0x37, 0x03, 0x8C, 0x00, 0xA2, 0x00, 0x29,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x66, 0xFF, 0x89, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0x00, 0x1E,
-0x00, 0x00, 0x02, 0x9D, 0x02, 0xCA, 0x00, 0x0D, 0x00, 0x19,
-0x00, 0x00, 0x01, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23,
-0x23, 0x11, 0x23, 0x35, 0x33, 0x11, 0x17, 0x23, 0x15, 0x33,
-0x15, 0x23, 0x15, 0x33, 0x20, 0x11, 0x34, 0x26, 0x01, 0x3D,
-0x6B, 0x9E, 0x57, 0xC5, 0xB1, 0xBF, 0x4A, 0x4A, 0xC8, 0x6E,
-0xB2, 0xB2, 0x5A, 0x01, 0x22, 0x8E, 0x02, 0xCA, 0x50, 0x9B,
-0x73, 0xB5, 0xB7, 0x01, 0x3A, 0x4E, 0x01, 0x42, 0x4D, 0xF5,
-0x4E, 0xED, 0x01, 0x1C, 0x8F, 0x85, 0xFF, 0xFF, 0x00, 0x61,
-0x00, 0x00, 0x02, 0x97, 0x03, 0x91, 0x00, 0xA2, 0x00, 0x2E,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x64, 0x00, 0x9D, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x3D,
-0xFF, 0xF6, 0x02, 0xD0, 0x03, 0xB0, 0x00, 0xA2, 0x00, 0x2F,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x40, 0x00, 0xDD, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x3D,
-0xFF, 0xF6, 0x02, 0xD0, 0x03, 0xB0, 0x00, 0xA2, 0x00, 0x2F,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x60, 0x01, 0x2A, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x3D,
-0xFF, 0xF6, 0x02, 0xD0, 0x03, 0xB0, 0x00, 0xA2, 0x00, 0x2F,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x62, 0x00, 0xB6, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x3D,
-0xFF, 0xF6, 0x02, 0xD0, 0x03, 0x91, 0x00, 0xA2, 0x00, 0x2F,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x64, 0x00, 0xA8, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x3D,
-0xFF, 0xF6, 0x02, 0xD0, 0x03, 0x8C, 0x00, 0xA2, 0x00, 0x2F,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x83, 0x00, 0x66, 0x00, 0x66, 0x00, 0xB2, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x40,
-0x00, 0x84, 0x01, 0xFA, 0x02, 0x3E, 0x00, 0x0B, 0x00, 0x00,
-0x01, 0x17, 0x07, 0x17, 0x07, 0x27, 0x07, 0x27, 0x37, 0x27,
-0x37, 0x17, 0x01, 0xC8, 0x32, 0xAA, 0xA9, 0x32, 0xAB, 0xA7,
-0x34, 0xA9, 0xAA, 0x34, 0xA9, 0x02, 0x3E, 0x33, 0xAA, 0xAA,
-0x33, 0xA9, 0xA9, 0x33, 0xAA, 0xA9, 0x34, 0xAB, 0x00, 0x03,
-0x00, 0x3D, 0xFF, 0xE1, 0x02, 0xD0, 0x02, 0xEA, 0x00, 0x17,
-0x00, 0x20, 0x00, 0x29, 0x00, 0x00, 0x01, 0x14, 0x06, 0x06,
-0x23, 0x22, 0x27, 0x07, 0x27, 0x37, 0x26, 0x26, 0x35, 0x34,
-0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x37, 0x17, 0x07, 0x16,
-0x05, 0x14, 0x16, 0x17, 0x01, 0x26, 0x23, 0x22, 0x06, 0x05,
-0x34, 0x27, 0x01, 0x16, 0x16, 0x33, 0x32, 0x36, 0x02, 0xD0,
-0x4B, 0x92, 0x6C, 0x70, 0x49, 0x30, 0x3D, 0x34, 0x2C, 0x2C,
-0x48, 0x93, 0x70, 0x34, 0x59, 0x25, 0x2E, 0x3D, 0x33, 0x5E,
-0xFD, 0xCC, 0x17, 0x18, 0x01, 0x3F, 0x34, 0x4E, 0x79, 0x73,
-0x01, 0xD5, 0x33, 0xFE, 0xC0, 0x1A, 0x45, 0x2A, 0x7A, 0x70,
-0x01, 0x66, 0x6F, 0xA5, 0x5C, 0x2F, 0x44, 0x28, 0x4A, 0x31,
-0x8C, 0x57, 0x6E, 0xA4, 0x5C, 0x18, 0x15, 0x42, 0x29, 0x47,
-0x63, 0xB1, 0x3D, 0x64, 0x25, 0x01, 0xC3, 0x23, 0x99, 0x87,
-0x81, 0x49, 0xFE, 0x3A, 0x12, 0x14, 0x9B, 0xFF, 0xFF, 0x00,
-0x5A, 0xFF, 0xF6, 0x02, 0x80, 0x03, 0xB0, 0x00, 0xA2, 0x00,
-0x35, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x83, 0x00, 0x40, 0x00, 0xC4, 0x00, 0xB2, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00,
-0x5A, 0xFF, 0xF6, 0x02, 0x80, 0x03, 0xB0, 0x00, 0xA2, 0x00,
-0x35, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x83, 0x00, 0x60, 0x01, 0x11, 0x00, 0xB2, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00,
-0x5A, 0xFF, 0xF6, 0x02, 0x80, 0x03, 0xB0, 0x00, 0xA2, 0x00,
-0x35, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x83, 0x00, 0x62, 0x00, 0x9D, 0x00, 0xB2, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00,
-0x5A, 0xFF, 0xF6, 0x02, 0x80, 0x03, 0x8C, 0x00, 0xA2, 0x00,
-0x35, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x83, 0x00, 0x66, 0x00, 0x4D, 0x00, 0xB2, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x02, 0x36, 0x03, 0xB0, 0x00, 0xA2, 0x00,
-0x39, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x83, 0x00, 0x60, 0x00, 0xBE, 0x00, 0xB2, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0x00,
-0x61, 0x00, 0x00, 0x02, 0x2A, 0x02, 0xCA, 0x00, 0x0D, 0x00,
-0x16, 0x00, 0x00, 0x01, 0x14, 0x06, 0x06, 0x23, 0x23, 0x15,
-0x23, 0x11, 0x33, 0x15, 0x33, 0x32, 0x16, 0x05, 0x32, 0x36,
-0x35, 0x34, 0x26, 0x23, 0x23, 0x11, 0x02, 0x2A, 0x34, 0x7D,
-0x6D, 0x51, 0x5A, 0x5A, 0x60, 0x91, 0x7E, 0xFE, 0xD9, 0x69,
-0x61, 0x57, 0x62, 0x59, 0x01, 0x7E, 0x3C, 0x67, 0x40, 0x9B,
-0x02, 0xCA, 0x7C, 0x6E, 0xF9, 0x43, 0x4F, 0x45, 0x43, 0xFE,
-0xE6, 0x00, 0x01, 0x00, 0x55, 0xFF, 0xF6, 0x02, 0x4A, 0x02,
-0xFD, 0x00, 0x36, 0x00, 0x00, 0x01, 0x14, 0x0E, 0x03, 0x15,
-0x14, 0x16, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23,
-0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35,
-0x34, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x03, 0x35,
-0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11, 0x23, 0x11,
-0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x02, 0x0A, 0x1C, 0x2A,
-0x2A, 0x1C, 0x0D, 0x26, 0x25, 0x36, 0x3E, 0x67, 0x53, 0x2F,
-0x48, 0x1A, 0x1A, 0x4C, 0x28, 0x37, 0x30, 0x29, 0x35, 0x3F,
-0x2E, 0x1B, 0x29, 0x29, 0x1B, 0x47, 0x38, 0x23, 0x3D, 0x25,
-0x58, 0x3A, 0x64, 0x3F, 0x61, 0x77, 0x02, 0x69, 0x22, 0x33,
-0x27, 0x20, 0x1F, 0x12, 0x0D, 0x16, 0x1D, 0x19, 0x24, 0x4B,
-0x3B, 0x55, 0x4E, 0x12, 0x10, 0x4F, 0x10, 0x1A, 0x2E, 0x28,
-0x24, 0x32, 0x22, 0x29, 0x3B, 0x28, 0x1F, 0x2C, 0x21, 0x20,
-0x26, 0x1B, 0x2A, 0x26, 0x13, 0x2E, 0x2B, 0xFD, 0xB8, 0x02,
-0x48, 0x43, 0x4F, 0x23, 0x4A, 0xFF, 0xFF, 0x00, 0x2E, 0xFF,
-0xF6, 0x01, 0xE0, 0x02, 0xFE, 0x00, 0xA2, 0x00, 0x41, 0x00,
-0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-0x82, 0x00, 0x40, 0x6F, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x2E, 0xFF, 0xF6, 0x01,
-0xE0, 0x02, 0xFE, 0x00, 0xA2, 0x00, 0x41, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x83, 0x00,
-0x60, 0x00, 0xBC, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x2E, 0xFF, 0xF6, 0x01,
-0xE0, 0x02, 0xFE, 0x00, 0xA2, 0x00, 0x41, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x82, 0x00,
-0x62, 0x48, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x00, 0xFF, 0xFF, 0x00, 0x2E, 0xFF, 0xF6, 0x01, 0xE0, 0x02,
-0xDF, 0x00, 0xA2, 0x00, 0x41, 0x00, 0x00, 0x40, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x82, 0x00, 0x64, 0x3A,
-0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF,
-0xFF, 0x00, 0x2E, 0xFF, 0xF6, 0x01, 0xE0, 0x02, 0xDA, 0x00,
-0xA2, 0x00, 0x41, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x40, 0x00, 0x00, 0x82, 0x00, 0x66, 0xF8, 0x00, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00,
-0x2E, 0xFF, 0xF6, 0x01, 0xE0, 0x03, 0x31, 0x00, 0xA2, 0x00,
-0x41, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x83, 0x00, 0x68, 0x00, 0x83, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0x00,
-0x2E, 0xFF, 0xF6, 0x03, 0x2D, 0x02, 0x22, 0x00, 0x2C, 0x00,
-0x33, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x32, 0x16, 0x16, 0x15,
-0x15, 0x21, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06,
-0x06, 0x23, 0x22, 0x27, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35,
-0x34, 0x36, 0x37, 0x37, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x36, 0x36,
-0x17, 0x22, 0x06, 0x07, 0x33, 0x34, 0x26, 0x05, 0x06, 0x06,
-0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x35, 0x02, 0x5B,
-0x41, 0x5E, 0x33, 0xFE, 0xA9, 0x02, 0x4F, 0x4A, 0x32, 0x4C,
-0x26, 0x28, 0x4D, 0x32, 0x8D, 0x3E, 0x22, 0x5C, 0x4D, 0x49,
-0x61, 0x78, 0x7C, 0x5A, 0x3D, 0x33, 0x28, 0x4D, 0x21, 0x1B,
-0x23, 0x64, 0x31, 0x3E, 0x51, 0x15, 0x1A, 0x54, 0x35, 0x3A,
-0x43, 0x05, 0xF8, 0x39, 0xFE, 0x98, 0x5E, 0x48, 0x33, 0x2A,
-0x3F, 0x55, 0x02, 0x22, 0x3C, 0x6C, 0x48, 0x36, 0x60, 0x5B,
-0x13, 0x12, 0x4D, 0x12, 0x11, 0x71, 0x34, 0x3D, 0x4D, 0x52,
-0x50, 0x57, 0x04, 0x03, 0x22, 0x41, 0x34, 0x18, 0x11, 0x42,
-0x14, 0x1A, 0x29, 0x2D, 0x29, 0x2E, 0x48, 0x4F, 0x4A, 0x45,
-0x54, 0xD7, 0x04, 0x38, 0x33, 0x2D, 0x2A, 0x4B, 0x4E, 0x30,
-0xFF, 0xFF, 0x00, 0x37, 0xFF, 0x10, 0x01, 0xBF, 0x02, 0x22,
-0x00, 0xA2, 0x00, 0x43, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x83, 0x00, 0x6B, 0x00, 0xAA,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6, 0x02, 0x01, 0x02, 0xFE,
-0x00, 0xA2, 0x00, 0x45, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x82, 0x00, 0x40, 0x73, 0x00,
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF,
-0x00, 0x37, 0xFF, 0xF6, 0x02, 0x01, 0x02, 0xFE, 0x00, 0xA2,
-0x00, 0x45, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x40, 0x00, 0x00, 0x83, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x00,
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF,
-0x00, 0x37, 0xFF, 0xF6, 0x02, 0x01, 0x02, 0xFE, 0x00, 0xA2,
-0x00, 0x45, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x40, 0x00, 0x00, 0x82, 0x00, 0x62, 0x4C, 0x00, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x37,
-0xFF, 0xF6, 0x02, 0x01, 0x02, 0xDA, 0x00, 0xA2, 0x00, 0x45,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x82, 0x00, 0x66, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x55, 0x00, 0x00,
-0x00, 0xAD, 0x02, 0x18, 0x00, 0x03, 0x00, 0x00, 0x33, 0x23,
-0x11, 0x33, 0xAD, 0x58, 0x58, 0x02, 0x18, 0xFF, 0xFF, 0xFF,
-0xFF, 0x00, 0x00, 0x00, 0xC8, 0x02, 0xFE, 0x00, 0xA2, 0x00,
-0x91, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x82, 0x00, 0x40, 0xD7, 0x00, 0x40, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x4C, 0x00,
-0x00, 0x01, 0x15, 0x02, 0xFE, 0x00, 0xA2, 0x00, 0x91, 0x00,
-0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-0x82, 0x00, 0x60, 0x24, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x01,
-0x2A, 0x02, 0xFE, 0x00, 0xA2, 0x00, 0x91, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x82, 0x00,
-0x62, 0xB0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x00, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x01, 0x0E, 0x02,
-0xDA, 0x00, 0xA2, 0x00, 0x91, 0x00, 0x00, 0x40, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x83, 0x00, 0x66, 0xFF,
-0x60, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x02, 0x00, 0x37, 0xFF, 0xF6, 0x02, 0x27, 0x02,
-0xFD, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x00, 0x13, 0x16, 0x16,
-0x17, 0x37, 0x17, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23,
-0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17,
-0x37, 0x26, 0x26, 0x27, 0x07, 0x27, 0x37, 0x26, 0x26, 0x27,
-0x13, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35,
-0x34, 0x26, 0xD8, 0x20, 0x41, 0x1D, 0x73, 0x26, 0x63, 0x44,
-0x57, 0x86, 0x74, 0x48, 0x6F, 0x3F, 0x7F, 0x6C, 0x35, 0x4F,
-0x18, 0x04, 0x10, 0x42, 0x2A, 0x82, 0x26, 0x70, 0x15, 0x2E,
-0x17, 0x7B, 0x54, 0x4B, 0x4C, 0x53, 0x53, 0x4C, 0x4E, 0x02,
-0xFD, 0x0F, 0x24, 0x15, 0x43, 0x36, 0x39, 0x40, 0xBC, 0x7A,
-0x8E, 0x8F, 0x3B, 0x6D, 0x4B, 0x70, 0x80, 0x1C, 0x1E, 0x02,
-0x39, 0x60, 0x26, 0x4B, 0x37, 0x40, 0x0E, 0x1B, 0x0C, 0xFE,
-0xD1, 0x59, 0x53, 0x49, 0x5F, 0x61, 0x5C, 0x3E, 0x59, 0xFF,
-0xFF, 0x00, 0x55, 0x00, 0x00, 0x02, 0x19, 0x02, 0xDF, 0x00,
-0xA2, 0x00, 0x4E, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x40, 0x00, 0x00, 0x82, 0x00, 0x64, 0x56, 0x00, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00,
-0x37, 0xFF, 0xF6, 0x02, 0x27, 0x02, 0xFE, 0x00, 0xA2, 0x00,
-0x4F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x83, 0x00, 0x40, 0x00, 0x85, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00,
-0x37, 0xFF, 0xF6, 0x02, 0x27, 0x02, 0xFE, 0x00, 0xA2, 0x00,
-0x4F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x83, 0x00, 0x60, 0x00, 0xD2, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00,
-0x37, 0xFF, 0xF6, 0x02, 0x27, 0x02, 0xFE, 0x00, 0xA2, 0x00,
-0x4F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x82, 0x00, 0x62, 0x5E, 0x00, 0x40, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x37, 0xFF,
-0xF6, 0x02, 0x27, 0x02, 0xDF, 0x00, 0xA2, 0x00, 0x4F, 0x00,
-0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-0x82, 0x00, 0x64, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6, 0x02,
-0x27, 0x02, 0xDA, 0x00, 0xA2, 0x00, 0x4F, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x82, 0x00,
-0x66, 0x0E, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x00, 0x00, 0x03, 0x00, 0x32, 0x00, 0x79, 0x02, 0x09, 0x02,
-0x47, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x00, 0x01,
-0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
-0x06, 0x05, 0x35, 0x21, 0x15, 0x07, 0x22, 0x26, 0x35, 0x34,
-0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x01, 0x1D, 0x17,
-0x21, 0x21, 0x17, 0x17, 0x20, 0x20, 0xFE, 0xFE, 0x01, 0xD7,
-0xEC, 0x17, 0x21, 0x21, 0x17, 0x17, 0x20, 0x20, 0x01, 0xCE,
-0x1D, 0x20, 0x22, 0x1A, 0x1A, 0x22, 0x20, 0x1D, 0x91, 0x47,
-0x47, 0xC4, 0x1D, 0x20, 0x22, 0x1A, 0x1A, 0x22, 0x20, 0x1D,
-0x00, 0x03, 0x00, 0x37, 0xFF, 0xDF, 0x02, 0x27, 0x02, 0x36,
-0x00, 0x15, 0x00, 0x1E, 0x00, 0x26, 0x00, 0x00, 0x01, 0x14,
-0x06, 0x23, 0x22, 0x27, 0x07, 0x27, 0x37, 0x26, 0x26, 0x35,
-0x34, 0x36, 0x33, 0x32, 0x17, 0x37, 0x17, 0x07, 0x16, 0x16,
-0x05, 0x14, 0x16, 0x17, 0x13, 0x26, 0x23, 0x22, 0x06, 0x05,
-0x34, 0x27, 0x03, 0x16, 0x33, 0x32, 0x36, 0x02, 0x27, 0x87,
-0x73, 0x49, 0x38, 0x28, 0x3A, 0x2D, 0x1F, 0x21, 0x86, 0x73,
-0x49, 0x3A, 0x27, 0x3B, 0x2D, 0x1D, 0x22, 0xFE, 0x6B, 0x0B,
-0x0D, 0xDC, 0x24, 0x34, 0x52, 0x4A, 0x01, 0x3A, 0x17, 0xDC,
-0x22, 0x34, 0x51, 0x4C, 0x01, 0x0D, 0x85, 0x92, 0x21, 0x38,
-0x27, 0x3E, 0x24, 0x65, 0x40, 0x85, 0x90, 0x24, 0x38, 0x26,
-0x3F, 0x23, 0x63, 0x3E, 0x26, 0x41, 0x19, 0x01, 0x32, 0x19,
-0x6C, 0x5F, 0x4A, 0x31, 0xFE, 0xCE, 0x17, 0x6F, 0xFF, 0xFF,
-0x00, 0x4F, 0xFF, 0xF6, 0x02, 0x15, 0x02, 0xFE, 0x00, 0xA2,
-0x00, 0x55, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x40, 0x00, 0x00, 0x83, 0x00, 0x40, 0x00, 0x8B, 0x00, 0x00,
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF,
-0x00, 0x4F, 0xFF, 0xF6, 0x02, 0x15, 0x02, 0xFE, 0x00, 0xA2,
-0x00, 0x55, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x40, 0x00, 0x00, 0x83, 0x00, 0x60, 0x00, 0xD8, 0x00, 0x00,
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF,
-0x00, 0x4F, 0xFF, 0xF6, 0x02, 0x15, 0x02, 0xFE, 0x00, 0xA2,
-0x00, 0x55, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x40, 0x00, 0x00, 0x82, 0x00, 0x62, 0x64, 0x00, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x4F,
-0xFF, 0xF6, 0x02, 0x15, 0x02, 0xDA, 0x00, 0xA2, 0x00, 0x55,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-0x00, 0x82, 0x00, 0x66, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x10,
-0x01, 0xFE, 0x02, 0xFE, 0x00, 0xA2, 0x00, 0x59, 0x00, 0x00,
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x83,
-0x00, 0x60, 0x00, 0xA2, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0x00, 0x55, 0xFF, 0x10,
-0x02, 0x30, 0x02, 0xF8, 0x00, 0x19, 0x00, 0x26, 0x00, 0x00,
-0x01, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x23, 0x1E, 0x02,
-0x15, 0x15, 0x23, 0x11, 0x33, 0x15, 0x14, 0x06, 0x07, 0x33,
-0x36, 0x36, 0x33, 0x32, 0x16, 0x07, 0x34, 0x26, 0x23, 0x22,
-0x06, 0x07, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x02, 0x30,
-0x79, 0x63, 0x3F, 0x50, 0x18, 0x06, 0x01, 0x03, 0x02, 0x58,
-0x58, 0x02, 0x01, 0x04, 0x18, 0x4E, 0x40, 0x63, 0x79, 0x5B,
-0x46, 0x4A, 0x52, 0x44, 0x02, 0x41, 0x58, 0x4A, 0x45, 0x01,
-0x0D, 0x89, 0x8E, 0x2E, 0x20, 0x07, 0x20, 0x22, 0x0B, 0xE0,
-0x03, 0xE8, 0xE0, 0x0E, 0x2D, 0x0D, 0x22, 0x30, 0x8C, 0x88,
-0x65, 0x65, 0x5C, 0x5C, 0x13, 0x63, 0x6B, 0x6B, 0xFF, 0xFF,
-0x00, 0x01, 0xFF, 0x10, 0x01, 0xFE, 0x02, 0xDA, 0x00, 0xA2,
-0x00, 0x59, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x40, 0x00, 0x00, 0x82, 0x00, 0x66, 0xDE, 0x00, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x05, 0xAC, 0xE3,
-0x5F, 0x0F, 0x3C, 0xF5, 0x00, 0x03, 0x08, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xE0, 0x7F, 0x10, 0x0D, 0x00, 0x00, 0x00, 0x00,
-0xE0, 0x7F, 0x10, 0x0D, 0xFD, 0x93, 0xFE, 0x76, 0x0A, 0xF0,
-0x05, 0x43, 0x00, 0x00, 0x00, 0x06, 0x00, 0x02, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x03, 0xA7, 0xFF, 0xB2, 0xFF, 0xD5,
-0x03, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6,
-0x02, 0x58, 0x00, 0x00, 0x01, 0x0D, 0x00, 0x48, 0x01, 0x98,
-0x00, 0x41, 0x02, 0x86, 0x00, 0x19, 0x02, 0x3C, 0x00, 0x3E,
-0x03, 0x3F, 0x00, 0x31, 0x02, 0xDC, 0x00, 0x35, 0x00, 0xE1,
-0x00, 0x41, 0x01, 0x2C, 0x00, 0x28, 0x01, 0x2C, 0x00, 0x1E,
-0x02, 0x27, 0x00, 0x29, 0x02, 0x3C, 0x00, 0x32, 0x01, 0x0C,
-0x00, 0x29, 0x01, 0x42, 0x00, 0x28, 0x01, 0x0C, 0x00, 0x48,
-0x01, 0x74, 0x00, 0x0A, 0x02, 0x3C, 0x00, 0x31, 0x02, 0x3C,
-0x00, 0x59, 0x02, 0x3C, 0x00, 0x30, 0x02, 0x3C, 0x00, 0x2D,
-0x02, 0x3C, 0x00, 0x15, 0x02, 0x3C, 0x00, 0x3F, 0x02, 0x3C,
-0x00, 0x37, 0x02, 0x3C, 0x00, 0x2C, 0x02, 0x3C, 0x00, 0x31,
-0x02, 0x3C, 0x00, 0x32, 0x01, 0x0C, 0x00, 0x48, 0x01, 0x0C,
-0x00, 0x1F, 0x02, 0x3C, 0x00, 0x32, 0x02, 0x3C, 0x00, 0x38,
-0x02, 0x3C, 0x00, 0x32, 0x01, 0xB2, 0x00, 0x0C, 0x03, 0x83,
-0x00, 0x3A, 0x02, 0x7F, 0x00, 0x00, 0x02, 0x8A, 0x00, 0x61,
-0x02, 0x78, 0x00, 0x3D, 0x02, 0xDA, 0x00, 0x61, 0x02, 0x2C,
-0x00, 0x61, 0x02, 0x07, 0x00, 0x61, 0x02, 0xD8, 0x00, 0x3D,
-0x02, 0xE5, 0x00, 0x61, 0x01, 0x53, 0x00, 0x28, 0x01, 0x11,
-0xFF, 0xB2, 0x02, 0x6B, 0x00, 0x61, 0x02, 0x0C, 0x00, 0x61,
-0x03, 0x8B, 0x00, 0x61, 0x02, 0xF8, 0x00, 0x61, 0x03, 0x0D,
-0x00, 0x3D, 0x02, 0x5D, 0x00, 0x61, 0x03, 0x0D, 0x00, 0x3D,
-0x02, 0x6E, 0x00, 0x61, 0x02, 0x25, 0x00, 0x33, 0x02, 0x2C,
-0x00, 0x0A, 0x02, 0xDB, 0x00, 0x5A, 0x02, 0x58, 0x00, 0x00,
-0x03, 0xA2, 0x00, 0x0C, 0x02, 0x4A, 0x00, 0x04, 0x02, 0x36,
-0x00, 0x00, 0x02, 0x3C, 0x00, 0x26, 0x01, 0x49, 0x00, 0x50,
-0x01, 0x74, 0x00, 0x0A, 0x01, 0x49, 0x00, 0x19, 0x02, 0x3C,
-0x00, 0x26, 0x01, 0xBC, 0xFF, 0xFE, 0x01, 0x19, 0x00, 0x28,
-0x02, 0x31, 0x00, 0x2E, 0x02, 0x67, 0x00, 0x55, 0x01, 0xE0,
-0x00, 0x37, 0x02, 0x67, 0x00, 0x37, 0x02, 0x34, 0x00, 0x37,
-0x01, 0x58, 0x00, 0x0F, 0x02, 0x67, 0x00, 0x37, 0x02, 0x6A,
-0x00, 0x55, 0x01, 0x02, 0x00, 0x4E, 0x01, 0x02, 0xFF, 0xC9,
-0x02, 0x16, 0x00, 0x55, 0x01, 0x02, 0x00, 0x55, 0x03, 0xA7,
-0x00, 0x55, 0x02, 0x6A, 0x00, 0x55, 0x02, 0x5D, 0x00, 0x37,
-0x02, 0x67, 0x00, 0x55, 0x02, 0x67, 0x00, 0x37, 0x01, 0x9D,
-0x00, 0x55, 0x01, 0xDF, 0x00, 0x33, 0x01, 0x69, 0x00, 0x10,
-0x02, 0x6A, 0x00, 0x4F, 0x01, 0xFC, 0x00, 0x00, 0x03, 0x12,
-0x00, 0x0B, 0x02, 0x11, 0x00, 0x12, 0x01, 0xFE, 0x00, 0x01,
-0x01, 0xD6, 0x00, 0x27, 0x01, 0x7C, 0x00, 0x1C, 0x02, 0x27,
-0x00, 0xEF, 0x01, 0x7C, 0x00, 0x20, 0x02, 0x3C, 0x00, 0x32,
-0x02, 0x7F, 0x00, 0x00, 0x01, 0x19, 0x00, 0x28, 0x02, 0x7F,
-0x00, 0x00, 0x01, 0xA2, 0x00, 0x28, 0x02, 0x7F, 0x00, 0x00,
-0x01, 0xBF, 0x00, 0x28, 0x02, 0x7F, 0x00, 0x00, 0x02, 0x44,
-0x00, 0x95, 0x02, 0x7F, 0x00, 0x00, 0x01, 0x2C, 0x00, 0x28,
-0x02, 0x7F, 0x00, 0x00, 0x03, 0x71, 0xFF, 0xFF, 0x00, 0xE1,
-0x00, 0x0E, 0x02, 0x78, 0x00, 0x3D, 0x02, 0x2C, 0x00, 0x61,
-0x02, 0x2C, 0x00, 0x61, 0x02, 0x2C, 0x00, 0x61, 0x02, 0x2C,
-0x00, 0x61, 0x01, 0x53, 0x00, 0x28, 0x01, 0x53, 0x00, 0x28,
-0x01, 0x53, 0x00, 0x01, 0x01, 0x53, 0x00, 0x1E, 0x02, 0xDA,
-0x00, 0x1E, 0x02, 0xF8, 0x00, 0x61, 0x03, 0x0D, 0x00, 0x3D,
-0x03, 0x0D, 0x00, 0x3D, 0x03, 0x0D, 0x00, 0x3D, 0x03, 0x0D,
-0x00, 0x3D, 0x03, 0x0D, 0x00, 0x3D, 0x02, 0x3C, 0x00, 0x40,
-0x03, 0x0D, 0x00, 0x3D, 0x02, 0xDB, 0x00, 0x5A, 0x02, 0xDB,
-0x00, 0x5A, 0x02, 0xDB, 0x00, 0x5A, 0x02, 0xDB, 0x00, 0x5A,
-0x02, 0x36, 0x00, 0x00, 0x02, 0x5D, 0x00, 0x61, 0x02, 0x77,
-0x00, 0x55, 0x02, 0x31, 0x00, 0x2E, 0x02, 0x31, 0x00, 0x2E,
-0x02, 0x31, 0x00, 0x2E, 0x02, 0x31, 0x00, 0x2E, 0x02, 0x31,
-0x00, 0x2E, 0x02, 0x31, 0x00, 0x2E, 0x03, 0x60, 0x00, 0x2E,
-0x01, 0xE0, 0x00, 0x37, 0x02, 0x34, 0x00, 0x37, 0x02, 0x34,
-0x00, 0x37, 0x02, 0x34, 0x00, 0x37, 0x02, 0x34, 0x00, 0x37,
-0x01, 0x02, 0x00, 0x55, 0x01, 0x02, 0xFF, 0xFF, 0x01, 0x02,
-0x00, 0x4C, 0x01, 0x02, 0xFF, 0xD8, 0x01, 0x02, 0xFF, 0xF5,
-0x02, 0x5D, 0x00, 0x37, 0x02, 0x6A, 0x00, 0x55, 0x02, 0x5D,
-0x00, 0x37, 0x02, 0x5D, 0x00, 0x37, 0x02, 0x5D, 0x00, 0x37,
-0x02, 0x5D, 0x00, 0x37, 0x02, 0x5D, 0x00, 0x37, 0x02, 0x3C,
-0x00, 0x32, 0x02, 0x5D, 0x00, 0x37, 0x02, 0x6A, 0x00, 0x4F,
-0x02, 0x6A, 0x00, 0x4F, 0x02, 0x6A, 0x00, 0x4F, 0x02, 0x6A,
-0x00, 0x4F, 0x01, 0xFE, 0x00, 0x01, 0x02, 0x67, 0x00, 0x55,
-0x01, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x38, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x9C,
-0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0x91, 0x00, 0x00,
-0x02, 0x22, 0x00, 0x00, 0x02, 0xC5, 0x00, 0x00, 0x02, 0xE1,
-0x00, 0x00, 0x03, 0x15, 0x00, 0x00, 0x03, 0x4A, 0x00, 0x00,
-0x03, 0x87, 0x00, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x03, 0xD7,
-0x00, 0x00, 0x03, 0xEE, 0x00, 0x00, 0x04, 0x19, 0x00, 0x00,
-0x04, 0x38, 0x00, 0x00, 0x04, 0x8B, 0x00, 0x00, 0x04, 0xBD,
-0x00, 0x00, 0x05, 0x14, 0x00, 0x00, 0x05, 0x8F, 0x00, 0x00,
-0x05, 0xD9, 0x00, 0x00, 0x06, 0x3A, 0x00, 0x00, 0x06, 0xBC,
-0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x07, 0x81, 0x00, 0x00,
-0x08, 0x04, 0x00, 0x00, 0x08, 0x4F, 0x00, 0x00, 0x08, 0x99,
-0x00, 0x00, 0x08, 0xBF, 0x00, 0x00, 0x08, 0xE5, 0x00, 0x00,
-0x09, 0x0A, 0x00, 0x00, 0x09, 0x89, 0x00, 0x00, 0x0A, 0x61,
-0x00, 0x00, 0x0A, 0xA9, 0x00, 0x00, 0x0B, 0x12, 0x00, 0x00,
-0x0B, 0x67, 0x00, 0x00, 0x0B, 0xA6, 0x00, 0x00, 0x0B, 0xD4,
-0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x0C, 0x5F, 0x00, 0x00,
-0x0C, 0x8D, 0x00, 0x00, 0x0C, 0xBC, 0x00, 0x00, 0x0C, 0xF6,
-0x00, 0x00, 0x0D, 0x30, 0x00, 0x00, 0x0D, 0x4D, 0x00, 0x00,
-0x0D, 0x98, 0x00, 0x00, 0x0D, 0xDA, 0x00, 0x00, 0x0E, 0x33,
-0x00, 0x00, 0x0E, 0x79, 0x00, 0x00, 0x0E, 0xDF, 0x00, 0x00,
-0x0F, 0x30, 0x00, 0x00, 0x0F, 0xAC, 0x00, 0x00, 0x0F, 0xCD,
-0x00, 0x00, 0x10, 0x0B, 0x00, 0x00, 0x10, 0x44, 0x00, 0x00,
-0x10, 0xB7, 0x00, 0x00, 0x10, 0xEC, 0x00, 0x00, 0x11, 0x17,
-0x00, 0x00, 0x11, 0x44, 0x00, 0x00, 0x11, 0x66, 0x00, 0x00,
-0x11, 0x84, 0x00, 0x00, 0x11, 0xA5, 0x00, 0x00, 0x11, 0xCB,
-0x00, 0x00, 0x11, 0xE5, 0x00, 0x00, 0x12, 0x13, 0x00, 0x00,
-0x12, 0x89, 0x00, 0x00, 0x12, 0xEE, 0x00, 0x00, 0x13, 0x42,
-0x00, 0x00, 0x13, 0xA9, 0x00, 0x00, 0x14, 0x0D, 0x00, 0x00,
-0x14, 0x58, 0x00, 0x00, 0x14, 0xD5, 0x00, 0x00, 0x15, 0x1A,
-0x00, 0x00, 0x15, 0x53, 0x00, 0x00, 0x15, 0xAB, 0x00, 0x00,
-0x15, 0xEF, 0x00, 0x00, 0x16, 0x06, 0x00, 0x00, 0x16, 0x6A,
-0x00, 0x00, 0x16, 0xAC, 0x00, 0x00, 0x16, 0xFF, 0x00, 0x00,
-0x17, 0x6B, 0x00, 0x00, 0x17, 0xD4, 0x00, 0x00, 0x18, 0x19,
-0x00, 0x00, 0x18, 0x94, 0x00, 0x00, 0x18, 0xE1, 0x00, 0x00,
-0x19, 0x23, 0x00, 0x00, 0x19, 0x5F, 0x00, 0x00, 0x19, 0xD6,
-0x00, 0x00, 0x1A, 0x08, 0x00, 0x00, 0x1A, 0x63, 0x00, 0x00,
-0x1A, 0x90, 0x00, 0x00, 0x1A, 0xE8, 0x00, 0x00, 0x1B, 0x01,
-0x00, 0x00, 0x1B, 0x58, 0x00, 0x00, 0x1B, 0xA6, 0x00, 0x00,
-0x1B, 0xCE, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x1C, 0x24,
-0x00, 0x00, 0x1C, 0x66, 0x00, 0x00, 0x1C, 0x8E, 0x00, 0x00,
-0x1C, 0xD6, 0x00, 0x00, 0x1C, 0xFE, 0x00, 0x00, 0x1D, 0x49,
-0x00, 0x00, 0x1D, 0x71, 0x00, 0x00, 0x1D, 0xBC, 0x00, 0x00,
-0x1D, 0xE4, 0x00, 0x00, 0x1E, 0x2A, 0x00, 0x00, 0x1E, 0x6E,
-0x00, 0x00, 0x1E, 0x96, 0x00, 0x00, 0x1E, 0xBE, 0x00, 0x00,
-0x1E, 0xE6, 0x00, 0x00, 0x1F, 0x0E, 0x00, 0x00, 0x1F, 0x36,
-0x00, 0x00, 0x1F, 0x5E, 0x00, 0x00, 0x1F, 0x86, 0x00, 0x00,
-0x1F, 0xAE, 0x00, 0x00, 0x1F, 0xD6, 0x00, 0x00, 0x20, 0x26,
-0x00, 0x00, 0x20, 0x4E, 0x00, 0x00, 0x20, 0x76, 0x00, 0x00,
-0x20, 0x9E, 0x00, 0x00, 0x20, 0xC6, 0x00, 0x00, 0x20, 0xEE,
-0x00, 0x00, 0x21, 0x16, 0x00, 0x00, 0x21, 0x4A, 0x00, 0x00,
-0x21, 0xD5, 0x00, 0x00, 0x21, 0xFD, 0x00, 0x00, 0x22, 0x25,
-0x00, 0x00, 0x22, 0x4D, 0x00, 0x00, 0x22, 0x75, 0x00, 0x00,
-0x22, 0x9D, 0x00, 0x00, 0x22, 0xE7, 0x00, 0x00, 0x23, 0x81,
-0x00, 0x00, 0x23, 0xA7, 0x00, 0x00, 0x23, 0xCF, 0x00, 0x00,
-0x23, 0xF5, 0x00, 0x00, 0x24, 0x1B, 0x00, 0x00, 0x24, 0x41,
-0x00, 0x00, 0x24, 0x69, 0x00, 0x00, 0x25, 0x20, 0x00, 0x00,
-0x25, 0x48, 0x00, 0x00, 0x25, 0x6E, 0x00, 0x00, 0x25, 0x96,
-0x00, 0x00, 0x25, 0xBC, 0x00, 0x00, 0x25, 0xE2, 0x00, 0x00,
-0x25, 0xF9, 0x00, 0x00, 0x26, 0x1F, 0x00, 0x00, 0x26, 0x45,
-0x00, 0x00, 0x26, 0x6B, 0x00, 0x00, 0x26, 0x93, 0x00, 0x00,
-0x27, 0x1D, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x27, 0x6B,
-0x00, 0x00, 0x27, 0x93, 0x00, 0x00, 0x27, 0xB9, 0x00, 0x00,
-0x27, 0xDF, 0x00, 0x00, 0x28, 0x05, 0x00, 0x00, 0x28, 0x5E,
-0x00, 0x00, 0x28, 0xDE, 0x00, 0x00, 0x29, 0x06, 0x00, 0x00,
-0x29, 0x2E, 0x00, 0x00, 0x29, 0x54, 0x00, 0x00, 0x29, 0x7A,
-0x00, 0x00, 0x29, 0xA2, 0x00, 0x00, 0x2A, 0x14, 0x00, 0x00,
-0x2A, 0x3A, 0x00, 0x01, 0x00, 0x00, 0x00, 0xA6, 0x10, 0x00,
-0x04, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xFF, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x96,
-0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x07, 0x00, 0x0D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x03, 0x00, 0x21, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x0D, 0x00, 0x35, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x42,
-0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0D,
-0x00, 0x45, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01,
-0x00, 0x1A, 0x00, 0x52, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-0x00, 0x02, 0x00, 0x0E, 0x00, 0x6C, 0x00, 0x03, 0x00, 0x01,
-0x04, 0x09, 0x00, 0x03, 0x00, 0x42, 0x00, 0x7A, 0x00, 0x03,
-0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x1A, 0x00, 0xBC,
-0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x06,
-0x00, 0xD6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06,
-0x00, 0x1A, 0x00, 0xDC, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61,
-0x74, 0x65, 0x64, 0x46, 0x6F, 0x6E, 0x74, 0x52, 0x65, 0x67,
-0x75, 0x6C, 0x61, 0x72, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61,
-0x74, 0x65, 0x64, 0x46, 0x6F, 0x6E, 0x74, 0x20, 0x52, 0x65,
-0x67, 0x75, 0x6C, 0x61, 0x72, 0x3A, 0x56, 0x65, 0x72, 0x73,
-0x69, 0x6F, 0x6E, 0x20, 0x31, 0x2E, 0x30, 0x47, 0x65, 0x6E,
-0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x46, 0x6F, 0x6E, 0x74,
-0x31, 0x2E, 0x30, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74,
-0x65, 0x64, 0x46, 0x6F, 0x6E, 0x74, 0x00, 0x47, 0x00, 0x65,
-0x00, 0x6E, 0x00, 0x65, 0x00, 0x72, 0x00, 0x61, 0x00, 0x74,
-0x00, 0x65, 0x00, 0x64, 0x00, 0x46, 0x00, 0x6F, 0x00, 0x6E,
-0x00, 0x74, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75,
-0x00, 0x6C, 0x00, 0x61, 0x00, 0x72, 0x00, 0x47, 0x00, 0x65,
-0x00, 0x6E, 0x00, 0x65, 0x00, 0x72, 0x00, 0x61, 0x00, 0x74,
-0x00, 0x65, 0x00, 0x64, 0x00, 0x46, 0x00, 0x6F, 0x00, 0x6E,
-0x00, 0x74, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67,
-0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x72, 0x00, 0x3A,
-0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69,
-0x00, 0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2E,
-0x00, 0x30, 0x00, 0x47, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x65,
-0x00, 0x72, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64,
-0x00, 0x46, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x31,
-0x00, 0x2E, 0x00, 0x30, 0x00, 0x47, 0x00, 0x65, 0x00, 0x6E,
-0x00, 0x65, 0x00, 0x72, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65,
-0x00, 0x64, 0x00, 0x46, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74,
-0x00, 0x04, 0x02, 0x3B, 0x01, 0x90, 0x00, 0x05, 0x00, 0x08,
-0x02, 0x8A, 0x02, 0x58, 0x00, 0x00, 0x00, 0x4B, 0x02, 0x8A,
-0x02, 0x58, 0x00, 0x00, 0x01, 0x5E, 0x00, 0x32, 0x01, 0x42,
-0x00, 0x00, 0x02, 0x0B, 0x05, 0x02, 0x04, 0x05, 0x04, 0x02,
-0x02, 0x04, 0xE0, 0x00, 0x82, 0xFF, 0x40, 0x00, 0x20, 0x5F,
-0x08, 0x00, 0x00, 0x29, 0x00, 0x10, 0x00, 0x00, 0x47, 0x4F,
-0x4F, 0x47, 0x00, 0xC0, 0x00, 0x00, 0xFF, 0xFD, 0x04, 0x2D,
-0xFE, 0xDB, 0x00, 0x00, 0x05, 0x43, 0x01, 0x8B, 0x00, 0x00,
-0x01, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x18, 0x02, 0xCA,
-0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01,
-0xFF, 0x85, 0xB0, 0x04, 0x8D, 0x00, };
-
-#endif
@@ -4,22 +4,31 @@
 #include <LittleFS.h>
 
 #include <OpenFontRender.h>
-#include <TJpg_Decoder.h>
 
-#include "fonts/open-sans.h"
+// src/fonts/open-sans.h reduced to what the UI renders, generated by scripts/build_font.py
+#include "font-subset.h"
+// the clock characters pre-rasterized, generated by scripts/build_font.py
+#include "clock-font.h"
+#include "BitmapFontRender.h"
+#include "CachedFontRender.h"
+#include "GestureRecognizer.h"
 #include "GfxUi.h"
 
-#include <JsonListener.h>
-#include <OpenWeatherMapCurrent.h>
-#include <OpenWeatherMapForecast.h>
 #include <SunMoonCalc.h>
 #include <TaskScheduler.h>
 
 #include "connectivity.h"
+#include "DoubleBuffer.h"
 #include "display.h"
+#include "pages.h"
 #include "persistence.h"
+#include "RenderStats.h"
 #include "settings.h"
+#include "TileRenderer.h"
+#include "TouchInput.h"
 #include "util.h"
+#include "weather.h"
+#include "widgets.h"
 
 
 
@@ -28,39 +37,103 @@
 // ----------------------------------------------------------------------------
 OpenFontRender ofr;
 FT6236 ts = FT6236(TFT_HEIGHT, TFT_WIDTH);
+TouchInput touchInput(&ts);
+GestureRecognizer gestureRecognizer;
 TFT_eSPI tft = TFT_eSPI();
 TFT_eSprite timeSprite = TFT_eSprite(&tft);
-GfxUi ui = GfxUi(&tft, &ofr);
+// the other pages are rendered into its shadow framebuffer, refreshes only push the tiles that
+// changed
+TileRenderer tileRenderer(&tft);
+// the dashboard as it was left, to return to it
+TFT_eSprite dashboardSprite = TFT_eSprite(&tft);
+// icons and JPEGs are pushed to the display from core 0 while the next block is decoded
+BlitPipeline blitPipeline(&tft);
+GfxUi ui = GfxUi(&tft, &ofr, &blitPipeline);
+// all text is drawn through the glyph cache, ofr only rasterizes each glyph once
+CachedFontRender cfr(&tft, &ofr);
+// the clock ticks every second, its digits come pre-rasterized
+BitmapFontRender clockFont;
 
 // time management variables
 int updateIntervalMillis = UPDATE_INTERVAL_MINUTES * 60 * 1000;
-unsigned long lastTimeSyncMillis = 0;
-unsigned long lastUpdateMillis = 0;
+// written by weatherTask, read on core 1
+std::atomic<uint32_t> lastTimeSyncMillis{0};
+std::atomic<uint32_t> lastUpdateMillis{0};
 
 const int16_t centerWidth = tft.width() / 2;
 
-OpenWeatherMapCurrentData currentWeather;
-OpenWeatherMapForecastData forecasts[NUMBER_OF_FORECASTS];
+CurrentWeatherData currentWeather;
+ForecastStore forecasts;
+DayForecast dayForecasts[NUMBER_OF_DAY_FORECASTS];
+time_t weatherFetchedAt = 0;
+// true while the dashboard shows the snapshot persisted by a previous run
+bool weatherFromFile = false;
+
+// Weather data is fetched by weatherTask on core 0 and handed over to the UI through this buffer.
+DoubleBuffer<WeatherSnapshot> weatherSnapshots;
+uint32_t weatherSnapshotSequence = 0;
+
+// What weatherTask is busy with, shown as progress on the boot screen
+typedef enum WeatherTaskStatus {
+  STARTING_WIFI,
+  SYNCHRONIZING_TIME,
+  UPDATING_WEATHER,
+  UPDATING_FORECAST,
+  WEATHER_READY
+} WeatherTaskStatus;
+std::atomic<WeatherTaskStatus> weatherTaskStatus{STARTING_WIFI};
+
+// Only used by weatherTask. Long-lived so it remembers the last responses for conditional fetches.
+WeatherClient weatherClient(IS_METRIC, OPEN_WEATHER_MAP_LANGUAGE);
 
 Scheduler scheduler;
 
+bool dashboardDrawn = false;
+PageId currentPage = PAGE_DASHBOARD;
+// fixed-width cells of the clock digits and separators and where the first one starts, see
+// initClockLayout()
+uint16_t clockDigitCellWidth = 0;
+uint16_t clockSeparatorCellWidth = 0;
+int16_t clockTimeX = 0;
+Widget<ClockInputs> clockWidget = {timeSpritePos};
+Widget<CurrentWeatherInputs> currentWeatherWidget = {currentWeatherPos};
+Widget<ForecastInputs> forecastWidget = {forecastPos};
+Widget<AstroInputs> astroWidget = {astroPos};
+
 
 
 // ----------------------------------------------------------------------------
 // Function prototypes (declarations)
 // ----------------------------------------------------------------------------
-void drawAstro();
-void drawCurrentWeather();
-void drawForecast();
+void applyWeatherSnapshot(const WeatherSnapshot *snapshot);
+void clearWidgetArea(RectangleDef area);
+void drawBootProgress();
+void drawBootScreen();
+bool drawAstro();
+void drawAstroPage();
+bool drawCurrentWeather();
+bool drawForecast();
+void drawHourlyForecastPage();
+void drawPage(PageId page);
 void drawProgress(const char *text, int8_t percentage);
+bool drawProfiled(const char *name, bool (*draw)());
+void drawClockCells(const char *previous, const char *current, int16_t &dirtyMinX,
+                    int16_t &dirtyMaxX);
+void drawSystemStatsPage();
 void drawTimeAndDate();
+const char *fetchResultName(FetchResult result);
 String getWeatherIconName(uint16_t id, bool today);
-void initJpegDecoder();
+void handleGesture(const Gesture &gesture);
+void initClockLayout();
 void initOpenFontRender();
-bool pushImageToTft(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
+bool initPageSprites();
+bool isWeatherStale();
+void showPage(PageId page);
 void syncTime();
+void refreshPage();
 void repaint();
-void updateData(boolean updateProgressBar);
+FetchResult updateData(WeatherSnapshot *snapshot);
+void weatherTask(void *parameter);
 
 
 Task clockTask(1000, TASK_FOREVER, &drawTimeAndDate);
@@ -77,40 +150,70 @@ void setup(void) {
   logBanner();
   logMemoryStats();
 
-  initJpegDecoder();
   initTouchScreen(&ts);
   initTft(&tft);
-  timeSprite.createSprite(timeSpritePos.width, timeSpritePos.height);
+  // reads the touch registers, before the touch task starts polling the I2C bus
   logDisplayDebugInfo(&tft);
+  touchInput.begin(TOUCH_INT);
+  blitPipeline.begin();
+  timeSprite.createSprite(timeSpritePos.width, timeSpritePos.height);
 
   initFileSystem();
+  // before anything reads the local time, the warm boot repaint below included
+  initTime();
   initOpenFontRender();
+  initClockLayout();
+  ui.openIconAtlas();
+  ui.setIconCacheBudget(ICON_CACHE_BUDGET_BYTES);
 
   scheduler.init();
   scheduler.addTask(clockTask);
-  clockTask.enable();
-}
 
-void loop(void) {
-  // update if
-  // - never (successfully) updated before OR
-  // - last sync too far back
-  if (lastTimeSyncMillis == 0 ||
-      lastUpdateMillis == 0 ||
-      (millis() - lastUpdateMillis) > updateIntervalMillis) {
+  // warm boot: show the last persisted weather right away while fresh data loads in the background
+  WeatherSnapshot *savedSnapshot = new WeatherSnapshot();
+  if (loadWeatherSnapshot(savedSnapshot)) {
+    applyWeatherSnapshot(savedSnapshot);
+    weatherFromFile = true;
     repaint();
+  } else {
+    drawBootScreen();
   }
+  delete savedSnapshot;
 
-  // if (ts.touched()) {
-  //   TS_Point p = ts.getPoint();
+  weatherClient.setAllowedHours(forecastHoursUtc, sizeof(forecastHoursUtc));
+  weatherClient.setForecastInterval(FORECAST_UPDATE_INTERVAL_MINUTES * 60 * 1000);
+  // network I/O and parsing must not block the clock and touch handling in loop() on core 1
+  xTaskCreatePinnedToCore(weatherTask, "weather", WEATHER_TASK_STACK_SIZE, nullptr, 1, nullptr, 0);
+}
+
+void loop(void) {
+  if (!dashboardDrawn) {
+    drawBootProgress();
+  }
 
-  //   uint16_t touchX = p.x;
-  //   uint16_t touchY = p.y;
+  // repaint whenever weatherTask published fresh data
+  const WeatherSnapshot *snapshot = weatherSnapshots.acquire(weatherSnapshotSequence);
+  if (snapshot != nullptr) {
+    applyWeatherSnapshot(snapshot);
+    weatherSnapshots.release();
+    weatherFromFile = false;
+    if (currentPage == PAGE_DASHBOARD) {
+      repaint();
+    } else {
+      // the dashboard catches up when it's shown again
+      refreshPage();
+    }
+  }
 
-  //   log_i("Touch coordinates: x=%d, y=%d", touchX, touchY);
-  //   // Debouncing; avoid returning the same touch multiple times.
-  //   delay(50);
-  // }
+  TouchEvent touchEvent;
+  while (touchInput.poll(touchEvent)) {
+    gestureRecognizer.feed(touchEvent);
+  }
+  gestureRecognizer.advance(millis());
+  Gesture gesture;
+  while (gestureRecognizer.next(gesture)) {
+    handleGesture(gesture);
+  }
   scheduler.execute();
 }
 
@@ -119,138 +222,460 @@ void loop(void) {
 // ----------------------------------------------------------------------------
 // Functions
 // ----------------------------------------------------------------------------
-void drawAstro() {
-  time_t tnow = time(nullptr);
+void applyWeatherSnapshot(const WeatherSnapshot *snapshot) {
+  weatherFetchedAt = snapshot->fetchedAt;
+  currentWeather = snapshot->currentWeather;
+  forecasts = snapshot->forecasts;
+  for (uint8_t i = 0; i < NUMBER_OF_DAY_FORECASTS; i++) {
+    dayForecasts[i] = snapshot->dayForecasts[i];
+  }
+}
+
+// After a warm boot the clock isn't synchronized yet, sun and moon are calculated for the time the
+// weather was fetched at rather than for a day in 1970.
+time_t astroTime() {
+  return lastTimeSyncMillis > 0 ? time(nullptr) : weatherFetchedAt;
+}
+
+bool drawAstro() {
+  time_t tnow = astroTime();
   struct tm *nowUtc = gmtime(&tnow);
 
   SunMoonCalc smCalc = SunMoonCalc(mkgmtime(nowUtc), currentWeather.lat, currentWeather.lon);
   const SunMoonCalc::Result result = smCalc.calculateSunAndMoonData();
 
-  ofr.setFontSize(24);
-  ofr.cdrawString(SUN_MOON_LABEL[0].c_str(), 60, 365);
-  ofr.cdrawString(SUN_MOON_LABEL[1].c_str(), tft.width() - 60, 365);
+  AstroInputs inputs;
+  char timestamp[TIMESTAMP_SIZE];
+  inputs.sunRise = formatLocalTime(timestamp, sizeof(timestamp), UI_TIME_FORMAT_NO_SECONDS,
+                                   result.sun.rise);
+  inputs.sunSet = formatLocalTime(timestamp, sizeof(timestamp), UI_TIME_FORMAT_NO_SECONDS,
+                                  result.sun.set);
+  inputs.moonRise = formatLocalTime(timestamp, sizeof(timestamp), UI_TIME_FORMAT_NO_SECONDS,
+                                    result.moon.rise);
+  inputs.moonSet = formatLocalTime(timestamp, sizeof(timestamp), UI_TIME_FORMAT_NO_SECONDS,
+                                   result.moon.set);
 
-  ofr.setFontSize(18);
+  int imageIndex = round(result.moon.age * NUMBER_OF_MOON_IMAGES / LUNAR_MONTH);
+  if (imageIndex == NUMBER_OF_MOON_IMAGES) imageIndex = NUMBER_OF_MOON_IMAGES - 1;
+  inputs.moonImageIndex = imageIndex;
+  inputs.moonPhaseIndex = result.moon.phase.index;
+
+  if (!updateWidgetInputs(astroWidget, inputs)) {
+    return false;
+  }
+  clearWidgetArea(astroWidget.area);
+
+  cfr.setFontSize(24);
+  cfr.cdrawString(SUN_MOON_LABEL[0].c_str(), 60, 365);
+  cfr.cdrawString(SUN_MOON_LABEL[1].c_str(), tft.width() - 60, 365);
+
+  cfr.setFontSize(18);
   // Sun
-  strftime(timestampBuffer, 26, UI_TIME_FORMAT_NO_SECONDS, localtime(&result.sun.rise));
-  ofr.cdrawString(timestampBuffer, 60, 400);
-  strftime(timestampBuffer, 26, UI_TIME_FORMAT_NO_SECONDS, localtime(&result.sun.set));
-  ofr.cdrawString(timestampBuffer, 60, 425);
+  cfr.cdrawString(inputs.sunRise.c_str(), 60, 400);
+  cfr.cdrawString(inputs.sunSet.c_str(), 60, 425);
 
   // Moon
-  strftime(timestampBuffer, 26, UI_TIME_FORMAT_NO_SECONDS, localtime(&result.moon.rise));
-  ofr.cdrawString(timestampBuffer, tft.width() - 60, 400);
-  strftime(timestampBuffer, 26, UI_TIME_FORMAT_NO_SECONDS, localtime(&result.moon.set));
-  ofr.cdrawString(timestampBuffer, tft.width() - 60, 425);
+  cfr.cdrawString(inputs.moonRise.c_str(), tft.width() - 60, 400);
+  cfr.cdrawString(inputs.moonSet.c_str(), tft.width() - 60, 425);
 
-  // Moon icon
-  int imageIndex = round(result.moon.age * NUMBER_OF_MOON_IMAGES / LUNAR_MONTH);
-  if (imageIndex == NUMBER_OF_MOON_IMAGES) imageIndex = NUMBER_OF_MOON_IMAGES - 1;
-  ui.drawBmp("/moon/m-phase-" + String(imageIndex) + ".bmp", centerWidth - 37, 365);
+  cfr.setFontSize(14);
+  cfr.cdrawString(MOON_PHASES[result.moon.phase.index].c_str(), centerWidth, 455);
 
-  ofr.setFontSize(14);
-  ofr.cdrawString(MOON_PHASES[result.moon.phase.index].c_str(), centerWidth, 455);
+  // Moon icon, last: it goes through the blit pipeline, text is drawn directly
+  ui.drawIcon("/moon/m-phase-" + String(imageIndex) + ".icon", centerWidth - 37, 365);
 
   log_i("Moon phase: %s, illumination: %f, age: %f -> image index: %d",
         result.moon.phase.name.c_str(), result.moon.illumination, result.moon.age, imageIndex);
+  return true;
 }
 
-void drawCurrentWeather() {
-  // re-use variable throughout function
-  String text = "";
+void clearWidgetArea(RectangleDef area) {
+  // the icons of the previous widget may still be on their way
+  blitPipeline.flush();
+  tft.fillRect(area.x, area.y, area.width, area.height, TFT_BLACK);
+  countPixelsPushed(area.width * area.height);
+}
 
-  // icon
-  String weatherIcon = getWeatherIconName(currentWeather.weatherId, true);
-  ui.drawBmp("/weather/" + weatherIcon + ".bmp", 5, 125);
-  // tft.drawRect(5, 125, 100, 100, 0x4228);
+void drawBootProgress() {
+  static int8_t drawnStatus = -1;
+  WeatherTaskStatus status = weatherTaskStatus;
+  if (status == drawnStatus) {
+    return;
+  }
+  drawnStatus = status;
+
+  RenderStats before = renderStats;
+  uint32_t startMicros = micros();
+  switch (status) {
+    case STARTING_WIFI: drawProgress("Starting WiFi...", 10); break;
+    case SYNCHRONIZING_TIME: drawProgress("Synchronizing time...", 30); break;
+    case UPDATING_WEATHER: drawProgress("Updating weather...", 70); break;
+    case UPDATING_FORECAST: drawProgress("Updating forecast...", 90); break;
+    case WEATHER_READY: drawProgress("Ready", 100); break;
+  }
+  log_d("Progress: %luus, %d pixels in %d address windows", micros() - startMicros,
+        renderStats.pixels - before.pixels, renderStats.windows - before.windows);
+}
+
+void drawBootScreen() {
+  tft.fillScreen(TFT_BLACK);
+  countPixelsPushed(tft.width() * tft.height());
+  ui.drawLogo();
+
+  cfr.setFontSize(16);
+  cfr.cdrawString(APP_NAME, centerWidth, tft.height() - 50);
+  cfr.cdrawString(VERSION, centerWidth, tft.height() - 30);
+}
+
+// Sun and moon in more detail than on the dashboard
+void drawAstroPage() {
+  time_t tnow = astroTime();
+  struct tm *nowUtc = gmtime(&tnow);
+  SunMoonCalc smCalc = SunMoonCalc(mkgmtime(nowUtc), currentWeather.lat, currentWeather.lon);
+  const SunMoonCalc::Result result = smCalc.calculateSunAndMoonData();
+
+  char line[48];
+  char rise[16], set[16];
+  uint16_t y = 70;
+  cfr.setFontSize(24);
+  cfr.drawString(SUN_MOON_LABEL[0].c_str(), 20, y);
+  cfr.setFontSize(18);
+  formatLocalTime(rise, sizeof(rise), UI_TIME_FORMAT_NO_SECONDS, result.sun.rise);
+  formatLocalTime(set, sizeof(set), UI_TIME_FORMAT_NO_SECONDS, result.sun.set);
+  snprintf(line, sizeof(line), "%s - %s", rise, set);
+  cfr.drawString(line, 20, y += 40);
+  uint32_t dayMinutes = (result.sun.set - result.sun.rise) / 60;
+  snprintf(line, sizeof(line), "%luh %02lumin", dayMinutes / 60, dayMinutes % 60);
+  cfr.drawString(line, 20, y += 28);
+
+  y += 60;
+  cfr.setFontSize(24);
+  cfr.drawString(SUN_MOON_LABEL[1].c_str(), 20, y);
+  cfr.setFontSize(18);
+  formatLocalTime(rise, sizeof(rise), UI_TIME_FORMAT_NO_SECONDS, result.moon.rise);
+  formatLocalTime(set, sizeof(set), UI_TIME_FORMAT_NO_SECONDS, result.moon.set);
+  snprintf(line, sizeof(line), "%s - %s", rise, set);
+  cfr.drawString(line, 20, y += 40);
+  cfr.drawString(MOON_PHASES[result.moon.phase.index].c_str(), 20, y += 28);
+  snprintf(line, sizeof(line), "%.0f%%, %.1f d", result.moon.illumination * 100, result.moon.age);
+  cfr.drawString(line, 20, y += 28);
+}
+
+bool drawCurrentWeather() {
+  CurrentWeatherInputs inputs;
+  inputs.iconName = getWeatherIconName(currentWeather.weatherId, true);
+  inputs.description = currentWeather.description;
+  inputs.temp = String(currentWeather.temp, 1) + "°";
+  inputs.humidity = String(currentWeather.humidity) + " %";
+  inputs.pressure = String(currentWeather.pressure) + " hPa";
+  int windAngleIndex = round(currentWeather.windDeg * 8 / 360);
+  if (windAngleIndex > 7) windAngleIndex = 0;
+  inputs.windIconName = WIND_ICON_NAMES[windAngleIndex];
+  inputs.windSpeed = String(currentWeather.windSpeed, 0);
+  if (IS_METRIC) inputs.windSpeed += " m/s";
+  else inputs.windSpeed += " mph";
+
+  if (!updateWidgetInputs(currentWeatherWidget, inputs)) {
+    return false;
+  }
+  clearWidgetArea(currentWeatherWidget.area);
 
   // condition string
-  ofr.setFontSize(24);
-  ofr.cdrawString(currentWeather.description.c_str(), centerWidth, 95);
+  cfr.setFontSize(24);
+  cfr.cdrawString(inputs.description.c_str(), centerWidth, 95);
 
   // temperature incl. symbol, slightly shifted to the right to find better balance due to the ° symbol
-  ofr.setFontSize(48);
-  text = String(currentWeather.temp, 1) + "°";
-  ofr.cdrawString(text.c_str(), centerWidth + 10, 120);
+  cfr.setFontSize(48);
+  cfr.cdrawString(inputs.temp.c_str(), centerWidth + 10, 120);
 
-  ofr.setFontSize(18);
+  cfr.setFontSize(18);
 
   // humidity
-  text = String(currentWeather.humidity) + " %";
-  ofr.cdrawString(text.c_str(), centerWidth, 178);
+  cfr.cdrawString(inputs.humidity.c_str(), centerWidth, 178);
 
   // pressure
-  text = String(currentWeather.pressure) + " hPa";
-  ofr.cdrawString(text.c_str(), centerWidth, 200);
+  cfr.cdrawString(inputs.pressure.c_str(), centerWidth, 200);
+
+  // wind speed
+  cfr.cdrawString(inputs.windSpeed.c_str(), tft.width() - 43, 200);
+
+  // the icons go through the blit pipeline, after all text which is drawn directly
+  ui.drawIcon("/weather/" + inputs.iconName + ".icon", 5, 125);
+  // tft.drawRect(5, 125, 100, 100, 0x4228);
 
   // wind rose icon
-  int windAngleIndex = round(currentWeather.windDeg * 8 / 360);
-  if (windAngleIndex > 7) windAngleIndex = 0;
-  ui.drawBmp("/wind/" + WIND_ICON_NAMES[windAngleIndex] + ".bmp", tft.width() - 80, 125);
+  ui.drawIcon("/wind/" + inputs.windIconName + ".icon", tft.width() - 80, 125);
   // tft.drawRect(tft.width() - 80, 125, 75, 75, 0x4228);
-
-  // wind speed
-  text = String(currentWeather.windSpeed, 0);
-  if (IS_METRIC) text += " m/s";
-  else text += " mph";
-  ofr.cdrawString(text.c_str(), tft.width() - 43, 200);
+  return true;
 }
 
-void drawForecast() {
-  DayForecast* dayForecasts = calculateDayForecasts(forecasts);
+bool drawForecast() {
+  ForecastInputs inputs;
   for (int i = 0; i < NUMBER_OF_DAY_FORECASTS; i++) {
-    log_i("[%d] condition code: %d, hour: %d, temp: %.1f/%.1f", dayForecasts[i].day,
-          dayForecasts[i].conditionCode, dayForecasts[i].conditionHour, dayForecasts[i].minTemp,
-          dayForecasts[i].maxTemp);
+    if (!dayForecasts[i].valid) {
+      // no forecast for the day, its column stays empty
+      log_i("[%d] no forecast", i);
+      continue;
+    }
+    log_i("[%d] condition code: %d, hour: %d, dominant: %d, temp: %.1f/%.1f, precipitation: %.1f, "
+          "wind: %.1f", dayForecasts[i].day, dayForecasts[i].conditionCode,
+          dayForecasts[i].conditionHour, dayForecasts[i].dominantConditionCode,
+          dayForecasts[i].minTemp, dayForecasts[i].maxTemp, dayForecasts[i].precipitation,
+          dayForecasts[i].maxWindSpeed);
+    inputs.weekday[i] = WEEKDAYS_ABBR[dayForecasts[i].day];
+    inputs.temps[i] = String(dayForecasts[i].minTemp, 0) + "-" + String(dayForecasts[i].maxTemp, 0) + "°";
+    inputs.iconName[i] = getWeatherIconName(dayForecasts[i].conditionCode, false);
   }
 
+  if (!updateWidgetInputs(forecastWidget, inputs)) {
+    return false;
+  }
+  clearWidgetArea(forecastWidget.area);
+
   int widthEigth = tft.width() / 8;
   for (int i = 0; i < NUMBER_OF_DAY_FORECASTS; i++) {
+    if (inputs.iconName[i].isEmpty()) {
+      continue;
+    }
     int x = widthEigth * ((i * 2) + 1);
-    ofr.setFontSize(24);
-    ofr.cdrawString(WEEKDAYS_ABBR[dayForecasts[i].day].c_str(), x, 235);
-    ofr.setFontSize(18);
-    ofr.cdrawString(String(String(dayForecasts[i].minTemp, 0) + "-" + String(dayForecasts[i].maxTemp, 0) + "°").c_str(), x, 265);
-    ui.drawBmp("/weather-small/" + getWeatherIconName(dayForecasts[i].conditionCode, false) + ".bmp", x - 25, 295);
+    cfr.setFontSize(24);
+    cfr.cdrawString(inputs.weekday[i].c_str(), x, 235);
+    cfr.setFontSize(18);
+    cfr.cdrawString(inputs.temps[i].c_str(), x, 265);
+  }
+  // the icons go through the blit pipeline, after all text which is drawn directly
+  for (int i = 0; i < NUMBER_OF_DAY_FORECASTS; i++) {
+    if (!inputs.iconName[i].isEmpty()) {
+      ui.drawIcon("/weather-small/" + inputs.iconName[i] + ".icon", widthEigth * ((i * 2) + 1) - 25,
+                  295);
+    }
+  }
+  return true;
+}
+
+// One line per 3 hour forecast still ahead, as many as fit on the page
+void drawHourlyForecastPage() {
+  time_t now = time(nullptr);
+  const char *windUnit = IS_METRIC ? "m/s" : "mph";
+  char text[24];
+  uint16_t y = 60;
+  cfr.setFontSize(18);
+  for (uint8_t i = 0; i < forecasts.count && y + 24 <= tft.height(); i++) {
+    time_t observationTime = forecasts.observationTime[i];
+    if (observationTime + 3 * 3600 < now) {
+      continue;
+    }
+    struct tm timeinfo;
+    localtime_r(&observationTime, &timeinfo);
+    int length = snprintf(text, sizeof(text), "%s ", WEEKDAYS_ABBR[timeinfo.tm_wday].c_str());
+    strftime(text + length, sizeof(text) - length, UI_TIME_FORMAT_NO_SECONDS, &timeinfo);
+    cfr.drawString(text, 10, y);
+    snprintf(text, sizeof(text), "%.0f°", forecastTemp(forecasts, i));
+    cfr.drawString(text, 140, y);
+    snprintf(text, sizeof(text), "%.1f mm", forecasts.precipitationCenti[i] / 100.0f);
+    cfr.drawString(text, 190, y);
+    snprintf(text, sizeof(text), "%.0f %s", forecasts.windSpeedCenti[i] / 100.0f, windUnit);
+    cfr.drawString(text, 260, y);
+    y += 24;
+  }
+}
+
+// Renders one of the pages next to the dashboard into the tile renderer's frame.
+void drawPage(PageId page) {
+  TFT_eSprite &pageSprite = tileRenderer.frame();
+  pageSprite.fillSprite(TFT_BLACK);
+  cfr.setDrawer(pageSprite);
+  cfr.setFontSize(24);
+  cfr.cdrawString(PAGE_TITLES[page].c_str(), centerWidth, 10);
+  switch (page) {
+    case PAGE_HOURLY_FORECAST: drawHourlyForecastPage(); break;
+    case PAGE_ASTRO: drawAstroPage(); break;
+    case PAGE_SYSTEM_STATS: drawSystemStatsPage(); break;
+    default: break;
   }
+  cfr.setDrawer(tft);
 }
 
 void drawProgress(const char *text, int8_t percentage) {
-  ofr.setFontSize(24);
+  cfr.setFontSize(24);
   int pbWidth = tft.width() - 100;
   int pbX = (tft.width() - pbWidth)/2;
   int pbY = 260;
   int progressTextY = 210;
 
   tft.fillRect(0, progressTextY, tft.width(), 40, TFT_BLACK);
-  ofr.cdrawString(text, centerWidth, progressTextY);
+  countPixelsPushed(tft.width() * 40);
+  cfr.cdrawString(text, centerWidth, progressTextY);
   ui.drawProgressBar(pbX, pbY, pbWidth, 15, percentage, TFT_WHITE, TFT_TP_BLUE);
 }
 
+// Calls a widget's draw function and logs its render time and what it pushed to the display, if
+// anything had to be redrawn.
+bool drawProfiled(const char *name, bool (*draw)()) {
+  RenderStats before = renderStats;
+  uint32_t startMicros = micros();
+  bool drawn = draw();
+  if (drawn) {
+    log_i("%s: %luus, %d pixels in %d address windows", name, micros() - startMicros,
+          renderStats.pixels - before.pixels, renderStats.windows - before.windows);
+  }
+  return drawn;
+}
+
 void drawSeparator(uint16_t y) {
   tft.drawFastHLine(10, y, tft.width() - 2 * 15, 0x4228);
+  countPixelsPushed(tft.width() - 2 * 15);
+}
+
+// Draws the time into the fixed clock cells. If the previously drawn time is passed only the
+// cells whose character changed are repainted: the old glyph is erased by drawing it in the
+// background color, which leaves the pixels of the date line above untouched.
+// dirtyMinX/dirtyMaxX are set to the horizontal range of the sprite that changed.
+void drawClockCells(const char *previous, const char *current, int16_t &dirtyMinX,
+                    int16_t &dirtyMaxX) {
+  int16_t x = clockTimeX;
+  dirtyMinX = timeSpritePos.width;
+  dirtyMaxX = 0;
+
+  for (uint8_t i = 0; current[i] != '\0'; i++) {
+    if (current[i] == ' ') {
+      // the am/pm suffix of 12h times is drawn as a whole
+      if (previous == nullptr || strcmp(previous + i, current + i) != 0) {
+        if (previous != nullptr) {
+          clockFont.setFontColor(TFT_BLACK);
+          clockFont.drawString(previous + i, x, CLOCK_TIME_Y);
+          clockFont.setFontColor(TFT_WHITE);
+        }
+        clockFont.drawString(current + i, x, CLOCK_TIME_Y);
+        dirtyMinX = min(dirtyMinX, x);
+        dirtyMaxX = timeSpritePos.width;
+      }
+      break;
+    }
+
+    uint16_t cellWidth = current[i] == ':' ? clockSeparatorCellWidth : clockDigitCellWidth;
+    if (previous == nullptr || previous[i] != current[i]) {
+      char glyph[2] = {'\0', '\0'};
+      if (previous != nullptr) {
+        glyph[0] = previous[i];
+        clockFont.setFontColor(TFT_BLACK);
+        clockFont.cdrawString(glyph, x + cellWidth / 2, CLOCK_TIME_Y);
+        clockFont.setFontColor(TFT_WHITE);
+      }
+      glyph[0] = current[i];
+      clockFont.cdrawString(glyph, x + cellWidth / 2, CLOCK_TIME_Y);
+      // anti-aliased glyphs may bleed a little beyond their cell
+      dirtyMinX = min(dirtyMinX, (int16_t)(x - 2));
+      dirtyMaxX = max(dirtyMaxX, (int16_t)(x + cellWidth + 2));
+    }
+    x += cellWidth;
+  }
+  dirtyMinX = max(dirtyMinX, (int16_t)0);
+  dirtyMaxX = min(dirtyMaxX, (int16_t)timeSpritePos.width);
 }
 
+void drawSystemStatsPage() {
+  char line[64];
+  uint16_t y = 60;
+  cfr.setFontSize(16);
+  uint32_t uptimeMinutes = millis() / 60000;
+  snprintf(line, sizeof(line), "Uptime: %lud %luh %lumin", uptimeMinutes / 1440,
+           uptimeMinutes / 60 % 24, uptimeMinutes % 60);
+  cfr.drawString(line, 10, y);
+  snprintf(line, sizeof(line), "Heap: %lu KB free, %lu KB min, %lu KB block",
+           ESP.getFreeHeap() / 1024, ESP.getMinFreeHeap() / 1024, ESP.getMaxAllocHeap() / 1024);
+  cfr.drawString(line, 10, y += 26);
+  snprintf(line, sizeof(line), "PSRAM: %lu of %lu KB free", ESP.getFreePsram() / 1024,
+           ESP.getPsramSize() / 1024);
+  cfr.drawString(line, 10, y += 26);
+
+  y += 20;
+  snprintf(line, sizeof(line), "WiFi: %s, %d dBm", WiFi.localIP().toString().c_str(), WiFi.RSSI());
+  cfr.drawString(line, 10, y += 26);
+  snprintf(line, sizeof(line), "Connects: %lu (%lu fast), %lums avg", wifiStats.connects,
+           wifiStats.fastConnects,
+           wifiStats.connects == 0 ? 0 : wifiStats.totalConnectMillis / wifiStats.connects);
+  cfr.drawString(line, 10, y += 26);
+
+  y += 20;
+  if (weatherFetchedAt > 0) {
+    char timestamp[TIMESTAMP_SIZE];
+    snprintf(line, sizeof(line), "Weather: %s",
+             formatLocalTime(timestamp, sizeof(timestamp), SYSTEM_TIMESTAMP_FORMAT,
+                             weatherFetchedAt));
+    cfr.drawString(line, 10, y += 26);
+  }
+  snprintf(line, sizeof(line), "Glyph cache: %lu hits, %lu misses", cfr.hits(), cfr.misses());
+  cfr.drawString(line, 10, y += 26);
+  snprintf(line, sizeof(line), "Touch events dropped: %lu", touchInput.droppedEvents());
+  cfr.drawString(line, 10, y += 26);
+}
+
+// Runs every second, hence everything is formatted into fixed buffers: no heap allocations. The
+// date line is only re-rendered when it changes (midnight), of the time only the changed glyphs.
 void drawTimeAndDate() {
-  timeSprite.fillSprite(TFT_BLACK);
-  ofr.setDrawer(timeSprite);
-
-  // Date
-  ofr.setFontSize(16);
-  ofr.cdrawString(
-    String(WEEKDAYS[getCurrentWeekday()] + ", " + getCurrentTimestamp(UI_DATE_FORMAT)).c_str(),
-    centerWidth,
-    10
-  );
-
-  // Time
-  ofr.setFontSize(48);
-  // centering that string would look optically odd for 12h times -> manage pos manually
-  ofr.drawString(getCurrentTimestamp(UI_TIME_FORMAT).c_str(), timePosX, 25);
-  timeSprite.pushSprite(timeSpritePos.x, timeSpritePos.y);
+  struct tm timeinfo;
+  // nothing to show until the time has been synchronized (after a warm boot), don't wait for it
+  if (!getLocalTime(&timeinfo, 0)) {
+    return;
+  }
+
+  ClockInputs inputs;
+  int weekdayLength = snprintf(inputs.date, sizeof(inputs.date), "%s, ",
+                               WEEKDAYS[timeinfo.tm_wday].c_str());
+  strftime(inputs.date + weekdayLength, sizeof(inputs.date) - weekdayLength, UI_DATE_FORMAT,
+           &timeinfo);
+  strftime(inputs.time, sizeof(inputs.time), UI_TIME_FORMAT, &timeinfo);
+  inputs.stale = isWeatherStale();
+
+  ClockInputs &previous = clockWidget.inputs;
+  bool fullRedraw = !clockWidget.drawn || inputs.stale != previous.stale ||
+                    strlen(inputs.time) != strlen(previous.time);
+  if (!fullRedraw && inputs == previous) {
+    return;
+  }
+
+  cfr.setDrawer(timeSprite);
+  int16_t dirtyMinX, dirtyMaxX;
+  if (fullRedraw) {
+    timeSprite.fillSprite(TFT_BLACK);
+
+    cfr.setFontSize(16);
+    cfr.cdrawString(inputs.date, centerWidth, CLOCK_DATE_Y);
+    drawClockCells(nullptr, inputs.time, dirtyMinX, dirtyMaxX);
+
+    // staleness indicator: the weather shown is from a previous run or hasn't been updated for long
+    if (inputs.stale) {
+      timeSprite.fillCircle(timeSpritePos.width - 10, 10, 4, TFT_ORANGE);
+    }
+    timeSprite.pushSprite(timeSpritePos.x, timeSpritePos.y);
+    countPixelsPushed(timeSpritePos.width * timeSpritePos.height);
+  } else {
+    bool dateChanged = strcmp(inputs.date, previous.date) != 0;
+    if (dateChanged) {
+      cfr.setFontSize(16);
+      cfr.setFontColor(TFT_BLACK);
+      cfr.cdrawString(previous.date, centerWidth, CLOCK_DATE_Y);
+      cfr.setFontColor(TFT_WHITE);
+      cfr.cdrawString(inputs.date, centerWidth, CLOCK_DATE_Y);
+    }
+    drawClockCells(previous.time, inputs.time, dirtyMinX, dirtyMaxX);
+
+    if (dateChanged) {
+      timeSprite.pushSprite(timeSpritePos.x, timeSpritePos.y);
+      countPixelsPushed(timeSpritePos.width * timeSpritePos.height);
+    } else if (dirtyMaxX > dirtyMinX) {
+      timeSprite.pushSprite(timeSpritePos.x + dirtyMinX, timeSpritePos.y, dirtyMinX, 0,
+                            dirtyMaxX - dirtyMinX, timeSpritePos.height);
+      countPixelsPushed((dirtyMaxX - dirtyMinX) * timeSpritePos.height);
+    }
+  }
+
+  clockWidget.inputs = inputs;
+  clockWidget.drawn = true;
 
   // set the drawer back since we temporarily changed it to the time sprite above
-  ofr.setDrawer(tft);
+  cfr.setDrawer(tft);
 }
 
 String getWeatherIconName(uint16_t id, bool today) {
@@ -291,94 +716,280 @@ String getWeatherIconName(uint16_t id, bool today) {
   return "unknown";
 }
 
-void initJpegDecoder() {
-    // The JPEG image can be scaled by a factor of 1, 2, 4, or 8 (default: 0)
-  TJpgDec.setJpgScale(1);
-  // The decoder must be given the exact name of the rendering function
-  TJpgDec.setCallback(pushImageToTft);
+// Swiping left and right moves between the pages.
+void handleGesture(const Gesture &gesture) {
+  uint32_t latencyMillis = millis() - gesture.timeMillis;
+  if (latencyMillis > gestureRecognizer.config().latencyBudgetMillis) {
+    log_w("Gesture %d handled %lums late, budget is %dms.", gesture.type, latencyMillis,
+          gestureRecognizer.config().latencyBudgetMillis);
+  }
+  log_i("Gesture %d at x=%d, y=%d (dx=%d, dy=%d, scale=%.2f)", gesture.type, gesture.x, gesture.y,
+        gesture.dx, gesture.dy, gesture.scale);
+
+  if (gesture.type == GESTURE_SWIPE_LEFT && currentPage + 1 < NUMBER_OF_PAGES) {
+    showPage((PageId)(currentPage + 1));
+  } else if (gesture.type == GESTURE_SWIPE_RIGHT && currentPage > PAGE_DASHBOARD) {
+    showPage((PageId)(currentPage - 1));
+  }
+}
+
+// Each time character gets a fixed-width cell so that a clock tick only has to repaint the cells
+// whose character changed. The am/pm suffix of 12h times follows with its proportional advances.
+// The cell padding shrinks until the widest possible time fits the sprite, then it's centered.
+void initClockLayout() {
+  clockFont.setFont(CLOCK_FONT_48);
+  clockFont.setDrawer(timeSprite);
+  clockFont.setFontColor(TFT_WHITE);
+  clockFont.setBackgroundColor(TFT_BLACK);
+  uint16_t widestDigit = 0;
+  for (char digit = '0'; digit <= '9'; digit++) {
+    widestDigit = max(widestDigit, (uint16_t)clockFont.advance(digit));
+  }
+
+  // count the cells and measure the widest suffix in the times of midnight and noon
+  uint8_t digits = 0, separators = 0;
+  uint16_t suffixWidth = 0;
+  for (int hour : {0, 12}) {
+    struct tm timeinfo = {};
+    timeinfo.tm_hour = hour;
+    char time[TIMESTAMP_SIZE];
+    strftime(time, sizeof(time), UI_TIME_FORMAT, &timeinfo);
+    const char *suffix = strchr(time, ' ');
+    uint16_t width = 0;
+    for (uint8_t i = 0; suffix != nullptr && suffix[i] != '\0'; i++) {
+      width += clockFont.advance(suffix[i]);
+    }
+    suffixWidth = max(suffixWidth, width);
+    digits = separators = 0;
+    for (uint8_t i = 0; time + i != suffix && time[i] != '\0'; i++) {
+      if (time[i] == ':') {
+        separators++;
+      } else {
+        digits++;
+      }
+    }
+  }
+
+  uint8_t digitPadding = 2, separatorPadding = 6;
+  uint16_t width;
+  while (true) {
+    clockDigitCellWidth = widestDigit + digitPadding;
+    clockSeparatorCellWidth = clockFont.advance(':') + separatorPadding;
+    width = digits * clockDigitCellWidth + separators * clockSeparatorCellWidth + suffixWidth;
+    if (width <= timeSpritePos.width || digitPadding + separatorPadding == 0) {
+      break;
+    }
+    if (separatorPadding > 0) {
+      separatorPadding--;
+    } else {
+      digitPadding--;
+    }
+  }
+  if (width > timeSpritePos.width) {
+    log_w("The time is %dpx wide, more than the %dpx of the clock.", width, timeSpritePos.width);
+  }
+  clockTimeX = max(0, (timeSpritePos.width - width) / 2);
+  log_i("Clock cells: %d digits of %dpx, %d separators of %dpx, %dpx suffix from x %d.", digits,
+        clockDigitCellWidth, separators, clockSeparatorCellWidth, suffixWidth, clockTimeX);
 }
 
 void initOpenFontRender() {
-  ofr.loadFont(opensans, sizeof(opensans));
-  ofr.setDrawer(tft);
-  ofr.setFontColor(TFT_WHITE);
-  ofr.setBackgroundColor(TFT_BLACK);
+  uint32_t startMicros = micros();
+  cfr.loadFont(opensans, sizeof(opensans));
+  log_i("Loaded the %d byte font in %luus.", sizeof(opensans), micros() - startMicros);
+  cfr.setBudget(GLYPH_CACHE_BUDGET_BYTES);
+  cfr.setDrawer(tft);
+  cfr.setFontColor(TFT_WHITE);
+  cfr.setBackgroundColor(TFT_BLACK);
 }
 
-// Function will be called as a callback during decoding of a JPEG file to
-// render each block to the TFT.
-bool pushImageToTft(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *bitmap) {
-  // Stop further decoding as image is running off bottom of screen
-  if (y >= tft.height()) {
-    return 0;
+// Both full screen sprites go to PSRAM, they are only created once the user navigates.
+bool initPageSprites() {
+  if (dashboardSprite.created()) {
+    return true;
   }
+  if (!tileRenderer.begin() ||
+      dashboardSprite.createSprite(tft.width(), tft.height()) == nullptr) {
+    log_e("Not enough memory for the page sprites.");
+    return false;
+  }
+  return true;
+}
 
-  // Automatically clips the image block rendering at the TFT boundaries.
-  tft.pushImage(x, y, w, h, bitmap);
+bool isWeatherStale() {
+  return weatherFromFile || time(nullptr) - weatherFetchedAt > WEATHER_STALE_AFTER_MINUTES * 60;
+}
 
-  // Return 1 to decode next block
-  return 1;
+// Replaces the current page by wiping the new one in from the side the swipe came from.
+void showPage(PageId page) {
+  if (page == currentPage || !dashboardDrawn || !initPageSprites()) {
+    return;
+  }
+  bool fromRight = page > currentPage;
+  uint32_t startMicros = micros();
+  takeRenderStats();
+  if (currentPage == PAGE_DASHBOARD) {
+    clockTask.disable();
+    // a single read of the whole screen, readRect() delivers the byte order sprites use
+    tft.readRect(0, 0, tft.width(), tft.height(), (uint16_t *)dashboardSprite.getPointer());
+  }
+  currentPage = page;
+
+  if (page == PAGE_DASHBOARD) {
+    wipePage(&dashboardSprite, fromRight);
+    tileRenderer.invalidate();
+  } else {
+    drawPage(page);
+    wipePage(&tileRenderer.frame(), fromRight);
+    tileRenderer.assume();
+  }
+  RenderStats stats = takeRenderStats();
+  log_i("Page %d shown in %luus, %d pixels in %d address windows.", page, micros() - startMicros,
+        stats.pixels, stats.windows);
+
+  if (page == PAGE_DASHBOARD) {
+    // bring the clock and whatever changed in the meantime up to date
+    repaint();
+    clockTask.enable();
+  }
 }
 
+// SNTP runs since setup(), this only waits for it until the time is known.
 void syncTime() {
-  if (initTime()) {
+  if (waitForTime()) {
     lastTimeSyncMillis = millis();
-    setTimezone(TIMEZONE);
-    log_i("Current local time: %s", getCurrentTimestamp(SYSTEM_TIMESTAMP_FORMAT).c_str());
   }
 }
 
-void repaint() {
-  tft.fillScreen(TFT_BLACK);
-  ui.drawLogo();
-
-  ofr.setFontSize(16);
-  ofr.cdrawString(APP_NAME, centerWidth, tft.height() - 50);
-  ofr.cdrawString(VERSION, centerWidth, tft.height() - 30);
+// Renders the current page again when new weather arrived and pushes the tiles that changed.
+void refreshPage() {
+  drawPage(currentPage);
+  TileStats stats = tileRenderer.push();
+  log_d("Page %d refreshed, %d tiles pushed, %d skipped.", currentPage, stats.pushed,
+        stats.skipped);
+}
 
-  drawProgress("Starting WiFi...", 10);
-  if (WiFi.status() != WL_CONNECTED) {
-    startWiFi();
+void repaint() {
+  // only count what this repaint sends to the display
+  takeRenderStats();
+  if (!dashboardDrawn) {
+    tft.fillScreen(TFT_BLACK);
+    countPixelsPushed(tft.width() * tft.height());
+    drawSeparator(90);
+    drawSeparator(230);
+    drawSeparator(355);
+    dashboardDrawn = true;
+    clockTask.enable();
   }
 
-  drawProgress("Synchronizing time...", 30);
-  syncTime();
-
-  updateData(true);
-
-  drawProgress("Ready", 100);
-  lastUpdateMillis = millis();
+  drawProfiled("Clock", []() {
+    drawTimeAndDate();
+    return true;
+  });
+
+  uint8_t widgetsRedrawn = 0;
+  if (drawProfiled("Current weather", drawCurrentWeather)) widgetsRedrawn++;
+  if (drawProfiled("Forecast", drawForecast)) widgetsRedrawn++;
+  if (drawProfiled("Astro", drawAstro)) widgetsRedrawn++;
+  // a single wait for the icons of all widgets
+  blitPipeline.flush();
+  RenderStats stats = takeRenderStats();
+  log_i("Redrew %d of 3 weather widgets, pushed %d pixels in %d address windows.", widgetsRedrawn,
+        stats.pixels, stats.windows);
+
+  ui.logIconCacheStats();
+  cfr.logStats();
+  clockFont.logStats();
+}
 
-  tft.fillScreen(TFT_BLACK);
+const char *fetchResultName(FetchResult result) {
+  switch (result) {
+    case FETCH_UPDATED:
+      return "updated";
+    case FETCH_UNCHANGED:
+      return "unchanged";
+    default:
+      return "failed";
+  }
+}
 
-  drawTimeAndDate();
-  drawSeparator(90);
+// FETCH_FAILED if either of the two fetches failed, the snapshot must not be used then.
+// FETCH_UNCHANGED if neither of them brought new data.
+FetchResult updateData(WeatherSnapshot *snapshot) {
+  log_i("Memory before the weather update:");
+  logMemoryStats();
+  weatherTaskStatus = UPDATING_WEATHER;
+  FetchResult currentResult = weatherClient.updateCurrentById(
+      &snapshot->currentWeather, OPEN_WEATHER_MAP_API_KEY, OPEN_WEATHER_MAP_LOCATION_ID);
+  log_i("Current weather %s in %s: %s, %.1f°", fetchResultName(currentResult),
+        snapshot->currentWeather.cityName, snapshot->currentWeather.description,
+        snapshot->currentWeather.feelsLike);
+
+  weatherTaskStatus = UPDATING_FORECAST;
+  FetchResult forecastResult = weatherClient.updateForecastsById(
+      &snapshot->forecasts, OPEN_WEATHER_MAP_API_KEY, OPEN_WEATHER_MAP_LOCATION_ID);
+  log_i("Forecasts %s, %d stored in %d bytes.", fetchResultName(forecastResult),
+        snapshot->forecasts.count, sizeof(ForecastStore));
+  if (currentResult == FETCH_FAILED || forecastResult == FETCH_FAILED) {
+    return FETCH_FAILED;
+  }
 
-  drawCurrentWeather();
-  drawSeparator(230);
+  // the days shift at midnight even if the forecasts didn't change
+  uint8_t days = calculateDayForecasts(snapshot->forecasts, time(nullptr), snapshot->dayForecasts,
+                                       NUMBER_OF_DAY_FORECASTS);
+  log_i("Forecasts found for %d of %d days.", days, NUMBER_OF_DAY_FORECASTS);
+  snapshot->fetchedAt = time(nullptr);
+  log_i("Memory after the weather update:");
+  logMemoryStats();
+  return currentResult == FETCH_UNCHANGED && forecastResult == FETCH_UNCHANGED ? FETCH_UNCHANGED
+                                                                              : FETCH_UPDATED;
+}
 
-  drawForecast();
-  drawSeparator(355);
+void weatherTask(void *parameter) {
+  uint32_t retryMillis = WEATHER_RETRY_MIN_BACKOFF_MILLIS;
+  while (true) {
+    if (isReusedLeaseExpiring()) {
+      log_i("The reused DHCP lease runs out, renewing it.");
+      WiFi.disconnect();
+    }
+    if (WiFi.status() != WL_CONNECTED) {
+      weatherTaskStatus = STARTING_WIFI;
+      if (!startWiFi()) {
+        // the UI keeps the previous weather meanwhile
+        vTaskDelay(pdMS_TO_TICKS(WIFI_MAX_BACKOFF_MILLIS));
+        continue;
+      }
+    }
 
-  drawAstro();
-}
+    weatherTaskStatus = SYNCHRONIZING_TIME;
+    syncTime();
+    if (lastTimeSyncMillis == 0) {
+      // the dashboard is useless without proper time, retry right away
+      continue;
+    }
 
-void updateData(boolean updateProgressBar) {
-  if(updateProgressBar) drawProgress("Updating weather...", 70);
-  OpenWeatherMapCurrent *currentWeatherClient = new OpenWeatherMapCurrent();
-  currentWeatherClient->setMetric(IS_METRIC);
-  currentWeatherClient->setLanguage(OPEN_WEATHER_MAP_LANGUAGE);
-  currentWeatherClient->updateCurrentById(&currentWeather, OPEN_WEATHER_MAP_API_KEY, OPEN_WEATHER_MAP_LOCATION_ID);
-  delete currentWeatherClient;
-  currentWeatherClient = nullptr;
-  log_i("Current weather in %s: %s, %.1f°", currentWeather.cityName.c_str(), currentWeather.description.c_str(), currentWeather.feelsLike);
+    // the back slot isn't published unless the update succeeded, the UI keeps the previous one
+    WeatherSnapshot &snapshot = weatherSnapshots.back();
+    switch (updateData(&snapshot)) {
+      case FETCH_UPDATED:
+        saveWeatherSnapshot(&snapshot);
+        break;
+      case FETCH_UNCHANGED:
+        // the saved snapshot still has the same weather, spare the flash
+        break;
+      default:
+        log_e("Weather update failed, keeping the previous weather. Retrying in %ds.",
+              retryMillis / 1000);
+        vTaskDelay(pdMS_TO_TICKS(retryMillis));
+        retryMillis = min(retryMillis * 2, (uint32_t)updateIntervalMillis);
+        continue;
+    }
+    // published even if unchanged, the day forecasts shift at midnight
+    weatherSnapshots.publish();
+    lastUpdateMillis = millis();
+    weatherTaskStatus = WEATHER_READY;
+    retryMillis = WEATHER_RETRY_MIN_BACKOFF_MILLIS;
 
-  if(updateProgressBar) drawProgress("Updating forecast...", 90);
-  OpenWeatherMapForecast *forecastClient = new OpenWeatherMapForecast();
-  forecastClient->setMetric(IS_METRIC);
-  forecastClient->setLanguage(OPEN_WEATHER_MAP_LANGUAGE);
-  forecastClient->setAllowedHours(forecastHoursUtc, sizeof(forecastHoursUtc));
-  forecastClient->updateForecastsById(forecasts, OPEN_WEATHER_MAP_API_KEY, OPEN_WEATHER_MAP_LOCATION_ID, NUMBER_OF_FORECASTS);
-  delete forecastClient;
-  forecastClient = nullptr;
+    vTaskDelay(pdMS_TO_TICKS(updateIntervalMillis));
+  }
 }
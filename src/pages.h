@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <TFT_eSPI.h>
+
+#include "RenderStats.h"
+
+// number of column strips a page is revealed in
+#define PAGE_WIPE_STEPS 8
+
+// In swipe order, swiping left shows the next page
+typedef enum PageId {
+  PAGE_DASHBOARD,
+  PAGE_HOURLY_FORECAST,
+  PAGE_ASTRO,
+  PAGE_SYSTEM_STATS,
+  NUMBER_OF_PAGES
+} PageId;
+
+/**
+ * Reveals a pre-rendered full screen page strip by strip, starting at the right edge if fromRight.
+ * Each pixel is pushed exactly once, so the transition costs no more than pushing the page in one
+ * go; the old page is never cleared.
+ */
+void wipePage(TFT_eSprite *page, bool fromRight) {
+  int16_t width = page->width();
+  int16_t height = page->height();
+  for (uint8_t step = 0; step < PAGE_WIPE_STEPS; step++) {
+    int16_t stripStart = width * step / PAGE_WIPE_STEPS;
+    int16_t stripWidth = width * (step + 1) / PAGE_WIPE_STEPS - stripStart;
+    int16_t x = fromRight ? width - stripStart - stripWidth : stripStart;
+    page->pushSprite(x, 0, x, 0, stripWidth, height);
+    countPixelsPushed(stripWidth * height);
+  }
+}
@@ -5,6 +5,19 @@
 
 #include <LittleFS.h>
 
+#include "weather.h"
+
+#define WEATHER_SNAPSHOT_FILE "/weather-snapshot.bin"
+#define WEATHER_SNAPSHOT_TMP_FILE "/weather-snapshot.tmp"
+// the previous snapshot while the new one is moved into place
+#define WEATHER_SNAPSHOT_BACKUP_FILE "/weather-snapshot.bak"
+// "TPWS" read as little-endian uint32
+#define WEATHER_SNAPSHOT_MAGIC 0x53575054
+// Bump whenever the layout written by saveWeatherSnapshot() changes. Only the current version is
+// read, versions 1 and 2 never left development builds; an older snapshot is dropped and the
+// weather fetched again.
+#define WEATHER_SNAPSHOT_VERSION 3
+
 void listFiles();
 
 void initFileSystem() {
@@ -30,3 +43,237 @@ void listFiles() {
     entry.close();
   }
 }
+
+template <typename T> bool writeValue(File &file, T value) {
+  return file.write((const uint8_t *)&value, sizeof(T)) == sizeof(T);
+}
+
+bool writeBytes(File &file, const void *data, size_t size) {
+  return file.write((const uint8_t *)data, size) == size;
+}
+
+template <typename T> bool readValue(File &file, T &value) {
+  return file.read((uint8_t *)&value, sizeof(T)) == sizeof(T);
+}
+
+// Strings are stored as 1 byte length followed by the (UTF-8) characters w/o terminating null
+bool writeString(File &file, const char *value) {
+  uint8_t length = min(strlen(value), (size_t)UINT8_MAX);
+  return writeValue(file, length) && writeBytes(file, value, length);
+}
+
+// Reads into a buffer of the given size, longer strings are truncated
+bool readString(File &file, char *value, size_t size) {
+  uint8_t length;
+  char buffer[UINT8_MAX + 1];
+  if (!readValue(file, length) || file.read((uint8_t *)buffer, length) != length) {
+    return false;
+  }
+  buffer[length] = '\0';
+  strlcpy(value, buffer, size);
+  return true;
+}
+
+/**
+ * Layout (version 3), all numbers little-endian:
+ * - header: magic, uint16 version, int64 fetchedAt
+ * - current weather: lat, lon, temp, feelsLike, windSpeed, windDeg as float; weatherId, pressure as
+ *   uint16; humidity as uint8; observationTime, sunrise, sunset as uint32; description, cityName
+ *   as strings
+ * - uint8 number of forecasts n, then n x observationTime as uint32, n x temp in 1/100 degrees as
+ *   int16, n x weatherId, n x windSpeed, n x precipitation (both 1/100 units) as uint16
+ * - uint8 number of day forecasts, each: minTemp, maxTemp as float; conditionCode as uint16;
+ *   conditionHour, day as uint8; precipitation, maxWindSpeed as float; dominantConditionCode as
+ *   uint16
+ */
+bool writeWeatherSnapshot(File &file, const WeatherSnapshot *snapshot) {
+  bool ok = writeValue(file, (uint32_t)WEATHER_SNAPSHOT_MAGIC) &&
+            writeValue(file, (uint16_t)WEATHER_SNAPSHOT_VERSION) &&
+            writeValue(file, (int64_t)snapshot->fetchedAt);
+
+  const CurrentWeatherData &current = snapshot->currentWeather;
+  ok = ok && writeValue(file, current.lat) && writeValue(file, current.lon) &&
+       writeValue(file, current.temp) && writeValue(file, current.feelsLike) &&
+       writeValue(file, current.windSpeed) && writeValue(file, current.windDeg) &&
+       writeValue(file, current.weatherId) && writeValue(file, current.pressure) &&
+       writeValue(file, current.humidity) && writeValue(file, current.observationTime) &&
+       writeValue(file, current.sunrise) && writeValue(file, current.sunset) &&
+       writeString(file, current.description) && writeString(file, current.cityName);
+
+  const ForecastStore &forecasts = snapshot->forecasts;
+  uint8_t n = forecasts.count;
+  ok = ok && writeValue(file, n) &&
+       writeBytes(file, forecasts.observationTime, n * sizeof(uint32_t)) &&
+       writeBytes(file, forecasts.tempCenti, n * sizeof(int16_t)) &&
+       writeBytes(file, forecasts.weatherId, n * sizeof(uint16_t)) &&
+       writeBytes(file, forecasts.windSpeedCenti, n * sizeof(uint16_t)) &&
+       writeBytes(file, forecasts.precipitationCenti, n * sizeof(uint16_t));
+
+  ok = ok && writeValue(file, (uint8_t)NUMBER_OF_DAY_FORECASTS);
+  for (uint8_t i = 0; ok && i < NUMBER_OF_DAY_FORECASTS; i++) {
+    const DayForecast &dayForecast = snapshot->dayForecasts[i];
+    ok = writeValue(file, dayForecast.minTemp) && writeValue(file, dayForecast.maxTemp) &&
+         writeValue(file, (uint16_t)dayForecast.conditionCode) &&
+         writeValue(file, (uint8_t)dayForecast.conditionHour) &&
+         writeValue(file, (uint8_t)dayForecast.day) &&
+         writeValue(file, dayForecast.precipitation) &&
+         writeValue(file, dayForecast.maxWindSpeed) &&
+         writeValue(file, (uint16_t)dayForecast.dominantConditionCode);
+  }
+  return ok;
+}
+
+// The new snapshot is written to a temporary file first and the previous one only renamed to a
+// backup, so neither a reset nor a full flash can leave the device without a snapshot. If writing
+// fails the previous snapshot stays.
+bool saveWeatherSnapshot(const WeatherSnapshot *snapshot) {
+  uint32_t startMillis = millis();
+  File file = LittleFS.open(WEATHER_SNAPSHOT_TMP_FILE, "w");
+  if (!file) {
+    log_e("Failed to open %s for writing.", WEATHER_SNAPSHOT_TMP_FILE);
+    return false;
+  }
+  bool written = writeWeatherSnapshot(file, snapshot);
+  file.close();
+  if (!written) {
+    log_e("Failed to write %s, keeping the previous snapshot.", WEATHER_SNAPSHOT_TMP_FILE);
+    LittleFS.remove(WEATHER_SNAPSHOT_TMP_FILE);
+    return false;
+  }
+
+  LittleFS.remove(WEATHER_SNAPSHOT_BACKUP_FILE);
+  bool hadSnapshot = LittleFS.exists(WEATHER_SNAPSHOT_FILE);
+  if (hadSnapshot && !LittleFS.rename(WEATHER_SNAPSHOT_FILE, WEATHER_SNAPSHOT_BACKUP_FILE)) {
+    log_e("Failed to rename %s.", WEATHER_SNAPSHOT_FILE);
+    LittleFS.remove(WEATHER_SNAPSHOT_TMP_FILE);
+    return false;
+  }
+  if (!LittleFS.rename(WEATHER_SNAPSHOT_TMP_FILE, WEATHER_SNAPSHOT_FILE)) {
+    log_e("Failed to rename %s.", WEATHER_SNAPSHOT_TMP_FILE);
+    LittleFS.remove(WEATHER_SNAPSHOT_TMP_FILE);
+    if (hadSnapshot) {
+      LittleFS.rename(WEATHER_SNAPSHOT_BACKUP_FILE, WEATHER_SNAPSHOT_FILE);
+    }
+    return false;
+  }
+  LittleFS.remove(WEATHER_SNAPSHOT_BACKUP_FILE);
+  log_i("Saved weather snapshot in %lums.", millis() - startMillis);
+  return true;
+}
+
+bool readCurrentWeather(File &file, WeatherSnapshot *snapshot) {
+  int64_t fetchedAt;
+  CurrentWeatherData &current = snapshot->currentWeather;
+  bool ok = readValue(file, fetchedAt) && readValue(file, current.lat) &&
+            readValue(file, current.lon) && readValue(file, current.temp) &&
+            readValue(file, current.feelsLike) && readValue(file, current.windSpeed) &&
+            readValue(file, current.windDeg) && readValue(file, current.weatherId) &&
+            readValue(file, current.pressure) && readValue(file, current.humidity) &&
+            readValue(file, current.observationTime) && readValue(file, current.sunrise) &&
+            readValue(file, current.sunset) &&
+            readString(file, current.description, sizeof(current.description)) &&
+            readString(file, current.cityName, sizeof(current.cityName));
+  snapshot->fetchedAt = fetchedAt;
+  return ok;
+}
+
+bool readDayForecasts(File &file, WeatherSnapshot *snapshot) {
+  uint8_t numberOfDayForecasts;
+  if (!readValue(file, numberOfDayForecasts)) {
+    return false;
+  }
+  // files written with fewer days leave the rest empty
+  for (uint8_t i = numberOfDayForecasts; i < NUMBER_OF_DAY_FORECASTS; i++) {
+    snapshot->dayForecasts[i].valid = false;
+  }
+  for (uint8_t i = 0; i < numberOfDayForecasts; i++) {
+    DayForecast dayForecast;
+    uint16_t conditionCode, dominantConditionCode;
+    uint8_t conditionHour, day;
+    if (!readValue(file, dayForecast.minTemp) || !readValue(file, dayForecast.maxTemp) ||
+        !readValue(file, conditionCode) || !readValue(file, conditionHour) ||
+        !readValue(file, day) || !readValue(file, dayForecast.precipitation) ||
+        !readValue(file, dayForecast.maxWindSpeed) || !readValue(file, dominantConditionCode)) {
+      return false;
+    }
+    dayForecast.conditionCode = conditionCode;
+    dayForecast.conditionHour = conditionHour;
+    dayForecast.day = day;
+    dayForecast.dominantConditionCode = dominantConditionCode;
+    // not stored, a day without forecasts keeps the min and max temp it started with
+    dayForecast.valid = dayForecast.minTemp <= dayForecast.maxTemp;
+    // tolerate files written with a different NUMBER_OF_DAY_FORECASTS
+    if (i < NUMBER_OF_DAY_FORECASTS) {
+      snapshot->dayForecasts[i] = dayForecast;
+    }
+  }
+  return true;
+}
+
+// Reads a column of a forecast store written with stored entries, of which the first count are
+// kept.
+bool readForecastColumn(File &file, void *column, size_t elementSize, uint8_t stored,
+                        uint8_t count) {
+  return file.read((uint8_t *)column, count * elementSize) == count * elementSize &&
+         file.seek((stored - count) * elementSize, SeekCur);
+}
+
+bool readForecasts(File &file, WeatherSnapshot *snapshot) {
+  uint8_t n;
+  if (!readValue(file, n)) {
+    return false;
+  }
+  // tolerate files written with a different NUMBER_OF_FORECASTS
+  ForecastStore &forecasts = snapshot->forecasts;
+  memset(&forecasts, 0, sizeof(ForecastStore));
+  uint8_t count = min(n, (uint8_t)NUMBER_OF_FORECASTS);
+  forecasts.count = count;
+  return readForecastColumn(file, forecasts.observationTime, sizeof(uint32_t), n, count) &&
+         readForecastColumn(file, forecasts.tempCenti, sizeof(int16_t), n, count) &&
+         readForecastColumn(file, forecasts.weatherId, sizeof(uint16_t), n, count) &&
+         readForecastColumn(file, forecasts.windSpeedCenti, sizeof(uint16_t), n, count) &&
+         readForecastColumn(file, forecasts.precipitationCenti, sizeof(uint16_t), n, count);
+}
+
+bool readWeatherSnapshot(const char *path, WeatherSnapshot *snapshot) {
+  uint32_t startMillis = millis();
+  File file = LittleFS.open(path, "r");
+  if (!file) {
+    return false;
+  }
+
+  uint32_t magic;
+  uint16_t version;
+  bool ok = readValue(file, magic) && magic == WEATHER_SNAPSHOT_MAGIC && readValue(file, version);
+  if (ok && version != WEATHER_SNAPSHOT_VERSION) {
+    log_w("Weather snapshot version %d not supported.", version);
+    ok = false;
+  }
+  ok = ok && readCurrentWeather(file, snapshot) && readForecasts(file, snapshot) &&
+       readDayForecasts(file, snapshot);
+  file.close();
+
+  if (ok) {
+    log_i("Loaded %s in %lums.", path, millis() - startMillis);
+  } else {
+    log_e("%s is corrupt or not supported, ignoring it.", path);
+  }
+  return ok;
+}
+
+// Falls back to the backup if a reset hit saveWeatherSnapshot() between its two renames or the
+// snapshot can't be read.
+bool loadWeatherSnapshot(WeatherSnapshot *snapshot) {
+  bool hasSnapshot = LittleFS.exists(WEATHER_SNAPSHOT_FILE);
+  if (hasSnapshot && readWeatherSnapshot(WEATHER_SNAPSHOT_FILE, snapshot)) {
+    return true;
+  }
+  if (LittleFS.exists(WEATHER_SNAPSHOT_BACKUP_FILE)) {
+    log_w("No readable weather snapshot, reading the backup.");
+    return readWeatherSnapshot(WEATHER_SNAPSHOT_BACKUP_FILE, snapshot);
+  }
+  if (!hasSnapshot) {
+    log_i("No weather snapshot found.");
+  }
+  return false;
+}
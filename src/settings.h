@@ -16,11 +16,36 @@
 // WiFi
 const char *SSID = "yourssid";
 const char *WIFI_PWD = "yourpassw0rd";
+// uncomment for a static IP config instead of DHCP
+// #define WIFI_STATIC_IP "192.168.1.50"
+// #define WIFI_GATEWAY "192.168.1.1"
+// #define WIFI_SUBNET "255.255.255.0"
+// #define WIFI_DNS "192.168.1.1"
+// connecting to the access point of the last connect directly, before falling back to a scan
+#define WIFI_FAST_CONNECT_TIMEOUT_MILLIS 3000
+// per attempt after that; failed attempts are retried with a backoff doubling up to the max
+#define WIFI_CONNECT_TIMEOUT_MILLIS 15000
+#define WIFI_MIN_BACKOFF_MILLIS 1000
+#define WIFI_MAX_BACKOFF_MILLIS 60000
+// after this many failed attempts startWiFi() gives up, weatherTask tries again later
+#define WIFI_CONNECT_ATTEMPTS 5
+// the DHCP lease time of your router; an older cached lease is renewed through DHCP on connect
+#define WIFI_DHCP_LEASE_MINUTES 60
+// A cached lease is reused only with at least this much of it left, and renewed through DHCP once
+// it gets there; weatherTask checks it before each update.
+#define WIFI_LEASE_MARGIN_MINUTES (2 * UPDATE_INTERVAL_MINUTES)
 
 // timezone Europe/Zurich as per https://github.com/nayarsystems/posix_tz_db/blob/master/zones.csv
 #define TIMEZONE "CET-1CEST,M3.5.0,M10.5.0/3"
 
 #define UPDATE_INTERVAL_MINUTES 10
+// the 5 day / 3 hour forecast changes far less often than the current weather, it's only
+// downloaded again after this interval or once its first entry has passed
+#define FORECAST_UPDATE_INTERVAL_MINUTES 60
+// a failed update is retried after this, doubling up to the update interval
+#define WEATHER_RETRY_MIN_BACKOFF_MILLIS 30000
+// weather data older than this is flagged as stale on the dashboard
+#define WEATHER_STALE_AFTER_MINUTES (3 * UPDATE_INTERVAL_MINUTES)
 
 // uncomment to get "08/23/2022 02:55:02 pm" instead of "23.08.2022 14:55:02"
 // #define DATE_TIME_FORMAT_US
@@ -60,12 +85,33 @@ typedef struct RectangleDef {
 typedef struct DayForecast {
   float minTemp;
   float maxTemp;
+  // condition of the forecast closest to 12 noon and its local hour
   int conditionCode;
   int conditionHour;
+  // weekday, 0 = Sunday
   int day;
+  // sum of rain and snow in mm
+  float precipitation;
+  float maxWindSpeed;
+  // condition with the most votes, forecasts between 6 and 18 o'clock count double
+  int dominantConditionCode;
+  // false if there was no forecast for the day, the other fields are meaningless then
+  bool valid;
 } DayForecast;
 
 RectangleDef timeSpritePos = {0, 0, 320, 88};
+// y position of the date line and the time within the time sprite
+#define CLOCK_DATE_Y 10
+#define CLOCK_TIME_Y 25
+// dashboard widget areas between the separators, cleared before a widget is redrawn
+RectangleDef currentWeatherPos = {0, 91, 320, 139};
+RectangleDef forecastPos = {0, 231, 320, 124};
+RectangleDef astroPos = {0, 356, 320, 124};
+
+// PSRAM the decoded weather, wind and moon icons may occupy; 0 disables the icon cache
+#define ICON_CACHE_BUDGET_BYTES (256 * 1024)
+// PSRAM the anti-aliased glyph masks of all font sizes may occupy; 0 disables the glyph cache
+#define GLYPH_CACHE_BUDGET_BYTES (64 * 1024)
 
 const String WIND_ICON_NAMES[] = {"N", "NE", "E", "SE", "S", "SW", "W", "NW"};
 
@@ -84,6 +130,8 @@ const uint8_t NUMBER_OF_MOON_IMAGES = 32;
 #define TOUCH_SENSITIVITY 40
 #define TOUCH_SDA 23
 #define TOUCH_SCL 22
+// GPIO the FT6236 INT line is wired to, -1 if it isn't connected (the panel is polled then)
+#define TOUCH_INT -1
 // Initial LCD Backlight brightness
 #define TFT_LED_BRIGHTNESS 200
 
@@ -92,13 +140,11 @@ const uint8_t NUMBER_OF_MOON_IMAGES = 32;
 
 // format specifiers: https://cplusplus.com/reference/ctime/strftime/
 #ifdef DATE_TIME_FORMAT_US
-  int timePosX = 29;
   #define UI_DATE_FORMAT "%m/%d/%Y"
   #define UI_TIME_FORMAT "%I:%M:%S %P"
   #define UI_TIME_FORMAT_NO_SECONDS "%I:%M %P"
   #define UI_TIMESTAMP_FORMAT (UI_DATE_FORMAT + " " + UI_TIME_FORMAT)
 #else
-  int timePosX = 68;
   #define UI_DATE_FORMAT "%d.%m.%Y"
   #define UI_TIME_FORMAT "%H:%M:%S"
   #define UI_TIME_FORMAT_NO_SECONDS "%H:%M"
@@ -109,9 +155,11 @@ const uint8_t NUMBER_OF_MOON_IMAGES = 32;
 
 // every 3h (UTC), we need all to be able to calculate daily min/max temperatures
 const uint8_t forecastHoursUtc[] = {0, 3, 6, 9, 12, 15, 18, 21};
-// 5 day / 3 hour forecast data => 8 forecasts/day => 40 total
-#define NUMBER_OF_FORECASTS 40
+// NUMBER_OF_FORECASTS, the size of the 5 day / 3 hour forecast, is defined in WeatherClient.h
 #define NUMBER_OF_DAY_FORECASTS 4
 
+// stack of the FreeRTOS task fetching and parsing the OpenWeatherMap data
+#define WEATHER_TASK_STACK_SIZE 8192
+
 #define APP_NAME "ESP32 Weather Station Touch"
 #define VERSION "1.0.0"
@@ -9,4 +9,7 @@ const String WEEKDAYS_ABBR[] = {"SO", "MO", "DI", "MI", "DO", "FR", "SA"};
 
 const String SUN_MOON_LABEL[] = {"Sonne", "Mond"};
 const String MOON_PHASES[] = {"Neumond", "zunehmender Sichelmond", "zunehmendes Viertel", "zunehmender Mond",
-                              "Vollmond", "abnehmender Mond", "abnehmendes Viertel", "abnehmender Sichelmond"};
\ No newline at end of file
+                              "Vollmond", "abnehmender Mond", "abnehmendes Viertel", "abnehmender Sichelmond"};
+
+// by PageId, the dashboard has none
+const String PAGE_TITLES[] = {"", "Nächste Stunden", "Sonne und Mond", "System"};
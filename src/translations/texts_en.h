@@ -8,4 +8,7 @@ const String WEEKDAYS_ABBR[] = {"SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"}
 
 const String SUN_MOON_LABEL[] = {"Sun", "Moon"};
 const String MOON_PHASES[] = {"New Moon", "Waxing Crescent", "First Quarter", "Waxing Gibbous",
-                              "Full Moon", "Waning Gibbous", "Third quarter", "Waning Crescent"};
\ No newline at end of file
+                              "Full Moon", "Waning Gibbous", "Third quarter", "Waning Crescent"};
+
+// by PageId, the dashboard has none
+const String PAGE_TITLES[] = {"", "Next hours", "Sun and moon", "System"};
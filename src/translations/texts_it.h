@@ -9,3 +9,6 @@ const String WEEKDAYS_ABBR[] = {"DOM", "LUN", "MAR", "MER", "GIO", "VEN", "SAB"}
 const String SUN_MOON_LABEL[] = {"Sole", "Luna"};
 const String MOON_PHASES[] = {"Luna nuova", "Luna crescente", "Primo quarto", "Gibbosa crescente",
                               "Luna piena", "Gibbosa calante", "Terzo quarto", "Luna calante"};
+
+// by PageId, the dashboard has none
+const String PAGE_TITLES[] = {"", "Prossime ore", "Sole e luna", "Sistema"};
@@ -18,3 +18,6 @@ const String MOON_PHASES[] = {"Nieuwe Maan", "Jonge Maansikkel", "Eerste Kwartie
 //  Krimpende of afnemende maan.
 //  Laatste kwartier.
 //  Krimpende, sikkelvormige maan of asgrauwe maan.
+
+// by PageId, the dashboard has none
+const String PAGE_TITLES[] = {"", "Komende uren", "Zon en maan", "Systeem"};
@@ -6,88 +6,153 @@
 #include "time.h"
 #include "settings.h"
 
-char timestampBuffer[26];
+// including the terminating null, enough for SYSTEM_TIMESTAMP_FORMAT
+#define TIMESTAMP_SIZE 26
 
-uint8_t getCurrentWeekday();
+// upper bound of 3-hourly forecasts on a day, 25 hours when DST ends
+#define MAX_FORECASTS_PER_DAY 9
 
 /**
- * Use the 3h/5d OWM forecast data to condense it into minimal daily forecasts (as required by this app).
+ * Condenses the 3h/5d OWM forecasts into daily forecasts in a single pass. Reentrant, the result
+ * goes to the buffer provided by the caller.
  * Algo:
- * - iterate over all OWM forecasts
- * - skip the ones from the current day
- * - find min/max temp for each day by comparing the temp from the current 3h forecast against the min/max found so far
- * - use the condition code (i.e. the weather) of the one 3h forecast closest to 12 moon
+ * - compute the local midnights following now once up front; mktime() takes care of DST, i.e. a
+ *   local day may have 23 or 25 hours
+ * - iterate over all OWM forecasts, they are sorted by time: skip the ones from the current day
+ *   and assign each other one to its day by advancing through the midnights; the local hour is
+ *   counted back from the following midnight, no time zone conversion per forecast. On DST
+ *   transition days that's only off for the hours before the switch at night.
+ * - per day: min/max temp, precipitation sum, max wind speed, the condition code (i.e. the
+ *   weather) of the one 3h forecast closest to 12 noon and the dominant condition by weighted vote
  *
- * @param forecasts NUMBER_OF_DAY_FORECASTS 3h/5d OWM forecast containers
- * @return DayForecast* array of NUMBER_OF_DAY_FORECASTS minimal daily forecast containers
+ * @param forecasts the 3h/5d OWM forecasts
+ * @param now the current UTC time, today is the local day it falls on
+ * @param dayForecasts buffer for the daily forecasts starting tomorrow, days without any forecast
+ *        are marked invalid
+ * @param size number of days dayForecasts holds, at most NUMBER_OF_DAY_FORECASTS are calculated
+ * @return number of days forecasts were found for
  */
-DayForecast* calculateDayForecasts(OpenWeatherMapForecastData *forecasts) {
-  uint8_t weekday = getCurrentWeekday();
-  static DayForecast dayForecasts[NUMBER_OF_DAY_FORECASTS];
-  for (int i = 0; i < NUMBER_OF_DAY_FORECASTS; i++) {
-    dayForecasts[i] = {200.0, -200.0, 0, 23};
+uint8_t calculateDayForecasts(const ForecastStore &forecasts, time_t now, DayForecast *dayForecasts,
+                              uint8_t size) {
+  // midnights[d] is the start of dayForecasts[d], midnights[size] the end of the last day
+  time_t midnights[NUMBER_OF_DAY_FORECASTS + 1];
+  size = min(size, (uint8_t)NUMBER_OF_DAY_FORECASTS);
+  struct tm localNow;
+  localtime_r(&now, &localNow);
+  for (uint8_t d = 0; d <= size; d++) {
+    struct tm midnight = localNow;
+    midnight.tm_mday += d + 1;
+    midnight.tm_hour = 0;
+    midnight.tm_min = 0;
+    midnight.tm_sec = 0;
+    midnight.tm_isdst = -1;
+    // normalizes the date and sets tm_wday
+    midnights[d] = mktime(&midnight);
+    if (d < size) {
+      dayForecasts[d] = {200.0, -200.0, 0, 23, midnight.tm_wday, 0.0, 0.0, 0, false};
+    }
   }
-  int k = -1;
-  int currentForecastDay = -1;
-
-  for (uint8_t i = 0; i < NUMBER_OF_FORECASTS; i++) {
-    OpenWeatherMapForecastData forecast = forecasts[i];
-    time_t forecastTimeUtc = forecast.observationTime;
-    struct tm *forecastLocalTime = localtime(&forecastTimeUtc);
 
-    if (weekday == forecastLocalTime->tm_wday) {
-      strftime(timestampBuffer, sizeof(timestampBuffer), SYSTEM_TIMESTAMP_FORMAT, forecastLocalTime);
-      log_d("Skipping forecast for today %s", timestampBuffer);
+  // votes for the conditions of the day being aggregated
+  uint16_t voteCodes[MAX_FORECASTS_PER_DAY];
+  uint8_t voteWeights[MAX_FORECASTS_PER_DAY];
+  uint8_t votes = 0;
+  auto countVotes = [&](DayForecast &dayForecast) {
+    uint8_t winner = 0;
+    for (uint8_t v = 1; v < votes; v++) {
+      if (voteWeights[v] > voteWeights[winner]) winner = v;
+    }
+    dayForecast.dominantConditionCode = votes > 0 ? voteCodes[winner] : 0;
+    votes = 0;
+  };
+
+  int8_t day = -1;
+  uint8_t found = 0;
+  for (uint8_t i = 0; i < forecasts.count; i++) {
+    time_t forecastTimeUtc = forecasts.observationTime[i];
+    if (forecastTimeUtc < midnights[0]) {
+      log_d("Skipping forecast for today %lu", forecasts.observationTime[i]);
       continue;
     }
+    if (forecastTimeUtc >= midnights[size]) {
+      break;
+    }
+    while (forecastTimeUtc >= midnights[day + 1]) {
+      if (day >= 0) countVotes(dayForecasts[day]);
+      day++;
+    }
 
-    if (forecastLocalTime->tm_wday != currentForecastDay) {
-      currentForecastDay = forecastLocalTime->tm_wday;
-      k++;
-      dayForecasts[k].day = currentForecastDay;
+    DayForecast &dayForecast = dayForecasts[day];
+    if (!dayForecast.valid) {
+      dayForecast.valid = true;
+      found++;
+    }
+    // hours before the next midnight, rounded up: 12:30 is 11.5 hours before, hour 12
+    int hour = 24 - (int)((midnights[day + 1] - forecastTimeUtc + 3599) / 3600);
+    float temp = forecastTemp(forecasts, i);
+    log_d("Current forecast day: %d, array index: %d, hour: %d, temp: %.1f", dayForecast.day, day,
+          hour, temp);
+    if (temp < dayForecast.minTemp) dayForecast.minTemp = temp;
+    if (temp > dayForecast.maxTemp) dayForecast.maxTemp = temp;
+    dayForecast.precipitation += forecasts.precipitationCenti[i] / 100.0f;
+    dayForecast.maxWindSpeed = max(dayForecast.maxWindSpeed, forecasts.windSpeedCenti[i] / 100.0f);
+    // find the condition closest to 12 noon
+    if (abs(12 - hour) < abs(12 - dayForecast.conditionHour)) {
+      dayForecast.conditionCode = forecasts.weatherId[i];
+      dayForecast.conditionHour = hour;
     }
-    log_d("Current forecast day: %d, array index: %d, hour: %d, temp: %.1f", currentForecastDay, k, forecastLocalTime->tm_hour, forecast.temp);
-    if (forecast.temp < dayForecasts[k].minTemp) dayForecasts[k].minTemp = forecast.temp;
-    if (forecast.temp > dayForecasts[k].maxTemp) dayForecasts[k].maxTemp = forecast.temp;
-    // find the condition closest to 12 noon (tm_hour is 0-23)
-    if (abs(12 - forecastLocalTime->tm_hour) < abs(12 - dayForecasts[k].conditionHour)) {
-      dayForecasts[k].conditionCode = forecast.weatherId;
-      dayForecasts[k].conditionHour = forecastLocalTime->tm_hour;
+
+    uint8_t weight = hour >= 6 && hour < 18 ? 2 : 1;
+    uint8_t v = 0;
+    while (v < votes && voteCodes[v] != forecasts.weatherId[i]) v++;
+    if (v == votes && votes < MAX_FORECASTS_PER_DAY) {
+      voteCodes[votes] = forecasts.weatherId[i];
+      voteWeights[votes++] = 0;
     }
+    if (v < votes) voteWeights[v] += weight;
   }
-  return dayForecasts;
+  if (day >= 0) countVotes(dayForecasts[day]);
+  return found;
 }
 
-uint8_t getCurrentWeekday() {
+// Formats the current local time into the buffer of the caller, empty if the time isn't known.
+const char *getCurrentTimestamp(char *buffer, size_t size, const char *format) {
   struct tm timeinfo;
+  buffer[0] = '\0';
   if (!getLocalTime(&timeinfo)) {
     log_e("Failed to obtain time.");
-    return -1;
+    return buffer;
   }
-  return timeinfo.tm_wday;
+  strftime(buffer, size, format, &timeinfo);
+  return buffer;
 }
 
-String getCurrentTimestamp(const char* format) {
+// Formats a UTC epoch time as local time into the buffer of the caller.
+const char *formatLocalTime(char *buffer, size_t size, const char *format, time_t time) {
   struct tm timeinfo;
-  if (!getLocalTime(&timeinfo)) {
-    log_e("Failed to obtain time.");
-    return "";
-  }
-  strftime(timestampBuffer, sizeof(timestampBuffer), format, &timeinfo);
-  return String(timestampBuffer);
+  localtime_r(&time, &timeinfo);
+  strftime(buffer, size, format, &timeinfo);
+  return buffer;
 }
 
-boolean initTime() {
-  struct tm timeinfo;
+// Sets the time zone and starts SNTP, once before the tasks start. The SNTP client keeps the
+// clock in sync in the background from then on, TZ is never written again while tasks read the
+// local time.
+void initTime() {
+  log_i("Setting timezone to '%s', synchronizing time.", TIMEZONE);
+  configTzTime(TIMEZONE, "pool.ntp.org");
+}
 
-  log_i("Synchronizing time.");
-  // Connect to NTP server with 0 TZ offset, call setTimezone() later
-  configTime(0, 0, "pool.ntp.org");
+// Waits for the first SNTP sync, returns right away once the time is known.
+boolean waitForTime() {
+  struct tm timeinfo;
   if (!getLocalTime(&timeinfo)) {
     log_e("Failed to obtain time.");
     return false;
   }
-  log_i("UTC time: %s", getCurrentTimestamp(SYSTEM_TIMESTAMP_FORMAT).c_str());
+  char timestamp[TIMESTAMP_SIZE];
+  strftime(timestamp, sizeof(timestamp), SYSTEM_TIMESTAMP_FORMAT, &timeinfo);
+  log_i("Current local time: %s", timestamp);
   return true;
 }
 
@@ -100,17 +165,12 @@ void logBanner() {
 void logMemoryStats() {
   log_i("Total heap: %d", ESP.getHeapSize());
   log_i("Free heap: %d", ESP.getFreeHeap());
+  // a shrinking largest free block while the free heap stays the same means fragmentation
+  log_i("Min. free heap: %d, largest free block: %d", ESP.getMinFreeHeap(), ESP.getMaxAllocHeap());
   log_i("Total PSRAM: %d", ESP.getPsramSize());
   log_i("Free PSRAM: %d", ESP.getFreePsram());
 }
 
-void setTimezone(const char* timezone) {
-  log_i("Setting timezone to '%s'.", timezone);
-  // Clock settings are adjusted to show the new local time
-  setenv("TZ", timezone, 1);
-  tzset();
-}
-
 // Algorithm: http://howardhinnant.github.io/date_algorithms.html
 int days_from_epoch(int y, int m, int d) {
   y -= m <= 2;
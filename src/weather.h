@@ -0,0 +1,17 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "settings.h"
+#include "WeatherClient.h"
+
+// Everything the dashboard shows from one OpenWeatherMap update. Handed from the weather task to
+// the UI and persisted to the file system to get a dashboard up right after boot.
+typedef struct WeatherSnapshot {
+  // UTC epoch seconds of the update
+  time_t fetchedAt;
+  CurrentWeatherData currentWeather;
+  ForecastStore forecasts;
+  DayForecast dayForecasts[NUMBER_OF_DAY_FORECASTS];
+} WeatherSnapshot;
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "settings.h"
+
+/**
+ * Retained state of a dashboard widget: its screen area plus the inputs it was last drawn with.
+ * Instead of clearing and redrawing the whole screen on every update, repaint() only clears and
+ * redraws widgets whose new inputs differ from the recorded ones.
+ */
+template <typename T> struct Widget {
+  RectangleDef area;
+  T inputs;
+  bool drawn;
+};
+
+// fixed buffers rather than Strings, the clock is updated every second and mustn't allocate
+typedef struct ClockInputs {
+  char date[40];
+  char time[16];
+  bool stale;
+} ClockInputs;
+
+typedef struct CurrentWeatherInputs {
+  String iconName;
+  String description;
+  String temp;
+  String humidity;
+  String pressure;
+  String windIconName;
+  String windSpeed;
+} CurrentWeatherInputs;
+
+// all empty for a day without forecast
+typedef struct ForecastInputs {
+  String weekday[NUMBER_OF_DAY_FORECASTS];
+  String temps[NUMBER_OF_DAY_FORECASTS];
+  String iconName[NUMBER_OF_DAY_FORECASTS];
+} ForecastInputs;
+
+typedef struct AstroInputs {
+  String sunRise;
+  String sunSet;
+  String moonRise;
+  String moonSet;
+  int moonImageIndex;
+  int moonPhaseIndex;
+} AstroInputs;
+
+bool operator==(const ClockInputs &a, const ClockInputs &b) {
+  return strcmp(a.date, b.date) == 0 && strcmp(a.time, b.time) == 0 && a.stale == b.stale;
+}
+
+bool operator==(const CurrentWeatherInputs &a, const CurrentWeatherInputs &b) {
+  return a.iconName == b.iconName && a.description == b.description && a.temp == b.temp &&
+         a.humidity == b.humidity && a.pressure == b.pressure &&
+         a.windIconName == b.windIconName && a.windSpeed == b.windSpeed;
+}
+
+bool operator==(const ForecastInputs &a, const ForecastInputs &b) {
+  for (int i = 0; i < NUMBER_OF_DAY_FORECASTS; i++) {
+    if (a.weekday[i] != b.weekday[i] || a.temps[i] != b.temps[i] ||
+        a.iconName[i] != b.iconName[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool operator==(const AstroInputs &a, const AstroInputs &b) {
+  return a.sunRise == b.sunRise && a.sunSet == b.sunSet && a.moonRise == b.moonRise &&
+         a.moonSet == b.moonSet && a.moonImageIndex == b.moonImageIndex &&
+         a.moonPhaseIndex == b.moonPhaseIndex;
+}
+
+/**
+ * Records the new inputs if they differ from the ones the widget was last drawn with.
+ *
+ * @return true if the widget needs to be redrawn
+ */
+template <typename T> bool updateWidgetInputs(Widget<T> &widget, const T &inputs) {
+  if (widget.drawn && widget.inputs == inputs) {
+    return false;
+  }
+  widget.inputs = inputs;
+  widget.drawn = true;
+  return true;
+}
@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <unity.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GfxUi.h"
+
+// a dashboard's worth of icons, as many as the current weather and forecast widgets draw
+#define FRAME_ICONS 6
+#define ICON_SIZE 100
+#define BENCHMARK_FRAMES 10
+// roughly the ILI9488 at 40 MHz: 3 bytes per pixel, a few commands per address window
+#define NANOS_PER_PIXEL 600
+#define NANOS_PER_WINDOW 5000
+
+TFT_eSPI tft = TFT_eSPI();
+OpenFontRender ofr;
+BlitPipeline pipeline(&tft);
+// never begun, pushes go to the TFT right away
+BlitPipeline direct(&tft);
+
+String iconFile(uint8_t i) {
+  return "/weather/" + String(i) + ".icon";
+}
+
+int16_t iconX(uint8_t i) {
+  return (i % 3) * (ICON_SIZE + 5);
+}
+
+int16_t iconY(uint8_t i) {
+  return 100 + (i / 3) * (ICON_SIZE + 5);
+}
+
+void append16(std::string &out, uint16_t value) {
+  out += (char)(value & 0xFF);
+  out += (char)(value >> 8);
+}
+
+// every row a single literal over a 16 color palette, the most decoding work per pixel
+void writeIcon(uint8_t i) {
+  std::string icon = "PRLE";
+  append16(icon, ICON_SIZE);
+  append16(icon, ICON_SIZE);
+  append16(icon, 16);
+  for (uint16_t color = 0; color < 16; color++) {
+    append16(icon, (color + i) * 0x1041);
+  }
+  for (uint16_t y = 0; y < ICON_SIZE; y++) {
+    icon += (char)(ICON_SIZE - 1);
+    for (uint16_t x = 0; x < ICON_SIZE; x++) {
+      icon += (char)((x / 4 + y / 4 + i) % 16);
+    }
+  }
+  File file = LittleFS.open(iconFile(i), "w");
+  file.write((const uint8_t *)icon.data(), icon.size());
+  file.close();
+}
+
+void drawFrame(GfxUi &ui, bool flushPerIcon) {
+  for (uint8_t i = 0; i < FRAME_ICONS; i++) {
+    ui.drawIcon(iconFile(i), iconX(i), iconY(i));
+    if (flushPerIcon) {
+      pipeline.flush();
+    }
+  }
+  pipeline.flush();
+}
+
+// Wall time, not micros(), the transfers busy-wait in real time on the display task.
+uint64_t benchmarkMicros(GfxUi &ui, bool flushPerIcon) {
+  auto start = std::chrono::steady_clock::now();
+  for (uint8_t frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+    drawFrame(ui, flushPerIcon);
+  }
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+void setUp() {
+  TEST_ASSERT_TRUE(LittleFS.nativeMountTemporary());
+  LittleFS.mkdir("/weather");
+  for (uint8_t i = 0; i < FRAME_ICONS; i++) {
+    writeIcon(i);
+  }
+  nativeSetPsramFound(false);
+  tft.init();
+  tft.fillScreen(TFT_BLACK);
+  tft.nativeSetTransferTime(0, 0);
+}
+
+void tearDown() {
+  tft.nativeSetTransferTime(0, 0);
+}
+
+void test_frame_waits_for_the_display_once() {
+  GfxUi reference(&tft, &ofr, &direct);
+  for (uint8_t i = 0; i < FRAME_ICONS; i++) {
+    reference.drawIcon(iconFile(i), iconX(i), iconY(i));
+  }
+  std::vector<uint16_t> expected(tft.nativeFrame(), tft.nativeFrame() + tft.width() * tft.height());
+  tft.fillScreen(TFT_BLACK);
+
+  GfxUi ui(&tft, &ofr, &pipeline);
+  uint32_t flushes = pipeline.flushes();
+  for (uint8_t i = 0; i < FRAME_ICONS; i++) {
+    ui.drawIcon(iconFile(i), iconX(i), iconY(i));
+  }
+  // streamed icons don't wait, their blocks are still on the way
+  TEST_ASSERT_EQUAL(flushes, pipeline.flushes());
+  pipeline.flush();
+  TEST_ASSERT_EQUAL(flushes + 1, pipeline.flushes());
+  TEST_ASSERT_EQUAL_UINT16_ARRAY(expected.data(), tft.nativeFrame(), expected.size());
+}
+
+void test_cached_icons_are_queued_too() {
+  nativeSetPsramFound(true);
+  GfxUi ui(&tft, &ofr, &pipeline);
+  ui.setIconCacheBudget(FRAME_ICONS * ICON_SIZE * ICON_SIZE * sizeof(uint16_t));
+  // decoded as a whole, each waits before it goes into the cache
+  drawFrame(ui, false);
+  tft.fillScreen(TFT_BLACK);
+
+  uint32_t flushes = pipeline.flushes();
+  for (uint8_t i = 0; i < FRAME_ICONS; i++) {
+    ui.drawIcon(iconFile(i), iconX(i), iconY(i));
+  }
+  TEST_ASSERT_EQUAL(flushes, pipeline.flushes());
+  pipeline.flush();
+  TEST_ASSERT_NOT_EQUAL(TFT_BLACK, tft.readPixel(iconX(FRAME_ICONS - 1) + 1,
+                                                 iconY(FRAME_ICONS - 1) + 1));
+}
+
+void test_throughput_of_batched_flushes() {
+  GfxUi ui(&tft, &ofr, &pipeline);
+  tft.nativeSetTransferTime(NANOS_PER_WINDOW, NANOS_PER_PIXEL);
+  // warm up, e.g. the file system
+  drawFrame(ui, false);
+
+  uint64_t perIconMicros = benchmarkMicros(ui, true);
+  uint64_t batchedMicros = benchmarkMicros(ui, false);
+  uint64_t pixels = (uint64_t)BENCHMARK_FRAMES * FRAME_ICONS * ICON_SIZE * ICON_SIZE;
+  char message[128];
+  snprintf(message, sizeof(message), "flush per icon: %llu pixels/s, per frame: %llu pixels/s",
+           (unsigned long long)(pixels * 1000000 / perIconMicros),
+           (unsigned long long)(pixels * 1000000 / batchedMicros));
+  TEST_MESSAGE(message);
+  // The transfers busy-wait like TFT_eSPI converting the pixels on the CPU, a single core host
+  // can't overlap them with decoding.
+  if (std::thread::hardware_concurrency() < 2) {
+    TEST_IGNORE_MESSAGE("a single core can't overlap decoding and transfers");
+  }
+  // decoding the next icon overlaps sending the previous one; some slack for the scheduler
+  TEST_ASSERT_LESS_OR_EQUAL(perIconMicros * 11 / 10, batchedMicros);
+}
+
+// What drawBmp() did before icons were pushed in blocks: an address window for every row. The rows
+// come ready from a buffer here, without the BMP conversion, so that side is a lower bound.
+void test_transactions_per_icon_against_per_row() {
+  GfxUi ui(&tft, &ofr, &pipeline);
+  // warm up, e.g. the file system
+  drawFrame(ui, false);
+  std::vector<uint16_t> icon(ICON_SIZE * ICON_SIZE);
+  for (uint16_t y = 0; y < ICON_SIZE; y++) {
+    for (uint16_t x = 0; x < ICON_SIZE; x++) {
+      icon[y * ICON_SIZE + x] = tft.readPixel(iconX(0) + x, iconY(0) + y);
+    }
+  }
+  tft.nativeSetTransferTime(NANOS_PER_WINDOW, NANOS_PER_PIXEL);
+  uint32_t icons = BENCHMARK_FRAMES * FRAME_ICONS;
+
+  tft.nativeResetStats();
+  // each icon waited for, as the rows were
+  uint64_t blockMicros = benchmarkMicros(ui, true);
+  NativeTransferStats blockStats = tft.nativeStats();
+
+  tft.nativeResetStats();
+  auto start = std::chrono::steady_clock::now();
+  for (uint8_t frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+    for (uint8_t i = 0; i < FRAME_ICONS; i++) {
+      for (uint16_t y = 0; y < ICON_SIZE; y++) {
+        tft.pushImage(iconX(i), iconY(i) + y, ICON_SIZE, 1, &icon[y * ICON_SIZE]);
+      }
+    }
+  }
+  uint64_t rowMicros = std::chrono::duration_cast<std::chrono::microseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+  NativeTransferStats rowStats = tft.nativeStats();
+
+  char message[160];
+  snprintf(message, sizeof(message),
+           "per icon: blocks %lu address windows and %lluus, rows %lu address windows and %lluus",
+           (unsigned long)(blockStats.windows / icons), (unsigned long long)(blockMicros / icons),
+           (unsigned long)(rowStats.windows / icons), (unsigned long long)(rowMicros / icons));
+  TEST_MESSAGE(message);
+  TEST_ASSERT_EQUAL_UINT32(ICON_SIZE * icons, rowStats.windows);
+  TEST_ASSERT_LESS_THAN_UINT32(rowStats.windows / 10, blockStats.windows);
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)rowStats.pixels, (uint32_t)blockStats.pixels);
+}
+
+int main(int argc, char **argv) {
+  pipeline.begin();
+  UNITY_BEGIN();
+  RUN_TEST(test_frame_waits_for_the_display_once);
+  RUN_TEST(test_cached_icons_are_queued_too);
+  RUN_TEST(test_throughput_of_batched_flushes);
+  RUN_TEST(test_transactions_per_icon_against_per_row);
+  return UNITY_END();
+}
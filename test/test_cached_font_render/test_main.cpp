@@ -0,0 +1,231 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <chrono>
+
+#include "CachedFontRender.h"
+
+#define SPRITE_WIDTH 320
+#define SPRITE_HEIGHT 40
+#define BENCHMARK_RUNS 200
+
+const unsigned char font[] = {0};
+
+TFT_eSPI tft = TFT_eSPI();
+OpenFontRender ofr;
+TFT_eSprite cached = TFT_eSprite(&tft);
+TFT_eSprite direct = TFT_eSprite(&tft);
+
+void setUp() {
+  tft.init();
+  nativeSetPsramFound(false);
+  cached.createSprite(SPRITE_WIDTH, SPRITE_HEIGHT);
+  direct.createSprite(SPRITE_WIDTH, SPRITE_HEIGHT);
+  cached.fillSprite(TFT_BLACK);
+  direct.fillSprite(TFT_BLACK);
+}
+
+void tearDown() {
+  cached.deleteSprite();
+  direct.deleteSprite();
+}
+
+// Cached masks are blended from the recovered coverage, which may be off by a level, so only
+// whether a pixel has ink is compared.
+void assertSameInk() {
+  for (int16_t y = 0; y < SPRITE_HEIGHT; y++) {
+    for (int16_t x = 0; x < SPRITE_WIDTH; x++) {
+      if ((cached.readPixel(x, y) != TFT_BLACK) != (direct.readPixel(x, y) != TFT_BLACK)) {
+        char message[32];
+        snprintf(message, sizeof(message), "ink differs at %d/%d", x, y);
+        TEST_FAIL_MESSAGE(message);
+      }
+    }
+  }
+}
+
+// OpenFontRender is set up after the cache drew, which rasterizes with it
+void drawBoth(CachedFontRender &cfr, const char *text, bool centered) {
+  cfr.setDrawer(cached);
+  if (centered) {
+    cfr.cdrawString(text, SPRITE_WIDTH / 2, 5);
+  } else {
+    cfr.drawString(text, 3, 5);
+  }
+  ofr.setDrawer(direct);
+  ofr.setFontSize(18);
+  ofr.setFontColor(TFT_WHITE);
+  ofr.setBackgroundColor(TFT_BLACK);
+  if (centered) {
+    ofr.cdrawString(text, SPRITE_WIDTH / 2, 5);
+  } else {
+    ofr.drawString(text, 3, 5);
+  }
+}
+
+CachedFontRender *newRender(size_t budget) {
+  CachedFontRender *cfr = new CachedFontRender(&tft, &ofr);
+  cfr->loadFont(font, sizeof(font));
+  cfr->setBudget(budget);
+  cfr->setFontSize(18);
+  return cfr;
+}
+
+void test_long_string_as_wide_as_open_font_render() {
+  CachedFontRender *cfr = newRender(64 * 1024);
+  // the fractional advances add up to several pixels over the string
+  const char *text = "Wednesday 23.5° 1019 hPa, 71%";
+  drawBoth(*cfr, text, false);
+  assertSameInk();
+  TEST_ASSERT_GREATER_THAN(0, cfr->misses());
+  delete cfr;
+}
+
+void test_centered_string_as_open_font_render() {
+  CachedFontRender *cfr = newRender(64 * 1024);
+  drawBoth(*cfr, "Sunrise 06:42", true);
+  cached.fillSprite(TFT_BLACK);
+  direct.fillSprite(TFT_BLACK);
+  // again from the cache
+  uint32_t misses = cfr->misses();
+  drawBoth(*cfr, "Sunrise 06:42", true);
+  TEST_ASSERT_EQUAL(misses, cfr->misses());
+  assertSameInk();
+  delete cfr;
+}
+
+void test_full_cache_evicts_least_recently_used() {
+  // 'A', 'P', '_' and 'n' are 15 codepoints apart, the stand-in glyphs are all the same size
+  CachedFontRender *cfr = newRender(64 * 1024);
+  cfr->drawString("A", 0, 0);
+  size_t glyphBytes = cfr->usedBytes();
+  delete cfr;
+
+  cfr = newRender(3 * glyphBytes);
+  cfr->setDrawer(cached);
+  cfr->drawString("A", 0, 0);
+  cfr->drawString("P", 0, 0);
+  cfr->drawString("_", 0, 0);
+  cfr->drawString("A", 0, 0);
+  TEST_ASSERT_EQUAL(0, cfr->evictions());
+  // makes room by evicting P, drawn longest ago
+  cfr->drawString("n", 0, 0);
+  TEST_ASSERT_EQUAL(1, cfr->evictions());
+  TEST_ASSERT_EQUAL(3 * glyphBytes, cfr->usedBytes());
+
+  uint32_t misses = cfr->misses();
+  cfr->drawString("An_", 0, 0);
+  TEST_ASSERT_EQUAL(misses, cfr->misses());
+  cfr->drawString("P", 0, 0);
+  TEST_ASSERT_EQUAL(misses + 1, cfr->misses());
+  delete cfr;
+}
+
+void test_string_larger_than_cache_still_drawn() {
+  CachedFontRender *probe = newRender(64 * 1024);
+  probe->drawString("A", 0, 0);
+  size_t glyphBytes = probe->usedBytes();
+  delete probe;
+
+  // its own glyphs are never evicted for each other, the string is drawn uncached
+  CachedFontRender *cfr = newRender(2 * glyphBytes);
+  drawBoth(*cfr, "AP_", false);
+  assertSameInk();
+  TEST_ASSERT_LESS_OR_EQUAL(2 * glyphBytes, cfr->usedBytes());
+  delete cfr;
+}
+
+void test_many_glyphs_stay_reachable() {
+  // more glyphs than slots: evicting shifts probe sequences, everything cached must be found
+  CachedFontRender *cfr = newRender(1024 * 1024);
+  cfr->setDrawer(cached);
+  char text[2] = {'\0', '\0'};
+  for (uint8_t size = 10; size < 16; size++) {
+    cfr->setFontSize(size);
+    for (char c = '!'; c <= '~'; c++) {
+      text[0] = c;
+      cfr->drawString(text, 0, 0);
+    }
+  }
+  TEST_ASSERT_GREATER_THAN(0, cfr->evictions());
+  // the most recent glyphs are all still there
+  uint32_t misses = cfr->misses();
+  for (char c = '!'; c <= '~'; c++) {
+    text[0] = c;
+    cfr->drawString(text, 0, 0);
+  }
+  TEST_ASSERT_EQUAL(misses, cfr->misses());
+  delete cfr;
+}
+
+// Renders a string through the cache or straight through OpenFontRender, returns how long it took
+// on average in nanoseconds.
+uint64_t benchmarkNanos(CachedFontRender *cfr, const char *text, uint8_t size) {
+  auto start = std::chrono::steady_clock::now();
+  for (int run = 0; run < BENCHMARK_RUNS; run++) {
+    if (cfr != nullptr) {
+      cfr->setFontSize(size);
+      cfr->drawString(text, 3, 0);
+    } else {
+      ofr.setFontSize(size);
+      ofr.drawString(text, 3, 0);
+    }
+  }
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                              start)
+             .count() /
+         BENCHMARK_RUNS;
+}
+
+// Strings as the dashboard draws them, at the sizes it uses. The stand-in's glyphs are boxes that
+// cost far less than FreeType's outlines, so the time is only reported; the glyphs that had to be
+// rendered are what the cache saves on the device.
+void test_benchmark_against_uncached() {
+  static const struct {
+    const char *text;
+    uint8_t size;
+  } strings[] = {{"Wed, 14 Jun 2023", 16}, {"23.4°C", 48}, {"scattered clouds", 18},
+                 {"Sunrise 06:42", 14}, {"1016 hPa", 24}};
+  CachedFontRender *cfr = newRender(64 * 1024);
+  cfr->setDrawer(cached);
+  ofr.setDrawer(direct);
+  ofr.setFontColor(TFT_WHITE);
+  ofr.setBackgroundColor(TFT_BLACK);
+
+  for (const auto &string : strings) {
+    uint32_t glyphs = ofr.nativeGlyphsRendered();
+    uint64_t uncachedNanos = benchmarkNanos(nullptr, string.text, string.size);
+    uint32_t uncachedGlyphs = ofr.nativeGlyphsRendered() - glyphs;
+    glyphs = ofr.nativeGlyphsRendered();
+    uint64_t cachedNanos = benchmarkNanos(cfr, string.text, string.size);
+    uint32_t cachedGlyphs = ofr.nativeGlyphsRendered() - glyphs;
+
+    char message[160];
+    snprintf(message, sizeof(message),
+             "'%s' at %u px, %d draws: cached %lluus per draw and %lu glyphs rendered, uncached "
+             "%lluus and %lu glyphs",
+             string.text, string.size, BENCHMARK_RUNS, (unsigned long long)cachedNanos / 1000,
+             (unsigned long)cachedGlyphs, (unsigned long long)uncachedNanos / 1000,
+             (unsigned long)uncachedGlyphs);
+    TEST_MESSAGE(message);
+    // each glyph once, the first time it's drawn
+    TEST_ASSERT_GREATER_THAN_UINT32(0, cachedGlyphs);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(uncachedGlyphs / BENCHMARK_RUNS, cachedGlyphs);
+  }
+  TEST_ASSERT_GREATER_THAN(0, cfr->hits());
+  delete cfr;
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_long_string_as_wide_as_open_font_render);
+  RUN_TEST(test_centered_string_as_open_font_render);
+  RUN_TEST(test_full_cache_evicts_least_recently_used);
+  RUN_TEST(test_string_larger_than_cache_still_drawn);
+  RUN_TEST(test_many_glyphs_stay_reachable);
+  RUN_TEST(test_benchmark_against_uncached);
+  return UNITY_END();
+}
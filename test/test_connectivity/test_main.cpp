@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "connectivity.h"
+
+const uint8_t otherBssid[6] = {0x24, 0x0A, 0xC4, 0x00, 0x00, 0x02};
+
+void setUp() {
+  TEST_ASSERT_TRUE(LittleFS.nativeMountTemporary());
+  WiFi.nativeReset();
+  wifiStats = {};
+}
+
+void tearDown() {}
+
+void test_first_connect_scans() {
+  startWiFi();
+  TEST_ASSERT_TRUE(WiFi.isConnected());
+  TEST_ASSERT_EQUAL(1, WiFi.nativeScans());
+  TEST_ASSERT_EQUAL(1, WiFi.nativeDhcpRequests());
+  TEST_ASSERT_EQUAL(0, wifiStats.fastConnects);
+
+  WiFiCache cache;
+  TEST_ASSERT_TRUE(loadWiFiCache(&cache));
+  TEST_ASSERT_EQUAL(6, cache.channel);
+  TEST_ASSERT_EQUAL_HEX32((uint32_t)IPAddress(192, 168, 1, 42), cache.ip);
+}
+
+void test_cached_connect_skips_scan_and_dhcp() {
+  startWiFi();
+  WiFi.disconnect();
+  uint32_t scanMillis = wifiStats.lastConnectMillis;
+  startWiFi();
+  TEST_ASSERT_TRUE(WiFi.isConnected());
+  TEST_ASSERT_EQUAL(1, WiFi.nativeScans());
+  TEST_ASSERT_EQUAL(1, WiFi.nativeDhcpRequests());
+  TEST_ASSERT_TRUE(WiFi.nativeStaticIp());
+  TEST_ASSERT_EQUAL(1, wifiStats.fastConnects);
+  TEST_ASSERT_LESS_THAN(scanMillis, wifiStats.lastConnectMillis);
+  TEST_ASSERT_EQUAL_STRING("192.168.1.42", WiFi.localIP().toString().c_str());
+}
+
+void test_moved_access_point_scans_again() {
+  startWiFi();
+  WiFi.disconnect();
+  WiFi.nativeSetAccessPoint(true, 11, otherBssid);
+  startWiFi();
+  TEST_ASSERT_TRUE(WiFi.isConnected());
+  TEST_ASSERT_EQUAL(2, WiFi.nativeScans());
+  TEST_ASSERT_EQUAL(1, wifiStats.failedAttempts);
+  TEST_ASSERT_EQUAL(0, wifiStats.fastConnects);
+
+  WiFiCache cache;
+  TEST_ASSERT_TRUE(loadWiFiCache(&cache));
+  TEST_ASSERT_EQUAL(11, cache.channel);
+  TEST_ASSERT_EQUAL_MEMORY(otherBssid, cache.bssid, sizeof(otherBssid));
+}
+
+void test_cache_of_other_network_ignored() {
+  WiFiCache cache = {};
+  cache.magic = WIFI_CACHE_MAGIC;
+  cache.version = WIFI_CACHE_VERSION;
+  strlcpy(cache.ssid, "othernet", sizeof(cache.ssid));
+  cache.channel = 6;
+  File file = LittleFS.open(WIFI_CACHE_FILE, "w");
+  file.write((const uint8_t *)&cache, sizeof(cache));
+  file.close();
+  TEST_ASSERT_FALSE(loadWiFiCache(&cache));
+
+  startWiFi();
+  TEST_ASSERT_EQUAL(1, WiFi.nativeScans());
+  TEST_ASSERT_TRUE(loadWiFiCache(&cache));
+}
+
+void test_unchanged_cache_not_rewritten() {
+  startWiFi();
+  WiFi.disconnect();
+  // anything written from here on fails
+  LittleFS.nativeFailWritesAfter(0);
+  startWiFi();
+  WiFiCache cache;
+  TEST_ASSERT_TRUE(loadWiFiCache(&cache));
+}
+
+// Sets the start of the cached lease, as if it was obtained that long ago.
+void ageLease(uint32_t leaseStart) {
+  WiFiCache cache;
+  TEST_ASSERT_TRUE(loadWiFiCache(&cache));
+  cache.leaseStart = leaseStart;
+  File file = LittleFS.open(WIFI_CACHE_FILE, "w");
+  file.write((const uint8_t *)&cache, sizeof(cache));
+  file.close();
+}
+
+void test_expired_lease_renewed_through_dhcp() {
+  startWiFi();
+  WiFi.disconnect();
+  ageLease(time(nullptr) - WIFI_DHCP_LEASE_MINUTES * 60 - 1);
+  startWiFi();
+  TEST_ASSERT_TRUE(WiFi.isConnected());
+  // still no scan, but a new lease
+  TEST_ASSERT_EQUAL(1, WiFi.nativeScans());
+  TEST_ASSERT_EQUAL(2, WiFi.nativeDhcpRequests());
+  TEST_ASSERT_FALSE(WiFi.nativeStaticIp());
+  TEST_ASSERT_EQUAL(1, wifiStats.fastConnects);
+
+  WiFiCache cache;
+  TEST_ASSERT_TRUE(loadWiFiCache(&cache));
+  TEST_ASSERT_UINT32_WITHIN(5, time(nullptr), cache.leaseStart);
+}
+
+void test_reused_lease_renewed_before_it_runs_out() {
+  startWiFi();
+  WiFi.disconnect();
+  startWiFi();
+  TEST_ASSERT_TRUE(WiFi.nativeStaticIp());
+  TEST_ASSERT_FALSE(isReusedLeaseExpiring());
+
+  // the connection lasted until only the margin is left
+  ageLease(time(nullptr) - (WIFI_DHCP_LEASE_MINUTES - WIFI_LEASE_MARGIN_MINUTES) * 60);
+  TEST_ASSERT_TRUE(isReusedLeaseExpiring());
+  WiFi.disconnect();
+  startWiFi();
+  TEST_ASSERT_EQUAL(2, WiFi.nativeDhcpRequests());
+  TEST_ASSERT_FALSE(WiFi.nativeStaticIp());
+  // the DHCP client renews it from here on
+  TEST_ASSERT_FALSE(isReusedLeaseExpiring());
+}
+
+void test_lease_within_margin_not_reused() {
+  startWiFi();
+  WiFi.disconnect();
+  ageLease(time(nullptr) - (WIFI_DHCP_LEASE_MINUTES - WIFI_LEASE_MARGIN_MINUTES) * 60 - 1);
+  startWiFi();
+  TEST_ASSERT_EQUAL(2, WiFi.nativeDhcpRequests());
+  TEST_ASSERT_FALSE(WiFi.nativeStaticIp());
+}
+
+void test_lease_of_unknown_age_not_reused() {
+  startWiFi();
+  WiFi.disconnect();
+  // obtained before the clock was set
+  ageLease(0);
+  startWiFi();
+  TEST_ASSERT_EQUAL(2, WiFi.nativeDhcpRequests());
+  TEST_ASSERT_FALSE(WiFi.nativeStaticIp());
+}
+
+void test_gives_up_after_bounded_attempts() {
+  WiFi.nativeSetAccessPoint(false);
+  TEST_ASSERT_FALSE(startWiFi());
+  TEST_ASSERT_FALSE(WiFi.isConnected());
+  TEST_ASSERT_EQUAL(WIFI_CONNECT_ATTEMPTS, WiFi.nativeBegins());
+  TEST_ASSERT_EQUAL(WIFI_CONNECT_ATTEMPTS, wifiStats.failedAttempts);
+  TEST_ASSERT_EQUAL(0, wifiStats.connects);
+
+  // back once the access point is
+  WiFi.nativeSetAccessPoint(true);
+  TEST_ASSERT_TRUE(startWiFi());
+  TEST_ASSERT_EQUAL(1, wifiStats.connects);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_first_connect_scans);
+  RUN_TEST(test_cached_connect_skips_scan_and_dhcp);
+  RUN_TEST(test_moved_access_point_scans_again);
+  RUN_TEST(test_cache_of_other_network_ignored);
+  RUN_TEST(test_unchanged_cache_not_rewritten);
+  RUN_TEST(test_expired_lease_renewed_through_dhcp);
+  RUN_TEST(test_reused_lease_renewed_before_it_runs_out);
+  RUN_TEST(test_lease_within_margin_not_reused);
+  RUN_TEST(test_lease_of_unknown_age_not_reused);
+  RUN_TEST(test_gives_up_after_bounded_attempts);
+  return UNITY_END();
+}
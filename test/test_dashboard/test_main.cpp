@@ -0,0 +1,278 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <unity.h>
+
+#include <stdlib.h>
+
+#include <chrono>
+#include <new>
+
+// the widgets and their globals as the firmware has them, setup() and loop() aren't called
+#include "main.cpp"
+
+// Tue, 2023-06-13 15:59:30 CEST, the clock ticks over an hour during the tests
+#define FIXTURE_TIME 1686664770
+// the ILI9488 at the 27 MHz SPI clock: 3 bytes per pixel, a few commands per address window
+#define NANOS_PER_PIXEL 889
+#define NANOS_PER_WINDOW 5000
+// a page wipe, about what the SPI needs to push a screen
+#define TRANSITION_BUDGET_MILLIS 150
+#define BENCHMARK_TICKS 600
+
+// heap allocations while counting is on: with glibc malloc() and friends, which operator new uses
+// as well, elsewhere operator new only
+volatile bool countingAllocations = false;
+volatile uint32_t allocations = 0;
+
+void countAllocation() {
+  if (countingAllocations) {
+    allocations++;
+  }
+}
+
+#ifdef __GLIBC__
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *p, size_t size);
+
+void *malloc(size_t size) {
+  countAllocation();
+  return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+  countAllocation();
+  return __libc_calloc(count, size);
+}
+
+void *realloc(void *p, size_t size) {
+  countAllocation();
+  return __libc_realloc(p, size);
+}
+}
+#else
+void *operator new(size_t size) {
+  countAllocation();
+  void *p = malloc(size == 0 ? 1 : size);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void *operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void *p) noexcept {
+  free(p);
+}
+
+void operator delete[](void *p) noexcept {
+  free(p);
+}
+#endif
+
+void setUp() {
+  nativeSetTime(FIXTURE_TIME);
+  weatherFetchedAt = FIXTURE_TIME - 600;
+  weatherFromFile = false;
+  clockWidget.drawn = false;
+}
+
+void tearDown() {
+  countingAllocations = false;
+}
+
+// what clockTask does every second once the clock is on screen: the time and the staleness
+// indicator are drawn from fixed buffers, the date line and the glyphs from the caches
+void test_clock_tick_does_not_allocate() {
+  // the first draw fills the glyph caches
+  drawTimeAndDate();
+  TEST_ASSERT_TRUE(clockWidget.drawn);
+
+  uint32_t ticks = 0;
+  for (time_t now = FIXTURE_TIME + 1; now <= FIXTURE_TIME + 90; now++, ticks++) {
+    nativeSetTime(now);
+    allocations = 0;
+    countingAllocations = true;
+    drawTimeAndDate();
+    countingAllocations = false;
+    char message[32];
+    snprintf(message, sizeof(message), "in tick %lu", (unsigned long)ticks);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, allocations, message);
+  }
+  TEST_ASSERT_EQUAL_STRING("16:01:00", clockWidget.inputs.time);
+}
+
+void loadFixtures() {
+  currentWeather = {};
+  currentWeather.temp = 23.4;
+  currentWeather.feelsLike = 22.9;
+  currentWeather.windSpeed = 3.2;
+  currentWeather.windDeg = 225;
+  currentWeather.weatherId = 802;
+  currentWeather.pressure = 1016;
+  currentWeather.humidity = 58;
+  currentWeather.observationTime = weatherFetchedAt;
+  currentWeather.sunrise = 1686626460;
+  currentWeather.sunset = 1686684180;
+  strlcpy(currentWeather.description, "scattered clouds", sizeof(currentWeather.description));
+  strlcpy(currentWeather.cityName, "Zurich", sizeof(currentWeather.cityName));
+
+  dayForecasts[0] = {14.2, 26.8, 800, 12, 3, 0, 3.1, 800, true};
+  dayForecasts[1] = {13.5, 21.0, 500, 12, 4, 4.2, 5.6, 500, true};
+  dayForecasts[2] = {15.9, 24.4, 211, 15, 5, 11.8, 8.9, 211, true};
+  dayForecasts[3] = {-1.3, 2.6, 601, 12, 6, 6.5, 4.0, 601, true};
+}
+
+// a weather update that brought the same data doesn't send anything to the display
+void test_unchanged_repaint_pushes_nothing() {
+  loadFixtures();
+  repaint();
+  tft.nativeResetStats();
+  repaint();
+  NativeTransferStats stats = tft.nativeStats();
+  TEST_ASSERT_EQUAL_UINT64(0, stats.pixels);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.windows);
+}
+
+// only the current weather widget is redrawn when only the temperature changed
+void test_changed_temperature_repaints_current_weather_only() {
+  loadFixtures();
+  repaint();
+  tft.nativeResetStats();
+  currentWeather.temp += 1;
+  repaint();
+  uint64_t repaintPixels = tft.nativeStats().pixels;
+
+  // what the widget pushes on its own
+  tft.nativeResetStats();
+  currentWeatherWidget.drawn = false;
+  TEST_ASSERT_TRUE(drawCurrentWeather());
+  blitPipeline.flush();
+  TEST_ASSERT_GREATER_THAN_UINT32(0, (uint32_t)repaintPixels);
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)tft.nativeStats().pixels, (uint32_t)repaintPixels);
+}
+
+// ticks within the same second don't draw anything
+void test_unchanged_time_does_not_allocate() {
+  drawTimeAndDate();
+  tft.nativeResetStats();
+  allocations = 0;
+  countingAllocations = true;
+  drawTimeAndDate();
+  countingAllocations = false;
+  TEST_ASSERT_EQUAL_UINT32(0, allocations);
+  TEST_ASSERT_EQUAL_UINT64(0, tft.nativeStats().pixels);
+}
+
+uint32_t microsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                               start)
+      .count();
+}
+
+// The time of the clock drawn with the pre-rasterized clock font and through OpenFontRender at the
+// same size, and whole clock ticks. Cycles are the host's time at 240 MHz. The OpenFontRender
+// stand-in draws boxes instead of rasterizing outlines, so only its glyph count carries over to the
+// device; a tick must not need any.
+void test_benchmark_clock_font() {
+  timeSprite.fillSprite(TFT_BLACK);
+  uint32_t start = ESP.getCycleCount();
+  for (int run = 0; run < BENCHMARK_TICKS; run++) {
+    clockFont.drawString("16:01:00", 20, CLOCK_TIME_Y);
+  }
+  uint32_t bitmapCycles = (ESP.getCycleCount() - start) / BENCHMARK_TICKS;
+
+  ofr.setDrawer(timeSprite);
+  ofr.setFontSize(48);
+  uint32_t glyphs = ofr.nativeGlyphsRendered();
+  start = ESP.getCycleCount();
+  for (int run = 0; run < BENCHMARK_TICKS; run++) {
+    ofr.drawString("16:01:00", 20, CLOCK_TIME_Y);
+  }
+  uint32_t outlineCycles = (ESP.getCycleCount() - start) / BENCHMARK_TICKS;
+  uint32_t outlineGlyphs = (ofr.nativeGlyphsRendered() - glyphs) / BENCHMARK_TICKS;
+  ofr.setDrawer(tft);
+
+  // the first draw lays out the clock and the date line
+  drawTimeAndDate();
+  glyphs = ofr.nativeGlyphsRendered();
+  start = ESP.getCycleCount();
+  for (time_t now = FIXTURE_TIME + 1; now <= FIXTURE_TIME + BENCHMARK_TICKS; now++) {
+    nativeSetTime(now);
+    drawTimeAndDate();
+  }
+  uint32_t tickCycles = (ESP.getCycleCount() - start) / BENCHMARK_TICKS;
+  uint32_t tickGlyphs = ofr.nativeGlyphsRendered() - glyphs;
+
+  char message[192];
+  snprintf(message, sizeof(message),
+           "time string: bitmap font %lu cycles (%luus), OpenFontRender %lu cycles and %lu glyphs; "
+           "clock tick: %lu cycles (%luus)",
+           (unsigned long)bitmapCycles, (unsigned long)bitmapCycles / 240,
+           (unsigned long)outlineCycles, (unsigned long)outlineGlyphs, (unsigned long)tickCycles,
+           (unsigned long)tickCycles / 240);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_EQUAL_UINT32(0, tickGlyphs);
+}
+
+// Each wipe step is a frame of the transition, with the transfers taking as long as on the device.
+void test_transition_frame_time() {
+  loadFixtures();
+  repaint();
+  TEST_ASSERT_TRUE(initPageSprites());
+  tft.nativeSetTransferTime(NANOS_PER_WINDOW, NANOS_PER_PIXEL);
+
+  // rendering the page and wiping it in
+  auto start = std::chrono::steady_clock::now();
+  showPage(PAGE_HOURLY_FORECAST);
+  uint32_t showMicros = microsSince(start);
+  TEST_ASSERT_EQUAL(PAGE_HOURLY_FORECAST, currentPage);
+
+  // the wipe alone
+  tft.nativeResetStats();
+  start = std::chrono::steady_clock::now();
+  wipePage(&tileRenderer.frame(), true);
+  uint32_t wipeMicros = microsSince(start);
+  NativeTransferStats stats = tft.nativeStats();
+
+  tft.nativeSetTransferTime(0, 0);
+  showPage(PAGE_DASHBOARD);
+
+  uint32_t frameMicros = wipeMicros / PAGE_WIPE_STEPS;
+  char message[128];
+  snprintf(message, sizeof(message),
+           "page shown in %luus, wipe: %luus, %lu frames of %luus, %llu pixels",
+           (unsigned long)showMicros, (unsigned long)wipeMicros, (unsigned long)PAGE_WIPE_STEPS,
+           (unsigned long)frameMicros, (unsigned long long)stats.pixels);
+  TEST_MESSAGE(message);
+  // every pixel once, a strip per frame
+  TEST_ASSERT_EQUAL_UINT32(PAGE_WIPE_STEPS, stats.windows);
+  TEST_ASSERT_EQUAL_UINT32(tft.width() * tft.height(), (uint32_t)stats.pixels);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(TRANSITION_BUDGET_MILLIS * 1000 / PAGE_WIPE_STEPS, frameMicros);
+}
+
+int main(int argc, char **argv) {
+  // what setup() does, without the touch screen, the network and the tasks
+  initTft(&tft);
+  blitPipeline.begin();
+  timeSprite.createSprite(timeSpritePos.width, timeSpritePos.height);
+  initFileSystem();
+  initTime();
+  initOpenFontRender();
+  initClockLayout();
+  ui.openIconAtlas();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_clock_tick_does_not_allocate);
+  RUN_TEST(test_unchanged_time_does_not_allocate);
+  RUN_TEST(test_unchanged_repaint_pushes_nothing);
+  RUN_TEST(test_changed_temperature_repaints_current_weather_only);
+  RUN_TEST(test_benchmark_clock_font);
+  RUN_TEST(test_transition_frame_time);
+  return UNITY_END();
+}
@@ -0,0 +1,200 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "GestureRecognizer.h"
+
+GestureRecognizer *recognizer;
+
+void setUp() {
+  recognizer = new GestureRecognizer();
+}
+
+void tearDown() {
+  delete recognizer;
+}
+
+void down(uint32_t time, int16_t x, int16_t y) {
+  recognizer->feed({TOUCH_DOWN, 1, x, y, 0, 0, time});
+}
+
+void move(uint32_t time, int16_t x, int16_t y) {
+  recognizer->feed({TOUCH_MOVE, 1, x, y, 0, 0, time});
+}
+
+void up(uint32_t time, int16_t x, int16_t y) {
+  recognizer->feed({TOUCH_UP, 0, x, y, 0, 0, time});
+}
+
+void pinch(uint32_t time, TouchEventType type, int16_t x, int16_t x2) {
+  recognizer->feed({type, 2, x, 200, x2, 200, time});
+}
+
+void assertNext(GestureType type) {
+  Gesture gesture;
+  TEST_ASSERT_TRUE_MESSAGE(recognizer->next(gesture), "no gesture");
+  TEST_ASSERT_EQUAL(type, gesture.type);
+}
+
+void assertNone() {
+  Gesture gesture;
+  TEST_ASSERT_FALSE_MESSAGE(recognizer->next(gesture), "unexpected gesture");
+}
+
+void test_tap_after_double_tap_time() {
+  down(1000, 100, 100);
+  up(1080, 102, 101);
+  recognizer->advance(1200);
+  assertNone();
+  recognizer->advance(1331);
+  assertNext(GESTURE_TAP);
+  assertNone();
+}
+
+void test_double_tap() {
+  down(1000, 100, 100);
+  up(1080, 100, 100);
+  down(1200, 105, 98);
+  up(1280, 105, 98);
+  assertNext(GESTURE_DOUBLE_TAP);
+  recognizer->advance(2000);
+  assertNone();
+}
+
+void test_taps_far_apart_are_two_taps() {
+  down(1000, 100, 100);
+  up(1080, 100, 100);
+  down(1200, 250, 300);
+  assertNext(GESTURE_TAP);
+  up(1280, 250, 300);
+  recognizer->advance(1600);
+  assertNext(GESTURE_TAP);
+}
+
+void test_held_second_contact_is_tap_and_long_press() {
+  down(1000, 100, 100);
+  up(1080, 100, 100);
+  down(1200, 102, 100);
+  recognizer->advance(1450);
+  assertNone();
+  Gesture gesture;
+  recognizer->advance(1451);
+  TEST_ASSERT_TRUE(recognizer->next(gesture));
+  TEST_ASSERT_EQUAL(GESTURE_TAP, gesture.type);
+  TEST_ASSERT_EQUAL_UINT32(1450, gesture.timeMillis);
+  recognizer->advance(1800);
+  TEST_ASSERT_TRUE(recognizer->next(gesture));
+  TEST_ASSERT_EQUAL(GESTURE_LONG_PRESS, gesture.type);
+  TEST_ASSERT_EQUAL(102, gesture.x);
+  up(2000, 102, 100);
+  recognizer->advance(3000);
+  assertNone();
+}
+
+void test_second_contact_swiping_is_tap_and_swipe() {
+  down(1000, 250, 200);
+  up(1080, 250, 200);
+  down(1200, 255, 200);
+  move(1250, 200, 200);
+  assertNext(GESTURE_TAP);
+  up(1300, 120, 200);
+  assertNext(GESTURE_SWIPE_LEFT);
+  recognizer->advance(2000);
+  assertNone();
+}
+
+void test_second_contact_pinching_is_tap_and_pinch() {
+  down(1000, 100, 200);
+  up(1080, 100, 200);
+  down(1200, 100, 200);
+  pinch(1220, TOUCH_MOVE, 100, 200);
+  assertNext(GESTURE_TAP);
+  pinch(1300, TOUCH_MOVE, 50, 250);
+  up(1400, 50, 200);
+  assertNext(GESTURE_PINCH);
+  assertNone();
+}
+
+void test_long_press_while_down() {
+  down(1000, 100, 100);
+  recognizer->advance(1599);
+  assertNone();
+  recognizer->advance(1600);
+  Gesture gesture;
+  TEST_ASSERT_TRUE(recognizer->next(gesture));
+  TEST_ASSERT_EQUAL(GESTURE_LONG_PRESS, gesture.type);
+  TEST_ASSERT_EQUAL_UINT32(1600, gesture.timeMillis);
+  up(2000, 100, 100);
+  recognizer->advance(3000);
+  assertNone();
+}
+
+void test_swipes() {
+  down(1000, 250, 200);
+  move(1100, 200, 205);
+  up(1200, 120, 210);
+  Gesture gesture;
+  TEST_ASSERT_TRUE(recognizer->next(gesture));
+  TEST_ASSERT_EQUAL(GESTURE_SWIPE_LEFT, gesture.type);
+  TEST_ASSERT_EQUAL(-130, gesture.dx);
+
+  down(2000, 100, 100);
+  move(2100, 105, 200);
+  up(2200, 105, 300);
+  assertNext(GESTURE_SWIPE_DOWN);
+}
+
+void test_slow_or_short_moves_are_no_swipes() {
+  down(1000, 100, 100);
+  move(1100, 130, 100);
+  up(1200, 130, 100);
+  down(2000, 100, 100);
+  move(2300, 200, 100);
+  up(2700, 250, 100);
+  recognizer->advance(4000);
+  assertNone();
+}
+
+void test_pinch() {
+  pinch(1000, TOUCH_DOWN, 100, 200);
+  pinch(1100, TOUCH_MOVE, 50, 250);
+  up(1200, 50, 200);
+  Gesture gesture;
+  TEST_ASSERT_TRUE(recognizer->next(gesture));
+  TEST_ASSERT_EQUAL(GESTURE_PINCH, gesture.type);
+  TEST_ASSERT_EQUAL(150, gesture.x);
+  TEST_ASSERT_EQUAL_FLOAT(2.0f, gesture.scale);
+}
+
+void test_queue_keeps_the_newest() {
+  for (uint8_t i = 0; i < GESTURE_QUEUE_SIZE + 1; i++) {
+    uint32_t start = 1000 + i * 1000;
+    down(start, 250, 200);
+    move(start + 50, 180, 200);
+    up(start + 100, 100, 200 + i);
+  }
+  Gesture gesture;
+  for (uint8_t i = 0; i < GESTURE_QUEUE_SIZE; i++) {
+    TEST_ASSERT_TRUE(recognizer->next(gesture));
+  }
+  TEST_ASSERT_EQUAL(GESTURE_QUEUE_SIZE, gesture.dy);
+  assertNone();
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_tap_after_double_tap_time);
+  RUN_TEST(test_double_tap);
+  RUN_TEST(test_taps_far_apart_are_two_taps);
+  RUN_TEST(test_held_second_contact_is_tap_and_long_press);
+  RUN_TEST(test_second_contact_swiping_is_tap_and_swipe);
+  RUN_TEST(test_second_contact_pinching_is_tap_and_pinch);
+  RUN_TEST(test_long_press_while_down);
+  RUN_TEST(test_swipes);
+  RUN_TEST(test_slow_or_short_moves_are_no_swipes);
+  RUN_TEST(test_pinch);
+  RUN_TEST(test_queue_keeps_the_newest);
+  return UNITY_END();
+}
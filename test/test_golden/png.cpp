@@ -0,0 +1,553 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include "png.h"
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+const uint8_t PNG_SIGNATURE[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+const uint8_t COLOR_TYPE_RGB = 2;
+const uint8_t COLOR_TYPE_RGBA = 6;
+const uint8_t FILTER_UP = 2;
+
+const uint16_t LENGTH_BASE[] = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+const uint8_t LENGTH_EXTRA[] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+const uint16_t DISTANCE_BASE[] = {1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+                                  33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+                                  1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+const uint8_t DISTANCE_EXTRA[] = {0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+                                  6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+const uint8_t CODE_LENGTH_ORDER[] = {16, 17, 18, 0, 8,  7, 9,  6, 10, 5,
+                                     11, 4,  12, 3, 13, 2, 14, 1, 15};
+
+#define DEFLATE_WINDOW_SIZE 32768
+#define DEFLATE_MAX_MATCH 258
+#define DEFLATE_MAX_CHAIN 64
+#define DEFLATE_HASH_BITS 15
+
+uint32_t crc32(const uint8_t *data, size_t length, uint32_t crc = 0) {
+  static uint32_t table[256] = {};
+  if (table[1] == 0) {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t value = i;
+      for (uint8_t bit = 0; bit < 8; bit++) {
+        value = value & 1 ? 0xEDB88320 ^ (value >> 1) : value >> 1;
+      }
+      table[i] = value;
+    }
+  }
+  crc = ~crc;
+  for (size_t i = 0; i < length; i++) {
+    crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+uint32_t adler32(const std::vector<uint8_t> &data) {
+  uint32_t a = 1, b = 0;
+  for (uint8_t byte : data) {
+    a = (a + byte) % 65521;
+    b = (b + a) % 65521;
+  }
+  return (b << 16) | a;
+}
+
+uint32_t readBigEndian32(const uint8_t *data) {
+  return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+}
+
+void appendBigEndian32(std::vector<uint8_t> &out, uint32_t value) {
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    out.push_back((value >> shift) & 0xFF);
+  }
+}
+
+// ----------------------------------------------------------------------------
+// Deflate: a single block with the fixed Huffman codes, greedy LZ77 matches
+// ----------------------------------------------------------------------------
+class BitWriter {
+public:
+  std::vector<uint8_t> bytes;
+
+  void bits(uint32_t value, uint8_t count) {
+    _buffer |= value << _count;
+    _count += count;
+    while (_count >= 8) {
+      bytes.push_back(_buffer & 0xFF);
+      _buffer >>= 8;
+      _count -= 8;
+    }
+  }
+
+  // Huffman codes go out most significant bit first.
+  void code(uint32_t code, uint8_t length) {
+    uint32_t reversed = 0;
+    for (uint8_t i = 0; i < length; i++) {
+      reversed = (reversed << 1) | ((code >> i) & 1);
+    }
+    bits(reversed, length);
+  }
+
+  void flush() {
+    if (_count > 0) {
+      bytes.push_back(_buffer & 0xFF);
+    }
+    _buffer = 0;
+    _count = 0;
+  }
+
+private:
+  uint32_t _buffer = 0;
+  uint8_t _count = 0;
+};
+
+void writeFixedSymbol(BitWriter &out, uint16_t symbol) {
+  if (symbol < 144) {
+    out.code(0x30 + symbol, 8);
+  } else if (symbol < 256) {
+    out.code(0x190 + symbol - 144, 9);
+  } else if (symbol < 280) {
+    out.code(symbol - 256, 7);
+  } else {
+    out.code(0xC0 + symbol - 280, 8);
+  }
+}
+
+void writeMatch(BitWriter &out, size_t length, size_t distance) {
+  uint8_t lengthCode = sizeof(LENGTH_BASE) / sizeof(LENGTH_BASE[0]) - 1;
+  while (LENGTH_BASE[lengthCode] > length) {
+    lengthCode--;
+  }
+  writeFixedSymbol(out, 257 + lengthCode);
+  out.bits(length - LENGTH_BASE[lengthCode], LENGTH_EXTRA[lengthCode]);
+  uint8_t distanceCode = sizeof(DISTANCE_BASE) / sizeof(DISTANCE_BASE[0]) - 1;
+  while (DISTANCE_BASE[distanceCode] > distance) {
+    distanceCode--;
+  }
+  out.code(distanceCode, 5);
+  out.bits(distance - DISTANCE_BASE[distanceCode], DISTANCE_EXTRA[distanceCode]);
+}
+
+std::vector<uint8_t> zlibCompress(const std::vector<uint8_t> &data) {
+  BitWriter out;
+  // zlib header: deflate with a 32K window, no dictionary, fastest
+  out.bytes = {0x78, 0x01};
+  // the final block, fixed Huffman codes
+  out.bits(1, 1);
+  out.bits(1, 2);
+
+  std::vector<int32_t> head(1 << DEFLATE_HASH_BITS, -1);
+  std::vector<int32_t> previous(data.size(), -1);
+  auto insert = [&](size_t position) {
+    if (position + 3 > data.size()) {
+      return;
+    }
+    uint32_t hash = ((data[position] << 10) ^ (data[position + 1] << 5) ^ data[position + 2]) &
+                    ((1 << DEFLATE_HASH_BITS) - 1);
+    previous[position] = head[hash];
+    head[hash] = position;
+  };
+
+  size_t position = 0;
+  while (position < data.size()) {
+    size_t maxLength = std::min((size_t)DEFLATE_MAX_MATCH, data.size() - position);
+    size_t bestLength = 0, bestDistance = 0;
+    if (maxLength >= 3) {
+      uint32_t hash = ((data[position] << 10) ^ (data[position + 1] << 5) ^ data[position + 2]) &
+                      ((1 << DEFLATE_HASH_BITS) - 1);
+      int32_t candidate = head[hash];
+      for (uint8_t chain = 0; candidate >= 0 && position - candidate <= DEFLATE_WINDOW_SIZE &&
+                              chain < DEFLATE_MAX_CHAIN && bestLength < maxLength;
+           chain++) {
+        size_t length = 0;
+        while (length < maxLength && data[candidate + length] == data[position + length]) {
+          length++;
+        }
+        if (length > bestLength) {
+          bestLength = length;
+          bestDistance = position - candidate;
+        }
+        candidate = previous[candidate];
+      }
+    }
+    if (bestLength >= 3) {
+      writeMatch(out, bestLength, bestDistance);
+      for (size_t i = 0; i < bestLength; i++) {
+        insert(position + i);
+      }
+      position += bestLength;
+    } else {
+      writeFixedSymbol(out, data[position]);
+      insert(position);
+      position++;
+    }
+  }
+  writeFixedSymbol(out, 256);
+  out.flush();
+  appendBigEndian32(out.bytes, adler32(data));
+  return out.bytes;
+}
+
+// ----------------------------------------------------------------------------
+// Inflate: stored, fixed and dynamic Huffman blocks
+// ----------------------------------------------------------------------------
+class BitReader {
+public:
+  BitReader(const std::vector<uint8_t> &data, size_t position) : _data(data), _position(position) {}
+
+  bool overrun = false;
+
+  uint32_t bits(uint8_t count) {
+    while (_count < count) {
+      if (_position >= _data.size()) {
+        overrun = true;
+        return 0;
+      }
+      _buffer |= (uint32_t)_data[_position++] << _count;
+      _count += 8;
+    }
+    uint32_t value = _buffer & ((1u << count) - 1);
+    _buffer >>= count;
+    _count -= count;
+    return value;
+  }
+
+  void alignToByte() {
+    _buffer = 0;
+    _count = 0;
+  }
+
+  bool readBytes(std::vector<uint8_t> &out, size_t length) {
+    if (_data.size() - _position < length) {
+      overrun = true;
+      return false;
+    }
+    out.insert(out.end(), _data.begin() + _position, _data.begin() + _position + length);
+    _position += length;
+    return true;
+  }
+
+private:
+  const std::vector<uint8_t> &_data;
+  size_t _position;
+  uint32_t _buffer = 0;
+  uint8_t _count = 0;
+};
+
+// Canonical Huffman code: the number of codes per length and the symbols ordered by code.
+typedef struct Huffman {
+  uint16_t counts[16];
+  uint16_t symbols[288];
+} Huffman;
+
+bool buildHuffman(Huffman &huffman, const uint8_t *lengths, uint16_t n) {
+  std::fill(std::begin(huffman.counts), std::end(huffman.counts), 0);
+  for (uint16_t symbol = 0; symbol < n; symbol++) {
+    huffman.counts[lengths[symbol]]++;
+  }
+  // over-subscribed lengths can't be decoded
+  int32_t left = 1;
+  for (uint8_t length = 1; length < 16; length++) {
+    left = (left << 1) - huffman.counts[length];
+    if (left < 0) {
+      return false;
+    }
+  }
+  uint16_t offsets[16] = {0};
+  for (uint8_t length = 1; length < 15; length++) {
+    offsets[length + 1] = offsets[length] + huffman.counts[length];
+  }
+  for (uint16_t symbol = 0; symbol < n; symbol++) {
+    if (lengths[symbol] != 0) {
+      huffman.symbols[offsets[lengths[symbol]]++] = symbol;
+    }
+  }
+  return true;
+}
+
+int32_t decodeSymbol(BitReader &in, const Huffman &huffman) {
+  int32_t code = 0, first = 0, index = 0;
+  for (uint8_t length = 1; length < 16; length++) {
+    code |= in.bits(1);
+    int32_t count = huffman.counts[length];
+    if (code - count < first) {
+      return huffman.symbols[index + (code - first)];
+    }
+    index += count;
+    first = (first + count) << 1;
+    code <<= 1;
+  }
+  return -1;
+}
+
+bool inflateCodes(BitReader &in, std::vector<uint8_t> &out, const Huffman &literals,
+                  const Huffman &distances) {
+  while (!in.overrun) {
+    int32_t symbol = decodeSymbol(in, literals);
+    if (symbol < 0 || symbol > 285) {
+      return false;
+    }
+    if (symbol < 256) {
+      out.push_back(symbol);
+      continue;
+    }
+    if (symbol == 256) {
+      return true;
+    }
+    symbol -= 257;
+    size_t length = LENGTH_BASE[symbol] + in.bits(LENGTH_EXTRA[symbol]);
+    symbol = decodeSymbol(in, distances);
+    if (symbol < 0 || symbol > 29) {
+      return false;
+    }
+    size_t distance = DISTANCE_BASE[symbol] + in.bits(DISTANCE_EXTRA[symbol]);
+    if (distance > out.size()) {
+      return false;
+    }
+    for (size_t i = 0; i < length; i++) {
+      out.push_back(out[out.size() - distance]);
+    }
+  }
+  return false;
+}
+
+bool inflateFixed(BitReader &in, std::vector<uint8_t> &out) {
+  uint8_t lengths[288 + 30];
+  std::fill(lengths, lengths + 144, 8);
+  std::fill(lengths + 144, lengths + 256, 9);
+  std::fill(lengths + 256, lengths + 280, 7);
+  std::fill(lengths + 280, lengths + 288, 8);
+  std::fill(lengths + 288, lengths + 288 + 30, 5);
+  Huffman literals, distances;
+  buildHuffman(literals, lengths, 288);
+  buildHuffman(distances, lengths + 288, 30);
+  return inflateCodes(in, out, literals, distances);
+}
+
+bool inflateDynamic(BitReader &in, std::vector<uint8_t> &out) {
+  uint16_t literalCount = in.bits(5) + 257;
+  uint16_t distanceCount = in.bits(5) + 1;
+  uint16_t codeLengthCount = in.bits(4) + 4;
+  if (literalCount > 286 || distanceCount > 30) {
+    return false;
+  }
+  uint8_t lengths[288 + 30] = {0};
+  for (uint16_t i = 0; i < codeLengthCount; i++) {
+    lengths[CODE_LENGTH_ORDER[i]] = in.bits(3);
+  }
+  Huffman codeLengths;
+  if (!buildHuffman(codeLengths, lengths, 19)) {
+    return false;
+  }
+
+  std::fill(std::begin(lengths), std::end(lengths), 0);
+  uint16_t index = 0;
+  while (index < literalCount + distanceCount) {
+    int32_t symbol = decodeSymbol(in, codeLengths);
+    if (symbol < 0 || in.overrun) {
+      return false;
+    }
+    if (symbol < 16) {
+      lengths[index++] = symbol;
+      continue;
+    }
+    uint8_t repeated = 0;
+    uint8_t times;
+    if (symbol == 16) {
+      if (index == 0) {
+        return false;
+      }
+      repeated = lengths[index - 1];
+      times = 3 + in.bits(2);
+    } else if (symbol == 17) {
+      times = 3 + in.bits(3);
+    } else {
+      times = 11 + in.bits(7);
+    }
+    if (index + times > literalCount + distanceCount) {
+      return false;
+    }
+    while (times-- > 0) {
+      lengths[index++] = repeated;
+    }
+  }
+
+  Huffman literals, distances;
+  return buildHuffman(literals, lengths, literalCount) &&
+         buildHuffman(distances, lengths + literalCount, distanceCount) &&
+         inflateCodes(in, out, literals, distances);
+}
+
+bool zlibDecompress(const std::vector<uint8_t> &data, std::vector<uint8_t> &out) {
+  // deflate, no preset dictionary
+  if (data.size() < 2 || (data[0] & 0x0F) != 8 || (data[1] & 0x20) != 0) {
+    return false;
+  }
+  BitReader in(data, 2);
+  bool final = false;
+  while (!final) {
+    final = in.bits(1);
+    uint8_t type = in.bits(2);
+    bool inflated;
+    if (type == 0) {
+      in.alignToByte();
+      std::vector<uint8_t> header;
+      if (!in.readBytes(header, 4)) {
+        return false;
+      }
+      uint16_t length = header[0] | header[1] << 8;
+      uint16_t lengthComplement = header[2] | header[3] << 8;
+      inflated = length == (uint16_t)~lengthComplement && in.readBytes(out, length);
+    } else if (type == 1) {
+      inflated = inflateFixed(in, out);
+    } else if (type == 2) {
+      inflated = inflateDynamic(in, out);
+    } else {
+      return false;
+    }
+    if (!inflated || in.overrun) {
+      return false;
+    }
+  }
+  return true;
+}
+
+uint8_t paeth(uint8_t left, uint8_t up, uint8_t upLeft) {
+  int16_t estimate = left + up - upLeft;
+  int16_t distanceLeft = abs(estimate - left);
+  int16_t distanceUp = abs(estimate - up);
+  int16_t distanceUpLeft = abs(estimate - upLeft);
+  if (distanceLeft <= distanceUp && distanceLeft <= distanceUpLeft) {
+    return left;
+  }
+  return distanceUp <= distanceUpLeft ? up : upLeft;
+}
+
+void appendChunk(std::vector<uint8_t> &out, const char *type, const std::vector<uint8_t> &data) {
+  appendBigEndian32(out, data.size());
+  size_t start = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), data.begin(), data.end());
+  appendBigEndian32(out, crc32(out.data() + start, out.size() - start));
+}
+
+} // namespace
+
+bool readPng(const std::string &path, PngImage &image) {
+  std::ifstream file(path, std::ios::binary);
+  std::vector<uint8_t> png((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+  if (png.size() < sizeof(PNG_SIGNATURE) ||
+      !std::equal(std::begin(PNG_SIGNATURE), std::end(PNG_SIGNATURE), png.begin())) {
+    return false;
+  }
+
+  uint8_t bytesPerPixel = 0;
+  std::vector<uint8_t> compressed;
+  size_t position = sizeof(PNG_SIGNATURE);
+  while (true) {
+    if (png.size() - position < 12) {
+      return false;
+    }
+    uint32_t length = readBigEndian32(&png[position]);
+    if (png.size() - position - 12 < length) {
+      return false;
+    }
+    const uint8_t *type = &png[position + 4];
+    const uint8_t *data = type + 4;
+    if (crc32(type, length + 4) != readBigEndian32(data + length)) {
+      return false;
+    }
+    position += 12 + length;
+
+    if (std::equal(type, type + 4, "IHDR")) {
+      // 8 bits per channel, no interlacing
+      if (length != 13 || data[8] != 8 || data[12] != 0) {
+        return false;
+      }
+      image.width = readBigEndian32(data);
+      image.height = readBigEndian32(data + 4);
+      if (data[9] == COLOR_TYPE_RGB) {
+        bytesPerPixel = 3;
+      } else if (data[9] == COLOR_TYPE_RGBA) {
+        bytesPerPixel = 4;
+      } else {
+        return false;
+      }
+    } else if (std::equal(type, type + 4, "IDAT")) {
+      compressed.insert(compressed.end(), data, data + length);
+    } else if (std::equal(type, type + 4, "IEND")) {
+      break;
+    }
+  }
+
+  std::vector<uint8_t> filtered;
+  size_t stride = (size_t)image.width * bytesPerPixel;
+  if (bytesPerPixel == 0 || !zlibDecompress(compressed, filtered) ||
+      filtered.size() < (stride + 1) * image.height) {
+    return false;
+  }
+  std::vector<uint8_t> previousRow(stride, 0), row(stride);
+  image.rgb.clear();
+  image.rgb.reserve((size_t)image.width * image.height * 3);
+  for (uint32_t y = 0; y < image.height; y++) {
+    const uint8_t *line = &filtered[y * (stride + 1)];
+    uint8_t filter = line[0];
+    for (size_t i = 0; i < stride; i++) {
+      uint8_t left = i >= bytesPerPixel ? row[i - bytesPerPixel] : 0;
+      uint8_t upLeft = i >= bytesPerPixel ? previousRow[i - bytesPerPixel] : 0;
+      uint8_t up = previousRow[i];
+      uint8_t predicted;
+      switch (filter) {
+        case 0: predicted = 0; break;
+        case 1: predicted = left; break;
+        case 2: predicted = up; break;
+        case 3: predicted = (left + up) / 2; break;
+        case 4: predicted = paeth(left, up, upLeft); break;
+        default: return false;
+      }
+      row[i] = line[1 + i] + predicted;
+    }
+    for (uint32_t x = 0; x < image.width; x++) {
+      image.rgb.insert(image.rgb.end(), &row[x * bytesPerPixel], &row[x * bytesPerPixel] + 3);
+    }
+    std::swap(row, previousRow);
+  }
+  return true;
+}
+
+bool writePng(const std::string &path, const PngImage &image) {
+  std::vector<uint8_t> header;
+  appendBigEndian32(header, image.width);
+  appendBigEndian32(header, image.height);
+  // 8 bits per channel, RGB, deflate, adaptive filtering, no interlacing
+  header.insert(header.end(), {8, COLOR_TYPE_RGB, 0, 0, 0});
+
+  // every row filtered by the one above, the widgets' flat backgrounds compress best that way
+  size_t stride = (size_t)image.width * 3;
+  std::vector<uint8_t> filtered;
+  filtered.reserve((stride + 1) * image.height);
+  for (uint32_t y = 0; y < image.height; y++) {
+    filtered.push_back(FILTER_UP);
+    for (size_t i = 0; i < stride; i++) {
+      uint8_t up = y > 0 ? image.rgb[(y - 1) * stride + i] : 0;
+      filtered.push_back(image.rgb[y * stride + i] - up);
+    }
+  }
+
+  std::vector<uint8_t> png(std::begin(PNG_SIGNATURE), std::end(PNG_SIGNATURE));
+  appendChunk(png, "IHDR", header);
+  appendChunk(png, "IDAT", zlibCompress(filtered));
+  appendChunk(png, "IEND", {});
+  std::ofstream file(path, std::ios::binary);
+  file.write((const char *)png.data(), png.size());
+  return file.good();
+}
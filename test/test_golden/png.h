@@ -0,0 +1,22 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+/**
+ * Just enough PNG for the golden images, without depending on zlib: writes 8-bit RGB, reads 8-bit
+ * RGB and RGBA (alpha dropped) that isn't interlaced. Pixels are rows top-down of r, g, b bytes.
+ */
+typedef struct PngImage {
+  uint32_t width = 0;
+  uint32_t height = 0;
+  std::vector<uint8_t> rgb;
+} PngImage;
+
+bool readPng(const std::string &path, PngImage &image);
+bool writePng(const std::string &path, const PngImage &image);
@@ -0,0 +1,216 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <unity.h>
+
+#include <stdlib.h>
+
+#include <chrono>
+#include <string>
+
+// the widgets and their globals as the firmware has them, setup() and loop() aren't called. Text
+// comes out as the blocks of the OpenFontRender stand-in, icons and the clock digits are the real
+// ones.
+#include "main.cpp"
+#include "png.h"
+
+// Tue, 2023-06-13 14:34:56 CEST
+#define FIXTURE_TIME 1686659696
+// per channel, other OpenFontRender or compiler builds may anti-alias a little differently
+#define GOLDEN_CHANNEL_TOLERANCE 24
+// pixels per thousand that may differ by more than that
+#define GOLDEN_MAX_DIFFERING_PER_MILLE 2
+
+// what drawProgress() paints: the text line and the bar below it
+RectangleDef progressPos = {0, 210, 320, 65};
+// the glyph sheet, two lines per font size the widgets use
+RectangleDef glyphsPos = {0, 0, 320, 300};
+
+std::string goldenPath(const char *name, const char *suffix) {
+  std::string file = __FILE__;
+  return file.substr(0, file.find_last_of('/') + 1) + "goldens/" + name + suffix;
+}
+
+PngImage capture(RectangleDef area) {
+  PngImage image;
+  image.width = area.width;
+  image.height = area.height;
+  for (uint16_t y = area.y; y < area.y + area.height; y++) {
+    for (uint16_t x = area.x; x < area.x + area.width; x++) {
+      uint16_t color = tft.readPixel(x, y);
+      uint8_t r = color >> 11, g = (color >> 5) & 0x3F, b = color & 0x1F;
+      image.rgb.insert(image.rgb.end(),
+                       {(uint8_t)(r << 3 | r >> 2), (uint8_t)(g << 2 | g >> 4),
+                        (uint8_t)(b << 3 | b >> 2)});
+    }
+  }
+  return image;
+}
+
+// Renders a widget onto a black screen with the fixture data, reports its render time and what it
+// pushed to the display, and compares its area with goldens/<name>.png. With UPDATE_GOLDENS set in
+// the environment the golden is written instead.
+void assertWidgetMatchesGolden(const char *name, RectangleDef area, bool (*draw)()) {
+  tft.fillScreen(TFT_BLACK);
+  tft.nativeResetStats();
+  auto start = std::chrono::steady_clock::now();
+  TEST_ASSERT_TRUE_MESSAGE(draw(), "the widget wasn't drawn");
+  blitPipeline.flush();
+  uint64_t renderMicros = std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+  NativeTransferStats stats = tft.nativeStats();
+  char message[128];
+  snprintf(message, sizeof(message), "%s: %lluus, %llu pixels in %lu address windows", name,
+           (unsigned long long)renderMicros, (unsigned long long)stats.pixels,
+           (unsigned long)stats.windows);
+  TEST_MESSAGE(message);
+
+  PngImage actual = capture(area);
+  if (getenv("UPDATE_GOLDENS") != nullptr) {
+    TEST_ASSERT_TRUE_MESSAGE(writePng(goldenPath(name, ".png"), actual), "can't write the golden");
+    return;
+  }
+  PngImage golden;
+  if (!readPng(goldenPath(name, ".png"), golden)) {
+    writePng(goldenPath(name, ".actual.png"), actual);
+    snprintf(message, sizeof(message), "no golden image %s.png, run with UPDATE_GOLDENS=1", name);
+    TEST_FAIL_MESSAGE(message);
+  }
+  TEST_ASSERT_EQUAL(actual.width, golden.width);
+  TEST_ASSERT_EQUAL(actual.height, golden.height);
+
+  uint32_t differing = 0;
+  for (size_t i = 0; i < actual.rgb.size(); i += 3) {
+    for (uint8_t channel = 0; channel < 3; channel++) {
+      if (abs(actual.rgb[i + channel] - golden.rgb[i + channel]) > GOLDEN_CHANNEL_TOLERANCE) {
+        differing++;
+        break;
+      }
+    }
+  }
+  if (differing * 1000 > (uint32_t)area.width * area.height * GOLDEN_MAX_DIFFERING_PER_MILLE) {
+    // to look at next to the golden
+    writePng(goldenPath(name, ".actual.png"), actual);
+    snprintf(message, sizeof(message), "%lu pixels differ from %s.png, see %s.actual.png",
+             (unsigned long)differing, name, name);
+    TEST_FAIL_MESSAGE(message);
+  }
+}
+
+void loadFixtures() {
+  nativeSetTime(FIXTURE_TIME);
+  weatherFetchedAt = FIXTURE_TIME - 600;
+  // shows the staleness indicator, no matter what time the host has
+  weatherFromFile = true;
+
+  currentWeather = {};
+  currentWeather.lat = 47.3769;
+  currentWeather.lon = 8.5417;
+  currentWeather.temp = 23.4;
+  currentWeather.feelsLike = 22.9;
+  currentWeather.windSpeed = 3.2;
+  currentWeather.windDeg = 225;
+  currentWeather.weatherId = 802;
+  currentWeather.pressure = 1016;
+  currentWeather.humidity = 58;
+  currentWeather.observationTime = weatherFetchedAt;
+  currentWeather.sunrise = 1686626460;
+  currentWeather.sunset = 1686684180;
+  strlcpy(currentWeather.description, "scattered clouds", sizeof(currentWeather.description));
+  strlcpy(currentWeather.cityName, "Zurich", sizeof(currentWeather.cityName));
+
+  // Wednesday to Saturday: sun, rain, thunderstorm, snow
+  dayForecasts[0] = {14.2, 26.8, 800, 12, 3, 0, 3.1, 800, true};
+  dayForecasts[1] = {13.5, 21.0, 500, 12, 4, 4.2, 5.6, 500, true};
+  dayForecasts[2] = {15.9, 24.4, 211, 15, 5, 11.8, 8.9, 211, true};
+  dayForecasts[3] = {-1.3, 2.6, 601, 12, 6, 6.5, 4.0, 601, true};
+}
+
+void setUp() {
+  // redraw every widget, whatever it was last drawn with
+  clockWidget.drawn = false;
+  currentWeatherWidget.drawn = false;
+  forecastWidget.drawn = false;
+  astroWidget.drawn = false;
+}
+
+void tearDown() {}
+
+void test_time_and_date() {
+  assertWidgetMatchesGolden("time-and-date", timeSpritePos, []() {
+    drawTimeAndDate();
+    return clockWidget.drawn;
+  });
+}
+
+void test_current_weather() {
+  assertWidgetMatchesGolden("current-weather", currentWeatherPos, drawCurrentWeather);
+}
+
+void test_forecast() {
+  assertWidgetMatchesGolden("forecast", forecastPos, drawForecast);
+}
+
+void test_astro() {
+  assertWidgetMatchesGolden("astro", astroPos, drawAstro);
+}
+
+void test_progress() {
+  assertWidgetMatchesGolden("progress", progressPos, []() {
+    drawProgress("Updating forecast...", 90);
+    return true;
+  });
+}
+
+// The glyphs the widgets draw at every size they use, anti-aliased against a background that isn't
+// black. Drawn through the glyph cache, and straight through OpenFontRender against the same
+// golden: the cached masks must land where OpenFontRender puts its glyphs, with the same blend.
+// The shapes are the stand-in's boxes, not the font's outlines, so this covers placement, advances
+// and blending; what FreeType makes of the font is only seen on the device.
+template <typename Render> bool drawGlyphs(Render &render) {
+  tft.fillRect(glyphsPos.x, glyphsPos.y, glyphsPos.width, glyphsPos.height, TFT_NAVY);
+  render.setDrawer(tft);
+  render.setFontColor(TFT_YELLOW);
+  render.setBackgroundColor(TFT_NAVY);
+  int32_t y = 4;
+  for (uint8_t size : {14, 16, 18, 24, 48}) {
+    render.setFontSize(size);
+    render.drawString(size < 48 ? "0123456789 -.:% °C" : "23.4°C", 4, y);
+    y += size + 4;
+    render.cdrawString(size < 48 ? "Wäh km/h hPa" : "hPa", glyphsPos.width / 2, y);
+    y += size + 6;
+  }
+  return true;
+}
+
+void test_cached_glyphs() {
+  assertWidgetMatchesGolden("glyphs", glyphsPos, []() { return drawGlyphs(cfr); });
+}
+
+void test_uncached_glyphs() {
+  assertWidgetMatchesGolden("glyphs", glyphsPos, []() { return drawGlyphs(ofr); });
+}
+
+int main(int argc, char **argv) {
+  // what setup() does, without the touch screen, the network and the tasks
+  initTft(&tft);
+  blitPipeline.begin();
+  timeSprite.createSprite(timeSpritePos.width, timeSpritePos.height);
+  initFileSystem();
+  initTime();
+  initOpenFontRender();
+  initClockLayout();
+  ui.openIconAtlas();
+  loadFixtures();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_time_and_date);
+  RUN_TEST(test_current_weather);
+  RUN_TEST(test_forecast);
+  RUN_TEST(test_astro);
+  RUN_TEST(test_progress);
+  RUN_TEST(test_cached_glyphs);
+  RUN_TEST(test_uncached_glyphs);
+  return UNITY_END();
+}
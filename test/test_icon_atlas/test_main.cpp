@@ -0,0 +1,275 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "IconAtlas.h"
+
+#define ATLAS_FILE "/icons.atlas"
+// about as many icons as data/ has, of a typical palette and RLE size
+#define BENCHMARK_ICONS 70
+#define BENCHMARK_ICON_BYTES 3000
+#define BENCHMARK_ROUNDS 20
+
+typedef struct TestIcon {
+  std::string path;
+  std::string content;
+} TestIcon;
+
+std::vector<TestIcon> icons = {
+    {"/weather/01d.icon", "sunny"},
+    {"/weather/10n.icon", "rainy night"},
+    {"/moon/m-phase-3.icon", "a quarter"},
+};
+
+uint32_t fnv1a(const std::string &text) {
+  uint32_t hash = 2166136261u;
+  for (char c : text) {
+    hash = (hash ^ (uint8_t)c) * 16777619u;
+  }
+  return hash;
+}
+
+void append32(std::string &out, uint32_t value) {
+  out.append((const char *)&value, sizeof(value));
+}
+
+// index entry i starts at 8 + 12 * i, the records follow the index
+std::string atlasBytes(const std::vector<TestIcon> &content) {
+  std::vector<TestIcon> sorted = content;
+  std::sort(sorted.begin(), sorted.end(), [](const TestIcon &a, const TestIcon &b) {
+    return fnv1a(a.path) < fnv1a(b.path);
+  });
+  std::string atlas;
+  append32(atlas, ICON_ATLAS_MAGIC);
+  append32(atlas, sorted.size());
+  std::string records;
+  uint32_t offset = 8 + sorted.size() * 12;
+  for (const TestIcon &icon : sorted) {
+    std::string record = icon.path + '\0' + icon.content;
+    append32(atlas, fnv1a(icon.path));
+    append32(atlas, offset + records.size());
+    append32(atlas, record.size());
+    records += record;
+  }
+  return atlas + records;
+}
+
+void writeFile(const std::string &content) {
+  File file = LittleFS.open(ATLAS_FILE, "w");
+  file.write((const uint8_t *)content.data(), content.size());
+  file.close();
+}
+
+void writeAtlas(const std::vector<TestIcon> &content) {
+  writeFile(atlasBytes(content));
+}
+
+void set32(std::string &atlas, size_t offset, uint32_t value) {
+  memcpy(&atlas[offset], &value, sizeof(value));
+}
+
+std::string readIcon(IconAtlas &atlas, const char *path) {
+  size_t size = 0;
+  fs::File *file = atlas.open(path, &size);
+  if (file == nullptr) {
+    return "<missing>";
+  }
+  std::string content(size, '\0');
+  file->read((uint8_t *)&content[0], size);
+  atlas.close();
+  return content;
+}
+
+void setUp() {
+  TEST_ASSERT_TRUE(LittleFS.nativeMountTemporary());
+}
+
+void tearDown() {}
+
+void test_finds_every_icon() {
+  writeAtlas(icons);
+  IconAtlas atlas;
+  TEST_ASSERT_TRUE(atlas.begin(LittleFS, ATLAS_FILE));
+  TEST_ASSERT_EQUAL(icons.size(), atlas.count());
+  // in another order than stored, each lookup seeks
+  for (auto icon = icons.rbegin(); icon != icons.rend(); icon++) {
+    TEST_ASSERT_EQUAL_STRING(icon->content.c_str(), readIcon(atlas, icon->path.c_str()).c_str());
+  }
+}
+
+void test_unknown_icon() {
+  writeAtlas(icons);
+  IconAtlas atlas;
+  TEST_ASSERT_TRUE(atlas.begin(LittleFS, ATLAS_FILE));
+  TEST_ASSERT_EQUAL_STRING("<missing>", readIcon(atlas, "/weather/02d.icon").c_str());
+}
+
+void test_without_atlas() {
+  IconAtlas atlas;
+  TEST_ASSERT_FALSE(atlas.begin(LittleFS, ATLAS_FILE));
+  TEST_ASSERT_EQUAL_STRING("<missing>", readIcon(atlas, "/weather/01d.icon").c_str());
+}
+
+void test_rejects_other_files() {
+  File file = LittleFS.open(ATLAS_FILE, "w");
+  file.write((const uint8_t *)"R565\x10\x00\x10\x00", 8);
+  file.close();
+  IconAtlas atlas;
+  TEST_ASSERT_FALSE(atlas.begin(LittleFS, ATLAS_FILE));
+}
+
+void test_same_hash_other_path() {
+  // the entry of /weather/01d.icon filed under the hash of /weather/02d.icon
+  std::string atlas = atlasBytes({{"/weather/01d.icon", "sunny"}});
+  set32(atlas, 8, fnv1a("/weather/02d.icon"));
+  writeFile(atlas);
+  IconAtlas iconAtlas;
+  TEST_ASSERT_TRUE(iconAtlas.begin(LittleFS, ATLAS_FILE));
+  TEST_ASSERT_EQUAL_STRING("<missing>", readIcon(iconAtlas, "/weather/02d.icon").c_str());
+}
+
+void test_rejects_count_beyond_file() {
+  std::string atlas = atlasBytes(icons);
+  // times 12 overflows 32 bits
+  set32(atlas, 4, 0x20000000);
+  writeFile(atlas);
+  IconAtlas iconAtlas;
+  TEST_ASSERT_FALSE(iconAtlas.begin(LittleFS, ATLAS_FILE));
+  TEST_ASSERT_EQUAL_STRING("<missing>", readIcon(iconAtlas, "/weather/01d.icon").c_str());
+
+  set32(atlas, 4, icons.size() + 1);
+  writeFile(atlas.substr(0, 8 + 12 * icons.size() + 4));
+  TEST_ASSERT_FALSE(iconAtlas.begin(LittleFS, ATLAS_FILE));
+}
+
+void test_rejects_entries_outside_file() {
+  std::string atlas = atlasBytes(icons);
+  // an offset beyond the end
+  set32(atlas, 8 + 4, atlas.size() + 1);
+  writeFile(atlas);
+  IconAtlas beyondEnd;
+  TEST_ASSERT_FALSE(beyondEnd.begin(LittleFS, ATLAS_FILE));
+
+  // a size running past the end, offset + size overflowing
+  atlas = atlasBytes(icons);
+  set32(atlas, 8 + 12 + 8, 0xFFFFFFF0);
+  writeFile(atlas);
+  IconAtlas tooLarge;
+  TEST_ASSERT_FALSE(tooLarge.begin(LittleFS, ATLAS_FILE));
+
+  // an offset into the index
+  atlas = atlasBytes(icons);
+  set32(atlas, 8 + 4, 8);
+  writeFile(atlas);
+  IconAtlas intoIndex;
+  TEST_ASSERT_FALSE(intoIndex.begin(LittleFS, ATLAS_FILE));
+}
+
+void test_file_locked_until_closed() {
+  writeAtlas(icons);
+  IconAtlas atlas;
+  TEST_ASSERT_TRUE(atlas.begin(LittleFS, ATLAS_FILE));
+  size_t size = 0;
+  TEST_ASSERT_NOT_NULL(atlas.open("/weather/01d.icon", &size));
+  std::atomic<bool> opened(false);
+  std::thread other([&]() {
+    size_t otherSize = 0;
+    opened = atlas.open("/moon/m-phase-3.icon", &otherSize) != nullptr;
+    atlas.close();
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  TEST_ASSERT_FALSE(opened);
+  atlas.close();
+  other.join();
+  TEST_ASSERT_TRUE(opened);
+}
+
+uint64_t elapsedNanos(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                              start)
+      .count();
+}
+
+// Every icon read through the atlas and as a file of its own, the way GfxUi did before: exists(),
+// open(), read. The host's file system is much faster than LittleFS on flash, so the time is only
+// reported; the path lookups are what walks the LittleFS metadata on the device.
+void test_benchmark_against_separate_files() {
+  std::vector<TestIcon> files;
+  LittleFS.mkdir("/weather");
+  for (int i = 0; i < BENCHMARK_ICONS; i++) {
+    TestIcon icon = {"/weather/icon-" + std::to_string(i) + ".icon",
+                     std::string(BENCHMARK_ICON_BYTES, (char)i)};
+    File file = LittleFS.open(icon.path.c_str(), "w");
+    file.write((const uint8_t *)icon.content.data(), icon.content.size());
+    file.close();
+    files.push_back(icon);
+  }
+  writeAtlas(files);
+  IconAtlas atlas;
+  TEST_ASSERT_TRUE(atlas.begin(LittleFS, ATLAS_FILE));
+  std::vector<uint8_t> buffer(BENCHMARK_ICON_BYTES);
+
+  uint32_t lookups = LittleFS.nativePathLookups();
+  auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < BENCHMARK_ROUNDS; round++) {
+    for (const TestIcon &icon : files) {
+      TEST_ASSERT_TRUE(LittleFS.exists(icon.path.c_str()));
+      File file = LittleFS.open(icon.path.c_str(), "r");
+      TEST_ASSERT_EQUAL(BENCHMARK_ICON_BYTES, file.read(buffer.data(), BENCHMARK_ICON_BYTES));
+      file.close();
+    }
+  }
+  uint64_t fileNanos = elapsedNanos(start);
+  uint32_t fileLookups = LittleFS.nativePathLookups() - lookups;
+
+  lookups = LittleFS.nativePathLookups();
+  start = std::chrono::steady_clock::now();
+  for (int round = 0; round < BENCHMARK_ROUNDS; round++) {
+    for (const TestIcon &icon : files) {
+      size_t size = 0;
+      fs::File *file = atlas.open(icon.path.c_str(), &size);
+      TEST_ASSERT_NOT_NULL(file);
+      TEST_ASSERT_EQUAL(BENCHMARK_ICON_BYTES, file->read(buffer.data(), size));
+      atlas.close();
+    }
+  }
+  uint64_t atlasNanos = elapsedNanos(start);
+  uint32_t atlasLookups = LittleFS.nativePathLookups() - lookups;
+
+  uint32_t reads = BENCHMARK_ROUNDS * BENCHMARK_ICONS;
+  char message[160];
+  snprintf(message, sizeof(message),
+           "%d icons of %d bytes: files %lluns and %lu path lookups per icon, atlas %lluns and "
+           "%lu path lookups per icon",
+           BENCHMARK_ICONS, BENCHMARK_ICON_BYTES, (unsigned long long)(fileNanos / reads),
+           (unsigned long)(fileLookups / reads), (unsigned long long)(atlasNanos / reads),
+           (unsigned long)(atlasLookups / reads));
+  TEST_MESSAGE(message);
+  TEST_ASSERT_EQUAL_UINT32(2 * reads, fileLookups);
+  // the atlas was opened once by begin()
+  TEST_ASSERT_EQUAL_UINT32(0, atlasLookups);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_finds_every_icon);
+  RUN_TEST(test_unknown_icon);
+  RUN_TEST(test_without_atlas);
+  RUN_TEST(test_rejects_other_files);
+  RUN_TEST(test_same_hash_other_path);
+  RUN_TEST(test_rejects_count_beyond_file);
+  RUN_TEST(test_rejects_entries_outside_file);
+  RUN_TEST(test_file_locked_until_closed);
+  RUN_TEST(test_benchmark_against_separate_files);
+  return UNITY_END();
+}
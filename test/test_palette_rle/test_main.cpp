@@ -0,0 +1,328 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <unity.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "GfxUi.h"
+#include "IconAtlas.h"
+
+#define ICON_FILE "/weather/01d.icon"
+#define ICON_X 40
+#define ICON_Y 60
+#define MOON_PHASES 32
+#define BENCHMARK_ROUNDS 20
+
+TFT_eSPI tft = TFT_eSPI();
+OpenFontRender ofr;
+// never begun, pushes go to the TFT right away
+BlitPipeline pipeline(&tft);
+
+void append16(std::string &out, uint16_t value) {
+  out += (char)(value & 0xFF);
+  out += (char)(value >> 8);
+}
+
+// colors go into the icon big-endian, in display byte order
+void appendColor(std::string &out, uint16_t color) {
+  out += (char)(color >> 8);
+  out += (char)(color & 0xFF);
+}
+
+std::string paletteIcon(uint16_t w, uint16_t h, const std::vector<uint16_t> &palette,
+                        const std::string &packets) {
+  std::string icon = "PRLE";
+  append16(icon, w);
+  append16(icon, h);
+  append16(icon, palette.size());
+  for (uint16_t color : palette) {
+    appendColor(icon, color);
+  }
+  return icon + packets;
+}
+
+void writeIcon(const std::string &content) {
+  File file = LittleFS.open(ICON_FILE, "w");
+  file.write((const uint8_t *)content.data(), content.size());
+  file.close();
+}
+
+void assertRow(uint16_t y, const std::vector<uint16_t> &colors) {
+  for (size_t i = 0; i < colors.size(); i++) {
+    TEST_ASSERT_EQUAL_HEX16(colors[i], tft.readPixel(ICON_X + i, ICON_Y + y));
+  }
+}
+
+void setUp() {
+  TEST_ASSERT_TRUE(LittleFS.nativeMountTemporary());
+  LittleFS.mkdir("/weather");
+  nativeSetPsramFound(false);
+  tft.init();
+  tft.fillScreen(TFT_DARKGREY);
+}
+
+void tearDown() {}
+
+void test_runs_and_literals() {
+  // row 0: a run of 3 reds and a literal blue, green; row 1: a literal of 5
+  writeIcon(paletteIcon(5, 2, {TFT_RED, TFT_GREEN, TFT_BLUE},
+                        std::string("\x82\x00\x01\x02\x01", 5) +
+                            std::string("\x04\x02\x02\x01\x00\x02", 6)));
+  GfxUi ui(&tft, &ofr, &pipeline);
+  ui.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  assertRow(0, {TFT_RED, TFT_RED, TFT_RED, TFT_BLUE, TFT_GREEN});
+  assertRow(1, {TFT_BLUE, TFT_BLUE, TFT_GREEN, TFT_RED, TFT_BLUE});
+  TEST_ASSERT_EQUAL_HEX16(TFT_DARKGREY, tft.readPixel(ICON_X + 5, ICON_Y));
+  TEST_ASSERT_EQUAL_HEX16(TFT_DARKGREY, tft.readPixel(ICON_X, ICON_Y + 2));
+}
+
+void test_longest_packets() {
+  // a row of 200: a run of 128 and a literal of 72
+  std::string packets = "\xFF\x01";
+  packets += (char)71;
+  for (int i = 0; i < 72; i++) {
+    packets += (char)(i % 2);
+  }
+  writeIcon(paletteIcon(200, 1, {TFT_BLACK, TFT_WHITE}, packets));
+  GfxUi ui(&tft, &ofr, &pipeline);
+  ui.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  TEST_ASSERT_EQUAL_HEX16(TFT_WHITE, tft.readPixel(ICON_X, ICON_Y));
+  TEST_ASSERT_EQUAL_HEX16(TFT_WHITE, tft.readPixel(ICON_X + 127, ICON_Y));
+  TEST_ASSERT_EQUAL_HEX16(TFT_BLACK, tft.readPixel(ICON_X + 128, ICON_Y));
+  TEST_ASSERT_EQUAL_HEX16(TFT_WHITE, tft.readPixel(ICON_X + 129, ICON_Y));
+  TEST_ASSERT_EQUAL_HEX16(TFT_WHITE, tft.readPixel(ICON_X + 199, ICON_Y));
+}
+
+void test_same_as_raw_icon() {
+  std::string raw = "R565";
+  append16(raw, 3);
+  append16(raw, 1);
+  for (uint16_t color : {TFT_YELLOW, TFT_YELLOW, TFT_CYAN}) {
+    appendColor(raw, color);
+  }
+  writeIcon(raw);
+  GfxUi ui(&tft, &ofr, &pipeline);
+  ui.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  assertRow(0, {TFT_YELLOW, TFT_YELLOW, TFT_CYAN});
+
+  tft.fillScreen(TFT_DARKGREY);
+  writeIcon(paletteIcon(3, 1, {TFT_YELLOW, TFT_CYAN}, std::string("\x81\x00\x00\x01", 4)));
+  GfxUi other(&tft, &ofr, &pipeline);
+  other.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  assertRow(0, {TFT_YELLOW, TFT_YELLOW, TFT_CYAN});
+}
+
+void test_packet_crossing_a_row() {
+  // a run of 4 in an icon 3 wide, nothing gets drawn
+  writeIcon(paletteIcon(3, 2, {TFT_RED}, std::string("\x83\x00\x81\x00", 4)));
+  GfxUi ui(&tft, &ofr, &pipeline);
+  ui.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  TEST_ASSERT_EQUAL_HEX16(TFT_DARKGREY, tft.readPixel(ICON_X, ICON_Y));
+}
+
+void test_index_outside_palette() {
+  writeIcon(paletteIcon(2, 1, {TFT_RED, TFT_GREEN}, std::string("\x01\x00\x02", 3)));
+  GfxUi ui(&tft, &ofr, &pipeline);
+  ui.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  TEST_ASSERT_EQUAL_HEX16(TFT_DARKGREY, tft.readPixel(ICON_X, ICON_Y));
+}
+
+void test_truncated_rows() {
+  // the second of two rows is missing, the first one still gets drawn
+  writeIcon(paletteIcon(2, 2, {TFT_RED}, std::string("\x81\x00", 2)));
+  GfxUi ui(&tft, &ofr, &pipeline);
+  ui.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  assertRow(0, {TFT_RED, TFT_RED});
+  TEST_ASSERT_EQUAL_HEX16(TFT_DARKGREY, tft.readPixel(ICON_X, ICON_Y + 1));
+}
+
+void test_cached_icon_redrawn() {
+  nativeSetPsramFound(true);
+  writeIcon(paletteIcon(2, 1, {TFT_RED, TFT_BLUE}, std::string("\x01\x00\x01", 3)));
+  GfxUi ui(&tft, &ofr, &pipeline);
+  ui.setIconCacheBudget(1024);
+  ui.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  // from the cache, the file is gone
+  LittleFS.remove(ICON_FILE);
+  tft.fillScreen(TFT_DARKGREY);
+  ui.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  assertRow(0, {TFT_RED, TFT_BLUE});
+}
+
+void test_streamed_without_cache_budget() {
+  nativeSetPsramFound(true);
+  std::string raw = "R565";
+  append16(raw, 100);
+  append16(raw, 100);
+  for (int i = 0; i < 100 * 100; i++) {
+    appendColor(raw, TFT_ORANGE);
+  }
+  writeIcon(raw);
+  GfxUi ui(&tft, &ofr, &pipeline);
+  ui.setIconCacheBudget(0);
+  size_t requested = nativePsramRequested();
+  ui.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  TEST_ASSERT_EQUAL(requested, nativePsramRequested());
+  TEST_ASSERT_EQUAL_HEX16(TFT_ORANGE, tft.readPixel(ICON_X + 99, ICON_Y + 99));
+}
+
+void test_header_out_of_bounds() {
+  GfxUi ui(&tft, &ofr, &pipeline);
+  std::string header = "PRLE";
+  append16(header, 2);
+  append16(header, 1);
+  // ends before the palette size
+  writeIcon(header);
+  ui.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  // more colors than the format allows, no colors at all
+  for (uint16_t colors : {PALETTE_RLE_MAX_COLORS + 1, 0}) {
+    std::string icon = header;
+    append16(icon, colors);
+    writeIcon(icon + std::string("\x00\x00\x01\x00\x00", 5));
+    ui.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  }
+  // the palette runs past the end of the file
+  writeIcon(paletteIcon(2, 1, {TFT_RED, TFT_GREEN, TFT_BLUE}, "").substr(0, 14));
+  ui.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  TEST_ASSERT_EQUAL_HEX16(TFT_DARKGREY, tft.readPixel(ICON_X, ICON_Y));
+}
+
+void test_size_out_of_bounds() {
+  GfxUi ui(&tft, &ofr, &pipeline);
+  // wider than the display and the pipeline buffers, no width at all
+  for (uint16_t w : {BLIT_PIPELINE_BUFFER_PIXELS + 1, 0}) {
+    writeIcon(paletteIcon(w, 1, {TFT_RED}, std::string("\xFF\x00", 2)));
+    ui.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  }
+  TEST_ASSERT_EQUAL_HEX16(TFT_DARKGREY, tft.readPixel(ICON_X, ICON_Y));
+  TEST_ASSERT_EQUAL(0, pipeline.rowsPerBuffer(0));
+  TEST_ASSERT_EQUAL(0, pipeline.rowsPerBuffer(BLIT_PIPELINE_BUFFER_PIXELS + 1));
+}
+
+void test_raw_icon_shorter_than_its_pixels() {
+  std::string raw = "R565";
+  append16(raw, 2);
+  append16(raw, 2);
+  for (uint16_t color : {TFT_YELLOW, TFT_YELLOW, TFT_CYAN}) {
+    appendColor(raw, color);
+  }
+  writeIcon(raw);
+  GfxUi ui(&tft, &ofr, &pipeline);
+  ui.drawIcon(ICON_FILE, ICON_X, ICON_Y);
+  TEST_ASSERT_EQUAL_HEX16(TFT_DARKGREY, tft.readPixel(ICON_X, ICON_Y));
+}
+
+void writeFile(const String &path, const std::string &content) {
+  File file = LittleFS.open(path, "w");
+  file.write((const uint8_t *)content.data(), content.size());
+  file.close();
+}
+
+String moonIconPath(const char *directory, int phase) {
+  return String(directory) + "/m-phase-" + String(phase) + ".icon";
+}
+
+typedef struct IconBenchmark {
+  size_t bytes = 0;
+  uint32_t micros = 0;
+  NativeTransferStats stats;
+} IconBenchmark;
+
+IconBenchmark benchmarkIcons(const char *directory) {
+  GfxUi ui(&tft, &ofr, &pipeline);
+  ui.setIconCacheBudget(0);
+  IconBenchmark result;
+  for (int phase = 0; phase < MOON_PHASES; phase++) {
+    result.bytes += LittleFS.open(moonIconPath(directory, phase)).size();
+  }
+  tft.nativeResetStats();
+  auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < BENCHMARK_ROUNDS; round++) {
+    for (int phase = 0; phase < MOON_PHASES; phase++) {
+      ui.drawIcon(moonIconPath(directory, phase), ICON_X, ICON_Y);
+    }
+  }
+  result.micros = std::chrono::duration_cast<std::chrono::microseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count() /
+                  (BENCHMARK_ROUNDS * MOON_PHASES);
+  result.stats = tft.nativeStats();
+  return result;
+}
+
+// The moon phases as scripts/convert_assets.py packs them into the atlas, mostly palette+RLE,
+// against the same pixels stored as raw RGB565 icons, the format the converter wrote before. Both
+// are drawn from separate files, so reading and decoding are all that differ. Host times are
+// reported; the file sizes and what reaches the display carry over to the device.
+void test_benchmark_against_raw_icons() {
+  fs::FS assets;
+  assets.nativeMount(NATIVE_FS_ROOT);
+  IconAtlas atlas;
+  TEST_ASSERT_TRUE_MESSAGE(atlas.begin(assets, "/icons.atlas"), "no atlas, see native_assets.py");
+  LittleFS.mkdir("/moon");
+  LittleFS.mkdir("/raw");
+
+  GfxUi ui(&tft, &ofr, &pipeline);
+  for (int phase = 0; phase < MOON_PHASES; phase++) {
+    String path = moonIconPath("/moon", phase);
+    size_t size;
+    fs::File *file = atlas.open(path, &size);
+    TEST_ASSERT_TRUE_MESSAGE(file != nullptr, path.c_str());
+    std::string icon(size, '\0');
+    TEST_ASSERT_EQUAL(size, file->read((uint8_t *)&icon[0], size));
+    atlas.close();
+    writeFile(path, icon);
+
+    // the raw icon is what the converted one draws
+    uint16_t w = (uint8_t)icon[4] | (uint8_t)icon[5] << 8;
+    uint16_t h = (uint8_t)icon[6] | (uint8_t)icon[7] << 8;
+    tft.fillScreen(TFT_DARKGREY);
+    ui.drawIcon(path, ICON_X, ICON_Y);
+    std::string raw = "R565";
+    append16(raw, w);
+    append16(raw, h);
+    for (uint16_t y = 0; y < h; y++) {
+      for (uint16_t x = 0; x < w; x++) {
+        appendColor(raw, tft.readPixel(ICON_X + x, ICON_Y + y));
+      }
+    }
+    writeFile(moonIconPath("/raw", phase), raw);
+  }
+
+  IconBenchmark converted = benchmarkIcons("/moon");
+  IconBenchmark raw = benchmarkIcons("/raw");
+  char message[192];
+  snprintf(message, sizeof(message),
+           "%d moon icons: converted %lu bytes, %luus per icon; raw RGB565 %lu bytes, %luus per "
+           "icon; %lu address windows per icon",
+           MOON_PHASES, (unsigned long)converted.bytes, (unsigned long)converted.micros,
+           (unsigned long)raw.bytes, (unsigned long)raw.micros,
+           (unsigned long)(converted.stats.windows / (BENCHMARK_ROUNDS * MOON_PHASES)));
+  TEST_MESSAGE(message);
+  TEST_ASSERT_LESS_THAN_UINT32((uint32_t)raw.bytes, (uint32_t)converted.bytes);
+  // the same pixels in the same windows
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)raw.stats.pixels, (uint32_t)converted.stats.pixels);
+  TEST_ASSERT_EQUAL_UINT32(raw.stats.windows, converted.stats.windows);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_runs_and_literals);
+  RUN_TEST(test_longest_packets);
+  RUN_TEST(test_same_as_raw_icon);
+  RUN_TEST(test_packet_crossing_a_row);
+  RUN_TEST(test_index_outside_palette);
+  RUN_TEST(test_truncated_rows);
+  RUN_TEST(test_cached_icon_redrawn);
+  RUN_TEST(test_streamed_without_cache_budget);
+  RUN_TEST(test_header_out_of_bounds);
+  RUN_TEST(test_size_out_of_bounds);
+  RUN_TEST(test_raw_icon_shorter_than_its_pixels);
+  RUN_TEST(test_benchmark_against_raw_icons);
+  return UNITY_END();
+}
@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "persistence.h"
+
+WeatherSnapshot saved;
+WeatherSnapshot loaded;
+
+void setUp() {
+  TEST_ASSERT_TRUE(LittleFS.nativeMountTemporary());
+  memset(&saved, 0, sizeof(saved));
+  memset(&loaded, 0, sizeof(loaded));
+  saved.fetchedAt = 1678870800;
+  CurrentWeatherData &current = saved.currentWeather;
+  current.temp = 12.5f;
+  current.windSpeed = 3.25f;
+  current.weatherId = 801;
+  current.pressure = 1013;
+  current.humidity = 71;
+  current.observationTime = 1678870500;
+  current.sunrise = 1678858200;
+  current.sunset = 1678901100;
+  strlcpy(current.description, "few clouds", sizeof(current.description));
+  strlcpy(current.cityName, "Zurich", sizeof(current.cityName));
+  ForecastStore &forecasts = saved.forecasts;
+  forecasts.count = NUMBER_OF_FORECASTS;
+  for (uint8_t i = 0; i < NUMBER_OF_FORECASTS; i++) {
+    forecasts.observationTime[i] = 1678881600 + i * 10800;
+    forecasts.tempCenti[i] = -250 + i * 25;
+    forecasts.weatherId[i] = 500 + i;
+    forecasts.windSpeedCenti[i] = 100 + i;
+    forecasts.precipitationCenti[i] = i * 10;
+  }
+  for (uint8_t i = 0; i < NUMBER_OF_DAY_FORECASTS; i++) {
+    saved.dayForecasts[i] = {-1.5f + i, 9.5f + i, 800 + i, 12, (4 + i) % 7, 0.5f * i, 4.0f, 801};
+  }
+}
+
+void tearDown() {}
+
+void test_round_trip() {
+  TEST_ASSERT_TRUE(saveWeatherSnapshot(&saved));
+  TEST_ASSERT_FALSE(LittleFS.exists(WEATHER_SNAPSHOT_TMP_FILE));
+  TEST_ASSERT_TRUE(loadWeatherSnapshot(&loaded));
+
+  TEST_ASSERT_EQUAL_INT64(saved.fetchedAt, loaded.fetchedAt);
+  TEST_ASSERT_EQUAL_MEMORY(&saved.currentWeather, &loaded.currentWeather,
+                           sizeof(CurrentWeatherData));
+  TEST_ASSERT_EQUAL(NUMBER_OF_FORECASTS, loaded.forecasts.count);
+  TEST_ASSERT_EQUAL_MEMORY(&saved.forecasts, &loaded.forecasts, sizeof(ForecastStore));
+  for (uint8_t i = 0; i < NUMBER_OF_DAY_FORECASTS; i++) {
+    const DayForecast &expected = saved.dayForecasts[i];
+    const DayForecast &actual = loaded.dayForecasts[i];
+    TEST_ASSERT_EQUAL_FLOAT(expected.minTemp, actual.minTemp);
+    TEST_ASSERT_EQUAL_FLOAT(expected.maxTemp, actual.maxTemp);
+    TEST_ASSERT_EQUAL(expected.conditionCode, actual.conditionCode);
+    TEST_ASSERT_EQUAL(expected.conditionHour, actual.conditionHour);
+    TEST_ASSERT_EQUAL(expected.day, actual.day);
+    TEST_ASSERT_EQUAL_FLOAT(expected.precipitation, actual.precipitation);
+    TEST_ASSERT_EQUAL_FLOAT(expected.maxWindSpeed, actual.maxWindSpeed);
+    TEST_ASSERT_EQUAL(expected.dominantConditionCode, actual.dominantConditionCode);
+  }
+}
+
+void test_missing_snapshot() {
+  TEST_ASSERT_FALSE(loadWeatherSnapshot(&loaded));
+}
+
+void test_truncated_snapshot_is_rejected() {
+  TEST_ASSERT_TRUE(saveWeatherSnapshot(&saved));
+  File file = LittleFS.open(WEATHER_SNAPSHOT_FILE, "r");
+  size_t size = file.size();
+  uint8_t content[size];
+  file.read(content, size);
+  file.close();
+
+  file = LittleFS.open(WEATHER_SNAPSHOT_FILE, "w");
+  file.write(content, size - 10);
+  file.close();
+  TEST_ASSERT_FALSE(loadWeatherSnapshot(&loaded));
+}
+
+void test_unknown_version_is_rejected() {
+  File file = LittleFS.open(WEATHER_SNAPSHOT_FILE, "w");
+  writeValue(file, (uint32_t)WEATHER_SNAPSHOT_MAGIC);
+  writeValue(file, (uint16_t)(WEATHER_SNAPSHOT_VERSION + 1));
+  file.close();
+  TEST_ASSERT_FALSE(loadWeatherSnapshot(&loaded));
+}
+
+void test_failed_write_keeps_previous_snapshot() {
+  TEST_ASSERT_TRUE(saveWeatherSnapshot(&saved));
+  WeatherSnapshot newer = saved;
+  newer.fetchedAt += 600;
+  // the flash fills up part way
+  LittleFS.nativeFailWritesAfter(100);
+  TEST_ASSERT_FALSE(saveWeatherSnapshot(&newer));
+  LittleFS.nativeFailWritesAfter(-1);
+  TEST_ASSERT_FALSE(LittleFS.exists(WEATHER_SNAPSHOT_TMP_FILE));
+  TEST_ASSERT_TRUE(loadWeatherSnapshot(&loaded));
+  TEST_ASSERT_EQUAL_INT64(saved.fetchedAt, loaded.fetchedAt);
+}
+
+void test_replaces_previous_snapshot() {
+  TEST_ASSERT_TRUE(saveWeatherSnapshot(&saved));
+  saved.fetchedAt += 600;
+  TEST_ASSERT_TRUE(saveWeatherSnapshot(&saved));
+  TEST_ASSERT_FALSE(LittleFS.exists(WEATHER_SNAPSHOT_BACKUP_FILE));
+  TEST_ASSERT_TRUE(loadWeatherSnapshot(&loaded));
+  TEST_ASSERT_EQUAL_INT64(saved.fetchedAt, loaded.fetchedAt);
+}
+
+void test_reads_backup_after_interrupted_save() {
+  TEST_ASSERT_TRUE(saveWeatherSnapshot(&saved));
+  // a reset right after the previous snapshot was moved aside
+  LittleFS.rename(WEATHER_SNAPSHOT_FILE, WEATHER_SNAPSHOT_BACKUP_FILE);
+  TEST_ASSERT_TRUE(loadWeatherSnapshot(&loaded));
+  TEST_ASSERT_EQUAL_INT64(saved.fetchedAt, loaded.fetchedAt);
+}
+
+void test_reads_backup_if_snapshot_is_corrupt() {
+  TEST_ASSERT_TRUE(saveWeatherSnapshot(&saved));
+  LittleFS.rename(WEATHER_SNAPSHOT_FILE, WEATHER_SNAPSHOT_BACKUP_FILE);
+  File file = LittleFS.open(WEATHER_SNAPSHOT_FILE, "w");
+  writeValue(file, (uint32_t)WEATHER_SNAPSHOT_MAGIC);
+  writeValue(file, (uint16_t)WEATHER_SNAPSHOT_VERSION);
+  writeValue(file, (int64_t)saved.fetchedAt + 600);
+  file.close();
+  TEST_ASSERT_TRUE(loadWeatherSnapshot(&loaded));
+  TEST_ASSERT_EQUAL_INT64(saved.fetchedAt, loaded.fetchedAt);
+  TEST_ASSERT_EQUAL_STRING("Zurich", loaded.currentWeather.cityName);
+}
+
+// development builds wrote versions 1 and 2, they aren't read
+void test_previous_version_is_rejected() {
+  File file = LittleFS.open(WEATHER_SNAPSHOT_FILE, "w");
+  writeValue(file, (uint32_t)WEATHER_SNAPSHOT_MAGIC);
+  writeValue(file, (uint16_t)(WEATHER_SNAPSHOT_VERSION - 1));
+  writeValue(file, (int64_t)saved.fetchedAt);
+  file.close();
+  TEST_ASSERT_FALSE(loadWeatherSnapshot(&loaded));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_missing_snapshot);
+  RUN_TEST(test_truncated_snapshot_is_rejected);
+  RUN_TEST(test_unknown_version_is_rejected);
+  RUN_TEST(test_previous_version_is_rejected);
+  RUN_TEST(test_failed_write_keeps_previous_snapshot);
+  RUN_TEST(test_replaces_previous_snapshot);
+  RUN_TEST(test_reads_backup_after_interrupted_save);
+  RUN_TEST(test_reads_backup_if_snapshot_is_corrupt);
+  return UNITY_END();
+}
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "TileRenderer.h"
+
+// 320x480 in 32x32 tiles
+#define TILE_COLUMNS 10
+#define TILE_ROWS 15
+#define TILES (TILE_COLUMNS * TILE_ROWS)
+
+TFT_eSPI tft = TFT_eSPI();
+
+void assertScreenIsFrame(TileRenderer &renderer) {
+  TFT_eSprite &frame = renderer.frame();
+  for (int16_t y = 0; y < tft.height(); y++) {
+    for (int16_t x = 0; x < tft.width(); x++) {
+      if (tft.readPixel(x, y) != frame.readPixel(x, y)) {
+        char message[32];
+        snprintf(message, sizeof(message), "pixel differs at %d/%d", x, y);
+        TEST_FAIL_MESSAGE(message);
+      }
+    }
+  }
+}
+
+void setUp() {
+  tft.init();
+  tft.fillScreen(TFT_DARKGREY);
+  tft.nativeResetStats();
+}
+
+void tearDown() {}
+
+void test_first_push_sends_every_tile() {
+  TileRenderer renderer(&tft);
+  TEST_ASSERT_TRUE(renderer.begin());
+  renderer.frame().fillSprite(TFT_NAVY);
+  TileStats stats = renderer.push();
+  TEST_ASSERT_EQUAL(TILES, stats.pushed);
+  TEST_ASSERT_EQUAL(0, stats.skipped);
+  // a window per tile row, the changed tiles of a row go out together
+  TEST_ASSERT_EQUAL(TILE_ROWS, tft.nativeStats().windows);
+  TEST_ASSERT_EQUAL(tft.width() * tft.height(), tft.nativeStats().pixels);
+  assertScreenIsFrame(renderer);
+}
+
+void test_unchanged_frame_sends_nothing() {
+  TileRenderer renderer(&tft);
+  TEST_ASSERT_TRUE(renderer.begin());
+  renderer.frame().fillSprite(TFT_NAVY);
+  renderer.push();
+  tft.nativeResetStats();
+
+  // rendered again, the same pixels
+  renderer.frame().fillSprite(TFT_NAVY);
+  TileStats stats = renderer.push();
+  TEST_ASSERT_EQUAL(0, stats.pushed);
+  TEST_ASSERT_EQUAL(TILES, stats.skipped);
+  TEST_ASSERT_EQUAL(0, tft.nativeStats().pixels);
+}
+
+void test_only_changed_tiles_are_sent() {
+  TileRenderer renderer(&tft);
+  TEST_ASSERT_TRUE(renderer.begin());
+  renderer.frame().fillSprite(TFT_BLACK);
+  renderer.push();
+  tft.nativeResetStats();
+
+  // spans the two tiles (1, 0) and (2, 0), plus a single pixel in the last tile
+  renderer.frame().fillRect(40, 10, 40, 5, TFT_WHITE);
+  renderer.frame().drawPixel(tft.width() - 1, tft.height() - 1, TFT_RED);
+  TileStats stats = renderer.push();
+  TEST_ASSERT_EQUAL(3, stats.pushed);
+  TEST_ASSERT_EQUAL(TILES - 3, stats.skipped);
+  TEST_ASSERT_EQUAL(2, tft.nativeStats().windows);
+  TEST_ASSERT_EQUAL(3 * TILE_SIZE * TILE_SIZE, tft.nativeStats().pixels);
+  assertScreenIsFrame(renderer);
+}
+
+void test_assumed_frame_is_not_sent_again() {
+  TileRenderer renderer(&tft);
+  TEST_ASSERT_TRUE(renderer.begin());
+  renderer.frame().fillSprite(TFT_NAVY);
+  // e.g. wiped in by the page transition
+  renderer.frame().pushSprite(0, 0);
+  renderer.assume();
+  tft.nativeResetStats();
+
+  renderer.frame().drawPixel(0, 0, TFT_WHITE);
+  TileStats stats = renderer.push();
+  TEST_ASSERT_EQUAL(1, stats.pushed);
+  TEST_ASSERT_EQUAL(TILE_SIZE * TILE_SIZE, tft.nativeStats().pixels);
+}
+
+void test_invalidated_push_sends_every_tile() {
+  TileRenderer renderer(&tft);
+  TEST_ASSERT_TRUE(renderer.begin());
+  renderer.frame().fillSprite(TFT_NAVY);
+  renderer.push();
+  // something else drew over it
+  tft.fillScreen(TFT_BLACK);
+  renderer.invalidate();
+
+  TileStats stats = renderer.push();
+  TEST_ASSERT_EQUAL(TILES, stats.pushed);
+  assertScreenIsFrame(renderer);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_first_push_sends_every_tile);
+  RUN_TEST(test_unchanged_frame_sends_nothing);
+  RUN_TEST(test_only_changed_tiles_are_sent);
+  RUN_TEST(test_assumed_frame_is_not_sent_again);
+  RUN_TEST(test_invalidated_push_sends_every_tile);
+  return UNITY_END();
+}
@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <unity.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "TouchInput.h"
+
+// any GPIO, the shim only needs it to find the handler
+#define TOUCH_TEST_INT 27
+#define FT6236_BURST_SIZE 16
+// for the touch task, real time
+#define WAIT_TIMEOUT_MILLIS 1000
+
+// What the panel reports from register 0 on, as FT6236::readData() fetches it: device mode,
+// gesture, number of points, then per point XH (event flag in bits 7-6, X bits 11-8), XL, YH
+// (touch id in bits 7-4, Y bits 11-8), YL, weight and area. Raw coordinates are those of the
+// panel, at TOUCH_ROTATION 0 the display's are (320 - x, 480 - y).
+const uint8_t NO_TOUCH[FT6236_BURST_SIZE] = {0x00, 0x00, 0x00, 0x40, 0x64, 0x00, 0xC8, 0x18,
+                                             0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+// one finger at raw (100, 200)
+const uint8_t ONE_DOWN[FT6236_BURST_SIZE] = {0x00, 0x00, 0x01, 0x00, 0x64, 0x00, 0xC8, 0x18,
+                                             0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+// the same finger at raw (110, 260)
+const uint8_t ONE_MOVED[FT6236_BURST_SIZE] = {0x00, 0x00, 0x01, 0x80, 0x6E, 0x01, 0x04, 0x1A,
+                                              0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+// a second finger at raw (250, 300) comes, the first stays
+const uint8_t TWO_DOWN[FT6236_BURST_SIZE] = {0x00, 0x00, 0x02, 0x80, 0x6E, 0x01, 0x04, 0x1A,
+                                             0x40, 0x00, 0xFA, 0x11, 0x2C, 0x16, 0x40, 0xFF};
+// the second finger is lifted
+const uint8_t SECOND_UP[FT6236_BURST_SIZE] = {0x00, 0x00, 0x01, 0x80, 0x6E, 0x01, 0x04, 0x1A,
+                                              0x40, 0x40, 0xFA, 0x11, 0x2C, 0x16, 0x40, 0xFF};
+
+FT6236 ts = FT6236(480, 320);
+TouchInput touchInput(&ts);
+
+bool waitFor(bool (*condition)()) {
+  auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::milliseconds(WAIT_TIMEOUT_MILLIS);
+  while (!condition()) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+
+uint32_t readsBefore;
+
+bool burstRead() {
+  return Wire.nativeReads() > readsBefore;
+}
+
+// The panel latches a report and pulses INT, the touch task reads it in one burst.
+void report(const uint8_t *burst) {
+  Wire.nativeSetRegisters(FT6236_ADDR, 0, burst, FT6236_BURST_SIZE);
+  readsBefore = Wire.nativeReads();
+  nativeTriggerInterrupt(TOUCH_TEST_INT);
+  TEST_ASSERT_TRUE_MESSAGE(waitFor(burstRead), "the touch task didn't read the report");
+}
+
+std::vector<TouchEvent> events;
+
+// waits until the touch task queued as many events, or a little longer if it shouldn't
+void takeEvents(size_t count) {
+  events.clear();
+  auto deadline = std::chrono::steady_clock::now() +
+                  std::chrono::milliseconds(count > 0 ? WAIT_TIMEOUT_MILLIS : 100);
+  while (std::chrono::steady_clock::now() < deadline) {
+    TouchEvent event;
+    while (touchInput.poll(event)) {
+      events.push_back(event);
+    }
+    if (count > 0 && events.size() >= count) {
+      // anything more the task may still queue would show up in the next takeEvents()
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  TEST_ASSERT_EQUAL(count, events.size());
+}
+
+void assertEvent(const TouchEvent &event, TouchEventType type, uint8_t points, int16_t x,
+                 int16_t y) {
+  TEST_ASSERT_EQUAL(type, event.type);
+  TEST_ASSERT_EQUAL(points, event.points);
+  TEST_ASSERT_EQUAL(x, event.x);
+  TEST_ASSERT_EQUAL(y, event.y);
+}
+
+void setUp() {}
+
+void tearDown() {
+  // released, whatever the test left
+  report(NO_TOUCH);
+  TouchEvent event;
+  while (touchInput.poll(event)) {
+  }
+}
+
+void test_begin_sets_trigger_mode() {
+  TEST_ASSERT_EQUAL(FT6236_G_MODE_TRIGGER, Wire.nativeRegister(FT6236_ADDR, FT6236_REG_G_MODE));
+}
+
+void test_down_move_up() {
+  report(ONE_DOWN);
+  report(ONE_MOVED);
+  report(NO_TOUCH);
+  takeEvents(3);
+  assertEvent(events[0], TOUCH_DOWN, 1, 220, 280);
+  assertEvent(events[1], TOUCH_MOVE, 1, 210, 220);
+  // where the finger was lifted
+  assertEvent(events[2], TOUCH_UP, 0, 210, 220);
+}
+
+void test_unchanged_report_queues_nothing() {
+  report(ONE_DOWN);
+  takeEvents(1);
+  report(ONE_DOWN);
+  report(ONE_DOWN);
+  takeEvents(0);
+}
+
+void test_finger_count_change_is_a_move() {
+  report(ONE_MOVED);
+  report(TWO_DOWN);
+  report(SECOND_UP);
+  takeEvents(3);
+  assertEvent(events[0], TOUCH_DOWN, 1, 210, 220);
+  // the first finger didn't move
+  assertEvent(events[1], TOUCH_MOVE, 2, 210, 220);
+  TEST_ASSERT_EQUAL(70, events[1].x2);
+  TEST_ASSERT_EQUAL(180, events[1].y2);
+  assertEvent(events[2], TOUCH_MOVE, 1, 210, 220);
+}
+
+// the panel sends no INT for the release, the task notices it on the read after the timeout
+void test_release_without_interrupt() {
+  report(ONE_DOWN);
+  takeEvents(1);
+  Wire.nativeSetRegisters(FT6236_ADDR, 0, NO_TOUCH, FT6236_BURST_SIZE);
+  takeEvents(1);
+  assertEvent(events[0], TOUCH_UP, 0, 220, 280);
+  TEST_ASSERT_EQUAL_UINT32(0, touchInput.droppedEvents());
+}
+
+int main(int argc, char **argv) {
+  Wire.nativeSetRegisters(FT6236_ADDR, 0, NO_TOUCH, FT6236_BURST_SIZE);
+  touchInput.begin(TOUCH_TEST_INT);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_begin_sets_trigger_mode);
+  RUN_TEST(test_down_move_up);
+  RUN_TEST(test_unchanged_report_queues_nothing);
+  RUN_TEST(test_finger_count_change_is_a_move);
+  RUN_TEST(test_release_without_interrupt);
+  return UNITY_END();
+}
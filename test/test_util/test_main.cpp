@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2023 ThingPulse Ltd., https://thingpulse.com
+// SPDX-License-Identifier: MIT
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "weather.h"
+#include "util.h"
+
+// 2023-03-15 10:00 CET
+#define MARCH_15_10AM_UTC 1678870800
+
+ForecastStore forecasts;
+
+void setUp() {
+  setenv("TZ", TIMEZONE, 1);
+  tzset();
+  memset(&forecasts, 0, sizeof(forecasts));
+}
+
+void tearDown() {}
+
+void addForecast(time_t time, float temp, uint16_t weatherId) {
+  uint8_t i = forecasts.count++;
+  forecasts.observationTime[i] = time;
+  forecasts.tempCenti[i] = toCentiDegrees(temp);
+  forecasts.weatherId[i] = weatherId;
+}
+
+// every 3 hours from the given UTC time on, temp rising by 1 degree each
+void addForecasts(time_t start, uint8_t count, float firstTemp, uint16_t weatherId) {
+  for (uint8_t i = 0; i < count; i++) {
+    addForecast(start + i * 3 * 3600, firstTemp + i, weatherId);
+  }
+}
+
+void test_mkgmtime_matches_epoch() {
+  struct tm t = {};
+  t.tm_year = 2023 - 1900;
+  t.tm_mon = 2;
+  t.tm_mday = 15;
+  t.tm_hour = 9;
+  TEST_ASSERT_EQUAL_INT64(MARCH_15_10AM_UTC, mkgmtime(&t));
+  t.tm_mon = 14;
+  // 2024 is a leap year
+  TEST_ASSERT_EQUAL_INT64(MARCH_15_10AM_UTC + 366 * 86400LL, mkgmtime(&t));
+}
+
+void test_skips_today_and_aggregates_following_days() {
+  // from 2023-03-15 00:00 UTC, i.e. 01:00 CET: 2.x days
+  addForecasts(1678838400, 24, 0.0f, 800);
+  DayForecast days[NUMBER_OF_DAY_FORECASTS];
+  uint8_t found = calculateDayForecasts(forecasts, MARCH_15_10AM_UTC, days,
+                                        NUMBER_OF_DAY_FORECASTS);
+  TEST_ASSERT_EQUAL(2, found);
+  // March 16 starts at 23:00 UTC the day before, the 8th forecast (index 7, 21:00 UTC) is the
+  // last of March 15
+  TEST_ASSERT_EQUAL(4, days[0].day);
+  TEST_ASSERT_EQUAL_FLOAT(8.0f, days[0].minTemp);
+  TEST_ASSERT_EQUAL_FLOAT(15.0f, days[0].maxTemp);
+  TEST_ASSERT_EQUAL(800, days[0].conditionCode);
+  TEST_ASSERT_EQUAL(5, days[1].day);
+}
+
+void test_condition_closest_to_noon_and_dominant_vote() {
+  // 2023-03-16 00:00 UTC = 01:00 CET
+  time_t start = 1678924800;
+  uint16_t ids[] = {500, 500, 500, 800, 801, 801, 500, 500};
+  for (uint8_t i = 0; i < 8; i++) {
+    addForecast(start + i * 3 * 3600, 10.0f, ids[i]);
+  }
+  DayForecast days[NUMBER_OF_DAY_FORECASTS];
+  TEST_ASSERT_EQUAL(1, calculateDayForecasts(forecasts, MARCH_15_10AM_UTC, days, 1));
+  // 12:00 UTC is 13:00 CET, closest to noon
+  TEST_ASSERT_EQUAL(801, days[0].conditionCode);
+  TEST_ASSERT_EQUAL(13, days[0].conditionHour);
+  // 500 has 4 night votes (1 each) plus a day vote (2), 801 two day votes
+  TEST_ASSERT_EQUAL(500, days[0].dominantConditionCode);
+}
+
+void test_day_without_forecasts_is_invalid() {
+  // March 16 and 18, nothing for March 17
+  addForecasts(1678924800, 8, 10.0f, 800);
+  addForecasts(1679097600, 8, 10.0f, 800);
+  DayForecast days[3];
+  TEST_ASSERT_EQUAL(2, calculateDayForecasts(forecasts, MARCH_15_10AM_UTC, days, 3));
+  TEST_ASSERT_TRUE(days[0].valid);
+  TEST_ASSERT_FALSE(days[1].valid);
+  // still the right weekday, for the empty column
+  TEST_ASSERT_EQUAL(5, days[1].day);
+  TEST_ASSERT_TRUE(days[2].valid);
+}
+
+void test_local_hours_when_dst_starts() {
+  // 2023-03-26 has 23 hours, from 09:00 UTC on the forecasts are at CEST 11, 14, ...
+  time_t start = 1679788800;
+  uint16_t ids[] = {500, 500, 500, 800, 801, 500, 500, 500};
+  for (uint8_t i = 0; i < 8; i++) {
+    addForecast(start + i * 3 * 3600, 10.0f, ids[i]);
+  }
+  DayForecast days[NUMBER_OF_DAY_FORECASTS];
+  // March 25, 11:00 CET
+  TEST_ASSERT_EQUAL(1, calculateDayForecasts(forecasts, 1679738400, days, 1));
+  TEST_ASSERT_EQUAL(0, days[0].day);
+  // 11:00 is closer to noon than 14:00, though 09:00 UTC is only 10 hours after midnight
+  TEST_ASSERT_EQUAL(800, days[0].conditionCode);
+  TEST_ASSERT_EQUAL(11, days[0].conditionHour);
+  // 21:00 UTC is 23:00 CEST, still on the same day
+  TEST_ASSERT_EQUAL_FLOAT(10.0f, days[0].maxTemp);
+}
+
+void test_local_hours_when_dst_ends() {
+  // 2023-10-29 has 25 hours, from 03:00 UTC on the forecasts are at CET 4, 7, 10, 13, ...
+  time_t start = 1698537600;
+  uint16_t ids[] = {500, 500, 500, 800, 801, 500, 500, 500};
+  for (uint8_t i = 0; i < 8; i++) {
+    addForecast(start + i * 3 * 3600, 10.0f + i, ids[i]);
+  }
+  // 23:00 UTC is midnight CET, already the next day
+  addForecast(start + 23 * 3600, 30.0f, 500);
+  DayForecast days[2];
+  // October 28, 12:00 CEST
+  TEST_ASSERT_EQUAL(2, calculateDayForecasts(forecasts, 1698487200, days, 2));
+  TEST_ASSERT_EQUAL(0, days[0].day);
+  // 13:00 is closer to noon than 10:00, though 12:00 UTC is 14 hours after midnight
+  TEST_ASSERT_EQUAL(801, days[0].conditionCode);
+  TEST_ASSERT_EQUAL(13, days[0].conditionHour);
+  TEST_ASSERT_EQUAL_FLOAT(17.0f, days[0].maxTemp);
+  TEST_ASSERT_EQUAL_FLOAT(30.0f, days[1].minTemp);
+}
+
+void test_hours_between_full_hours() {
+  // 2023-03-16 11:30 UTC = 12:30 CET, 14:30 UTC = 15:30 CET
+  addForecast(1678966200, 10.0f, 801);
+  addForecast(1678977000, 10.0f, 800);
+  DayForecast days[1];
+  TEST_ASSERT_EQUAL(1, calculateDayForecasts(forecasts, MARCH_15_10AM_UTC, days, 1));
+  TEST_ASSERT_EQUAL(801, days[0].conditionCode);
+  TEST_ASSERT_EQUAL(12, days[0].conditionHour);
+}
+
+void test_at_most_the_supported_days() {
+  addForecasts(1678924800, 40, 10.0f, 800);
+  DayForecast days[NUMBER_OF_DAY_FORECASTS + 2];
+  days[NUMBER_OF_DAY_FORECASTS].valid = false;
+  TEST_ASSERT_EQUAL(NUMBER_OF_DAY_FORECASTS,
+                    calculateDayForecasts(forecasts, MARCH_15_10AM_UTC, days,
+                                          NUMBER_OF_DAY_FORECASTS + 2));
+  // not written
+  TEST_ASSERT_FALSE(days[NUMBER_OF_DAY_FORECASTS].valid);
+}
+
+void test_timestamp_is_formatted_in_local_time() {
+  nativeSetTime(MARCH_15_10AM_UTC);
+  char timestamp[TIMESTAMP_SIZE];
+  TEST_ASSERT_EQUAL_STRING("2023-03-15 10:00:00",
+                           getCurrentTimestamp(timestamp, sizeof(timestamp),
+                                               SYSTEM_TIMESTAMP_FORMAT));
+  nativeSetTime(0);
+}
+
+void test_init_time_sets_the_timezone() {
+  setenv("TZ", "UTC0", 1);
+  tzset();
+  initTime();
+  char timestamp[TIMESTAMP_SIZE];
+  // summer time
+  TEST_ASSERT_EQUAL_STRING("2023-07-01 14:00:00",
+                           formatLocalTime(timestamp, sizeof(timestamp), SYSTEM_TIMESTAMP_FORMAT,
+                                           1688212800));
+  TEST_ASSERT_TRUE(waitForTime());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_mkgmtime_matches_epoch);
+  RUN_TEST(test_skips_today_and_aggregates_following_days);
+  RUN_TEST(test_condition_closest_to_noon_and_dominant_vote);
+  RUN_TEST(test_day_without_forecasts_is_invalid);
+  RUN_TEST(test_local_hours_when_dst_starts);
+  RUN_TEST(test_local_hours_when_dst_ends);
+  RUN_TEST(test_hours_between_full_hours);
+  RUN_TEST(test_at_most_the_supported_days);
+  RUN_TEST(test_timestamp_is_formatted_in_local_time);
+  RUN_TEST(test_init_time_sets_the_timezone);
+  return UNITY_END();
+}